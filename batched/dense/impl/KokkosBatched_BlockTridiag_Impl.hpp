@@ -0,0 +1,229 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_IMPL_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_Trsv_Decl.hpp"
+#include "KokkosBatched_Gemv_Decl.hpp"
+#include "KokkosBlas2_serial_gemv_impl.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Impl
+/// ===========
+
+template <typename ArgAlgo>
+template <typename AViewType, typename BViewType, typename CViewType>
+KOKKOS_INLINE_FUNCTION int SerialBlockTridiagFactor<ArgAlgo>::invoke(
+    const AViewType &A, const BViewType &B, const CViewType &C) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert(Kokkos::is_view<AViewType>::value,
+                "KokkosBatched::blocktridiag: AViewType is not a "
+                "Kokkos::View.");
+  static_assert(AViewType::rank == 3,
+                "KokkosBatched::blocktridiag: AViewType must have rank 3.");
+  static_assert(BViewType::rank == 3,
+                "KokkosBatched::blocktridiag: BViewType must have rank 3.");
+  static_assert(CViewType::rank == 3,
+                "KokkosBatched::blocktridiag: CViewType must have rank 3.");
+#endif
+  const int L = A.extent(0);
+  if (L == 0) return 0;
+
+  int r_val = 0;
+  for (int k = 0; k < L - 1 && r_val == 0; ++k) {
+    auto Ak  = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Ak1 = Kokkos::subview(A, k + 1, Kokkos::ALL(), Kokkos::ALL());
+    auto Bk  = Kokkos::subview(B, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Ck  = Kokkos::subview(C, k, Kokkos::ALL(), Kokkos::ALL());
+
+    r_val = SerialLU<ArgAlgo>::invoke(Ak);
+    if (r_val == 0)
+      r_val = SerialTrsm<Side::Left, Uplo::Lower, Trans::NoTranspose,
+                         Diag::Unit, ArgAlgo>::invoke(1.0, Ak, Bk);
+    if (r_val == 0)
+      r_val = SerialTrsm<Side::Right, Uplo::Upper, Trans::NoTranspose,
+                         Diag::NonUnit, ArgAlgo>::invoke(1.0, Ak, Ck);
+    if (r_val == 0)
+      r_val = SerialGemm<Trans::NoTranspose, Trans::NoTranspose,
+                         ArgAlgo>::invoke(-1.0, Ck, Bk, 1.0, Ak1);
+  }
+  if (r_val == 0)
+    r_val = SerialLU<ArgAlgo>::invoke(
+        Kokkos::subview(A, L - 1, Kokkos::ALL(), Kokkos::ALL()));
+  return r_val;
+}
+
+template <typename ArgAlgo>
+template <typename AViewType, typename BViewType, typename CViewType,
+          typename XViewType>
+KOKKOS_INLINE_FUNCTION int SerialBlockTridiagSolve<ArgAlgo>::invoke(
+    const AViewType &A, const BViewType &B, const CViewType &C,
+    const XViewType &X) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert(Kokkos::is_view<XViewType>::value,
+                "KokkosBatched::blocktridiag: XViewType is not a "
+                "Kokkos::View.");
+  static_assert(XViewType::rank == 2,
+                "KokkosBatched::blocktridiag: XViewType must have rank 2.");
+#endif
+  const int L = A.extent(0);
+  if (L == 0) return 0;
+
+  /// forward substitution
+  for (int k = 0; k < L - 1; ++k) {
+    auto Ak  = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Ck  = Kokkos::subview(C, k, Kokkos::ALL(), Kokkos::ALL());
+    auto xk  = Kokkos::subview(X, k, Kokkos::ALL());
+    auto xk1 = Kokkos::subview(X, k + 1, Kokkos::ALL());
+
+    SerialTrsv<Uplo::Lower, Trans::NoTranspose, Diag::Unit, ArgAlgo>::invoke(
+        1.0, Ak, xk);
+    KokkosBlas::SerialGemv<Trans::NoTranspose, ArgAlgo>::invoke(-1.0, Ck, xk,
+                                                                1.0, xk1);
+  }
+  SerialTrsv<Uplo::Lower, Trans::NoTranspose, Diag::Unit, ArgAlgo>::invoke(
+      1.0, Kokkos::subview(A, L - 1, Kokkos::ALL(), Kokkos::ALL()),
+      Kokkos::subview(X, L - 1, Kokkos::ALL()));
+
+  /// backward substitution
+  for (int k = L - 1; k > 0; --k) {
+    auto Ak  = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Bk1 = Kokkos::subview(B, k - 1, Kokkos::ALL(), Kokkos::ALL());
+    auto xk  = Kokkos::subview(X, k, Kokkos::ALL());
+    auto xk1 = Kokkos::subview(X, k - 1, Kokkos::ALL());
+
+    SerialTrsv<Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
+               ArgAlgo>::invoke(1.0, Ak, xk);
+    KokkosBlas::SerialGemv<Trans::NoTranspose, ArgAlgo>::invoke(-1.0, Bk1, xk,
+                                                                1.0, xk1);
+  }
+  SerialTrsv<Uplo::Upper, Trans::NoTranspose, Diag::NonUnit, ArgAlgo>::invoke(
+      1.0, Kokkos::subview(A, 0, Kokkos::ALL(), Kokkos::ALL()),
+      Kokkos::subview(X, 0, Kokkos::ALL()));
+
+  return 0;
+}
+
+///
+/// Team Impl
+/// =========
+
+template <typename MemberType, typename ArgAlgo>
+template <typename AViewType, typename BViewType, typename CViewType>
+KOKKOS_INLINE_FUNCTION int
+TeamBlockTridiagFactor<MemberType, ArgAlgo>::invoke(const MemberType &member,
+                                                    const AViewType &A,
+                                                    const BViewType &B,
+                                                    const CViewType &C) {
+  const int L = A.extent(0);
+  if (L == 0) return 0;
+
+  int r_val = 0;
+  for (int k = 0; k < L - 1 && r_val == 0; ++k) {
+    auto Ak  = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Ak1 = Kokkos::subview(A, k + 1, Kokkos::ALL(), Kokkos::ALL());
+    auto Bk  = Kokkos::subview(B, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Ck  = Kokkos::subview(C, k, Kokkos::ALL(), Kokkos::ALL());
+
+    r_val = TeamLU<MemberType, ArgAlgo>::invoke(member, Ak);
+    member.team_barrier();
+    if (r_val == 0) {
+      /// Bk and Ck are independent, both only read the factored Ak
+      r_val = TeamTrsm<MemberType, Side::Left, Uplo::Lower, Trans::NoTranspose,
+                       Diag::Unit, ArgAlgo>::invoke(member, 1.0, Ak, Bk);
+      if (r_val == 0)
+        r_val =
+            TeamTrsm<MemberType, Side::Right, Uplo::Upper, Trans::NoTranspose,
+                     Diag::NonUnit, ArgAlgo>::invoke(member, 1.0, Ak, Ck);
+      member.team_barrier();
+    }
+    if (r_val == 0) {
+      r_val = TeamGemm<MemberType, Trans::NoTranspose, Trans::NoTranspose,
+                       ArgAlgo>::invoke(member, -1.0, Ck, Bk, 1.0, Ak1);
+      member.team_barrier();
+    }
+  }
+  if (r_val == 0) {
+    r_val = TeamLU<MemberType, ArgAlgo>::invoke(
+        member, Kokkos::subview(A, L - 1, Kokkos::ALL(), Kokkos::ALL()));
+    member.team_barrier();
+  }
+  return r_val;
+}
+
+template <typename MemberType, typename ArgAlgo>
+template <typename AViewType, typename BViewType, typename CViewType,
+          typename XViewType>
+KOKKOS_INLINE_FUNCTION int TeamBlockTridiagSolve<MemberType, ArgAlgo>::invoke(
+    const MemberType &member, const AViewType &A, const BViewType &B,
+    const CViewType &C, const XViewType &X) {
+  const int L = A.extent(0);
+  if (L == 0) return 0;
+
+  /// forward substitution
+  for (int k = 0; k < L - 1; ++k) {
+    auto Ak  = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Ck  = Kokkos::subview(C, k, Kokkos::ALL(), Kokkos::ALL());
+    auto xk  = Kokkos::subview(X, k, Kokkos::ALL());
+    auto xk1 = Kokkos::subview(X, k + 1, Kokkos::ALL());
+
+    TeamTrsv<MemberType, Uplo::Lower, Trans::NoTranspose, Diag::Unit,
+             ArgAlgo>::invoke(member, 1.0, Ak, xk);
+    member.team_barrier();
+    TeamGemv<MemberType, Trans::NoTranspose, ArgAlgo>::invoke(member, -1.0, Ck,
+                                                              xk, 1.0, xk1);
+    member.team_barrier();
+  }
+  TeamTrsv<MemberType, Uplo::Lower, Trans::NoTranspose, Diag::Unit,
+           ArgAlgo>::invoke(member, 1.0,
+                            Kokkos::subview(A, L - 1, Kokkos::ALL(),
+                                            Kokkos::ALL()),
+                            Kokkos::subview(X, L - 1, Kokkos::ALL()));
+  member.team_barrier();
+
+  /// backward substitution
+  for (int k = L - 1; k > 0; --k) {
+    auto Ak  = Kokkos::subview(A, k, Kokkos::ALL(), Kokkos::ALL());
+    auto Bk1 = Kokkos::subview(B, k - 1, Kokkos::ALL(), Kokkos::ALL());
+    auto xk  = Kokkos::subview(X, k, Kokkos::ALL());
+    auto xk1 = Kokkos::subview(X, k - 1, Kokkos::ALL());
+
+    TeamTrsv<MemberType, Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
+             ArgAlgo>::invoke(member, 1.0, Ak, xk);
+    member.team_barrier();
+    TeamGemv<MemberType, Trans::NoTranspose, ArgAlgo>::invoke(member, -1.0,
+                                                              Bk1, xk, 1.0,
+                                                              xk1);
+    member.team_barrier();
+  }
+  TeamTrsv<MemberType, Uplo::Upper, Trans::NoTranspose, Diag::NonUnit,
+           ArgAlgo>::invoke(member, 1.0,
+                            Kokkos::subview(A, 0, Kokkos::ALL(), Kokkos::ALL()),
+                            Kokkos::subview(X, 0, Kokkos::ALL()));
+  member.team_barrier();
+
+  return 0;
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,79 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_CHOLESKY_SERIAL_IMPL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_SERIAL_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Internal Impl
+/// ====================
+
+template <typename AlgoType>
+struct SerialCholesky_Internal {
+  template <typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const int n,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1);
+};
+
+template <>
+template <typename ValueType>
+KOKKOS_INLINE_FUNCTION int
+SerialCholesky_Internal<Algo::Cholesky::Unblocked>::invoke(
+    const int n, ValueType *KOKKOS_RESTRICT A, const int as0, const int as1) {
+  using ats = Kokkos::ArithTraits<ValueType>;
+  // picks KokkosBatched::sqrt for SIMD value types
+  using Kokkos::sqrt;
+
+  for (int p = 0; p < n; ++p) {
+    const int iend = n - p - 1;
+
+    ValueType *KOKKOS_RESTRICT a21 = A + (p + 1) * as0 + (p)*as1,
+                               *KOKKOS_RESTRICT A22 =
+                                   A + (p + 1) * as0 + (p + 1) * as1;
+
+    const ValueType alpha11 = sqrt(A[p * as0 + p * as1]);
+    A[p * as0 + p * as1]    = alpha11;
+
+    for (int i = 0; i < iend; ++i) {
+      a21[i * as0] /= alpha11;
+
+      // lower triangle of A22 -= a21 a21^H
+      for (int j = 0; j <= i; ++j)
+        A22[i * as0 + j * as1] -= a21[i * as0] * ats::conj(a21[j * as0]);
+    }
+  }
+  return 0;
+}
+
+///
+/// Serial Impl
+/// ===========
+
+template <>
+template <typename AViewType>
+KOKKOS_INLINE_FUNCTION int SerialCholesky<Algo::Cholesky::Unblocked>::invoke(
+    const AViewType &A) {
+  return SerialCholesky_Internal<Algo::Cholesky::Unblocked>::invoke(
+      A.extent(0), A.data(), A.stride_0(), A.stride_1());
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,90 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_CHOLESKY_TEAM_IMPL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_TEAM_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Team Internal Impl
+/// ==================
+
+template <typename AlgoType>
+struct TeamCholesky_Internal {
+  template <typename MemberType, typename ValueType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const int n,
+                                           ValueType *KOKKOS_RESTRICT A,
+                                           const int as0, const int as1);
+};
+
+template <>
+template <typename MemberType, typename ValueType>
+KOKKOS_INLINE_FUNCTION int
+TeamCholesky_Internal<Algo::Cholesky::Unblocked>::invoke(
+    const MemberType &member, const int n, ValueType *KOKKOS_RESTRICT A,
+    const int as0, const int as1) {
+  using ats = Kokkos::ArithTraits<ValueType>;
+  // picks KokkosBatched::sqrt for SIMD value types
+  using Kokkos::sqrt;
+
+  for (int p = 0; p < n; ++p) {
+    // Made this non-const in order to WORKAROUND issue #349
+    int iend = n - p - 1;
+
+    ValueType *KOKKOS_RESTRICT a21 = A + (p + 1) * as0 + (p)*as1,
+                               *KOKKOS_RESTRICT A22 =
+                                   A + (p + 1) * as0 + (p + 1) * as1;
+
+    member.team_barrier();
+    const ValueType alpha11 = sqrt(A[p * as0 + p * as1]);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, 0, iend),
+                         [&](const int &i) { a21[i * as0] /= alpha11; });
+
+    member.team_barrier();
+    Kokkos::single(Kokkos::PerTeam(member),
+                   [&]() { A[p * as0 + p * as1] = alpha11; });
+    // lower triangle of A22 -= a21 a21^H, one row per thread
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(member, 0, iend),
+                         [&](const int &i) {
+                           for (int j = 0; j <= i; ++j)
+                             A22[i * as0 + j * as1] -=
+                                 a21[i * as0] * ats::conj(a21[j * as0]);
+                         });
+  }
+  member.team_barrier();
+  return 0;
+}
+
+///
+/// Team Impl
+/// =========
+
+template <typename MemberType>
+struct TeamCholesky<MemberType, Algo::Cholesky::Unblocked> {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A) {
+    return TeamCholesky_Internal<Algo::Cholesky::Unblocked>::invoke(
+        member, A.extent(0), A.data(), A.stride_0(), A.stride_1());
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,165 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_DENSE_IMPL_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_DENSE_IMPL_HPP__
+
+#include <iostream>
+
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_SolveLU_Decl.hpp"
+#include "KokkosBatched_Cholesky_Decl.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_HostLevel_Dense_Handle.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+
+// Every operation solves problem k of the batch with serial<ArgAlgo>(k) or
+// team(member, k); the batch index is the leading extent of the views.
+
+template <typename AViewType>
+struct BatchedLUOp {
+  AViewType A;
+
+  template <typename ArgAlgo>
+  KOKKOS_INLINE_FUNCTION void serial(const int k) const {
+    SerialLU<ArgAlgo>::invoke(Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL));
+  }
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void team(const MemberType &member,
+                                   const int k) const {
+    TeamLU<MemberType, Algo::LU::Unblocked>::invoke(
+        member, Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL));
+  }
+};
+
+template <typename ArgTrans, typename AViewType, typename BViewType>
+struct BatchedSolveLUOp {
+  AViewType A;
+  BViewType B;
+
+  template <typename ArgAlgo>
+  KOKKOS_INLINE_FUNCTION void serial(const int k) const {
+    SerialSolveLU<ArgTrans, ArgAlgo>::invoke(
+        Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL),
+        Kokkos::subview(B, k, Kokkos::ALL, Kokkos::ALL));
+  }
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void team(const MemberType &member,
+                                   const int k) const {
+    TeamSolveLU<MemberType, ArgTrans, Algo::SolveLU::Unblocked>::invoke(
+        member, Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL),
+        Kokkos::subview(B, k, Kokkos::ALL, Kokkos::ALL));
+  }
+};
+
+template <typename AViewType>
+struct BatchedCholeskyOp {
+  AViewType A;
+
+  // there is no register-blocked Cholesky, every serial variant is unblocked
+  template <typename ArgAlgo>
+  KOKKOS_INLINE_FUNCTION void serial(const int k) const {
+    SerialCholesky<Algo::Cholesky::Unblocked>::invoke(
+        Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL));
+  }
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void team(const MemberType &member,
+                                   const int k) const {
+    TeamCholesky<MemberType, Algo::Cholesky::Unblocked>::invoke(
+        member, Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL));
+  }
+};
+
+template <typename ArgSide, typename ArgUplo, typename ArgTrans,
+          typename ArgDiag, typename ScalarType, typename AViewType,
+          typename BViewType>
+struct BatchedTrsmOp {
+  ScalarType alpha;
+  AViewType A;
+  BViewType B;
+
+  template <typename ArgAlgo>
+  KOKKOS_INLINE_FUNCTION void serial(const int k) const {
+    SerialTrsm<ArgSide, ArgUplo, ArgTrans, ArgDiag, ArgAlgo>::invoke(
+        alpha, Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL),
+        Kokkos::subview(B, k, Kokkos::ALL, Kokkos::ALL));
+  }
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void team(const MemberType &member,
+                                   const int k) const {
+    auto Ak = Kokkos::subview(A, k, Kokkos::ALL, Kokkos::ALL);
+    auto Bk = Kokkos::subview(B, k, Kokkos::ALL, Kokkos::ALL);
+    TeamTrsm<MemberType, ArgSide, ArgUplo, ArgTrans, ArgDiag,
+             Algo::Trsm::Unblocked>::invoke(member, alpha, Ak, Bk);
+  }
+};
+
+template <typename OpType, typename ArgAlgo>
+struct BatchedDenseSerialFunctor {
+  OpType op;
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int k) const { op.template serial<ArgAlgo>(k); }
+};
+
+template <typename OpType>
+struct BatchedDenseTeamFunctor {
+  OpType op;
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    op.team(member, member.league_rank());
+  }
+};
+
+/// Runs op on the batchSize problems of order n with the algorithm that the
+/// handle selects
+template <typename ExecutionSpace, typename ValueType, typename OpType>
+void batched_dense_invoke(const BatchedDenseHandle &handle, const char *label,
+                          const OpType &op, const size_t batchSize,
+                          const int n) {
+  if (batchSize == 0) return;
+  const int algo = handle.select_algo<ExecutionSpace, ValueType>(batchSize, n);
+  if (handle.enableDebug)
+    std::cout << label << ": " << handle.get_kernel_algo_type_str()
+              << " selected algorithm " << algo << " for " << batchSize
+              << " problems of order " << n << std::endl;
+
+  if (algo == DenseKokkosBatchedAlgos::KK_TEAM) {
+    using policy_type = Kokkos::TeamPolicy<ExecutionSpace>;
+    policy_type policy =
+        handle.teamSz > 0
+            ? policy_type(batchSize, handle.teamSz,
+                          handle.vecLen > 0 ? handle.vecLen : 1)
+            : policy_type(batchSize, Kokkos::AUTO);
+    Kokkos::parallel_for(label, policy, BatchedDenseTeamFunctor<OpType>{op});
+  } else if (algo == DenseKokkosBatchedAlgos::KK_SERIALSIMD ||
+             n >= Algo::Level3::Blocked::mb()) {
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<ExecutionSpace>(0, batchSize),
+        BatchedDenseSerialFunctor<OpType, Algo::Level3::Blocked>{op});
+  } else {
+    Kokkos::parallel_for(
+        label, Kokkos::RangePolicy<ExecutionSpace>(0, batchSize),
+        BatchedDenseSerialFunctor<OpType, Algo::Level3::Unblocked>{op});
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosBatched
+
+#endif  // __KOKKOSBATCHED_HOSTLEVEL_DENSE_IMPL_HPP__
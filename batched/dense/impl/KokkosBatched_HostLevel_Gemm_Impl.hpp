@@ -62,6 +62,62 @@ constexpr KOKKOS_INLINE_FUNCTION size_t kk_gemm_dbl_buf_alpha_in_fma_thresh() {
 #endif  // __CUDAACC_RDC__
 }
 
+// Invokes BatchedDblBufGemm with TILE_M x TILE_N tiles of C. Bounds checks are
+// skipped when the tiles and the k loop divide C evenly, and alpha is applied
+// in the fma for long k loops.
+template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
+          int TILE_M, int TILE_N, int TILE_K, typename BatchedGemmHandleType,
+          typename ScalarType, typename AViewType, typename BViewType,
+          typename CViewType>
+int BatchedDblBufGemmTiled(BatchedGemmHandleType *const handle,
+                           const ScalarType alpha, const AViewType &A,
+                           const BViewType &B, const ScalarType beta,
+                           const CViewType &C, const size_t c_m,
+                           const size_t c_n, const size_t c_k) {
+  // The team is TILE_K x TILE_K threads, each with TILE_M / TILE_K x
+  // TILE_N / TILE_K results of C in registers.
+  static_assert(TILE_M % TILE_K == 0 && TILE_N % TILE_K == 0,
+                "The tiles of C must be multiples of TILE_K");
+  constexpr size_t alpha_in_fma_thresh =
+      Impl::kk_gemm_dbl_buf_alpha_in_fma_thresh();
+
+  const bool no_bounds_check = c_m % TILE_M == 0 && c_n % TILE_N == 0 &&
+                               c_k >= TILE_K && c_k % TILE_K == 0;
+  if (no_bounds_check) {
+    if (c_k >= alpha_in_fma_thresh) {
+      return Impl::BatchedDblBufGemm<
+                 ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType,
+                 ScalarType, AViewType, BViewType, CViewType, BoundsCheck::No,
+                 AlphaTag::Yes, TILE_M, TILE_N, TILE_K>(handle, alpha, A, B,
+                                                        beta, C)
+          .invoke();
+    } else {
+      return Impl::BatchedDblBufGemm<
+                 ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType,
+                 ScalarType, AViewType, BViewType, CViewType, BoundsCheck::No,
+                 AlphaTag::No, TILE_M, TILE_N, TILE_K>(handle, alpha, A, B,
+                                                       beta, C)
+          .invoke();
+    }
+  } else {
+    if (c_k >= alpha_in_fma_thresh) {
+      return Impl::BatchedDblBufGemm<
+                 ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType,
+                 ScalarType, AViewType, BViewType, CViewType, BoundsCheck::Yes,
+                 AlphaTag::Yes, TILE_M, TILE_N, TILE_K>(handle, alpha, A, B,
+                                                        beta, C)
+          .invoke();
+    } else {
+      return Impl::BatchedDblBufGemm<
+                 ArgTransA, ArgTransB, ArgBatchSzDim, BatchedGemmHandleType,
+                 ScalarType, AViewType, BViewType, CViewType, BoundsCheck::Yes,
+                 AlphaTag::No, TILE_M, TILE_N, TILE_K>(handle, alpha, A, B,
+                                                       beta, C)
+          .invoke();
+    }
+  }
+}
+
 template <typename ArgTransA, typename ArgTransB, typename ArgBatchSzDim,
           typename BatchedGemmHandleType, typename ScalarType,
           typename AViewType, typename BViewType, typename CViewType>
@@ -69,7 +125,7 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
                     const AViewType &A, const BViewType &B,
                     const ScalarType beta, const CViewType &C) {
   int ret = 0;
-  size_t c_m, c_n;
+  size_t c_m, c_n, c_k;
   using ViewValueType = typename CViewType::value_type;
   // Check for valid input views
   static_assert(Kokkos::is_view<AViewType>::value,
@@ -92,6 +148,8 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
     switch (handle->get_kernel_algo_type()) {
       case BaseKokkosBatchedAlgos::KK_SERIAL:
       case BaseHeuristicAlgos::SQUARE:
+      case BaseHeuristicAlgos::TALL:
+      case BaseHeuristicAlgos::WIDE:
       case BaseTplAlgos::ARMPL:
 #if KOKKOS_VERSION > 40099
         assert(A.rank_dynamic() == 3 && "AViewType must have rank 3.");
@@ -128,14 +186,17 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
                   !std::is_same<ArgBatchSzDim, BatchLayout::Left>::value),
                 "LayoutRight views require BatchLayout::Left");
 
+  constexpr bool a_trans = std::is_same<ArgTransA, Trans::Transpose>::value;
   if constexpr (std::is_same<ArgBatchSzDim, BatchLayout::Left>::value) {
     // c_b = C.extent(0);
     c_m = C.extent(1);
     c_n = C.extent(2);
+    c_k = A.extent(a_trans ? 1 : 2);
   } else {
     // c_b = C.extent(2);
     c_m = C.extent(0);
     c_n = C.extent(1);
+    c_k = A.extent(a_trans ? 0 : 1);
   }
 
   // Begin checking conditions for optimal BatchedGemm invocation.
@@ -257,9 +318,78 @@ int BatchedGemmImpl(BatchedGemmHandleType *const handle, const ScalarType alpha,
       }
       break;
 
-      //    case BaseHeuristicAlgos::TALL:
-      //
-      //    case BaseHeuristicAlgos::WIDE:
+    case BaseHeuristicAlgos::TALL:
+    case BaseHeuristicAlgos::WIDE: {
+      // C is skinny: c_m > c_n for TALL and c_m < c_n for WIDE, e.g. 64x8 or
+      // 8x64 blocks. Other shapes are supported but not tuned for.
+      const bool is_tall =
+          handle->get_kernel_algo_type() == BaseHeuristicAlgos::TALL;
+      const size_t c_long  = is_tall ? c_m : c_n;
+      const size_t c_short = is_tall ? c_n : c_m;
+
+      if constexpr (on_gpu) {
+        if (c_long >= 32 && c_short >= 4) {
+          handle->teamSz = handle->vecLen = 8;
+          if (c_short > 16) {
+            // not skinny enough for the narrow tiles, use the square ones
+            constexpr int tile_m = Impl::kk_gemm_dbl_buf_tile_m<exec_space>();
+            constexpr int tile_n = Impl::kk_gemm_dbl_buf_tile_n<exec_space>();
+            constexpr int tile_k = Impl::kk_gemm_dbl_buf_tile_k<exec_space>();
+            ret = Impl::BatchedDblBufGemmTiled<ArgTransA, ArgTransB,
+                                               ArgBatchSzDim, tile_m, tile_n,
+                                               tile_k>(handle, alpha, A, B,
+                                                       beta, C, c_m, c_n, c_k);
+          } else if (is_tall) {
+            // 64x8 tiles: every thread holds a column of 8 results of C
+            ret = Impl::BatchedDblBufGemmTiled<ArgTransA, ArgTransB,
+                                               ArgBatchSzDim, 64, 8, 8>(
+                handle, alpha, A, B, beta, C, c_m, c_n, c_k);
+          } else {
+            // 8x64 tiles: every thread holds a row of 8 results of C
+            ret = Impl::BatchedDblBufGemmTiled<ArgTransA, ArgTransB,
+                                               ArgBatchSzDim, 8, 64, 8>(
+                handle, alpha, A, B, beta, C, c_m, c_n, c_k);
+          }
+        } else {
+          // too small for a team per tile, one thread per entry of C as for
+          // SQUARE
+          using gpuResultsPerThread =
+              std::conditional_t<is_vector, ResultsPerThread::Rank2,
+                                 ResultsPerThread::Rank0>;
+          using gpuModeType = std::conditional_t<is_vector, Algo::Gemm::Blocked,
+                                                 Algo::Gemm::Unblocked>;
+          ret = Impl::BatchedSerialGemm<ArgTransA, ArgTransB, gpuModeType,
+                                        ArgBatchSzDim, gpuResultsPerThread,
+                                        ScalarType, AViewType, BViewType,
+                                        CViewType>(alpha, A, B, beta, C)
+                    .invoke();
+        }
+      } else {
+        // One matrix per thread. The register blocked kernel computes
+        // mb x mb blocks of C, which pays off only when the short side of C
+        // fills them.
+        constexpr bool blocked_only = is_vector && on_x86_64;
+        if (blocked_only ||
+            (!is_vector && !on_a64fx &&
+             c_short >= size_t(Algo::Gemm::Blocked::mb()))) {
+          ret = Impl::BatchedSerialGemm<ArgTransA, ArgTransB,
+                                        Algo::Gemm::Blocked, ArgBatchSzDim,
+                                        ResultsPerThread::Rank2, ScalarType,
+                                        AViewType, BViewType, CViewType>(
+                    alpha, A, B, beta, C)
+                    .invoke();
+        } else {
+          ret = Impl::BatchedSerialGemm<ArgTransA, ArgTransB,
+                                        Algo::Gemm::Unblocked, ArgBatchSzDim,
+                                        ResultsPerThread::Rank2, ScalarType,
+                                        AViewType, BViewType, CViewType>(
+                    alpha, A, B, beta, C)
+                    .invoke();
+        }
+      }
+      break;
+    }
+
       ////////////// TPL ALGOS //////////////
 #if defined(KOKKOSKERNELS_ENABLE_TPL_ARMPL) && ARMPL_BUILD >= 1058
     case BaseTplAlgos::ARMPL:
@@ -0,0 +1,178 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_GROUPED_IMPL_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_GROUPED_IMPL_HPP__
+
+#include <Kokkos_Core.hpp>
+#include <KokkosBatched_Util.hpp>
+#include "KokkosBatched_Gemm_Decl.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_HostLevel_Grouped_Handle.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+
+// Unmanaged rows x cols LayoutRight matrix at offset of a packed array
+template <class ViewType>
+using GroupedMatrix =
+    Kokkos::View<typename ViewType::value_type **, Kokkos::LayoutRight,
+                 typename ViewType::device_type,
+                 Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+template <class ViewType>
+KOKKOS_INLINE_FUNCTION GroupedMatrix<ViewType> grouped_matrix(
+    const ViewType &v, const size_t offset, const int rows, const int cols) {
+  return GroupedMatrix<ViewType>(v.data() + offset, rows, cols);
+}
+
+/// Every team runs one work item of the handle: a single problem with the
+/// team kernel, or a chunk of problems of the same serial kernel, possibly of
+/// different sizes, with one problem per thread.
+template <class ArgTransA, class ArgTransB, class HandleType, class ScalarType,
+          class AViewType, class BViewType, class CViewType>
+struct BatchedGroupedGemmFunctor {
+  using execution_space = typename HandleType::execution_space;
+  using member_type =
+      typename Kokkos::TeamPolicy<execution_space>::member_type;
+  using ordinal_view_t = typename HandleType::ordinal_view_t;
+  using offset_view_t  = typename HandleType::offset_view_t;
+
+  static constexpr bool transA =
+      std::is_same<ArgTransA, Trans::Transpose>::value;
+  static constexpr bool transB =
+      std::is_same<ArgTransB, Trans::Transpose>::value;
+
+  ordinal_view_t _m, _n, _k;
+  offset_view_t _aOffsets, _bOffsets, _cOffsets;
+  ordinal_view_t _perm, _itemBegin, _itemCount, _itemKernel;
+  ScalarType _alpha, _beta;
+  AViewType _A;
+  BViewType _B;
+  CViewType _C;
+
+  BatchedGroupedGemmFunctor(const HandleType &handle, const ScalarType alpha,
+                            const AViewType &A, const BViewType &B,
+                            const ScalarType beta, const CViewType &C)
+      : _m(handle.get_m()),
+        _n(handle.get_n()),
+        _k(handle.get_k()),
+        _aOffsets(handle.get_a_offsets()),
+        _bOffsets(handle.get_b_offsets()),
+        _cOffsets(handle.get_c_offsets()),
+        _perm(handle.get_perm()),
+        _itemBegin(handle.get_item_begin()),
+        _itemCount(handle.get_item_count()),
+        _itemKernel(handle.get_item_kernel()),
+        _alpha(alpha),
+        _beta(beta),
+        _A(A),
+        _B(B),
+        _C(C) {}
+
+  KOKKOS_INLINE_FUNCTION
+  GroupedMatrix<AViewType> a_matrix(const int p) const {
+    return transA ? grouped_matrix(_A, _aOffsets(p), _k(p), _m(p))
+                  : grouped_matrix(_A, _aOffsets(p), _m(p), _k(p));
+  }
+  KOKKOS_INLINE_FUNCTION
+  GroupedMatrix<BViewType> b_matrix(const int p) const {
+    return transB ? grouped_matrix(_B, _bOffsets(p), _n(p), _k(p))
+                  : grouped_matrix(_B, _bOffsets(p), _k(p), _n(p));
+  }
+  KOKKOS_INLINE_FUNCTION
+  GroupedMatrix<CViewType> c_matrix(const int p) const {
+    return grouped_matrix(_C, _cOffsets(p), _m(p), _n(p));
+  }
+
+  template <class ArgAlgo>
+  KOKKOS_INLINE_FUNCTION void serial_gemm(const int p) const {
+    SerialGemm<ArgTransA, ArgTransB, ArgAlgo>::invoke(
+        _alpha, a_matrix(p), b_matrix(p), _beta, c_matrix(p));
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &member) const {
+    const int item   = member.league_rank();
+    const int begin  = _itemBegin(item);
+    const int kernel = _itemKernel(item);
+    if (kernel == GroupedKernel::Team) {
+      const int p = _perm(begin);
+      TeamGemm<member_type, ArgTransA, ArgTransB,
+               Algo::Gemm::Unblocked>::invoke(member, _alpha, a_matrix(p),
+                                              b_matrix(p), _beta, c_matrix(p));
+    } else {
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, _itemCount(item)), [&](const int i) {
+            if (kernel == GroupedKernel::SerialBlocked)
+              serial_gemm<Algo::Gemm::Blocked>(_perm(begin + i));
+            else
+              serial_gemm<Algo::Gemm::Unblocked>(_perm(begin + i));
+          });
+    }
+  }
+};
+
+/// Same work distribution as BatchedGroupedGemmFunctor, for LU without
+/// pivoting of the n(p) x n(p) matrices
+template <class HandleType, class AViewType>
+struct BatchedGroupedLUFunctor {
+  using execution_space = typename HandleType::execution_space;
+  using member_type =
+      typename Kokkos::TeamPolicy<execution_space>::member_type;
+  using ordinal_view_t = typename HandleType::ordinal_view_t;
+  using offset_view_t  = typename HandleType::offset_view_t;
+
+  ordinal_view_t _n;
+  offset_view_t _aOffsets;
+  ordinal_view_t _perm, _itemBegin, _itemCount, _itemKernel;
+  AViewType _A;
+
+  BatchedGroupedLUFunctor(const HandleType &handle, const AViewType &A)
+      : _n(handle.get_n()),
+        _aOffsets(handle.get_a_offsets()),
+        _perm(handle.get_perm()),
+        _itemBegin(handle.get_item_begin()),
+        _itemCount(handle.get_item_count()),
+        _itemKernel(handle.get_item_kernel()),
+        _A(A) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_type &member) const {
+    const int item   = member.league_rank();
+    const int begin  = _itemBegin(item);
+    const int kernel = _itemKernel(item);
+    if (kernel == GroupedKernel::Team) {
+      const int p = _perm(begin);
+      auto A      = grouped_matrix(_A, _aOffsets(p), _n(p), _n(p));
+      TeamLU<member_type, Algo::LU::Unblocked>::invoke(member, A);
+    } else {
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, _itemCount(item)), [&](const int i) {
+            const int p = _perm(begin + i);
+            auto A      = grouped_matrix(_A, _aOffsets(p), _n(p), _n(p));
+            if (kernel == GroupedKernel::SerialBlocked)
+              SerialLU<Algo::LU::Blocked>::invoke(A);
+            else
+              SerialLU<Algo::LU::Unblocked>::invoke(A);
+          });
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosBatched
+
+#endif  // __KOKKOSBATCHED_HOSTLEVEL_GROUPED_IMPL_HPP__
@@ -0,0 +1,281 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_TRIDIAG_IMPL_HPP__
+#define __KOKKOSBATCHED_TRIDIAG_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+///
+/// Serial Impl
+/// ===========
+
+template <typename DViewType, typename EViewType>
+KOKKOS_INLINE_FUNCTION int SerialPttrf::invoke(const DViewType &d,
+                                               const EViewType &e) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert(Kokkos::is_view<DViewType>::value,
+                "KokkosBatched::pttrf: DViewType is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<EViewType>::value,
+                "KokkosBatched::pttrf: EViewType is not a Kokkos::View.");
+  static_assert(DViewType::rank == 1,
+                "KokkosBatched::pttrf: DViewType must have rank 1.");
+  static_assert(EViewType::rank == 1,
+                "KokkosBatched::pttrf: EViewType must have rank 1.");
+#endif
+  typedef typename DViewType::non_const_value_type value_type;
+
+  const int n = d.extent(0);
+  for (int i = 0; i < n - 1; ++i) {
+    const value_type ei = e(i);
+    e(i)                = ei / d(i);
+    d(i + 1) -= e(i) * ei;
+  }
+  return 0;
+}
+
+template <typename DViewType, typename EViewType, typename BViewType>
+KOKKOS_INLINE_FUNCTION int SerialPttrs::invoke(const DViewType &d,
+                                               const EViewType &e,
+                                               const BViewType &b) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert(Kokkos::is_view<BViewType>::value,
+                "KokkosBatched::pttrs: BViewType is not a Kokkos::View.");
+  static_assert(BViewType::rank == 1,
+                "KokkosBatched::pttrs: BViewType must have rank 1.");
+#endif
+  const int n = d.extent(0);
+
+  /// L y = b
+  for (int i = 1; i < n; ++i) b(i) -= e(i - 1) * b(i - 1);
+
+  /// D z = y
+  for (int i = 0; i < n; ++i) b(i) /= d(i);
+
+  /// L^T x = z
+  for (int i = n - 2; i >= 0; --i) b(i) -= e(i) * b(i + 1);
+
+  return 0;
+}
+
+template <typename DLViewType, typename DViewType, typename DUViewType>
+KOKKOS_INLINE_FUNCTION int SerialGttrf::invoke(const DLViewType &dl,
+                                               const DViewType &d,
+                                               const DUViewType &du) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert(Kokkos::is_view<DLViewType>::value,
+                "KokkosBatched::gttrf: DLViewType is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<DViewType>::value,
+                "KokkosBatched::gttrf: DViewType is not a Kokkos::View.");
+  static_assert(Kokkos::is_view<DUViewType>::value,
+                "KokkosBatched::gttrf: DUViewType is not a Kokkos::View.");
+#endif
+  const int n = d.extent(0);
+  for (int i = 0; i < n - 1; ++i) {
+    dl(i) /= d(i);
+    d(i + 1) -= dl(i) * du(i);
+  }
+  return 0;
+}
+
+template <>
+struct SerialGttrs<Trans::NoTranspose> {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    static_assert(Kokkos::is_view<BViewType>::value,
+                  "KokkosBatched::gttrs: BViewType is not a Kokkos::View.");
+    static_assert(BViewType::rank == 1,
+                  "KokkosBatched::gttrs: BViewType must have rank 1.");
+#endif
+    const int n = d.extent(0);
+    if (n == 0) return 0;
+
+    /// L y = b
+    for (int i = 1; i < n; ++i) b(i) -= dl(i - 1) * b(i - 1);
+
+    /// U x = y
+    b(n - 1) /= d(n - 1);
+    for (int i = n - 2; i >= 0; --i) b(i) = (b(i) - du(i) * b(i + 1)) / d(i);
+
+    return 0;
+  }
+};
+
+template <>
+struct SerialGttrs<Trans::Transpose> {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    static_assert(Kokkos::is_view<BViewType>::value,
+                  "KokkosBatched::gttrs: BViewType is not a Kokkos::View.");
+    static_assert(BViewType::rank == 1,
+                  "KokkosBatched::gttrs: BViewType must have rank 1.");
+#endif
+    const int n = d.extent(0);
+    if (n == 0) return 0;
+
+    /// U^T y = b
+    b(0) /= d(0);
+    for (int i = 1; i < n; ++i) b(i) = (b(i) - du(i - 1) * b(i - 1)) / d(i);
+
+    /// L^T x = y
+    for (int i = n - 2; i >= 0; --i) b(i) -= dl(i) * b(i + 1);
+
+    return 0;
+  }
+};
+
+template <>
+struct SerialGtsv<Tridiag::Thomas> {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b) {
+    int r_val = SerialGttrf::invoke(dl, d, du);
+    if (r_val == 0)
+      r_val = SerialGttrs<Trans::NoTranspose>::invoke(dl, d, du, b);
+    return r_val;
+  }
+};
+
+///
+/// Team Impl
+/// =========
+
+template <typename MemberType, typename ArgTrans>
+template <typename DLViewType, typename DViewType, typename DUViewType,
+          typename BViewType>
+KOKKOS_INLINE_FUNCTION int TeamGttrs<MemberType, ArgTrans>::invoke(
+    const MemberType &member, const DLViewType &dl, const DViewType &d,
+    const DUViewType &du, const BViewType &B) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+  static_assert(Kokkos::is_view<BViewType>::value,
+                "KokkosBatched::gttrs: BViewType is not a Kokkos::View.");
+  static_assert(BViewType::rank == 2,
+                "KokkosBatched::gttrs: BViewType must have rank 2.");
+#endif
+  Kokkos::parallel_for(Kokkos::TeamThreadRange(member, B.extent(1)),
+                       [&](const int &j) {
+                         auto b = Kokkos::subview(B, Kokkos::ALL(), j);
+                         SerialGttrs<ArgTrans>::invoke(dl, d, du, b);
+                       });
+  return 0;
+}
+
+template <typename MemberType>
+struct TeamGtsv<MemberType, Tridiag::Thomas> {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b) {
+    int r_val = 0;
+    Kokkos::single(
+        Kokkos::PerTeam(member),
+        [&](int &val) {
+          val = SerialGtsv<Tridiag::Thomas>::invoke(dl, d, du, b);
+        },
+        r_val);
+    return r_val;
+  }
+};
+
+template <typename MemberType>
+struct TeamGtsv<MemberType, Tridiag::CyclicReduction> {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b) {
+#if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
+    static_assert(Kokkos::is_view<BViewType>::value,
+                  "KokkosBatched::gtsv: BViewType is not a Kokkos::View.");
+    static_assert(BViewType::rank == 1,
+                  "KokkosBatched::gtsv: BViewType must have rank 1.");
+#endif
+    typedef typename BViewType::non_const_value_type value_type;
+
+    const int n = d.extent(0);
+    if (n == 0) return 0;
+
+    /// Row i couples to rows i-s and i+s at level s; the coupling to i-s
+    /// is kept in dl(i-1) and the coupling to i+s in du(i). Rows with
+    /// (i+1) % 2s == 0 eliminate their neighbors at level s.
+    int s = 1;
+    for (; 2 * s <= n; s *= 2) {
+      const int nrows = n / (2 * s);
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, nrows), [&](const int &k) {
+            const int i = 2 * s * (k + 1) - 1, im = i - s, ip = i + s;
+
+            const value_type alpha = -dl(i - 1) / d(im);
+            value_type di          = d(i) + alpha * du(im);
+            value_type bi          = b(i) + alpha * b(im);
+            dl(i - 1) = im > 0 ? value_type(alpha * dl(im - 1)) : value_type(0);
+            if (ip < n) {
+              const value_type gamma = -du(i) / d(ip);
+              di += gamma * dl(ip - 1);
+              bi += gamma * b(ip);
+              du(i) =
+                  ip < n - 1 ? value_type(gamma * du(ip)) : value_type(0);
+            }
+            d(i) = di;
+            b(i) = bi;
+          });
+      member.team_barrier();
+    }
+
+    /// the remaining row s-1 is decoupled from all others
+    Kokkos::single(Kokkos::PerTeam(member),
+                   [&]() { b(s - 1) /= d(s - 1); });
+    member.team_barrier();
+
+    for (s /= 2; s >= 1; s /= 2) {
+      const int nrows = (n + s) / (2 * s);
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, nrows), [&](const int &k) {
+            const int j = 2 * s * k + s - 1;
+
+            value_type bj = b(j);
+            if (j - s >= 0) bj -= dl(j - 1) * b(j - s);
+            if (j + s < n) bj -= du(j) * b(j + s);
+            b(j) = bj / d(j);
+          });
+      member.team_barrier();
+    }
+    return 0;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
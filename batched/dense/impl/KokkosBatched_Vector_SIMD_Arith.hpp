@@ -45,6 +45,21 @@ operator+(const Vector<SIMD<Kokkos::complex<double> >, 4> &a,
 }
 #endif
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator+(
+    const Vector<SIMD<float>, 16> &a, const Vector<SIMD<float>, 16> &b) {
+  return _mm512_add_ps(a, b);
+}
+
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator+(const Vector<SIMD<Kokkos::complex<float> >, 8> &a,
+          const Vector<SIMD<Kokkos::complex<float> >, 8> &b) {
+  return _mm512_add_ps(a, b);
+}
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 KOKKOS_FORCEINLINE_FUNCTION
@@ -65,6 +80,39 @@ operator+(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator+(
+    const Vector<SIMD<double>, 4> &a, const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vaddq_f64(aa.val[0], bb.val[0]),
+                        vaddq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator+(
+    const Vector<SIMD<float>, 8> &a, const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vaddq_f32(aa.val[0], bb.val[0]),
+                        vaddq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+operator+(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+          const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svadd_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+operator+(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+          const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svadd_f32_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator+(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -236,6 +284,21 @@ operator-(const Vector<SIMD<Kokkos::complex<double> >, 4> &a,
 }
 #endif
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator-(
+    const Vector<SIMD<float>, 16> &a, const Vector<SIMD<float>, 16> &b) {
+  return _mm512_sub_ps(a, b);
+}
+
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator-(const Vector<SIMD<Kokkos::complex<float> >, 8> &a,
+          const Vector<SIMD<Kokkos::complex<float> >, 8> &b) {
+  return _mm512_sub_ps(a, b);
+}
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 KOKKOS_FORCEINLINE_FUNCTION
@@ -256,6 +319,39 @@ operator-(const Vector<SIMD<Kokkos::complex<double> >, 2> &a,
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(
+    const Vector<SIMD<double>, 4> &a, const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vsubq_f64(aa.val[0], bb.val[0]),
+                        vsubq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator-(
+    const Vector<SIMD<float>, 8> &a, const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vsubq_f32(aa.val[0], bb.val[0]),
+                        vsubq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+operator-(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+          const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svsub_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+operator-(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+          const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svsub_f32_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator-(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -308,6 +404,55 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(
 }
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 8) operator-(
+    const Vector<SIMD<double>, 8> &a) {
+  return _mm512_castsi512_pd(
+      _mm512_xor_si512(_mm512_castpd_si512(a),
+                       _mm512_castpd_si512(_mm512_set1_pd(-0.0))));
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator-(
+    const Vector<SIMD<float>, 16> &a) {
+  return _mm512_castsi512_ps(
+      _mm512_xor_si512(_mm512_castps_si512(a),
+                       _mm512_castps_si512(_mm512_set1_ps(-0.0f))));
+}
+#endif
+#endif
+
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator-(
+    const Vector<SIMD<double>, 4> &a) {
+  const float64x2x2_t aa = a;
+  return float64x2x2_t{{vnegq_f64(aa.val[0]), vnegq_f64(aa.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator-(
+    const Vector<SIMD<float>, 8> &a) {
+  const float32x4x2_t aa = a;
+  return float32x4x2_t{{vnegq_f32(aa.val[0]), vnegq_f32(aa.val[1])}};
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+operator-(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a) {
+  return svneg_f64_x(svptrue_b64(), a);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+operator-(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a) {
+  return svneg_f32_x(svptrue_b32(), a);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator-(const Vector<SIMD<T>, l> &a) {
@@ -456,6 +601,34 @@ static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<double>, 4) operator
 }
 #endif
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator*(
+    const Vector<SIMD<float>, 16> &a, const Vector<SIMD<float>, 16> &b) {
+  return _mm512_mul_ps(a, b);
+}
+
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator*(const Vector<SIMD<Kokkos::complex<float> >, 8> &a,
+          const Vector<SIMD<Kokkos::complex<float> >, 8> &b) {
+  const __m512 as = _mm512_permute_ps(a, 0xb1),
+               br = _mm512_permute_ps(b, 0xa0),
+               bi = _mm512_permute_ps(b, 0xf5);
+
+#if defined(__FMA__)
+  return _mm512_fmaddsub_ps(a, br, _mm512_mul_ps(as, bi));
+#else
+  return _mm512_add_ps(
+      _mm512_mul_ps(a, br),
+      _mm512_castsi512_ps(_mm512_xor_si512(
+          _mm512_castps_si512(_mm512_mul_ps(as, bi)),
+          _mm512_castps_si512(
+              _mm512_maskz_mov_ps(0x5555, _mm512_set1_ps(-0.0f))))));
+#endif
+}
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 KOKKOS_FORCEINLINE_FUNCTION
@@ -485,6 +658,39 @@ static Vector<SIMD<Kokkos::complex<double> >, 2> operator*(
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator*(
+    const Vector<SIMD<double>, 4> &a, const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vmulq_f64(aa.val[0], bb.val[0]),
+                        vmulq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator*(
+    const Vector<SIMD<float>, 8> &a, const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vmulq_f32(aa.val[0], bb.val[0]),
+                        vmulq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+operator*(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+          const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svmul_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+operator*(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+          const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svmul_f32_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator*(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -580,6 +786,14 @@ operator*(const Vector<SIMD<Kokkos::complex<double> >, 4> &a, const double b) {
 }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator*(const Vector<SIMD<Kokkos::complex<float> >, 8> &a, const float b) {
+  return _mm512_mul_ps(a, _mm512_set1_ps(b));
+}
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 
@@ -612,6 +826,14 @@ operator*(const double a, const Vector<SIMD<Kokkos::complex<double> >, 4> &b) {
 }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator*(const float a, const Vector<SIMD<Kokkos::complex<float> >, 8> &b) {
+  return _mm512_mul_ps(_mm512_set1_ps(a), b);
+}
+#endif
+
 #endif
 #if defined(__AVX__) || defined(__AVX2__)
 
@@ -703,7 +925,7 @@ operator/(const Vector<SIMD<Kokkos::complex<double> >, 4> &a,
           _mm512_castsi512_pd(_mm512_xor_si512(
               _mm512_castpd_si512(_mm512_mul_pd(as, bi)),
               _mm512_castpd_si512(_mm512_mask_broadcast_f64x4(
-                  _mm512_setzero_pd(), 0xAA, _mm256_set1_pd(-0.0)))))),
+                  _mm512_setzero_pd(), 0x55, _mm256_set1_pd(-0.0)))))),
       _mm512_add_pd(_mm512_mul_pd(br, br), _mm512_mul_pd(bi, bi)));
   // const __mm512d cc = _mm512_mul_pd(as, bi);
   // return _mm512_div_pd(_mm512_mask_sub_pd(_mm512_mask_add_pd(_mm512_mul_pd(a,
@@ -714,6 +936,41 @@ operator/(const Vector<SIMD<Kokkos::complex<double> >, 4> &a,
 }
 #endif
 
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 16) operator/(
+    const Vector<SIMD<float>, 16> &a, const Vector<SIMD<float>, 16> &b) {
+  return _mm512_div_ps(a, b);
+}
+
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator/(const Vector<SIMD<Kokkos::complex<float> >, 8> &a,
+          const Vector<SIMD<Kokkos::complex<float> >, 8> &b) {
+  const __m512 as = _mm512_permute_ps(a, 0xb1),
+               cb = _mm512_castsi512_ps(_mm512_xor_si512(
+                   _mm512_castps_si512(b),
+                   _mm512_castps_si512(
+                       _mm512_maskz_mov_ps(0xAAAA, _mm512_set1_ps(-0.0f))))),
+               br = _mm512_permute_ps(cb, 0xa0),
+               bi = _mm512_permute_ps(cb, 0xf5);
+
+#if defined(__FMA__)
+  return _mm512_div_ps(_mm512_fmaddsub_ps(a, br, _mm512_mul_ps(as, bi)),
+                       _mm512_fmadd_ps(br, br, _mm512_mul_ps(bi, bi)));
+#else
+  return _mm512_div_ps(
+      _mm512_add_ps(
+          _mm512_mul_ps(a, br),
+          _mm512_castsi512_ps(_mm512_xor_si512(
+              _mm512_castps_si512(_mm512_mul_ps(as, bi)),
+              _mm512_castps_si512(
+                  _mm512_maskz_mov_ps(0x5555, _mm512_set1_ps(-0.0f)))))),
+      _mm512_add_ps(_mm512_mul_ps(br, br), _mm512_mul_ps(bi, bi)));
+#endif
+}
+#endif
+
 #endif
 
 #if defined(__AVX__) || defined(__AVX2__)
@@ -750,6 +1007,39 @@ operator/(Vector<SIMD<Kokkos::complex<double> >, 2> const &a,
 #endif
 #endif
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, 4) operator/(
+    const Vector<SIMD<double>, 4> &a, const Vector<SIMD<double>, 4> &b) {
+  const float64x2x2_t aa = a, bb = b;
+  return float64x2x2_t{{vdivq_f64(aa.val[0], bb.val[0]),
+                        vdivq_f64(aa.val[1], bb.val[1])}};
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, 8) operator/(
+    const Vector<SIMD<float>, 8> &a, const Vector<SIMD<float>, 8> &b) {
+  const float32x4x2_t aa = a, bb = b;
+  return float32x4x2_t{{vdivq_f32(aa.val[0], bb.val[0]),
+                        vdivq_f32(aa.val[1], bb.val[1])}};
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+operator/(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a,
+          const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &b) {
+  return svdiv_f64_x(svptrue_b64(), a, b);
+}
+
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+operator/(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a,
+          const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &b) {
+  return svdiv_f32_x(svptrue_b32(), a, b);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_FORCEINLINE_FUNCTION static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(T, l)
 operator/(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
@@ -822,6 +1112,14 @@ operator/(const Vector<SIMD<Kokkos::complex<double> >, 4> &a, const double b) {
 }
 #endif
 
+#if !defined(KOKKOS_COMPILER_GNU)
+KOKKOS_FORCEINLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_ARITH_RETURN_TYPE(Kokkos::complex<float>, 8)
+operator/(const Vector<SIMD<Kokkos::complex<float> >, 8> &a, const float b) {
+  return _mm512_div_ps(a, _mm512_set1_ps(b));
+}
+#endif
+
 #endif
 #endif
 
@@ -29,6 +29,53 @@ namespace KokkosBatched {
 
 /// simd
 
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 8)
+    sqrt(const Vector<SIMD<double>, 8> &a) {
+  return _mm512_sqrt_pd(a);
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 16)
+    sqrt(const Vector<SIMD<float>, 16> &a) {
+  return _mm512_sqrt_ps(a);
+}
+#endif
+#if defined(__AVX__) || defined(__AVX2__)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    sqrt(const Vector<SIMD<double>, 4> &a) {
+  return _mm256_sqrt_pd(a);
+}
+#endif
+#endif
+
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, 4)
+    sqrt(const Vector<SIMD<double>, 4> &a) {
+  const float64x2x2_t aa = a;
+  return float64x2x2_t{{vsqrtq_f64(aa.val[0]), vsqrtq_f64(aa.val[1])}};
+}
+
+KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, 8)
+    sqrt(const Vector<SIMD<float>, 8> &a) {
+  const float32x4x2_t aa = a;
+  return float32x4x2_t{{vsqrtq_f32(aa.val[0]), vsqrtq_f32(aa.val[1])}};
+}
+#endif
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+KOKKOS_INLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(double, __ARM_FEATURE_SVE_BITS / 64)
+    sqrt(const Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> &a) {
+  return svsqrt_f64_x(svptrue_b64(), a);
+}
+
+KOKKOS_INLINE_FUNCTION
+static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(float, __ARM_FEATURE_SVE_BITS / 32)
+    sqrt(const Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> &a) {
+  return svsqrt_f32_x(svptrue_b32(), a);
+}
+#endif
+
 template <typename T, int l>
 KOKKOS_INLINE_FUNCTION static KOKKOSKERNELS_SIMD_MATH_RETURN_TYPE(T, l)
     sqrt(const Vector<SIMD<T>, l> &a) {
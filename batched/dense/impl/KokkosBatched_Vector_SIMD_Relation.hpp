@@ -77,6 +77,64 @@ KOKKOSBATCHED_RELATION_OPERATOR(>=)
 KOKKOSBATCHED_RELATION_OPERATOR(==)
 KOKKOSBATCHED_RELATION_OPERATOR(!=)
 
+// vector, vector with hardware comparison masks
+#if defined(__KOKKOSBATCHED_ENABLE_AVX__)
+#if defined(__AVX512F__)
+#undef KOKKOSBATCHED_RELATION_OPERATOR
+#define KOKKOSBATCHED_RELATION_OPERATOR(op, T, l, cmp, pred)     \
+  KOKKOS_INLINE_FUNCTION const Vector<SIMD<bool>, l> operator op( \
+      const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) { \
+    const unsigned int m = cmp(a, b, pred);                       \
+    Vector<SIMD<bool>, l> r_val;                                  \
+    for (int i = 0; i < l; ++i) r_val[i] = (m >> i) & 1u;         \
+    return r_val;                                                 \
+  }
+
+KOKKOSBATCHED_RELATION_OPERATOR(<, double, 8, _mm512_cmp_pd_mask, _CMP_LT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>, double, 8, _mm512_cmp_pd_mask, _CMP_GT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(<=, double, 8, _mm512_cmp_pd_mask, _CMP_LE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>=, double, 8, _mm512_cmp_pd_mask, _CMP_GE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(==, double, 8, _mm512_cmp_pd_mask, _CMP_EQ_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(!=, double, 8, _mm512_cmp_pd_mask, _CMP_NEQ_UQ)
+
+KOKKOSBATCHED_RELATION_OPERATOR(<, float, 16, _mm512_cmp_ps_mask, _CMP_LT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>, float, 16, _mm512_cmp_ps_mask, _CMP_GT_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(<=, float, 16, _mm512_cmp_ps_mask, _CMP_LE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(>=, float, 16, _mm512_cmp_ps_mask, _CMP_GE_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(==, float, 16, _mm512_cmp_ps_mask, _CMP_EQ_OQ)
+KOKKOSBATCHED_RELATION_OPERATOR(!=, float, 16, _mm512_cmp_ps_mask, _CMP_NEQ_UQ)
+#endif
+#endif
+
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+#undef KOKKOSBATCHED_RELATION_OPERATOR
+#define KOKKOSBATCHED_RELATION_OPERATOR(op, T, U, b, cmp)                     \
+  KOKKOS_INLINE_FUNCTION const Vector<SIMD<bool>, __ARM_FEATURE_SVE_BITS / b> \
+  operator op(const Vector<SIMD<T>, __ARM_FEATURE_SVE_BITS / b> &a,           \
+              const Vector<SIMD<T>, __ARM_FEATURE_SVE_BITS / b> &c) {         \
+    const svbool_t pg = svptrue_b##b();                                       \
+    U m[__ARM_FEATURE_SVE_BITS / b];                                          \
+    svst1_u##b(pg, m, svdup_n_u##b##_z(cmp(pg, a, c), 1));                    \
+    Vector<SIMD<bool>, __ARM_FEATURE_SVE_BITS / b> r_val;                     \
+    for (int i = 0; i < __ARM_FEATURE_SVE_BITS / b; ++i) r_val[i] = m[i];     \
+    return r_val;                                                             \
+  }
+
+KOKKOSBATCHED_RELATION_OPERATOR(<, double, uint64_t, 64, svcmplt_f64)
+KOKKOSBATCHED_RELATION_OPERATOR(>, double, uint64_t, 64, svcmpgt_f64)
+KOKKOSBATCHED_RELATION_OPERATOR(<=, double, uint64_t, 64, svcmple_f64)
+KOKKOSBATCHED_RELATION_OPERATOR(>=, double, uint64_t, 64, svcmpge_f64)
+KOKKOSBATCHED_RELATION_OPERATOR(==, double, uint64_t, 64, svcmpeq_f64)
+KOKKOSBATCHED_RELATION_OPERATOR(!=, double, uint64_t, 64, svcmpne_f64)
+
+KOKKOSBATCHED_RELATION_OPERATOR(<, float, uint32_t, 32, svcmplt_f32)
+KOKKOSBATCHED_RELATION_OPERATOR(>, float, uint32_t, 32, svcmpgt_f32)
+KOKKOSBATCHED_RELATION_OPERATOR(<=, float, uint32_t, 32, svcmple_f32)
+KOKKOSBATCHED_RELATION_OPERATOR(>=, float, uint32_t, 32, svcmpge_f32)
+KOKKOSBATCHED_RELATION_OPERATOR(==, float, uint32_t, 32, svcmpeq_f32)
+KOKKOSBATCHED_RELATION_OPERATOR(!=, float, uint32_t, 32, svcmpne_f32)
+#endif
+
 #undef KOKKOSBATCHED_RELATION_OPERATOR
 }  // namespace KokkosBatched
 
@@ -0,0 +1,176 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BLOCKTRIDIAG_HPP__
+#define __KOKKOSBATCHED_BLOCKTRIDIAG_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Serial Batched Block Tridiagonal Factorization:
+///
+/// Compute the block L U factorization (without pivoting across blocks) of
+/// the block tridiagonal matrix
+///
+///   [ A_0  B_0                     ]
+///   [ C_0  A_1  B_1                ]
+///   [      ...  ...  ...           ]
+///   [           C_{L-2}  A_{L-1}   ]
+///
+/// for all l = 0, ..., N. This is the factorization used by line-implicit
+/// smoothers; the value type may be a Vector<SIMD<T>,l> to factorize l
+/// interleaved systems at once.
+///
+/// \tparam ArgAlgo: algorithm passed to the dense LU, Trsm and Gemm kernels,
+/// Algo::Level3::Unblocked or Algo::Level3::Blocked
+///
+/// \param A [in/out]: diagonal blocks, a rank 3 view of dimension L x m x m;
+/// on output the LU factors of the pivot blocks
+/// \param B [in/out]: super-diagonal blocks, a rank 3 view with at least L-1
+/// blocks of dimension m x m; on output L_k^{-1} B_k
+/// \param C [in/out]: sub-diagonal blocks, a rank 3 view with at least L-1
+/// blocks of dimension m x m, where C_k is the block (k+1, k); on output
+/// C_k U_k^{-1}
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+template <typename ArgAlgo>
+struct SerialBlockTridiagFactor {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C);
+};
+
+/// \brief Serial Batched Block Tridiagonal Solve:
+///
+/// Solve the block tridiagonal system using the factors computed by
+/// SerialBlockTridiagFactor.
+///
+/// \tparam ArgAlgo: algorithm passed to the dense Trsv and Gemv kernels,
+/// Algo::Level2::Unblocked or Algo::Level2::Blocked
+///
+/// \param A [in]: factored diagonal blocks
+/// \param B [in]: factored super-diagonal blocks
+/// \param C [in]: factored sub-diagonal blocks
+/// \param X [in/out]: on input the right-hand side, on output the solution,
+/// a rank 2 view of dimension L x m
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+template <typename ArgAlgo>
+struct SerialBlockTridiagSolve {
+  template <typename AViewType, typename BViewType, typename CViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C,
+                                           const XViewType &X);
+};
+
+/// \brief Team Batched Block Tridiagonal Factorization:
+///
+/// Team version of SerialBlockTridiagFactor; the block operations use the
+/// team LU, Trsm and Gemm kernels.
+///
+/// \param member [in]: TeamPolicy member
+/// \param A [in/out]: diagonal blocks, L x m x m
+/// \param B [in/out]: super-diagonal blocks, (L-1) x m x m
+/// \param C [in/out]: sub-diagonal blocks, (L-1) x m x m
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamBlockTridiagFactor {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C);
+};
+
+/// \brief Team Batched Block Tridiagonal Solve:
+///
+/// Team version of SerialBlockTridiagSolve; the block operations use the
+/// team Trsv and Gemv kernels.
+///
+/// \param member [in]: TeamPolicy member
+/// \param A [in]: factored diagonal blocks
+/// \param B [in]: factored super-diagonal blocks
+/// \param C [in]: factored sub-diagonal blocks
+/// \param X [in/out]: on input the right-hand side, on output the solution,
+/// L x m
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamBlockTridiagSolve {
+  template <typename AViewType, typename BViewType, typename CViewType,
+            typename XViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A,
+                                           const BViewType &B,
+                                           const CViewType &C,
+                                           const XViewType &X);
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct BlockTridiagFactor {
+  template <typename AViewType, typename BViewType, typename CViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const BViewType &B,
+                                                const CViewType &C) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialBlockTridiagFactor<ArgAlgo>::invoke(A, B, C);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val =
+          TeamBlockTridiagFactor<MemberType, ArgAlgo>::invoke(member, A, B, C);
+    }
+    return r_val;
+  }
+};
+
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct BlockTridiagSolve {
+  template <typename AViewType, typename BViewType, typename CViewType,
+            typename XViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A,
+                                                const BViewType &B,
+                                                const CViewType &C,
+                                                const XViewType &X) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialBlockTridiagSolve<ArgAlgo>::invoke(A, B, C, X);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamBlockTridiagSolve<MemberType, ArgAlgo>::invoke(member, A, B,
+                                                                 C, X);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_BlockTridiag_Impl.hpp"
+
+#endif
@@ -0,0 +1,81 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_CHOLESKY_DECL_HPP__
+#define __KOKKOSBATCHED_CHOLESKY_DECL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Serial Batched Cholesky:
+///
+/// Compute the Cholesky factorization A = L L^H of a Hermitian positive
+/// definite matrix. L overwrites the lower triangle of A and the strictly
+/// upper triangle of A is not referenced.
+///
+/// \tparam AViewType: Input type for the matrix, needs to be a 2D view
+///
+/// \param A [in/out]: on input the n x n matrix, on output L in its lower
+/// triangle
+///
+/// Positivity of the pivots is not checked, so that the routine can be used
+/// with SIMD value types.
+///
+/// No nested parallel_for is used inside of the function.
+///
+template <typename ArgAlgo>
+struct SerialCholesky {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const AViewType &A);
+};
+
+/// \brief Team Batched Cholesky:
+///
+/// Same as SerialCholesky, the trailing updates are spread over the threads
+/// of the team.
+///
+template <typename MemberType, typename ArgAlgo>
+struct TeamCholesky {
+  template <typename AViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const AViewType &A);
+};
+
+///
+/// Selective Interface
+///
+template <typename MemberType, typename ArgMode, typename ArgAlgo>
+struct Cholesky {
+  template <typename AViewType>
+  KOKKOS_FORCEINLINE_FUNCTION static int invoke(const MemberType &member,
+                                                const AViewType &A) {
+    int r_val = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      r_val = SerialCholesky<ArgAlgo>::invoke(A);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      r_val = TeamCholesky<MemberType, ArgAlgo>::invoke(member, A);
+    }
+    return r_val;
+  }
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Cholesky_Serial_Impl.hpp"
+#include "KokkosBatched_Cholesky_Team_Impl.hpp"
+
+#endif
@@ -0,0 +1,200 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_DENSE_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_DENSE_HPP__
+
+#include <sstream>
+
+#include "KokkosBatched_HostLevel_Dense_Handle.hpp"
+#include "KokkosBatched_HostLevel_Dense_Impl.hpp"
+
+namespace KokkosBatched {
+namespace Impl {
+template <typename AViewType>
+void batched_dense_check_square(const char *label, const AViewType &A) {
+  static_assert(AViewType::rank == 3, "A must be a rank 3 view.");
+  if (A.extent(1) != A.extent(2)) {
+    std::ostringstream os;
+    os << label << ": A must hold square matrices, got " << A.extent(1)
+       << " x " << A.extent(2);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+template <typename AViewType, typename BViewType>
+void batched_dense_check_rhs(const char *label, const AViewType &A,
+                             const BViewType &B, const size_t rows) {
+  static_assert(BViewType::rank == 3, "B must be a rank 3 view.");
+  if (B.extent(0) != A.extent(0) || B.extent(1) != rows) {
+    std::ostringstream os;
+    os << label << ": dimensions do not match: A: " << A.extent(0) << " x "
+       << A.extent(1) << " x " << A.extent(2) << ", B: " << B.extent(0)
+       << " x " << B.extent(1) << " x " << B.extent(2);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+}  // namespace Impl
+
+// clang-format off
+/// \brief Non-blocking LU factorization without pivoting of a batch of
+/// uniform square matrices.
+///
+///        A_k = L_k * U_k
+///
+/// \tparam ExecutionSpace Specifies the execution space of the kernels
+/// \tparam AViewType      Input/Output rank-3 view of dimension (batch size, n, n)
+///
+/// \param handle [in]     A handle selecting the algorithm, see BatchedDenseHandle
+/// \param A [in/out]      On output, L_k (unit diagonal) and U_k
+/// \return 0 upon success, non-zero otherwise
+///
+/// Usage Example:
+///   BatchedDenseHandle handle;
+///   BatchedLU(&handle, A);
+///   BatchedSolveLU<Trans::NoTranspose>(&handle, A, B);
+// clang-format on
+template <typename AViewType,
+          typename ExecutionSpace = typename AViewType::execution_space>
+int BatchedLU(const BatchedDenseHandle *const handle, const AViewType &A) {
+  Impl::batched_dense_check_square("KokkosBatched::BatchedLU", A);
+  Impl::batched_dense_invoke<ExecutionSpace,
+                             typename AViewType::non_const_value_type>(
+      *handle, "KokkosBatched::BatchedLU", Impl::BatchedLUOp<AViewType>{A},
+      A.extent(0), A.extent(1));
+  return 0;
+}
+
+// clang-format off
+/// \brief Non-blocking solve of a batch of linear systems with the factors of
+/// BatchedLU.
+///
+///        op(A_k) X_k = B_k
+///
+/// \tparam ArgTrans       Specifies op: Trans::NoTranspose or Trans::Transpose
+/// \tparam AViewType      Input rank-3 view of dimension (batch size, n, n)
+/// \tparam BViewType      Input/Output rank-3 view of dimension
+///                        (batch size, n, nrhs)
+///
+/// \param handle [in]     A handle selecting the algorithm, see BatchedDenseHandle
+/// \param A [in]          The factors computed by BatchedLU
+/// \param B [in/out]      On input the right-hand sides, on output X_k
+/// \return 0 upon success, non-zero otherwise
+// clang-format on
+template <typename ArgTrans, typename AViewType, typename BViewType,
+          typename ExecutionSpace = typename AViewType::execution_space>
+int BatchedSolveLU(const BatchedDenseHandle *const handle, const AViewType &A,
+                   const BViewType &B) {
+  Impl::batched_dense_check_square("KokkosBatched::BatchedSolveLU", A);
+  Impl::batched_dense_check_rhs("KokkosBatched::BatchedSolveLU", A, B,
+                                A.extent(1));
+  Impl::batched_dense_invoke<ExecutionSpace,
+                             typename AViewType::non_const_value_type>(
+      *handle, "KokkosBatched::BatchedSolveLU",
+      Impl::BatchedSolveLUOp<ArgTrans, AViewType, BViewType>{A, B},
+      A.extent(0), A.extent(1));
+  return 0;
+}
+
+// clang-format off
+/// \brief Non-blocking Cholesky factorization of a batch of uniform Hermitian
+/// positive definite matrices.
+///
+///        A_k = L_k * L_k^H
+///
+/// \tparam AViewType      Input/Output rank-3 view of dimension (batch size, n, n)
+///
+/// \param handle [in]     A handle selecting the algorithm, see BatchedDenseHandle
+/// \param A [in/out]      On output, L_k in the lower triangle. The strictly
+///                        upper triangle is not referenced.
+/// \return 0 upon success, non-zero otherwise
+///
+/// Usage Example:
+///   BatchedCholesky(&handle, A);
+///   BatchedTrsm<Side::Left, Uplo::Lower, Trans::NoTranspose, Diag::NonUnit>(
+///       &handle, 1.0, A, B);
+///   BatchedTrsm<Side::Left, Uplo::Lower, Trans::Transpose, Diag::NonUnit>(
+///       &handle, 1.0, A, B);
+// clang-format on
+template <typename AViewType,
+          typename ExecutionSpace = typename AViewType::execution_space>
+int BatchedCholesky(const BatchedDenseHandle *const handle,
+                    const AViewType &A) {
+  Impl::batched_dense_check_square("KokkosBatched::BatchedCholesky", A);
+  Impl::batched_dense_invoke<ExecutionSpace,
+                             typename AViewType::non_const_value_type>(
+      *handle, "KokkosBatched::BatchedCholesky",
+      Impl::BatchedCholeskyOp<AViewType>{A}, A.extent(0), A.extent(1));
+  return 0;
+}
+
+// clang-format off
+/// \brief Non-blocking triangular solve of a batch of uniform matrices.
+///
+///        op(A_k) X_k = alpha * B_k  (Side::Left)
+///        X_k op(A_k) = alpha * B_k  (Side::Right)
+///
+/// The combinations of ArgSide, ArgUplo and ArgTrans are the ones of
+/// SerialTrsm and TeamTrsm: Left with any Uplo and Trans, and Right, Upper,
+/// NoTranspose.
+///
+/// \tparam AViewType      Input rank-3 view of dimension (batch size, n, n)
+/// \tparam BViewType      Input/Output rank-3 view of dimension
+///                        (batch size, n, nrhs) for Side::Left and
+///                        (batch size, nrhs, n) for Side::Right
+///
+/// \param handle [in]     A handle selecting the algorithm, see BatchedDenseHandle
+/// \param alpha [in]      Input coefficient of B
+/// \param A [in]          The triangular matrices
+/// \param B [in/out]      On input the right-hand sides, on output X_k
+/// \return 0 upon success, non-zero otherwise
+// clang-format on
+template <typename ArgSide, typename ArgUplo, typename ArgTrans,
+          typename ArgDiag, typename ScalarType, typename AViewType,
+          typename BViewType,
+          typename ExecutionSpace = typename AViewType::execution_space>
+int BatchedTrsm(const BatchedDenseHandle *const handle, const ScalarType alpha,
+                const AViewType &A, const BViewType &B) {
+  static_assert(std::is_same<ArgSide, Side::Left>::value ||
+                    (std::is_same<ArgUplo, Uplo::Upper>::value &&
+                     std::is_same<ArgTrans, Trans::NoTranspose>::value),
+                "KokkosBatched::BatchedTrsm: the supported combinations are "
+                "Side::Left with any Uplo and Trans, and Side::Right with "
+                "Uplo::Upper and Trans::NoTranspose.");
+  Impl::batched_dense_check_square("KokkosBatched::BatchedTrsm", A);
+  if (std::is_same<ArgSide, Side::Left>::value)
+    Impl::batched_dense_check_rhs("KokkosBatched::BatchedTrsm", A, B,
+                                  A.extent(1));
+  else
+    Impl::batched_dense_check_rhs("KokkosBatched::BatchedTrsm", A, B,
+                                  B.extent(1));
+  if (!std::is_same<ArgSide, Side::Left>::value &&
+      B.extent(2) != A.extent(1)) {
+    std::ostringstream os;
+    os << "KokkosBatched::BatchedTrsm: B must have " << A.extent(1)
+       << " columns, got " << B.extent(2);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  Impl::batched_dense_invoke<ExecutionSpace,
+                             typename AViewType::non_const_value_type>(
+      *handle, "KokkosBatched::BatchedTrsm",
+      Impl::BatchedTrsmOp<ArgSide, ArgUplo, ArgTrans, ArgDiag, ScalarType,
+                          AViewType, BViewType>{alpha, A, B},
+      A.extent(0), A.extent(1));
+  return 0;
+}
+}  // namespace KokkosBatched
+
+#endif  // __KOKKOSBATCHED_HOSTLEVEL_DENSE_HPP__
@@ -0,0 +1,112 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_DENSE_HANDLE_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_DENSE_HANDLE_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Kernel_Handle.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+
+namespace KokkosBatched {
+
+/// \brief KokkosBatched algorithm types. See BatchedDenseHandle for details.
+namespace DenseKokkosBatchedAlgos {
+enum DENSE_KOKKOS_BATCHED_ALGOS : int {
+  KK_TEAM = N_BASE_ALGOS,
+  KK_SERIALSIMD,
+  N
+};
+}
+
+#define DENSE_ALGO_STRS \
+  "DenseKokkosBatchedAlgos::KK_TEAM", "DenseKokkosBatchedAlgos::KK_SERIALSIMD"
+// clang-format off
+/// \brief Handle for selecting runtime behavior of the BatchedLU,
+/// BatchedSolveLU, BatchedCholesky and BatchedTrsm interfaces.
+///
+/// \param kernelAlgoType  Specifies which algorithm to use for invocation (default, SQUARE).
+///
+///                        Specifies whether to select optimal invocations based on inputs and
+///                        heuristics:
+///                          SQUARE, TALL and WIDE all select the invocation from the value type
+///                          of the views, the batch size and the matrix size:
+///                            - KK_SERIALSIMD for SIMD value types,
+///                            - KK_TEAM on GPUs for matrices of order team_threshold and above,
+///                            - KK_SERIAL otherwise.
+///
+///                        TPL algorithms are currently UNSUPPORTED.
+///
+///                        Specifies which kokkos-kernels (KK) algorithm to invoke:
+///                          KK_SERIAL       Invoke SerialFUNC     via RangePolicy(BatchSz)
+///                                          The register-blocked algorithm is used once
+///                                          the matrices fill its blocks.
+///                          KK_TEAM         Invoke TeamFUNC       via TeamPolicy(BatchSz)
+///                          KK_SERIALSIMD   Invoke SerialFUNC     via RangePolicy(BatchSz)
+///                                          on views of Vector<SIMD<T>, l> values, each thread
+///                                          solves l interleaved problems with the
+///                                          register-blocked algorithm.
+/// \param teamSz          Specifies the team size of KK_TEAM (default, Kokkos::AUTO).
+/// \param vecLen          Specifies the vector length of KK_TEAM (default, Kokkos::AUTO).
+// clang-format on
+class BatchedDenseHandle : public BatchedKernelHandle {
+ public:
+  /// Order of the matrices from which the heuristics use teams on GPUs
+  int team_threshold = 16;
+
+  BatchedDenseHandle(int kernelAlgoType = BaseHeuristicAlgos::SQUARE,
+                     int teamSize = 0, int vecLength = 0)
+      : BatchedKernelHandle(kernelAlgoType, teamSize, vecLength) {
+    if (kernelAlgoType < 0 || kernelAlgoType >= DenseKokkosBatchedAlgos::N ||
+        kernelAlgoType == BaseTplAlgos::ARMPL ||
+        kernelAlgoType == BaseTplAlgos::MKL) {
+      std::ostringstream os;
+      os << "KokkosBatched::BatchedDenseHandle: unsupported kernelAlgoType "
+         << kernelAlgoType << std::endl;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+  }
+
+  std::string get_kernel_algo_type_str() const {
+    return dense_algo_type_strs[_kernelAlgoType];
+  }
+
+  /// \brief Resolves the heuristic algorithm types to the KK algorithm used
+  /// for a batch of batchSize matrices of order n
+  template <typename ExecutionSpace, typename ValueType>
+  int select_algo(const size_t batchSize, const int n) const {
+    if (_kernelAlgoType >= BaseKokkosBatchedAlgos::KK_SERIAL)
+      return _kernelAlgoType;
+    if (is_vector<ValueType>::value)
+      return DenseKokkosBatchedAlgos::KK_SERIALSIMD;
+    // a team per matrix only pays off on GPUs, once the trailing updates
+    // keep its threads busy or the batch is too small to fill the device
+    if (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>() &&
+        (n >= team_threshold ||
+         batchSize < size_t(ExecutionSpace().concurrency()) / 32))
+      return DenseKokkosBatchedAlgos::KK_TEAM;
+    return BaseKokkosBatchedAlgos::KK_SERIAL;
+  }
+
+ private:
+  const char *dense_algo_type_strs[DenseKokkosBatchedAlgos::N] = {
+      BASE_ALGO_STRS, DENSE_ALGO_STRS};
+};
+
+}  // namespace KokkosBatched
+
+#endif  // __KOKKOSBATCHED_HOSTLEVEL_DENSE_HANDLE_HPP__
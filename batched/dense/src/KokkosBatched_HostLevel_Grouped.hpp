@@ -0,0 +1,153 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_GROUPED_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_GROUPED_HPP__
+
+#include <sstream>
+
+#include "KokkosBatched_HostLevel_Grouped_Handle.hpp"
+#include "KokkosBatched_HostLevel_Grouped_Impl.hpp"
+
+namespace KokkosBatched {
+// clang-format off
+/// \brief Non-blocking general matrix multiply on a batch of matrices of
+/// varying sizes.
+///
+///        C_p = alpha * op(A_p) * op(B_p) + beta * C_p,  for every problem p
+///
+/// \tparam ArgTransA      Specifies what op does to A:
+///                        Trans::NoTranspose   for non-transpose
+///                        Trans::Transpose     for transpose
+/// \tparam ArgTransB      Specifies what op does to B:
+///                        Trans::NoTranspose   for non-transpose
+///                        Trans::Transpose     for transpose
+/// \tparam HandleType     Specifies the handle type of the grouped batch
+/// \tparam ScalarType     Specifies the scalar type of alpha and beta
+/// \tparam AViewType      Input rank-1 view holding the packed A_p matrices
+/// \tparam BViewType      Input rank-1 view holding the packed B_p matrices
+/// \tparam CViewType      Input(RHS)/Output(LHS) rank-1 view holding the
+///                        packed C_p matrices
+///
+/// See BatchedGroupedHandle for the layout of the packed matrices.
+///
+/// \param handle [in]     A BatchedGroupedHandle built from the dimensions
+/// \param alpha [in]      Input coefficient used for multiplication with A
+/// \param A [in]          Input view of length at least handle.get_a_size()
+/// \param B [in]          Input view of length at least handle.get_b_size()
+/// \param beta [in]       Input coefficient used for multiplication with C
+/// \param C [in/out]      Input/Output view of length at least
+///                        handle.get_c_size()
+/// \return 0 upon success, non-zero otherwise
+///
+/// Usage Example:
+///   BatchedGroupedGemm<Trans::NoTranspose, Trans::NoTranspose>(handle,
+///                                                               alpha, A, B,
+///                                                               beta, C);
+// clang-format on
+template <typename ArgTransA, typename ArgTransB, typename HandleType,
+          typename ScalarType, typename AViewType, typename BViewType,
+          typename CViewType>
+int BatchedGroupedGemm(const HandleType &handle, const ScalarType alpha,
+                       const AViewType &A, const BViewType &B,
+                       const ScalarType beta, const CViewType &C) {
+  using execution_space = typename HandleType::execution_space;
+  static_assert(AViewType::rank == 1 && BViewType::rank == 1 &&
+                    CViewType::rank == 1,
+                "KokkosBatched::BatchedGroupedGemm: A, B and C must be rank 1 "
+                "views.");
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space,
+                                 typename CViewType::memory_space>::accessible,
+      "KokkosBatched::BatchedGroupedGemm: C must be accessible from the "
+      "execution space of the handle.");
+  if (A.extent(0) < handle.get_a_size() || B.extent(0) < handle.get_b_size() ||
+      C.extent(0) < handle.get_c_size()) {
+    std::ostringstream os;
+    os << "KokkosBatched::BatchedGroupedGemm: the packed matrices are too "
+          "short: A: "
+       << A.extent(0) << " < " << handle.get_a_size() << " or B: "
+       << B.extent(0) << " < " << handle.get_b_size() << " or C: "
+       << C.extent(0) << " < " << handle.get_c_size();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (handle.get_num_items() == 0) return 0;
+
+  Impl::BatchedGroupedGemmFunctor<ArgTransA, ArgTransB, HandleType, ScalarType,
+                                  AViewType, BViewType, CViewType>
+      functor(handle, alpha, A, B, beta, C);
+  Kokkos::parallel_for(
+      "KokkosBatched::BatchedGroupedGemm",
+      Kokkos::TeamPolicy<execution_space>(handle.get_num_items(),
+                                          handle.get_team_size()),
+      functor);
+  return 0;
+}
+
+// clang-format off
+/// \brief Non-blocking LU factorization without pivoting on a batch of square
+/// matrices of varying sizes.
+///
+///        A_p = L_p * U_p,  for every problem p
+///
+/// L_p (unit diagonal) and U_p overwrite A_p.
+///
+/// \tparam HandleType     Specifies the handle type of the grouped batch
+/// \tparam AViewType      Input/Output rank-1 view holding the packed A_p
+///                        matrices
+///
+/// \param handle [in]     A BatchedGroupedHandle built from the orders n(p);
+///                        throws if any of its problems is not square
+/// \param A [in/out]      Input/Output view of length at least
+///                        handle.get_a_size()
+/// \return 0 upon success, non-zero otherwise
+// clang-format on
+template <typename HandleType, typename AViewType>
+int BatchedGroupedLU(const HandleType &handle, const AViewType &A) {
+  using execution_space = typename HandleType::execution_space;
+  static_assert(AViewType::rank == 1,
+                "KokkosBatched::BatchedGroupedLU: A must be a rank 1 view.");
+  static_assert(
+      Kokkos::SpaceAccessibility<execution_space,
+                                 typename AViewType::memory_space>::accessible,
+      "KokkosBatched::BatchedGroupedLU: A must be accessible from the "
+      "execution space of the handle.");
+  if (A.extent(0) < handle.get_a_size()) {
+    std::ostringstream os;
+    os << "KokkosBatched::BatchedGroupedLU: the packed matrices are too "
+          "short: A: "
+       << A.extent(0) << " < " << handle.get_a_size();
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (handle.get_first_non_square() >= 0) {
+    std::ostringstream os;
+    os << "KokkosBatched::BatchedGroupedLU: every problem must be square, "
+          "problem "
+       << handle.get_first_non_square() << " is not";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (handle.get_num_items() == 0) return 0;
+
+  Impl::BatchedGroupedLUFunctor<HandleType, AViewType> functor(handle, A);
+  Kokkos::parallel_for(
+      "KokkosBatched::BatchedGroupedLU",
+      Kokkos::TeamPolicy<execution_space>(handle.get_num_items(),
+                                          handle.get_team_size()),
+      functor);
+  return 0;
+}
+}  // namespace KokkosBatched
+
+#endif  // __KOKKOSBATCHED_HOSTLEVEL_GROUPED_HPP__
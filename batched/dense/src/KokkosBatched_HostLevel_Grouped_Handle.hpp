@@ -0,0 +1,256 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_HOSTLEVEL_GROUPED_HANDLE_HPP__
+#define __KOKKOSBATCHED_HOSTLEVEL_GROUPED_HANDLE_HPP__
+
+#include <algorithm>
+#include <numeric>
+#include <sstream>
+#include <tuple>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+#include <KokkosBatched_Util.hpp>
+#include <KokkosKernels_Error.hpp>
+#include <KokkosKernels_ExecSpaceUtils.hpp>
+
+namespace KokkosBatched {
+
+/// \brief Kernels selected for the problems of a bin of a grouped batch
+struct GroupedKernel {
+  enum : int {
+    /// one problem per thread, unblocked algorithm
+    Serial = 0,
+    /// one problem per thread, register-blocked algorithm
+    SerialBlocked,
+    /// one problem per team, unblocked algorithm
+    Team
+  };
+};
+
+// clang-format off
+/// \brief Handle describing a batch of problems of varying sizes, for the
+/// grouped host-level interfaces BatchedGroupedGemm and BatchedGroupedLU.
+///
+/// Problem p is C_p = op(A_p) op(B_p) with C_p of dimension m(p) x n(p) and
+/// inner dimension k(p), or the LU factorization of an n(p) x n(p) matrix.
+/// The matrices are packed back to back in rank-1 views, in the CRS-like
+/// layout given by get_a_offsets(), get_b_offsets() and get_c_offsets():
+/// matrix p starts at offsets(p) and is stored row by row (LayoutRight). A_p is
+/// stored as m(p) x k(p) (k(p) x m(p) when transposed) and B_p as k(p) x n(p)
+/// (n(p) x k(p) when transposed).
+///
+/// On construction every problem is assigned the kernel that suits its size
+/// (see GroupedKernel): on GPUs, problems with at least teamThreshold
+/// multiply-adds get a team each, and smaller ones are spread one per thread;
+/// the register-blocked serial kernel is used when the problems fill its
+/// blocks. The problems are sorted by kernel and then by decreasing work, so
+/// problems of equal dimensions (a bin) are contiguous, and consecutive
+/// problems of the same kernel are cut into work items that may span several
+/// bins. All items run in a single launch. No problem is padded to the size
+/// of another one.
+///
+/// The handle only depends on the dimensions, so it should be built once and
+/// reused for every batch of the same shapes.
+///
+/// \tparam ExecutionSpace The execution space the grouped kernels run on
+///
+/// Usage Example:
+///   BatchedGroupedHandle<ExecutionSpace> handle(m, n, k);
+///   BatchedGroupedGemm<Trans::NoTranspose, Trans::NoTranspose>(handle,
+///                                                               alpha, A, B,
+///                                                               beta, C);
+// clang-format on
+template <class ExecutionSpace = Kokkos::DefaultExecutionSpace>
+class BatchedGroupedHandle {
+ public:
+  using execution_space = ExecutionSpace;
+  using memory_space    = typename execution_space::memory_space;
+  using ordinal_view_t  = Kokkos::View<int *, memory_space>;
+  using offset_view_t   = Kokkos::View<size_t *, memory_space>;
+  using host_dims_t     = Kokkos::View<const int *, Kokkos::HostSpace>;
+
+  /// \brief Handle for the gemm problems m(p) x n(p) x k(p)
+  /// \param teamThreshold [in] Minimum number of multiply-adds m * n * k of a
+  ///                           problem solved by a whole team (GPUs only)
+  BatchedGroupedHandle(const host_dims_t &m, const host_dims_t &n,
+                       const host_dims_t &k,
+                       const size_t teamThreshold = 32 * 32 * 32) {
+    if (m.extent(0) != n.extent(0) || m.extent(0) != k.extent(0)) {
+      std::ostringstream os;
+      os << "KokkosBatched::BatchedGroupedHandle: m, n and k must have the "
+            "same length, got "
+         << m.extent(0) << ", " << n.extent(0) << " and " << k.extent(0);
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    build(m, n, k, teamThreshold);
+  }
+
+  /// \brief Handle for the square problems n(p) x n(p), as for LU
+  explicit BatchedGroupedHandle(const host_dims_t &n,
+                                const size_t teamThreshold = 32 * 32 * 32) {
+    build(n, n, n, teamThreshold);
+  }
+
+  int get_num_problems() const { return _numProblems; }
+  /// First problem p with m(p), n(p) and k(p) not all equal, or -1 when every
+  /// problem is square
+  int get_first_non_square() const { return _firstNonSquare; }
+  int get_num_bins() const { return _numBins; }
+  int get_num_items() const { return _itemBegin.extent_int(0); }
+  int get_team_size() const { return _teamSize; }
+
+  /// Lengths of the packed arrays of A, B and C
+  size_t get_a_size() const { return _aSize; }
+  size_t get_b_size() const { return _bSize; }
+  size_t get_c_size() const { return _cSize; }
+
+  ordinal_view_t get_m() const { return _m; }
+  ordinal_view_t get_n() const { return _n; }
+  ordinal_view_t get_k() const { return _k; }
+  offset_view_t get_a_offsets() const { return _aOffsets; }
+  offset_view_t get_b_offsets() const { return _bOffsets; }
+  offset_view_t get_c_offsets() const { return _cOffsets; }
+
+  /// Problems sorted by bin, and the work items: item i solves the problems
+  /// perm(item_begin(i) : item_begin(i) + item_count(i)) with the kernel
+  /// item_kernel(i)
+  ordinal_view_t get_perm() const { return _perm; }
+  ordinal_view_t get_item_begin() const { return _itemBegin; }
+  ordinal_view_t get_item_count() const { return _itemCount; }
+  ordinal_view_t get_item_kernel() const { return _itemKernel; }
+
+ private:
+  void build(const host_dims_t &m, const host_dims_t &n, const host_dims_t &k,
+             const size_t teamThreshold) {
+    constexpr bool on_gpu =
+        KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>();
+    // threads per team, and problems per team for the serial kernels
+    _teamSize                 = on_gpu ? 64 : 1;
+    const int problemsPerTeam = on_gpu ? _teamSize : 16;
+
+    _numProblems = m.extent(0);
+    auto work    = [&](int p) { return size_t(m(p)) * n(p) * k(p); };
+
+    // CRS-like offsets of the packed matrices
+    _aOffsets = offset_view_t("BatchedGroupedHandle::aOffsets",
+                              _numProblems + 1);
+    _bOffsets = offset_view_t("BatchedGroupedHandle::bOffsets",
+                              _numProblems + 1);
+    _cOffsets = offset_view_t("BatchedGroupedHandle::cOffsets",
+                              _numProblems + 1);
+
+    auto aOffsets = Kokkos::create_mirror_view(_aOffsets);
+    auto bOffsets = Kokkos::create_mirror_view(_bOffsets);
+    auto cOffsets = Kokkos::create_mirror_view(_cOffsets);
+
+    aOffsets(0) = bOffsets(0) = cOffsets(0) = 0;
+    for (int p = 0; p < _numProblems; ++p) {
+      if (m(p) < 0 || n(p) < 0 || k(p) < 0) {
+        std::ostringstream os;
+        os << "KokkosBatched::BatchedGroupedHandle: problem " << p
+           << " has negative dimensions";
+        KokkosKernels::Impl::throw_runtime_exception(os.str());
+      }
+      if (_firstNonSquare < 0 && (m(p) != n(p) || k(p) != n(p)))
+        _firstNonSquare = p;
+      aOffsets(p + 1) = aOffsets(p) + size_t(m(p)) * k(p);
+      bOffsets(p + 1) = bOffsets(p) + size_t(k(p)) * n(p);
+      cOffsets(p + 1) = cOffsets(p) + size_t(m(p)) * n(p);
+    }
+    _aSize = aOffsets(_numProblems);
+    _bSize = bOffsets(_numProblems);
+    _cSize = cOffsets(_numProblems);
+
+    auto kernel = [&](int p) {
+      if (on_gpu && work(p) >= teamThreshold) return int(GroupedKernel::Team);
+      if (std::min(m(p), n(p)) >= Algo::Gemm::Blocked::mb())
+        return int(GroupedKernel::SerialBlocked);
+      return int(GroupedKernel::Serial);
+    };
+    // team problems first, then the largest problems first within a kernel
+    auto kernel_rank = [&](int p) {
+      const int kp = kernel(p);
+      return kp == GroupedKernel::Team            ? 0
+             : kp == GroupedKernel::SerialBlocked ? 1
+                                                  : 2;
+    };
+    std::vector<int> order(_numProblems);
+    std::iota(order.begin(), order.end(), 0);
+    auto key = [&](int p) {
+      return std::make_tuple(kernel_rank(p), -int64_t(work(p)), m(p), n(p),
+                             k(p));
+    };
+    std::stable_sort(order.begin(), order.end(),
+                     [&](int p, int q) { return key(p) < key(q); });
+
+    // bins of equal dimensions are contiguous in order
+    _numBins = 0;
+    for (int i = 0; i < _numProblems; ++i)
+      if (i == 0 || key(order[i]) != key(order[i - 1])) ++_numBins;
+
+    // chunks of problems with the same kernel, across bins
+    std::vector<int> itemBegin, itemCount, itemKernel;
+    for (int first = 0; first < _numProblems;) {
+      const int kp = kernel(order[first]);
+      int last     = first + 1;
+      while (last < _numProblems && kernel(order[last]) == kp) ++last;
+
+      const int chunk = kp == GroupedKernel::Team ? 1 : problemsPerTeam;
+      for (int i = first; i < last; i += chunk) {
+        itemBegin.push_back(i);
+        itemCount.push_back(std::min(chunk, last - i));
+        itemKernel.push_back(kp);
+      }
+      first = last;
+    }
+
+    auto to_device = [](const std::vector<int> &v, const char *label) {
+      ordinal_view_t d(label, v.size());
+      auto h = Kokkos::create_mirror_view(d);
+      for (size_t i = 0; i < v.size(); ++i) h(i) = v[i];
+      Kokkos::deep_copy(d, h);
+      return d;
+    };
+    std::vector<int> hm(m.data(), m.data() + _numProblems),
+        hn(n.data(), n.data() + _numProblems),
+        hk(k.data(), k.data() + _numProblems);
+    _m          = to_device(hm, "BatchedGroupedHandle::m");
+    _n          = to_device(hn, "BatchedGroupedHandle::n");
+    _k          = to_device(hk, "BatchedGroupedHandle::k");
+    _perm       = to_device(order, "BatchedGroupedHandle::perm");
+    _itemBegin  = to_device(itemBegin, "BatchedGroupedHandle::itemBegin");
+    _itemCount  = to_device(itemCount, "BatchedGroupedHandle::itemCount");
+    _itemKernel = to_device(itemKernel, "BatchedGroupedHandle::itemKernel");
+    Kokkos::deep_copy(_aOffsets, aOffsets);
+    Kokkos::deep_copy(_bOffsets, bOffsets);
+    Kokkos::deep_copy(_cOffsets, cOffsets);
+  }
+
+  int _numProblems    = 0;
+  int _numBins        = 0;
+  int _teamSize       = 1;
+  int _firstNonSquare = -1;
+  size_t _aSize       = 0, _bSize = 0, _cSize = 0;
+  ordinal_view_t _m, _n, _k;
+  offset_view_t _aOffsets, _bOffsets, _cOffsets;
+  ordinal_view_t _perm;
+  ordinal_view_t _itemBegin, _itemCount, _itemKernel;
+};
+
+}  // namespace KokkosBatched
+
+#endif  // __KOKKOSBATCHED_HOSTLEVEL_GROUPED_HANDLE_HPP__
@@ -0,0 +1,226 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_TRIDIAG_HPP__
+#define __KOKKOSBATCHED_TRIDIAG_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+struct Tridiag {
+  struct Thomas {};
+  struct CyclicReduction {};
+
+  using Default = Thomas;
+};
+
+/// \brief Serial Batched PTTRF:
+///
+/// Compute the L D L^T factorization of a symmetric positive definite
+/// tridiagonal matrix A_l for all l = 0, ..., N.
+///
+/// \tparam DViewType: Input type for the diagonal, needs to be a 1D view
+/// \tparam EViewType: Input type for the off-diagonal, needs to be a 1D view
+///
+/// \param d [in/out]: on input the n diagonal entries of A, on output the
+/// diagonal of D
+/// \param e [in/out]: on input the n-1 sub-diagonal entries of A, on output
+/// the sub-diagonal of the unit bidiagonal factor L
+///
+/// No pivoting is performed and positivity of the pivots is not checked, so
+/// that the routine can be used with SIMD value types.
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+struct SerialPttrf {
+  template <typename DViewType, typename EViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DViewType &d,
+                                           const EViewType &e);
+};
+
+/// \brief Serial Batched PTTRS:
+///
+/// Solve A_l x_l = b_l for all l = 0, ..., N using the factorization
+/// computed by SerialPttrf.
+///
+/// \tparam DViewType: Input type for the diagonal, needs to be a 1D view
+/// \tparam EViewType: Input type for the off-diagonal, needs to be a 1D view
+/// \tparam BViewType: Input type for the right-hand side and the solution,
+/// needs to be a 1D view
+///
+/// \param d [in]: diagonal of D computed by SerialPttrf
+/// \param e [in]: sub-diagonal of L computed by SerialPttrf
+/// \param b [in/out]: on input the right-hand side, on output the solution
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+struct SerialPttrs {
+  template <typename DViewType, typename EViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DViewType &d,
+                                           const EViewType &e,
+                                           const BViewType &b);
+};
+
+/// \brief Serial Batched GTTRF:
+///
+/// Compute the L U factorization of a general tridiagonal matrix A_l for all
+/// l = 0, ..., N using the Thomas algorithm.
+///
+/// \tparam DLViewType: Input type for the sub-diagonal, needs to be a 1D view
+/// \tparam DViewType: Input type for the diagonal, needs to be a 1D view
+/// \tparam DUViewType: Input type for the super-diagonal, needs to be a 1D
+/// view
+///
+/// \param dl [in/out]: on input the n-1 sub-diagonal entries of A, on output
+/// the multipliers defining the unit lower bidiagonal factor L
+/// \param d [in/out]: on input the n diagonal entries of A, on output the
+/// diagonal of U
+/// \param du [in]: the n-1 super-diagonal entries of A, which are also the
+/// super-diagonal of U
+///
+/// No pivoting is performed; the matrix is expected to be diagonally
+/// dominant or otherwise stable without pivoting, as is the case for the
+/// line systems of implicit smoothers.
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+struct SerialGttrf {
+  template <typename DLViewType, typename DViewType, typename DUViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du);
+};
+
+/// \brief Serial Batched GTTRS:
+///
+/// Solve A_l x_l = b_l or A_l^T x_l = b_l for all l = 0, ..., N using the
+/// factorization computed by SerialGttrf.
+///
+/// \tparam ArgTrans: Trans::NoTranspose or Trans::Transpose
+///
+/// \param dl [in]: multipliers computed by SerialGttrf
+/// \param d [in]: diagonal of U computed by SerialGttrf
+/// \param du [in]: super-diagonal of U
+/// \param b [in/out]: on input the right-hand side, on output the solution, a
+/// rank 1 view
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+template <typename ArgTrans>
+struct SerialGttrs {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b);
+};
+
+/// \brief Team Batched GTTRS:
+///
+/// Solve A_l X_l = B_l or A_l^T X_l = B_l for all l = 0, ..., N using the
+/// factorization computed by SerialGttrf, for multiple right-hand sides.
+///
+/// \param member [in]: TeamPolicy member
+/// \param dl [in]: multipliers computed by SerialGttrf
+/// \param d [in]: diagonal of U computed by SerialGttrf
+/// \param du [in]: super-diagonal of U
+/// \param B [in/out]: on input the right-hand sides, on output the solutions,
+/// a rank 2 view of dimension n x nrhs
+///
+/// The right-hand sides are distributed over the team with TeamThreadRange.
+///
+
+template <typename MemberType, typename ArgTrans>
+struct TeamGttrs {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &B);
+};
+
+/// \brief Serial Batched GTSV:
+///
+/// Solve A_l x_l = b_l for all l = 0, ..., N where A_l is a general
+/// tridiagonal matrix.
+///
+/// \param dl [in/out]: sub-diagonal of A, n-1 entries, overwritten
+/// \param d [in/out]: diagonal of A, n entries, overwritten
+/// \param du [in/out]: super-diagonal of A, n-1 entries, overwritten
+/// \param b [in/out]: on input the right-hand side, on output the solution
+///
+/// Only Tridiag::Thomas is available; it is a SerialGttrf followed by a
+/// SerialGttrs.
+///
+/// No nested parallel_for is used inside of the function.
+///
+
+template <typename ArgAlgo>
+struct SerialGtsv {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b);
+};
+
+/// \brief Team Batched GTSV:
+///
+/// Solve A_l x_l = b_l for all l = 0, ..., N where A_l is a general
+/// tridiagonal matrix.
+///
+/// \param member [in]: TeamPolicy member
+/// \param dl [in/out]: sub-diagonal of A, n-1 entries, overwritten
+/// \param d [in/out]: diagonal of A, n entries, overwritten
+/// \param du [in/out]: super-diagonal of A, n-1 entries, overwritten
+/// \param b [in/out]: on input the right-hand side, on output the solution
+///
+/// Two versions are available (those are chosen based on ArgAlgo):
+///
+///   1. Thomas: the sequential Thomas algorithm executed by a single thread
+///      of the team; this is the right choice when the team is already
+///      busy with other systems or n is small,
+///   2. CyclicReduction: log2(n) levels of odd-even reduction followed by
+///      log2(n) levels of back substitution; the rows of each level are
+///      distributed over the team with TeamThreadRange and the levels are
+///      separated by team barriers.
+///
+
+template <typename MemberType, typename ArgAlgo>
+struct TeamGtsv {
+  template <typename DLViewType, typename DViewType, typename DUViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const DLViewType &dl,
+                                           const DViewType &d,
+                                           const DUViewType &du,
+                                           const BViewType &b);
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_Tridiag_Impl.hpp"
+
+#endif
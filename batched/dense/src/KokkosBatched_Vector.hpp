@@ -40,6 +40,9 @@ struct DefaultVectorLength<float, Kokkos::HostSpace> {
   enum : int{value = 16};
 #elif defined(__AVX__) || defined(__AVX2__)
   enum : int{value = 8};
+#elif defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+    (__ARM_FEATURE_SVE_BITS >= 256)
+  enum : int{value = __ARM_FEATURE_SVE_BITS / 32};
 #elif defined(__ARM_ARCH)
   enum : int{value = 8};
 #else
@@ -52,6 +55,9 @@ struct DefaultVectorLength<double, Kokkos::HostSpace> {
   enum : int{value = 8};
 #elif defined(__AVX__) || defined(__AVX2__)
   enum : int{value = 4};
+#elif defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS) && \
+    (__ARM_FEATURE_SVE_BITS >= 256)
+  enum : int{value = __ARM_FEATURE_SVE_BITS / 64};
 #elif defined(__ARM_ARCH)
   enum : int{value = 4};
 #else
@@ -24,9 +24,22 @@
 
 #if defined(__CUDA_ARCH__) || defined(__HIP_DEVICE_COMPILE__)
 #undef __KOKKOSBATCHED_ENABLE_AVX__
+#undef __KOKKOSBATCHED_ENABLE_NEON__
+#undef __KOKKOSBATCHED_ENABLE_SVE__
 #else
 // compiler bug with AVX in some architectures
 #define __KOKKOSBATCHED_ENABLE_AVX__
+// sve intrinsics are only used with a fixed vector length
+// (-msve-vector-bits) so that the vector can be a class member
+#if defined(__ARM_FEATURE_SVE) && defined(__ARM_FEATURE_SVE_BITS)
+#if (__ARM_FEATURE_SVE_BITS >= 256)
+#define __KOKKOSBATCHED_ENABLE_SVE__
+#endif
+#endif
+#if defined(__ARM_NEON) && defined(__aarch64__) && \
+    !defined(__KOKKOSBATCHED_ENABLE_SVE__)
+#define __KOKKOSBATCHED_ENABLE_NEON__
+#endif
 #endif
 
 namespace KokkosBatched {
@@ -88,6 +101,20 @@ class Vector<SIMD<T>, l> {
   KOKKOS_INLINE_FUNCTION
   void storeUnaligned(value_type *p) const { storeAligned(p); }
 
+  /// partial load/store of the first n entries e.g., the remainder of a batch
+  /// that is not a multiple of the vector length; the rest is zero-filled
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      _data[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = _data[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const { return _data[i]; }
 };
@@ -182,6 +209,18 @@ class Vector<SIMD<float>, 2> {
     *(p + 1) = _data.y;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
@@ -274,6 +313,18 @@ class Vector<SIMD<double>, 2> {
     *(p + 1) = _data.y;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
@@ -388,6 +439,18 @@ class Vector<SIMD<float>, 4> {
     *(p + 3) = _data.w;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
@@ -502,6 +565,18 @@ class Vector<SIMD<double>, 4> {
     *(p + 3) = _data.w;
   }
 
+  KOKKOS_INLINE_FUNCTION
+  type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
   KOKKOS_INLINE_FUNCTION
   value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
@@ -535,6 +610,10 @@ class Vector<SIMD<double>, 4> {
  private:
   mutable data_type _data;
 
+  inline static __m256i mask(const int n) {
+    return _mm256_set_epi64x(-(n > 3), -(n > 2), -(n > 1), -(n > 0));
+  }
+
  public:
   inline Vector() { _data = _mm256_setzero_pd(); }
   inline Vector(const value_type &val) { _data = _mm256_set1_pd(val); }
@@ -579,6 +658,15 @@ class Vector<SIMD<double>, 4> {
     _mm256_storeu_pd(p, _data);
   }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm256_maskload_pd(p, mask(n));
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    _mm256_maskstore_pd(p, mask(n), _data);
+  }
+
   inline value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
   }
@@ -602,6 +690,10 @@ class Vector<SIMD<Kokkos::complex<double> >, 2> {
  private:
   mutable data_type _data;
 
+  inline static __m256i mask(const int n) {
+    return _mm256_set_epi64x(-(n > 1), -(n > 1), -(n > 0), -(n > 0));
+  }
+
  public:
   inline Vector() { _data = _mm256_setzero_pd(); }
   inline Vector(const value_type &val) {
@@ -660,6 +752,15 @@ class Vector<SIMD<Kokkos::complex<double> >, 2> {
     _mm256_storeu_pd((mag_type *)p, _data);
   }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm256_maskload_pd((mag_type *)p, mask(n));
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    _mm256_maskstore_pd((mag_type *)p, mask(n), _data);
+  }
+
   inline value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
   }
@@ -690,6 +791,10 @@ class Vector<SIMD<double>, 8> {
  private:
   mutable data_type _data;
 
+  inline static __mmask8 mask(const int n) {
+    return n < vector_length ? __mmask8((1u << n) - 1) : __mmask8(0xff);
+  }
+
  public:
   inline Vector() { _data = _mm512_setzero_pd(); }
   inline Vector(const value_type &val) { _data = _mm512_set1_pd(val); }
@@ -733,6 +838,15 @@ class Vector<SIMD<double>, 8> {
     _mm512_storeu_pd(p, _data);
   }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_pd(mask(n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    _mm512_mask_storeu_pd(p, mask(n), _data);
+  }
+
   inline value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
   }
@@ -756,6 +870,10 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
  private:
   mutable data_type _data;
 
+  inline static __mmask8 mask(const int n) {
+    return n < vector_length ? __mmask8((1u << (2 * n)) - 1) : __mmask8(0xff);
+  }
+
  public:
   inline Vector() { _data = _mm512_setzero_pd(); }
   inline Vector(const value_type &val) {
@@ -810,6 +928,184 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
     _mm512_storeu_pd((mag_type *)p, _data);
   }
 
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_pd(mask(n), (mag_type *)p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    _mm512_mask_storeu_pd((mag_type *)p, mask(n), _data);
+  }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+
+template <>
+class Vector<SIMD<float>, 16> {
+ public:
+  using type       = Vector<SIMD<float>, 16>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 16 };
+  typedef __m512 data_type __attribute__((aligned(64)));
+
+  inline static const char *label() { return "AVX512"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+  inline static __mmask16 mask(const int n) {
+    return n < vector_length ? __mmask16((1u << n) - 1) : __mmask16(0xffff);
+  }
+
+ public:
+  inline Vector() { _data = _mm512_setzero_ps(); }
+  inline Vector(const value_type &val) { _data = _mm512_set1_ps(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const __m512 &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const __m512 &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator __m512() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = _mm512_load_ps(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = _mm512_loadu_ps(p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const { _mm512_store_ps(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const {
+    _mm512_storeu_ps(p, _data);
+  }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_ps(mask(n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    _mm512_mask_storeu_ps(p, mask(n), _data);
+  }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+
+template <>
+class Vector<SIMD<Kokkos::complex<float> >, 8> {
+ public:
+  using type       = Vector<SIMD<Kokkos::complex<float> >, 8>;
+  using value_type = Kokkos::complex<float>;
+  using mag_type   = float;
+
+  enum : int { vector_length = 8 };
+  typedef __m512 data_type __attribute__((aligned(64)));
+
+  inline static const char *label() { return "AVX512"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+  inline static __mmask16 mask(const int n) {
+    return n < vector_length ? __mmask16((1u << (2 * n)) - 1)
+                             : __mmask16(0xffff);
+  }
+
+ public:
+  inline Vector() { _data = _mm512_setzero_ps(); }
+  inline Vector(const value_type &val) {
+    _data = _mm512_mask_blend_ps(0xAAAA, _mm512_set1_ps(val.real()),
+                                 _mm512_set1_ps(val.imag()));
+    KOKKOSKERNELS_GNU_COMPILER_FENCE
+  }
+  inline Vector(const mag_type &val) {
+    _data = _mm512_maskz_mov_ps(0x5555, _mm512_set1_ps(val));
+    KOKKOSKERNELS_GNU_COMPILER_FENCE
+  }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const __m512 &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<value_type *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const __m512 &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator __m512() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = _mm512_load_ps((mag_type *)p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) {
+    _data = _mm512_loadu_ps((mag_type *)p);
+    return *this;
+  }
+
+  inline void storeAligned(value_type *p) const {
+    _mm512_store_ps((mag_type *)p, _data);
+  }
+
+  inline void storeUnaligned(value_type *p) const {
+    _mm512_storeu_ps((mag_type *)p, _data);
+  }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = _mm512_maskz_loadu_ps(mask(n), (mag_type *)p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    _mm512_mask_storeu_ps((mag_type *)p, mask(n), _data);
+  }
+
   inline value_type &operator[](const int &i) const {
     return reinterpret_cast<value_type *>(&_data)[i];
   }
@@ -819,6 +1115,322 @@ class Vector<SIMD<Kokkos::complex<double> >, 4> {
 #endif /* #if defined(__AVX512F__) */
 #endif /* #if defined(__KOKKOSBATCHED_ENABLE_AVX__) */
 
+#if defined(__KOKKOSBATCHED_ENABLE_NEON__)
+#include <arm_neon.h>
+
+namespace KokkosBatched {
+
+template <>
+class Vector<SIMD<double>, 4> {
+ public:
+  using type       = Vector<SIMD<double>, 4>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = 4 };
+  typedef float64x2x2_t data_type;
+
+  inline static const char *label() { return "NEON"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() {
+    _data.val[0] = vdupq_n_f64(0);
+    _data.val[1] = vdupq_n_f64(0);
+  }
+  inline Vector(const value_type &val) {
+    _data.val[0] = vdupq_n_f64(val);
+    _data.val[1] = vdupq_n_f64(val);
+  }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float64x2x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float64x2x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float64x2x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = vld1q_f64_x2(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const { vst1q_f64_x2(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+
+template <>
+class Vector<SIMD<float>, 8> {
+ public:
+  using type       = Vector<SIMD<float>, 8>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = 8 };
+  typedef float32x4x2_t data_type;
+
+  inline static const char *label() { return "NEON"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() {
+    _data.val[0] = vdupq_n_f32(0);
+    _data.val[1] = vdupq_n_f32(0);
+  }
+  inline Vector(const value_type &val) {
+    _data.val[0] = vdupq_n_f32(val);
+    _data.val[1] = vdupq_n_f32(val);
+  }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const float32x4x2_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const float32x4x2_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator float32x4x2_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = vld1q_f32_x2(p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const { vst1q_f32_x2(p, _data); }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    for (int i = 0; i < vector_length; ++i)
+      (*this)[i] = i < n ? p[i] : value_type(0);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    for (int i = 0; i < vector_length && i < n; ++i) p[i] = (*this)[i];
+  }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+}  // namespace KokkosBatched
+
+#endif /* #if defined(__KOKKOSBATCHED_ENABLE_NEON__) */
+
+#if defined(__KOKKOSBATCHED_ENABLE_SVE__)
+#include <arm_sve.h>
+
+namespace KokkosBatched {
+
+template <>
+class Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64> {
+ public:
+  using type       = Vector<SIMD<double>, __ARM_FEATURE_SVE_BITS / 64>;
+  using value_type = double;
+  using mag_type   = double;
+
+  enum : int { vector_length = __ARM_FEATURE_SVE_BITS / 64 };
+  typedef svfloat64_t data_type
+      __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f64(0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f64(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const svfloat64_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const svfloat64_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator svfloat64_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f64(svptrue_b64(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    svst1_f64(svptrue_b64(), p, _data);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = svld1_f64(svwhilelt_b64(0, n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    svst1_f64(svwhilelt_b64(0, n), p, _data);
+  }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+
+template <>
+class Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32> {
+ public:
+  using type       = Vector<SIMD<float>, __ARM_FEATURE_SVE_BITS / 32>;
+  using value_type = float;
+  using mag_type   = float;
+
+  enum : int { vector_length = __ARM_FEATURE_SVE_BITS / 32 };
+  typedef svfloat32_t data_type
+      __attribute__((arm_sve_vector_bits(__ARM_FEATURE_SVE_BITS)));
+
+  inline static const char *label() { return "SVE"; }
+
+  template <typename, int>
+  friend class Vector;
+
+ private:
+  mutable data_type _data;
+
+ public:
+  inline Vector() { _data = svdup_n_f32(0); }
+  inline Vector(const value_type &val) { _data = svdup_n_f32(val); }
+  inline Vector(const type &b) { _data = b._data; }
+  inline Vector(const svfloat32_t &val) { _data = val; }
+
+  template <typename ArgValueType>
+  inline Vector(const ArgValueType &val) {
+    auto d = reinterpret_cast<value_type *>(&_data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) d[i] = val;
+  }
+  template <typename ArgValueType>
+  inline Vector(const Vector<SIMD<ArgValueType>, vector_length> &b) {
+    auto dd = reinterpret_cast<value_type *>(&_data);
+    auto bb = reinterpret_cast<ArgValueType *>(&b._data);
+    KOKKOSKERNELS_FORCE_SIMD
+    for (int i = 0; i < vector_length; ++i) dd[i] = bb[i];
+  }
+
+  inline type &operator=(const svfloat32_t &val) {
+    _data = val;
+    return *this;
+  }
+
+  inline operator svfloat32_t() const { return _data; }
+
+  inline type &loadAligned(const value_type *p) {
+    _data = svld1_f32(svptrue_b32(), p);
+    return *this;
+  }
+
+  inline type &loadUnaligned(const value_type *p) { return loadAligned(p); }
+
+  inline void storeAligned(value_type *p) const {
+    svst1_f32(svptrue_b32(), p, _data);
+  }
+
+  inline void storeUnaligned(value_type *p) const { storeAligned(p); }
+
+  inline type &loadUnaligned(const value_type *p, const int n) {
+    _data = svld1_f32(svwhilelt_b32(0, n), p);
+    return *this;
+  }
+
+  inline void storeUnaligned(value_type *p, const int n) const {
+    svst1_f32(svwhilelt_b32(0, n), p, _data);
+  }
+
+  inline value_type &operator[](const int &i) const {
+    return reinterpret_cast<value_type *>(&_data)[i];
+  }
+};
+}  // namespace KokkosBatched
+
+#endif /* #if defined(__KOKKOSBATCHED_ENABLE_SVE__) */
+
 #include "KokkosBatched_Vector_SIMD_Arith.hpp"
 #include "KokkosBatched_Vector_SIMD_Logical.hpp"
 #include "KokkosBatched_Vector_SIMD_Relation.hpp"
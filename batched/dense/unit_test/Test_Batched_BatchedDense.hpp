@@ -0,0 +1,175 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_HostLevel_Dense.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace BatchedDense {
+
+/// A_k = M_k M_k^T + n I, symmetric positive definite and diagonally dominant
+template <typename DeviceType, typename ValueType>
+Kokkos::View<ValueType ***, DeviceType> make_spd(const int N, const int n) {
+  using execution_space = typename DeviceType::execution_space;
+  Kokkos::View<ValueType ***, DeviceType> M("M", N, n, n), A("A", N, n, n);
+  Kokkos::Random_XorShift64_Pool<execution_space> random(13718);
+  Kokkos::fill_random(M, random, ValueType(1.0));
+  auto h_M = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), M);
+  auto h_A = Kokkos::create_mirror_view(A);
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < n; ++j) {
+        ValueType sum = i == j ? ValueType(n) : ValueType(0);
+        for (int l = 0; l < n; ++l) sum += h_M(k, i, l) * h_M(k, j, l);
+        h_A(k, i, j) = sum;
+      }
+  Kokkos::deep_copy(A, h_A);
+  return A;
+}
+
+template <typename DeviceType, typename ValueType>
+void impl_test_batched_cholesky(BatchedDenseHandle *handle, const int N,
+                                const int n) {
+  using ats      = Kokkos::ArithTraits<ValueType>;
+  using mag_type = typename ats::mag_type;
+
+  auto A    = make_spd<DeviceType, ValueType>(N, n);
+  auto h_A0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+
+  BatchedCholesky(handle, A);
+  Kokkos::fence();
+  auto h_L = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+
+  // the lower triangle of L L^T matches A
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j <= i; ++j) {
+        ValueType sum = 0;
+        for (int l = 0; l <= j; ++l) sum += h_L(k, i, l) * h_L(k, j, l);
+        EXPECT_NEAR_KK(sum, h_A0(k, i, j), eps * n * n);
+      }
+}
+
+template <typename DeviceType, typename ValueType, typename ArgTrans>
+void impl_test_batched_lu_solve(BatchedDenseHandle *handle, const int N,
+                                const int n) {
+  using execution_space = typename DeviceType::execution_space;
+  using ats             = Kokkos::ArithTraits<ValueType>;
+  using mag_type        = typename ats::mag_type;
+  using view_type       = Kokkos::View<ValueType ***, DeviceType>;
+
+  const bool trans = std::is_same<ArgTrans, Trans::Transpose>::value;
+  const int nrhs   = 2;
+
+  // diagonally dominant, LU does not pivot
+  view_type A("A", N, n, n), X("X", N, n, nrhs), B("B", N, n, nrhs);
+  Kokkos::Random_XorShift64_Pool<execution_space> random(13718);
+  Kokkos::fill_random(A, random, ValueType(1.0));
+  Kokkos::fill_random(X, random, ValueType(1.0));
+  auto h_A = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto h_X = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), X);
+  auto h_B = Kokkos::create_mirror_view(B);
+  for (int k = 0; k < N; ++k) {
+    for (int i = 0; i < n; ++i) h_A(k, i, i) += ValueType(n);
+    for (int i = 0; i < n; ++i)
+      for (int r = 0; r < nrhs; ++r) {
+        ValueType sum = 0;
+        for (int j = 0; j < n; ++j)
+          sum += (trans ? h_A(k, j, i) : h_A(k, i, j)) * h_X(k, j, r);
+        h_B(k, i, r) = sum;
+      }
+  }
+  Kokkos::deep_copy(A, h_A);
+  Kokkos::deep_copy(B, h_B);
+
+  BatchedLU(handle, A);
+  BatchedSolveLU<ArgTrans>(handle, A, B);
+  Kokkos::fence();
+  Kokkos::deep_copy(h_B, B);
+
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < n; ++i)
+      for (int r = 0; r < nrhs; ++r)
+        EXPECT_NEAR_KK(h_B(k, i, r), h_X(k, i, r), eps * n);
+}
+
+template <typename DeviceType, typename ValueType>
+void impl_test_batched_trsm(BatchedDenseHandle *handle, const int N,
+                            const int n) {
+  using ats      = Kokkos::ArithTraits<ValueType>;
+  using mag_type = typename ats::mag_type;
+
+  // the Cholesky factors are well conditioned lower triangular matrices
+  auto A = make_spd<DeviceType, ValueType>(N, n);
+  BatchedCholesky(handle, A);
+  Kokkos::View<ValueType ***, DeviceType> B("B", N, n, 3);
+  Kokkos::Random_XorShift64_Pool<typename DeviceType::execution_space> random(
+      13718);
+  Kokkos::fill_random(B, random, ValueType(1.0));
+  Kokkos::fence();
+  auto h_B0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+
+  const ValueType alpha = 1.5;
+  BatchedTrsm<Side::Left, Uplo::Lower, Trans::NoTranspose, Diag::NonUnit>(
+      handle, alpha, A, B);
+  Kokkos::fence();
+  auto h_L = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto h_X = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (int k = 0; k < N; ++k)
+    for (int i = 0; i < n; ++i)
+      for (int r = 0; r < 3; ++r) {
+        ValueType sum = 0;
+        for (int l = 0; l <= i; ++l) sum += h_L(k, i, l) * h_X(k, l, r);
+        EXPECT_NEAR_KK(sum, alpha * h_B0(k, i, r), eps * n);
+      }
+}
+
+}  // namespace BatchedDense
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType>
+int test_batched_dense() {
+  const int algos[] = {BaseHeuristicAlgos::SQUARE,
+                       BaseKokkosBatchedAlgos::KK_SERIAL,
+                       DenseKokkosBatchedAlgos::KK_TEAM};
+  for (const int algo : algos) {
+    BatchedDenseHandle handle(algo);
+    // unblocked, register-blocked and (on GPUs) team-sized matrices
+    for (const int n : {3, 8, 20}) {
+      Test::BatchedDense::impl_test_batched_cholesky<DeviceType, ValueType>(
+          &handle, 10, n);
+      Test::BatchedDense::impl_test_batched_lu_solve<DeviceType, ValueType,
+                                                     Trans::NoTranspose>(
+          &handle, 10, n);
+      Test::BatchedDense::impl_test_batched_lu_solve<DeviceType, ValueType,
+                                                     Trans::Transpose>(
+          &handle, 10, n);
+      Test::BatchedDense::impl_test_batched_trsm<DeviceType, ValueType>(
+          &handle, 10, n);
+    }
+  }
+  return 0;
+}
@@ -13,6 +13,8 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //@HEADER
+#include <array>
+
 #include "gtest/gtest.h"
 #include "Kokkos_Core.hpp"
 #include "Kokkos_Random.hpp"
@@ -257,7 +259,9 @@ void impl_test_batched_gemm(const int N, const int matAdim1, const int matAdim2,
                                              ParamTagType>(
               &batchedGemmHandle, N, matAdim1, matAdim2, matBdim1, matBdim2,
               matCdim1, matCdim2, 1.5, 3.0);
-        } else if (algo_type == BaseHeuristicAlgos::SQUARE) {
+        } else if (algo_type == BaseHeuristicAlgos::SQUARE ||
+                   algo_type == BaseHeuristicAlgos::TALL ||
+                   algo_type == BaseHeuristicAlgos::WIDE) {
           // Invoke 4 times to ensure we cover all paths for alpha and beta
           impl_test_batched_gemm_with_handle<DeviceType, ViewType, ScalarType,
                                              ParamTagType>(
@@ -332,11 +336,19 @@ void test_batched_gemm_with_layout(int N) {
                                  ParamTagType>(N, i, i, i, i, i, i);
   }
 
-  // Non-square cases
-  for (int i = 1; i < 5; ++i) {
-    int dimM = 1 * i;
-    int dimN = 2 * i;
-    int dimK = 3 * i;
+  // Non-square cases: M x N x K
+  std::vector<std::array<int, 3>> shapes;
+  for (int i = 1; i < 5; ++i) shapes.push_back({1 * i, 2 * i, 3 * i});
+  // Skinny cases for the TALL and WIDE heuristics, with and without a
+  // remainder in the k loop
+  for (int k : {8, 12}) {
+    shapes.push_back({64, 8, k});
+    shapes.push_back({8, 64, k});
+  }
+  for (const auto& shape : shapes) {
+    int dimM = shape[0];
+    int dimN = shape[1];
+    int dimK = shape[2];
     if ((std::is_same<typename ParamTagType::transA,
                       KokkosBatched::Trans::NoTranspose>::value) &&
         (std::is_same<typename ParamTagType::transB,
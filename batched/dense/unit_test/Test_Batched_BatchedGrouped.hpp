@@ -0,0 +1,205 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include <algorithm>
+#include <cstdlib>
+
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+
+#include "KokkosBatched_HostLevel_Grouped.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace BatchedGrouped {
+
+template <typename TA, typename TB>
+struct ParamTag {
+  typedef TA transA;
+  typedef TB transB;
+};
+
+/// random mix of small, register-blocked and (on GPUs) team-sized problems
+inline Kokkos::View<int *, Kokkos::HostSpace> random_dims(const int N,
+                                                          const int seed) {
+  const int sizes[] = {1, 3, 5, 8, 33};
+  Kokkos::View<int *, Kokkos::HostSpace> dims("dims", N);
+  std::srand(seed);
+  for (int p = 0; p < N; ++p) dims(p) = sizes[std::rand() % 5];
+  return dims;
+}
+
+template <typename DeviceType, typename ValueType, typename ParamTagType>
+void impl_test_batched_grouped_gemm(const int N) {
+  using execution_space = typename DeviceType::execution_space;
+  using transA          = typename ParamTagType::transA;
+  using transB          = typename ParamTagType::transB;
+  using ats             = Kokkos::ArithTraits<ValueType>;
+  using mag_type        = typename ats::mag_type;
+  using view_type       = Kokkos::View<ValueType *, DeviceType>;
+
+  const bool tA = std::is_same<transA, Trans::Transpose>::value;
+  const bool tB = std::is_same<transB, Trans::Transpose>::value;
+
+  auto m = random_dims(N, 13718);
+  auto n = random_dims(N, 13719);
+  auto k = random_dims(N, 13720);
+  BatchedGroupedHandle<execution_space> handle(m, n, k);
+  EXPECT_EQ(handle.get_num_problems(), N);
+
+  // the serial kernels take chunks of at least 16 problems across bins
+  {
+    auto h_count  = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), handle.get_item_count());
+    auto h_kernel = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), handle.get_item_kernel());
+    int num_problems = 0, num_serial = 0, num_serial_items = 0;
+    for (int i = 0; i < handle.get_num_items(); ++i) {
+      num_problems += h_count(i);
+      if (h_kernel(i) != GroupedKernel::Team) {
+        num_serial += h_count(i);
+        ++num_serial_items;
+      }
+    }
+    EXPECT_EQ(num_problems, N);
+    EXPECT_LE(num_serial_items, (num_serial + 15) / 16 + 1);
+  }
+
+  view_type A("A", handle.get_a_size()), B("B", handle.get_b_size()),
+      C("C", handle.get_c_size());
+  Kokkos::Random_XorShift64_Pool<execution_space> random(13718);
+  Kokkos::fill_random(A, random, ValueType(1.0));
+  Kokkos::fill_random(B, random, ValueType(1.0));
+  Kokkos::fill_random(C, random, ValueType(1.0));
+  Kokkos::fence();
+
+  auto h_A  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+  auto h_B  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), B);
+  auto h_C0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  auto h_aOffsets = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), handle.get_a_offsets());
+  auto h_bOffsets = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), handle.get_b_offsets());
+  auto h_cOffsets = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), handle.get_c_offsets());
+
+  const ValueType alpha = 1.5, beta = 3.0;
+  BatchedGroupedGemm<transA, transB>(handle, alpha, A, B, beta, C);
+  Kokkos::fence();
+  auto h_C = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), C);
+
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (int p = 0; p < N; ++p) {
+    const ValueType *a = h_A.data() + h_aOffsets(p);
+    const ValueType *b = h_B.data() + h_bOffsets(p);
+    const size_t c     = h_cOffsets(p);
+    for (int i = 0; i < m(p); ++i)
+      for (int j = 0; j < n(p); ++j) {
+        ValueType sum = 0;
+        for (int l = 0; l < k(p); ++l)
+          sum += (tA ? a[l * m(p) + i] : a[i * k(p) + l]) *
+                 (tB ? b[j * k(p) + l] : b[l * n(p) + j]);
+        const ValueType expected = alpha * sum + beta * h_C0(c + i * n(p) + j);
+        EXPECT_NEAR_KK(h_C(c + i * n(p) + j), expected,
+                       eps * (k(p) + ats::abs(expected)));
+      }
+  }
+}
+
+template <typename DeviceType, typename ValueType>
+void impl_test_batched_grouped_lu(const int N) {
+  using execution_space = typename DeviceType::execution_space;
+  using ats             = Kokkos::ArithTraits<ValueType>;
+  using mag_type        = typename ats::mag_type;
+  using view_type       = Kokkos::View<ValueType *, DeviceType>;
+
+  auto n = random_dims(N, 13721);
+  BatchedGroupedHandle<execution_space> handle(n);
+
+  view_type A("A", handle.get_a_size());
+  Kokkos::Random_XorShift64_Pool<execution_space> random(13718);
+  Kokkos::fill_random(A, random, ValueType(1.0));
+  Kokkos::fence();
+
+  // make the matrices diagonally dominant, LU does not pivot
+  auto h_A0 = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+
+  auto h_aOffsets = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), handle.get_a_offsets());
+  for (int p = 0; p < N; ++p)
+    for (int i = 0; i < n(p); ++i)
+      h_A0(h_aOffsets(p) + i * n(p) + i) += ValueType(n(p));
+  Kokkos::deep_copy(A, h_A0);
+
+  BatchedGroupedLU(handle, A);
+  Kokkos::fence();
+  auto h_A = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A);
+
+  const mag_type eps = 1.0e3 * ats::epsilon();
+  for (int p = 0; p < N; ++p) {
+    const ValueType *lu = h_A.data() + h_aOffsets(p);
+    const int np        = n(p);
+    for (int i = 0; i < np; ++i)
+      for (int j = 0; j < np; ++j) {
+        // (L U)(i, j) with the unit diagonal of L
+        ValueType sum = 0;
+        for (int l = 0; l <= std::min(i, j); ++l)
+          sum += (l == i ? ValueType(1) : lu[i * np + l]) * lu[l * np + j];
+        const ValueType expected = h_A0(h_aOffsets(p) + i * np + j);
+        EXPECT_NEAR_KK(sum, expected, eps * (np + ats::abs(expected)));
+      }
+  }
+  EXPECT_EQ(handle.get_first_non_square(), -1);
+
+  // a handle with a non-square problem is rejected
+  if (N > 0) {
+    Kokkos::View<int *, Kokkos::HostSpace> m("m", N);
+    Kokkos::deep_copy(m, n);
+    m(N - 1) += 1;
+    BatchedGroupedHandle<execution_space> rect_handle(m, n, n);
+    EXPECT_EQ(rect_handle.get_first_non_square(), N - 1);
+
+    view_type rect_A("rect A", rect_handle.get_a_size());
+    EXPECT_ANY_THROW(BatchedGroupedLU(rect_handle, rect_A));
+  }
+}
+
+}  // namespace BatchedGrouped
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ParamTagType>
+int test_batched_grouped_gemm() {
+  Test::BatchedGrouped::impl_test_batched_grouped_gemm<DeviceType, ValueType,
+                                                       ParamTagType>(0);
+  Test::BatchedGrouped::impl_test_batched_grouped_gemm<DeviceType, ValueType,
+                                                       ParamTagType>(1);
+  Test::BatchedGrouped::impl_test_batched_grouped_gemm<DeviceType, ValueType,
+                                                       ParamTagType>(97);
+  return 0;
+}
+
+template <typename DeviceType, typename ValueType>
+int test_batched_grouped_lu() {
+  Test::BatchedGrouped::impl_test_batched_grouped_lu<DeviceType, ValueType>(0);
+  Test::BatchedGrouped::impl_test_batched_grouped_lu<DeviceType, ValueType>(1);
+  Test::BatchedGrouped::impl_test_batched_grouped_lu<DeviceType, ValueType>(
+      97);
+  return 0;
+}
@@ -0,0 +1,44 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_batched_grouped_gemm_nt_nt_double) {
+  typedef ::Test::BatchedGrouped::ParamTag<Trans::NoTranspose,
+                                           Trans::NoTranspose>
+      param_tag_type;
+  test_batched_grouped_gemm<TestDevice, double, param_tag_type>();
+}
+TEST_F(TestCategory, batched_scalar_batched_grouped_gemm_t_nt_double) {
+  typedef ::Test::BatchedGrouped::ParamTag<Trans::Transpose,
+                                           Trans::NoTranspose>
+      param_tag_type;
+  test_batched_grouped_gemm<TestDevice, double, param_tag_type>();
+}
+TEST_F(TestCategory, batched_scalar_batched_grouped_gemm_nt_t_double) {
+  typedef ::Test::BatchedGrouped::ParamTag<Trans::NoTranspose,
+                                           Trans::Transpose>
+      param_tag_type;
+  test_batched_grouped_gemm<TestDevice, double, param_tag_type>();
+}
+TEST_F(TestCategory, batched_scalar_batched_grouped_gemm_t_t_double) {
+  typedef ::Test::BatchedGrouped::ParamTag<Trans::Transpose, Trans::Transpose>
+      param_tag_type;
+  test_batched_grouped_gemm<TestDevice, double, param_tag_type>();
+}
+TEST_F(TestCategory, batched_scalar_batched_grouped_lu_double) {
+  test_batched_grouped_lu<TestDevice, double>();
+}
+#endif
@@ -17,9 +17,13 @@
 #define TEST_BATCHED_DENSE_HPP
 
 // Serial kernels
+#include "Test_Batched_BatchedDense.hpp"
+#include "Test_Batched_BatchedDense_Real.hpp"
 #include "Test_Batched_SerialAxpy.hpp"
 #include "Test_Batched_SerialAxpy_Real.hpp"
 #include "Test_Batched_SerialAxpy_Complex.hpp"
+#include "Test_Batched_SerialBlockTridiag.hpp"
+#include "Test_Batched_SerialBlockTridiag_Real.hpp"
 #include "Test_Batched_SerialEigendecomposition.hpp"
 #include "Test_Batched_SerialEigendecomposition_Real.hpp"
 #include "Test_Batched_SerialGesv.hpp"
@@ -33,6 +37,8 @@
 #include "Test_Batched_SerialSolveLU.hpp"
 #include "Test_Batched_SerialSolveLU_Real.hpp"
 #include "Test_Batched_SerialSolveLU_Complex.hpp"
+#include "Test_Batched_SerialTridiag.hpp"
+#include "Test_Batched_SerialTridiag_Real.hpp"
 #include "Test_Batched_SerialTrmm.hpp"
 #include "Test_Batched_SerialTrmm_Real.hpp"
 #include "Test_Batched_SerialTrmm_Complex.hpp"
@@ -51,6 +57,8 @@
 #include "Test_Batched_TeamAxpy.hpp"
 #include "Test_Batched_TeamAxpy_Real.hpp"
 #include "Test_Batched_TeamAxpy_Complex.hpp"
+#include "Test_Batched_TeamBlockTridiag.hpp"
+#include "Test_Batched_TeamBlockTridiag_Real.hpp"
 #include "Test_Batched_TeamGesv.hpp"
 #include "Test_Batched_TeamGesv_Real.hpp"
 #include "Test_Batched_TeamInverseLU.hpp"
@@ -62,6 +70,8 @@
 #include "Test_Batched_TeamSolveLU.hpp"
 #include "Test_Batched_TeamSolveLU_Real.hpp"
 #include "Test_Batched_TeamSolveLU_Complex.hpp"
+#include "Test_Batched_TeamTridiag.hpp"
+#include "Test_Batched_TeamTridiag_Real.hpp"
 #include "Test_Batched_TeamTrsm.hpp"
 #include "Test_Batched_TeamTrsm_Real.hpp"
 #include "Test_Batched_TeamTrsm_Complex.hpp"
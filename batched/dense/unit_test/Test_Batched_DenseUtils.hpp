@@ -16,6 +16,10 @@
 #ifndef TEST_BATCHED_DENSE_HELPER_HPP
 #define TEST_BATCHED_DENSE_HELPER_HPP
 
+#include <random>
+
+#include "KokkosBatched_Vector.hpp"
+
 namespace KokkosBatched {
 template <typename MatrixViewType, typename VectorViewType>
 void create_tridiagonal_batched_matrices(const MatrixViewType &A,
@@ -54,6 +58,91 @@ void create_tridiagonal_batched_matrices(const MatrixViewType &A,
 
   Kokkos::fence();
 }
+
+/// fill a scalar or every lane of a SIMD vector with random values
+template <typename ValueType, typename GeneratorType>
+void set_random(ValueType &a, GeneratorType &gen) {
+  a = ValueType(gen());
+}
+
+template <typename T, int l, typename GeneratorType>
+void set_random(Vector<SIMD<T>, l> &a, GeneratorType &gen) {
+  for (int k = 0; k < l; ++k) a[k] = T(gen());
+}
+
+template <typename ValueType>
+double abs_diff(const ValueType &a, const ValueType &b) {
+  return Kokkos::ArithTraits<ValueType>::abs(a - b);
+}
+
+template <typename T, int l>
+double abs_diff(const Vector<SIMD<T>, l> &a, const Vector<SIMD<T>, l> &b) {
+  double r_val = 0;
+  for (int k = 0; k < l; ++k)
+    r_val = std::max(r_val, double(Kokkos::ArithTraits<T>::abs(a[k] - b[k])));
+  return r_val;
+}
+
+/// rows of the tridiagonal test matrices are diagonally dominant
+template <typename ValueType, typename ViewType>
+void create_tridiagonal_systems(const ViewType &dl, const ViewType &d,
+                                const ViewType &du, const ViewType &x) {
+  std::mt19937 engine(13718);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  auto gen = [&]() { return dist(engine); };
+
+  const int N = d.extent(0), n = d.extent(1);
+  for (int l = 0; l < N; ++l) {
+    for (int i = 0; i < n; ++i) {
+      set_random(d(l, i), gen);
+      d(l, i) = d(l, i) + ValueType(4);
+      set_random(x(l, i), gen);
+    }
+    for (int i = 0; i < n - 1; ++i) {
+      set_random(dl(l, i), gen);
+      set_random(du(l, i), gen);
+    }
+  }
+}
+/// blocks of the block tridiagonal test matrices are diagonally dominant;
+/// X receives the exact solutions and Y the matching right-hand sides
+template <typename ValueType, typename BlockViewType, typename VectorViewType>
+void create_block_tridiagonal_systems(const BlockViewType &A,
+                                      const BlockViewType &B,
+                                      const BlockViewType &C,
+                                      const VectorViewType &X,
+                                      const VectorViewType &Y) {
+  std::mt19937 engine(13718);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+  auto gen = [&]() { return dist(engine); };
+
+  const int N = A.extent(0), L = A.extent(1), m = A.extent(2);
+  for (int l = 0; l < N; ++l) {
+    for (int k = 0; k < L; ++k)
+      for (int i = 0; i < m; ++i) {
+        set_random(X(l, k, i), gen);
+        for (int j = 0; j < m; ++j) {
+          set_random(A(l, k, i, j), gen);
+          if (k < L - 1) {
+            set_random(B(l, k, i, j), gen);
+            set_random(C(l, k, i, j), gen);
+          }
+        }
+        A(l, k, i, i) = A(l, k, i, i) + ValueType(3 * m);
+      }
+
+    for (int k = 0; k < L; ++k)
+      for (int i = 0; i < m; ++i) {
+        ValueType yi(0);
+        for (int j = 0; j < m; ++j) {
+          yi += A(l, k, i, j) * X(l, k, j);
+          if (k > 0) yi += C(l, k - 1, i, j) * X(l, k - 1, j);
+          if (k < L - 1) yi += B(l, k, i, j) * X(l, k + 1, j);
+        }
+        Y(l, k, i) = yi;
+      }
+  }
+}
 }  // namespace KokkosBatched
 
 #endif  // TEST_BATCHED_DENSE_HELPER_HPP
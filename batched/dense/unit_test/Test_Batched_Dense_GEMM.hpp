@@ -8,6 +8,8 @@
 #include "Test_Batched_BatchedGemm.hpp"
 #include "Test_Batched_BatchedGemm_Real.hpp"
 #include "Test_Batched_BatchedGemm_Complex.hpp"
+#include "Test_Batched_BatchedGrouped.hpp"
+#include "Test_Batched_BatchedGrouped_Real.hpp"
 
 // Team Kernels
 #include "Test_Batched_TeamGemm.hpp"
@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+
+#include "KokkosBatched_BlockTridiag.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "Test_Batched_DenseUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace BlockTridiag {
+
+template <typename DeviceType, typename BlockViewType, typename VectorViewType,
+          typename FactorAlgoTagType, typename SolveAlgoTagType>
+struct Functor_TestBatchedSerialBlockTridiag {
+  using execution_space = typename DeviceType::execution_space;
+  BlockViewType _A, _B, _C;
+  VectorViewType _X;
+
+  KOKKOS_INLINE_FUNCTION
+  Functor_TestBatchedSerialBlockTridiag(const BlockViewType &A,
+                                        const BlockViewType &B,
+                                        const BlockViewType &C,
+                                        const VectorViewType &X)
+      : _A(A), _B(B), _C(C), _X(X) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int k) const {
+    auto A =
+        Kokkos::subview(_A, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+    auto B =
+        Kokkos::subview(_B, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+    auto C =
+        Kokkos::subview(_C, k, Kokkos::ALL(), Kokkos::ALL(), Kokkos::ALL());
+    auto X = Kokkos::subview(_X, k, Kokkos::ALL(), Kokkos::ALL());
+
+    SerialBlockTridiagFactor<FactorAlgoTagType>::invoke(A, B, C);
+    SerialBlockTridiagSolve<SolveAlgoTagType>::invoke(A, B, C, X);
+  }
+
+  inline void run() {
+    typedef typename VectorViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::SerialBlockTridiag");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::RangePolicy<execution_space> policy(0, _X.extent(0));
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename BlockViewType, typename VectorViewType,
+          typename FactorAlgoTagType, typename SolveAlgoTagType>
+void impl_test_batched_block_tridiag(const int N, const int L,
+                                     const int BlkSize) {
+  typedef typename VectorViewType::value_type value_type;
+  typedef typename MagnitudeScalarType<value_type>::type mag_type;
+  typedef Kokkos::ArithTraits<mag_type> ats;
+
+  const int Lm1 = L > 1 ? L - 1 : 0;
+  BlockViewType A("A", N, L, BlkSize, BlkSize),
+      B("B", N, Lm1, BlkSize, BlkSize), C("C", N, Lm1, BlkSize, BlkSize);
+  VectorViewType X("X", N, L, BlkSize);
+
+  auto A_host = Kokkos::create_mirror_view(A);
+  auto B_host = Kokkos::create_mirror_view(B);
+  auto C_host = Kokkos::create_mirror_view(C);
+  auto X_host = Kokkos::create_mirror_view(X);
+
+  typename VectorViewType::HostMirror Xref_host("Xref", N, L, BlkSize);
+  create_block_tridiagonal_systems<value_type>(A_host, B_host, C_host,
+                                               Xref_host, X_host);
+
+  Kokkos::deep_copy(A, A_host);
+  Kokkos::deep_copy(B, B_host);
+  Kokkos::deep_copy(C, C_host);
+  Kokkos::deep_copy(X, X_host);
+
+  Functor_TestBatchedSerialBlockTridiag<DeviceType, BlockViewType,
+                                        VectorViewType, FactorAlgoTagType,
+                                        SolveAlgoTagType>(A, B, C, X)
+      .run();
+
+  Kokkos::fence();
+
+  Kokkos::deep_copy(X_host, X);
+
+  const double eps = 1.0e3 * ats::epsilon();
+  for (int l = 0; l < N; ++l)
+    for (int k = 0; k < L; ++k)
+      for (int i = 0; i < BlkSize; ++i)
+        EXPECT_NEAR_KK(abs_diff(X_host(l, k, i), Xref_host(l, k, i)), 0, eps);
+}
+}  // namespace BlockTridiag
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename FactorAlgoTagType,
+          typename SolveAlgoTagType>
+int test_batched_block_tridiag() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType ****, Kokkos::LayoutLeft, DeviceType>
+        BlockViewType;
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutLeft, DeviceType>
+        VectorViewType;
+    for (int L : {1, 2, 10})
+      for (int i = 1; i < 6; ++i) {
+        Test::BlockTridiag::impl_test_batched_block_tridiag<
+            DeviceType, BlockViewType, VectorViewType, FactorAlgoTagType,
+            SolveAlgoTagType>(64, L, i);
+      }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType ****, Kokkos::LayoutRight, DeviceType>
+        BlockViewType;
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutRight, DeviceType>
+        VectorViewType;
+    for (int L : {1, 2, 10})
+      for (int i = 1; i < 6; ++i) {
+        Test::BlockTridiag::impl_test_batched_block_tridiag<
+            DeviceType, BlockViewType, VectorViewType, FactorAlgoTagType,
+            SolveAlgoTagType>(64, L, i);
+      }
+  }
+#endif
+
+  return 0;
+}
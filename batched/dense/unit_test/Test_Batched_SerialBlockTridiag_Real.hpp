@@ -0,0 +1,59 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_serial_block_tridiag_unblocked_float) {
+  test_batched_block_tridiag<TestDevice, float,
+                             KokkosBatched::Algo::Level3::Unblocked,
+                             KokkosBatched::Algo::Level2::Unblocked>();
+}
+TEST_F(TestCategory, batched_scalar_serial_block_tridiag_blocked_float) {
+  test_batched_block_tridiag<TestDevice, float,
+                             KokkosBatched::Algo::Level3::Blocked,
+                             KokkosBatched::Algo::Level2::Blocked>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_serial_block_tridiag_unblocked_double) {
+  test_batched_block_tridiag<TestDevice, double,
+                             KokkosBatched::Algo::Level3::Unblocked,
+                             KokkosBatched::Algo::Level2::Unblocked>();
+}
+TEST_F(TestCategory, batched_scalar_serial_block_tridiag_blocked_double) {
+  test_batched_block_tridiag<TestDevice, double,
+                             KokkosBatched::Algo::Level3::Blocked,
+                             KokkosBatched::Algo::Level2::Blocked>();
+}
+#endif
+
+// SIMD vector types are only tested on host backends
+#if !defined(TEST_CUDA_BATCHED_DENSE_CPP) && \
+    !defined(TEST_HIP_BATCHED_DENSE_CPP) &&  \
+    !defined(TEST_SYCL_BATCHED_DENSE_CPP) && \
+    !defined(TEST_OPENMPTARGET_BATCHED_DENSE_CPP)
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_vector_serial_block_tridiag_blocked_double) {
+  typedef KokkosBatched::Vector<
+      KokkosBatched::SIMD<double>,
+      KokkosBatched::DefaultVectorLength<
+          double, typename TestDevice::memory_space>::value>
+      vector_type;
+  test_batched_block_tridiag<TestDevice, vector_type,
+                             KokkosBatched::Algo::Level3::Blocked,
+                             KokkosBatched::Algo::Level2::Blocked>();
+}
+#endif
+#endif
@@ -0,0 +1,170 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+
+#include "KokkosBatched_Tridiag.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "Test_Batched_DenseUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace Tridiag {
+
+struct ParamTag {
+  struct Gtsv {};
+  struct GttrsTranspose {};
+  struct Pttrs {};
+};
+
+template <typename DeviceType, typename ViewType, typename ParamTagType>
+struct Functor_TestBatchedSerialTridiag {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _dl, _d, _du, _b;
+
+  KOKKOS_INLINE_FUNCTION
+  Functor_TestBatchedSerialTridiag(const ViewType &dl, const ViewType &d,
+                                   const ViewType &du, const ViewType &b)
+      : _dl(dl), _d(d), _du(du), _b(b) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ParamTag::Gtsv &, const int k) const {
+    auto dl = Kokkos::subview(_dl, k, Kokkos::ALL());
+    auto d  = Kokkos::subview(_d, k, Kokkos::ALL());
+    auto du = Kokkos::subview(_du, k, Kokkos::ALL());
+    auto b  = Kokkos::subview(_b, k, Kokkos::ALL());
+
+    SerialGtsv<KokkosBatched::Tridiag::Thomas>::invoke(dl, d, du, b);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ParamTag::GttrsTranspose &, const int k) const {
+    auto dl = Kokkos::subview(_dl, k, Kokkos::ALL());
+    auto d  = Kokkos::subview(_d, k, Kokkos::ALL());
+    auto du = Kokkos::subview(_du, k, Kokkos::ALL());
+    auto b  = Kokkos::subview(_b, k, Kokkos::ALL());
+
+    SerialGttrf::invoke(dl, d, du);
+    SerialGttrs<Trans::Transpose>::invoke(dl, d, du, b);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ParamTag::Pttrs &, const int k) const {
+    auto e = Kokkos::subview(_dl, k, Kokkos::ALL());
+    auto d = Kokkos::subview(_d, k, Kokkos::ALL());
+    auto b = Kokkos::subview(_b, k, Kokkos::ALL());
+
+    SerialPttrf::invoke(d, e);
+    SerialPttrs::invoke(d, e, b);
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::SerialTridiag");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::RangePolicy<execution_space, ParamTagType> policy(0,
+                                                              _d.extent(0));
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ViewType, typename ParamTagType>
+void impl_test_batched_tridiag(const int N, const int n) {
+  typedef typename ViewType::value_type value_type;
+  typedef typename MagnitudeScalarType<value_type>::type mag_type;
+  typedef Kokkos::ArithTraits<mag_type> ats;
+
+  ViewType dl("dl", N, n > 1 ? n - 1 : 0), d("d", N, n),
+      du("du", N, n > 1 ? n - 1 : 0), b("b", N, n);
+
+  auto dl_host = Kokkos::create_mirror_view(dl);
+  auto d_host  = Kokkos::create_mirror_view(d);
+  auto du_host = Kokkos::create_mirror_view(du);
+  auto b_host  = Kokkos::create_mirror_view(b);
+
+  typename ViewType::HostMirror x_host("x", N, n);
+  create_tridiagonal_systems<value_type>(dl_host, d_host, du_host, x_host);
+
+  /// symmetric problems use dl as their off-diagonal
+  const bool is_symmetric = std::is_same<ParamTagType, ParamTag::Pttrs>::value;
+  const bool is_transpose =
+      std::is_same<ParamTagType, ParamTag::GttrsTranspose>::value;
+  if (is_symmetric) Kokkos::deep_copy(du_host, dl_host);
+
+  for (int l = 0; l < N; ++l)
+    for (int i = 0; i < n; ++i) {
+      value_type bi = d_host(l, i) * x_host(l, i);
+      if (i > 0)
+        bi += (is_transpose ? du_host(l, i - 1) : dl_host(l, i - 1)) *
+              x_host(l, i - 1);
+      if (i < n - 1)
+        bi += (is_transpose ? dl_host(l, i) : du_host(l, i)) *
+              x_host(l, i + 1);
+      b_host(l, i) = bi;
+    }
+
+  Kokkos::deep_copy(dl, dl_host);
+  Kokkos::deep_copy(d, d_host);
+  Kokkos::deep_copy(du, du_host);
+  Kokkos::deep_copy(b, b_host);
+
+  Functor_TestBatchedSerialTridiag<DeviceType, ViewType, ParamTagType>(dl, d,
+                                                                       du, b)
+      .run();
+
+  Kokkos::fence();
+
+  Kokkos::deep_copy(b_host, b);
+
+  const double eps = 1.0e3 * ats::epsilon();
+  for (int l = 0; l < N; ++l)
+    for (int i = 0; i < n; ++i)
+      EXPECT_NEAR_KK(abs_diff(b_host(l, i), x_host(l, i)), 0, eps);
+}
+}  // namespace Tridiag
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename ParamTagType>
+int test_batched_tridiag() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType>
+        ViewType;
+    for (int n : {1, 2, 3, 7, 16, 33}) {
+      Test::Tridiag::impl_test_batched_tridiag<DeviceType, ViewType,
+                                               ParamTagType>(128, n);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    for (int n : {1, 2, 3, 7, 16, 33}) {
+      Test::Tridiag::impl_test_batched_tridiag<DeviceType, ViewType,
+                                               ParamTagType>(128, n);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,67 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_serial_gtsv_thomas_float) {
+  test_batched_tridiag<TestDevice, float, Test::Tridiag::ParamTag::Gtsv>();
+}
+TEST_F(TestCategory, batched_scalar_serial_gttrs_transpose_float) {
+  test_batched_tridiag<TestDevice, float,
+                       Test::Tridiag::ParamTag::GttrsTranspose>();
+}
+TEST_F(TestCategory, batched_scalar_serial_pttrs_float) {
+  test_batched_tridiag<TestDevice, float, Test::Tridiag::ParamTag::Pttrs>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_serial_gtsv_thomas_double) {
+  test_batched_tridiag<TestDevice, double, Test::Tridiag::ParamTag::Gtsv>();
+}
+TEST_F(TestCategory, batched_scalar_serial_gttrs_transpose_double) {
+  test_batched_tridiag<TestDevice, double,
+                       Test::Tridiag::ParamTag::GttrsTranspose>();
+}
+TEST_F(TestCategory, batched_scalar_serial_pttrs_double) {
+  test_batched_tridiag<TestDevice, double, Test::Tridiag::ParamTag::Pttrs>();
+}
+#endif
+
+// SIMD vector types are only tested on host backends
+#if !defined(TEST_CUDA_BATCHED_DENSE_CPP) && \
+    !defined(TEST_HIP_BATCHED_DENSE_CPP) &&  \
+    !defined(TEST_SYCL_BATCHED_DENSE_CPP) && \
+    !defined(TEST_OPENMPTARGET_BATCHED_DENSE_CPP)
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_vector_serial_gtsv_thomas_double) {
+  typedef KokkosBatched::Vector<
+      KokkosBatched::SIMD<double>,
+      KokkosBatched::DefaultVectorLength<
+          double, typename TestDevice::memory_space>::value>
+      vector_type;
+  test_batched_tridiag<TestDevice, vector_type,
+                       Test::Tridiag::ParamTag::Gtsv>();
+}
+TEST_F(TestCategory, batched_vector_serial_pttrs_double) {
+  typedef KokkosBatched::Vector<
+      KokkosBatched::SIMD<double>,
+      KokkosBatched::DefaultVectorLength<
+          double, typename TestDevice::memory_space>::value>
+      vector_type;
+  test_batched_tridiag<TestDevice, vector_type,
+                       Test::Tridiag::ParamTag::Pttrs>();
+}
+#endif
+#endif
@@ -0,0 +1,40 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_team_block_tridiag_unblocked_float) {
+  test_batched_team_block_tridiag<TestDevice, float,
+                                  KokkosBatched::Algo::Level3::Unblocked,
+                                  KokkosBatched::Algo::Level2::Unblocked>();
+}
+TEST_F(TestCategory, batched_scalar_team_block_tridiag_blocked_float) {
+  test_batched_team_block_tridiag<TestDevice, float,
+                                  KokkosBatched::Algo::Level3::Blocked,
+                                  KokkosBatched::Algo::Level2::Blocked>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_team_block_tridiag_unblocked_double) {
+  test_batched_team_block_tridiag<TestDevice, double,
+                                  KokkosBatched::Algo::Level3::Unblocked,
+                                  KokkosBatched::Algo::Level2::Unblocked>();
+}
+TEST_F(TestCategory, batched_scalar_team_block_tridiag_blocked_double) {
+  test_batched_team_block_tridiag<TestDevice, double,
+                                  KokkosBatched::Algo::Level3::Blocked,
+                                  KokkosBatched::Algo::Level2::Blocked>();
+}
+#endif
@@ -0,0 +1,174 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+
+#include "KokkosBatched_Tridiag.hpp"
+
+#include "KokkosKernels_TestUtils.hpp"
+
+#include "Test_Batched_DenseUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace TeamTridiag {
+
+/// factorize with SerialGttrf and solve all right-hand sides with TeamGttrs
+struct Gttrs {};
+
+template <typename DeviceType, typename ViewType, typename RHSViewType,
+          typename AlgoTagType>
+struct Functor_TestBatchedTeamTridiag {
+  using execution_space = typename DeviceType::execution_space;
+  ViewType _dl, _d, _du;
+  RHSViewType _B;
+
+  KOKKOS_INLINE_FUNCTION
+  Functor_TestBatchedTeamTridiag(const ViewType &dl, const ViewType &d,
+                                 const ViewType &du, const RHSViewType &B)
+      : _dl(dl), _d(d), _du(du), _B(B) {}
+
+  template <typename MemberType, typename DViewType, typename BViewType>
+  KOKKOS_INLINE_FUNCTION void solve(const MemberType &member, const Gttrs &,
+                                    const DViewType &dl, const DViewType &d,
+                                    const DViewType &du,
+                                    const BViewType &B) const {
+    Kokkos::single(Kokkos::PerTeam(member),
+                   [&]() { SerialGttrf::invoke(dl, d, du); });
+    member.team_barrier();
+    TeamGttrs<MemberType, Trans::NoTranspose>::invoke(member, dl, d, du, B);
+  }
+
+  template <typename MemberType, typename ArgAlgo, typename DViewType,
+            typename BViewType>
+  KOKKOS_INLINE_FUNCTION void solve(const MemberType &member, const ArgAlgo &,
+                                    const DViewType &dl, const DViewType &d,
+                                    const DViewType &du,
+                                    const BViewType &B) const {
+    auto b = Kokkos::subview(B, Kokkos::ALL(), 0);
+    TeamGtsv<MemberType, ArgAlgo>::invoke(member, dl, d, du, b);
+  }
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int k = member.league_rank();
+    auto dl     = Kokkos::subview(_dl, k, Kokkos::ALL());
+    auto d      = Kokkos::subview(_d, k, Kokkos::ALL());
+    auto du     = Kokkos::subview(_du, k, Kokkos::ALL());
+    auto B      = Kokkos::subview(_B, k, Kokkos::ALL(), Kokkos::ALL());
+
+    solve(member, AlgoTagType(), dl, d, du, B);
+  }
+
+  inline void run() {
+    typedef typename ViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::TeamTridiag");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_d.extent(0), Kokkos::AUTO());
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ViewType, typename RHSViewType,
+          typename AlgoTagType>
+void impl_test_batched_tridiag(const int N, const int n, const int nrhs) {
+  typedef typename ViewType::value_type value_type;
+  typedef typename MagnitudeScalarType<value_type>::type mag_type;
+  typedef Kokkos::ArithTraits<mag_type> ats;
+
+  ViewType dl("dl", N, n > 1 ? n - 1 : 0), d("d", N, n),
+      du("du", N, n > 1 ? n - 1 : 0);
+  RHSViewType B("B", N, n, nrhs);
+
+  auto dl_host = Kokkos::create_mirror_view(dl);
+  auto d_host  = Kokkos::create_mirror_view(d);
+  auto du_host = Kokkos::create_mirror_view(du);
+  auto B_host  = Kokkos::create_mirror_view(B);
+
+  typename ViewType::HostMirror x_host("x", N, n);
+  create_tridiagonal_systems<value_type>(dl_host, d_host, du_host, x_host);
+
+  /// the j-th right-hand side is (j+1) A x
+  for (int l = 0; l < N; ++l)
+    for (int i = 0; i < n; ++i) {
+      value_type bi = d_host(l, i) * x_host(l, i);
+      if (i > 0) bi += dl_host(l, i - 1) * x_host(l, i - 1);
+      if (i < n - 1) bi += du_host(l, i) * x_host(l, i + 1);
+      for (int j = 0; j < nrhs; ++j) B_host(l, i, j) = value_type(j + 1) * bi;
+    }
+
+  Kokkos::deep_copy(dl, dl_host);
+  Kokkos::deep_copy(d, d_host);
+  Kokkos::deep_copy(du, du_host);
+  Kokkos::deep_copy(B, B_host);
+
+  Functor_TestBatchedTeamTridiag<DeviceType, ViewType, RHSViewType,
+                                 AlgoTagType>(dl, d, du, B)
+      .run();
+
+  Kokkos::fence();
+
+  Kokkos::deep_copy(B_host, B);
+
+  /// TeamGtsv only solves the first right-hand side
+  const int nsolved = std::is_same<AlgoTagType, Gttrs>::value ? nrhs : 1;
+
+  const double eps = 1.0e3 * ats::epsilon();
+  for (int l = 0; l < N; ++l)
+    for (int i = 0; i < n; ++i)
+      for (int j = 0; j < nsolved; ++j)
+        EXPECT_NEAR_KK(
+            abs_diff(B_host(l, i, j), value_type(j + 1) * x_host(l, i)), 0,
+            (j + 1) * eps);
+}
+}  // namespace TeamTridiag
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, typename AlgoTagType>
+int test_batched_team_tridiag() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType>
+        ViewType;
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutLeft, DeviceType>
+        RHSViewType;
+    for (int n : {1, 2, 3, 7, 16, 33, 100}) {
+      Test::TeamTridiag::impl_test_batched_tridiag<DeviceType, ViewType,
+                                                   RHSViewType, AlgoTagType>(
+          64, n, 3);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    typedef Kokkos::View<ValueType ***, Kokkos::LayoutRight, DeviceType>
+        RHSViewType;
+    for (int n : {1, 2, 3, 7, 16, 33, 100}) {
+      Test::TeamTridiag::impl_test_batched_tridiag<DeviceType, ViewType,
+                                                   RHSViewType, AlgoTagType>(
+          64, n, 3);
+    }
+  }
+#endif
+
+  return 0;
+}
@@ -0,0 +1,42 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_team_gtsv_thomas_float) {
+  test_batched_team_tridiag<TestDevice, float,
+                            KokkosBatched::Tridiag::Thomas>();
+}
+TEST_F(TestCategory, batched_scalar_team_gtsv_cyclic_reduction_float) {
+  test_batched_team_tridiag<TestDevice, float,
+                            KokkosBatched::Tridiag::CyclicReduction>();
+}
+TEST_F(TestCategory, batched_scalar_team_gttrs_float) {
+  test_batched_team_tridiag<TestDevice, float, Test::TeamTridiag::Gttrs>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_team_gtsv_thomas_double) {
+  test_batched_team_tridiag<TestDevice, double,
+                            KokkosBatched::Tridiag::Thomas>();
+}
+TEST_F(TestCategory, batched_scalar_team_gtsv_cyclic_reduction_double) {
+  test_batched_team_tridiag<TestDevice, double,
+                            KokkosBatched::Tridiag::CyclicReduction>();
+}
+TEST_F(TestCategory, batched_scalar_team_gttrs_double) {
+  test_batched_team_tridiag<TestDevice, double, Test::TeamTridiag::Gttrs>();
+}
+#endif
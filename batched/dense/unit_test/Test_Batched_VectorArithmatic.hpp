@@ -222,6 +222,21 @@ void impl_test_batched_vector_arithmatic() {
       for (int k = 0; k < vector_length; ++k)
         EXPECT_NEAR(ats::abs(c[k]), ats::abs(-a[k]), eps * ats::abs(c[k]));
     }
+    {
+      /// test : partial load and store of the first n entries
+      value_type buf[VectorLength];
+      for (int n = 0; n <= vector_length; ++n) {
+        for (int k = 0; k < vector_length; ++k) buf[k] = a[k];
+        c.loadUnaligned(buf, n);
+        for (int k = 0; k < vector_length; ++k)
+          EXPECT_EQ(c[k], k < n ? a[k] : zero);
+
+        for (int k = 0; k < vector_length; ++k) buf[k] = zero;
+        b.storeUnaligned(buf, n);
+        for (int k = 0; k < vector_length; ++k)
+          EXPECT_EQ(buf[k], k < n ? b[k] : zero);
+      }
+    }
 #if defined(__DO_NOT_TEST__)
     {
       /// test : add radial
@@ -162,6 +162,10 @@ TEST_F(TestCategory, batched_vector_math_simd_float3) {
 TEST_F(TestCategory, batched_vector_math_simd_float8) {
   test_batched_vector_math<TestDevice, SIMD<float>, 8>();
 }
+// avx 512
+TEST_F(TestCategory, batched_vector_math_simd_float16) {
+  test_batched_vector_math<TestDevice, SIMD<float>, 16>();
+}
 #endif
 
 #if defined(KOKKOSKERNELS_INST_DOUBLE)
@@ -171,6 +175,10 @@ TEST_F(TestCategory, batched_vector_math_simd_double3) {
 TEST_F(TestCategory, batched_vector_math_simd_double4) {
   test_batched_vector_math<TestDevice, SIMD<double>, 4>();
 }
+// avx 512
+TEST_F(TestCategory, batched_vector_math_simd_double8) {
+  test_batched_vector_math<TestDevice, SIMD<double>, 8>();
+}
 #endif
 
 // using namespace Test;
@@ -0,0 +1,364 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BICGSTAB_TEAMVECTOR_IMPL_HPP__
+#define __KOKKOSBATCHED_BICGSTAB_TEAMVECTOR_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+#include "KokkosBatched_Axpy.hpp"
+#include "KokkosBatched_Copy_Decl.hpp"
+#include "KokkosBatched_Dot.hpp"
+#include "KokkosBatched_Spmv.hpp"
+#include "KokkosBatched_Identity.hpp"
+
+namespace KokkosBatched {
+
+///
+/// TeamVector BiCGStab
+///   A nested parallel_for with TeamVectorRange is used.
+///
+///   Right preconditioned BiCGStab: the preconditioner is applied to the
+///   search directions p and s, and the residual r is the residual of the
+///   unpreconditioned system. Unlike GMRES, the memory footprint does not
+///   grow with the number of iterations: six vectors and eight scalars per
+///   system.
+///
+
+template <typename MemberType>
+template <typename OperatorType, typename VectorViewType,
+          typename PrecOperatorType, typename KrylovHandleType,
+          typename TMPViewType, typename TMPNormViewType>
+KOKKOS_INLINE_FUNCTION int TeamVectorBiCGStab<MemberType>::invoke(
+    const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+    const VectorViewType& _X, const PrecOperatorType& P,
+    const KrylovHandleType& handle, const TMPViewType& _TMPView,
+    const TMPNormViewType& _TMPNormView) {
+  typedef int OrdinalType;
+  typedef typename Kokkos::ArithTraits<
+      typename VectorViewType::non_const_value_type>::mag_type MagnitudeType;
+  typedef Kokkos::ArithTraits<MagnitudeType> ATM;
+
+  const size_t maximum_iteration    = handle.get_max_iteration();
+  const MagnitudeType tolerance     = handle.get_tolerance();
+  const MagnitudeType max_tolerance = handle.get_max_tolerance();
+
+  const OrdinalType numMatrices = _X.extent(0);
+  const OrdinalType numRows     = _X.extent(1);
+
+  int offset_R    = 0;
+  int offset_Rhat = offset_R + numRows;
+  int offset_P    = offset_Rhat + numRows;
+  int offset_V    = offset_P + numRows;
+  int offset_Z    = offset_V + numRows;
+  int offset_T    = offset_Z + numRows;
+
+  auto R    = Kokkos::subview(_TMPView, Kokkos::ALL,
+                            Kokkos::make_pair(offset_R, offset_R + numRows));
+  auto Rhat = Kokkos::subview(
+      _TMPView, Kokkos::ALL,
+      Kokkos::make_pair(offset_Rhat, offset_Rhat + numRows));
+  auto P_ = Kokkos::subview(_TMPView, Kokkos::ALL,
+                            Kokkos::make_pair(offset_P, offset_P + numRows));
+  auto V  = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_V, offset_V + numRows));
+  // Z holds the preconditioned search direction, first M^{-1} p then M^{-1} s
+  auto Z = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_Z, offset_Z + numRows));
+  auto T = Kokkos::subview(_TMPView, Kokkos::ALL,
+                           Kokkos::make_pair(offset_T, offset_T + numRows));
+
+  // mask: 1 while the system iterates, 0 once it converged, -1 after a
+  // breakdown
+  auto norm_0  = Kokkos::subview(_TMPNormView, Kokkos::ALL, 0);
+  auto rho     = Kokkos::subview(_TMPNormView, Kokkos::ALL, 1);
+  auto rho_old = Kokkos::subview(_TMPNormView, Kokkos::ALL, 2);
+  auto alpha   = Kokkos::subview(_TMPNormView, Kokkos::ALL, 3);
+  auto omega   = Kokkos::subview(_TMPNormView, Kokkos::ALL, 4);
+  auto mask    = Kokkos::subview(_TMPNormView, Kokkos::ALL, 5);
+  auto tmp     = Kokkos::subview(_TMPNormView, Kokkos::ALL, 6);
+  auto tmp2    = Kokkos::subview(_TMPNormView, Kokkos::ALL, 7);
+
+  // Deep copy of b into r_0:
+  TeamVectorCopy<MemberType>::invoke(member, _B, R);
+
+  // r_0 := b - A x_0
+  member.team_barrier();
+  A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, _X, R, -1, 1);
+  member.team_barrier();
+
+  // r_hat := r_0, p := 0, v := 0
+  TeamVectorCopy<MemberType>::invoke(member, R, Rhat);
+  Kokkos::parallel_for(
+      Kokkos::TeamVectorRange(member, 0, numMatrices * numRows),
+      [&](const OrdinalType& iTemp) {
+        OrdinalType iRow, iMatrix;
+        getIndices<OrdinalType, typename VectorViewType::array_layout>(
+            iTemp, numRows, numMatrices, iRow, iMatrix);
+        P_(iMatrix, iRow) = 0;
+        V(iMatrix, iRow)  = 0;
+      });
+
+  TeamVectorDot<MemberType>::invoke(member, R, R, norm_0);
+  member.team_barrier();
+
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
+                       [&](const OrdinalType& i) {
+                         norm_0(i) = ATM::sqrt(norm_0(i));
+                         handle.set_norm(member.league_rank(), i, 0, norm_0(i));
+                         rho_old(i) = 1;
+                         alpha(i)   = 1;
+                         omega(i)   = 1;
+                         if (norm_0(i) > max_tolerance) {
+                           mask(i) = 1;
+                         } else {
+                           handle.set_iteration(member.league_rank(), i, 0);
+                           mask(i) = 0;
+                         }
+                       });
+  member.team_barrier();
+
+  int status               = 1;
+  int number_not_converged = 0;
+
+  for (size_t j = 0; j < maximum_iteration; ++j) {
+    // rho_j := (r_hat, r_j)
+    TeamVectorDot<MemberType>::invoke(member, Rhat, R, rho);
+    member.team_barrier();
+
+    // beta := (rho_j / rho_{j-1}) (alpha / omega), stored in tmp
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, numMatrices),
+        [&](const OrdinalType& i) {
+          if (mask(i) == 1. && (ATM::abs(rho(i)) <= max_tolerance ||
+                                ATM::abs(omega(i)) <= max_tolerance)) {
+            // breakdown: r_hat is orthogonal to the residual or the
+            // stabilization step stagnated, after j complete iterations
+            mask(i) = -1.;
+            handle.set_iteration(member.league_rank(), i, j);
+          }
+          tmp(i) = mask(i) == 1.
+                       ? (rho(i) / rho_old(i)) * (alpha(i) / omega(i))
+                       : 0.;
+          rho_old(i) = rho(i);
+        });
+    member.team_barrier();
+
+    // p := r_j + beta (p - omega v)
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, numMatrices * numRows),
+        [&](const OrdinalType& iTemp) {
+          OrdinalType iRow, iMatrix;
+          getIndices<OrdinalType, typename VectorViewType::array_layout>(
+              iTemp, numRows, numMatrices, iRow, iMatrix);
+          P_(iMatrix, iRow) =
+              R(iMatrix, iRow) +
+              tmp(iMatrix) *
+                  (P_(iMatrix, iRow) - omega(iMatrix) * V(iMatrix, iRow));
+        });
+    member.team_barrier();
+
+    // z := M^{-1} p, v := A z
+    P.template apply<Trans::NoTranspose, Mode::TeamVector, 0>(member, P_, Z);
+    member.team_barrier();
+    A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, Z, V);
+    member.team_barrier();
+
+    // alpha := rho_j / (r_hat, v)
+    TeamVectorDot<MemberType>::invoke(member, Rhat, V, tmp);
+    member.team_barrier();
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, numMatrices),
+        [&](const OrdinalType& i) {
+          if (mask(i) == 1. && ATM::abs(tmp(i)) <= max_tolerance) {
+            // breakdown: v is orthogonal to r_hat
+            mask(i) = -1.;
+            handle.set_iteration(member.league_rank(), i, j);
+          }
+          alpha(i) = mask(i) == 1. ? rho(i) / tmp(i) : 0.;
+        });
+    member.team_barrier();
+
+    // x := x + alpha z
+    TeamVectorAxpy<MemberType>::invoke(member, alpha, Z, _X);
+    // s := r - alpha v, stored in r
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
+                         [&](const OrdinalType& i) { tmp(i) = -alpha(i); });
+    member.team_barrier();
+    TeamVectorAxpy<MemberType>::invoke(member, tmp, V, R);
+    member.team_barrier();
+
+    // Early exit if s is small enough
+    TeamVectorDot<MemberType>::invoke(member, R, R, tmp);
+    member.team_barrier();
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
+                         [&](const OrdinalType& i) {
+                           if (mask(i) == 1. &&
+                               ATM::sqrt(tmp(i)) / norm_0(i) < tolerance) {
+                             mask(i) = 0.;
+                             handle.set_norm(member.league_rank(), i, j + 1,
+                                             ATM::sqrt(tmp(i)) / norm_0(i));
+                             handle.set_iteration(member.league_rank(), i,
+                                                  j + 1);
+                           }
+                         });
+    member.team_barrier();
+
+    // z := M^{-1} s, t := A z
+    P.template apply<Trans::NoTranspose, Mode::TeamVector, 0>(member, R, Z);
+    member.team_barrier();
+    A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, Z, T);
+    member.team_barrier();
+
+    // omega := (t, s) / (t, t)
+    TeamVectorDot<MemberType>::invoke(member, T, R, tmp);
+    TeamVectorDot<MemberType>::invoke(member, T, T, tmp2);
+    member.team_barrier();
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, numMatrices),
+        [&](const OrdinalType& i) {
+          if (mask(i) == 1. && ATM::abs(tmp2(i)) <= max_tolerance) {
+            // breakdown: t vanished
+            mask(i) = -1.;
+            handle.set_iteration(member.league_rank(), i, j);
+          }
+          omega(i) = mask(i) == 1. ? tmp(i) / tmp2(i) : 0.;
+          tmp(i)   = -omega(i);
+        });
+    member.team_barrier();
+
+    // x := x + omega z, r := s - omega t
+    TeamVectorAxpy<MemberType>::invoke(member, omega, Z, _X);
+    TeamVectorAxpy<MemberType>::invoke(member, tmp, T, R);
+    member.team_barrier();
+
+    TeamVectorDot<MemberType>::invoke(member, R, R, tmp);
+    member.team_barrier();
+
+    // Relative convergence check:
+    number_not_converged = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(member, 0, numMatrices),
+        [&](const OrdinalType& i, int& lnumber_not_converged) {
+          if (mask(i) == 1.) {
+            const MagnitudeType res_norm = ATM::sqrt(tmp(i)) / norm_0(i);
+            handle.set_norm(member.league_rank(), i, j + 1, res_norm);
+            if (res_norm < tolerance) {
+              mask(i) = 0.;
+              handle.set_iteration(member.league_rank(), i, j + 1);
+            } else
+              ++lnumber_not_converged;
+          }
+        },
+        number_not_converged);
+    member.team_barrier();
+
+    if (number_not_converged == 0) {
+      status = 0;
+      break;
+    }
+  }
+
+  // a system that broke down stopped without converging
+  int number_broken_down = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::TeamVectorRange(member, 0, numMatrices),
+      [&](const OrdinalType& i, int& lnumber_broken_down) {
+        if (mask(i) == -1.) ++lnumber_broken_down;
+      },
+      number_broken_down);
+  if (number_broken_down > 0) status = 1;
+
+  if (handle.get_compute_last_residual()) {
+    TeamVectorCopy<MemberType>::invoke(member, _B, R);
+    member.team_barrier();
+    A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, _X, R, -1,
+                                                           1);
+    member.team_barrier();
+    TeamVectorDot<MemberType>::invoke(member, R, R, tmp);
+    member.team_barrier();
+
+    Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
+                         [&](const OrdinalType& i) {
+                           handle.set_last_norm(member.league_rank(), i,
+                                                ATM::sqrt(tmp(i)));
+                         });
+  }
+  return status;
+}
+
+template <typename MemberType>
+template <typename OperatorType, typename VectorViewType,
+          typename PrecOperatorType, typename KrylovHandleType>
+KOKKOS_INLINE_FUNCTION int TeamVectorBiCGStab<MemberType>::invoke(
+    const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+    const VectorViewType& _X, const PrecOperatorType& P,
+    const KrylovHandleType& handle) {
+  const int strategy = handle.get_memory_strategy();
+
+  using ScratchPadNormViewType = Kokkos::View<
+      typename Kokkos::ArithTraits<
+          typename VectorViewType::non_const_value_type>::mag_type**,
+      typename VectorViewType::execution_space::scratch_memory_space>;
+
+  const int numMatrices = _X.extent(0);
+  const int numRows     = _X.extent(1);
+
+  ScratchPadNormViewType _TMPNormView(
+      member.team_scratch(handle.get_scratch_pad_level()), numMatrices, 8);
+
+  if (strategy == 0) {
+    using ScratchPadVectorViewType = Kokkos::View<
+        typename VectorViewType::non_const_value_type**,
+        typename VectorViewType::array_layout,
+        typename VectorViewType::execution_space::scratch_memory_space>;
+
+    ScratchPadVectorViewType _TMPView(
+        member.team_scratch(handle.get_scratch_pad_level()), numMatrices,
+        6 * numRows);
+
+    return invoke<OperatorType, VectorViewType, PrecOperatorType,
+                  KrylovHandleType>(member, A, _B, _X, P, handle, _TMPView,
+                                    _TMPNormView);
+  }
+  if (strategy == 1) {
+    const int first_matrix = handle.first_index(member.league_rank());
+    const int last_matrix  = handle.last_index(member.league_rank());
+
+    auto _TMPView = Kokkos::subview(
+        handle.tmp_view, Kokkos::make_pair(first_matrix, last_matrix),
+        Kokkos::make_pair(0, 6 * numRows));
+
+    return invoke<OperatorType, VectorViewType, PrecOperatorType,
+                  KrylovHandleType>(member, A, _B, _X, P, handle, _TMPView,
+                                    _TMPNormView);
+  }
+  return 0;
+}
+
+template <typename MemberType>
+template <typename OperatorType, typename VectorViewType,
+          typename KrylovHandleType>
+KOKKOS_INLINE_FUNCTION int TeamVectorBiCGStab<MemberType>::invoke(
+    const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+    const VectorViewType& _X, const KrylovHandleType& handle) {
+  Identity P;
+  return invoke<OperatorType, VectorViewType, Identity>(member, A, _B, _X, P,
+                                                        handle);
+}
+
+}  // namespace KokkosBatched
+
+#endif
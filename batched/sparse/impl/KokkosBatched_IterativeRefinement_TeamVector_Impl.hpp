@@ -0,0 +1,242 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_ITERATIVEREFINEMENT_TEAMVECTOR_IMPL_HPP__
+#define __KOKKOSBATCHED_ITERATIVEREFINEMENT_TEAMVECTOR_IMPL_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+#include "KokkosBatched_Axpy.hpp"
+#include "KokkosBatched_Copy_Decl.hpp"
+#include "KokkosBatched_Dot.hpp"
+#include "KokkosBatched_Identity.hpp"
+
+namespace KokkosBatched {
+
+namespace Impl {
+
+///
+/// Workspace of the inner solvers of the iterative refinement: the number of
+/// work vectors and norms per system, and the invoke taking them
+///
+
+template <typename InnerSolverType>
+struct IterativeRefinementInnerSolver;
+
+template <typename MemberType>
+struct IterativeRefinementInnerSolver<TeamVectorCG<MemberType>> {
+  static constexpr int n_vectors = 4;
+  static constexpr int n_norms   = 5;
+
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType, typename TMPViewType,
+            typename TMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const OperatorType &A, const VectorViewType &B,
+      const VectorViewType &X, const KrylovHandleType &handle,
+      const TMPViewType &_TMPView, const TMPNormViewType &_TMPNormView) {
+    return TeamVectorCG<MemberType>::invoke(member, A, B, X, handle, _TMPView,
+                                            _TMPNormView);
+  }
+};
+
+template <typename MemberType>
+struct IterativeRefinementInnerSolver<TeamVectorBiCGStab<MemberType>> {
+  static constexpr int n_vectors = 6;
+  static constexpr int n_norms   = 8;
+
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType, typename TMPViewType,
+            typename TMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const OperatorType &A, const VectorViewType &B,
+      const VectorViewType &X, const KrylovHandleType &handle,
+      const TMPViewType &_TMPView, const TMPNormViewType &_TMPNormView) {
+    Identity P;
+    return TeamVectorBiCGStab<MemberType>::invoke(member, A, B, X, P, handle,
+                                                  _TMPView, _TMPNormView);
+  }
+};
+
+}  // namespace Impl
+
+///
+/// TeamVector iterative refinement
+///
+
+template <typename MemberType, typename InnerSolverType>
+template <typename OperatorType, typename LowOperatorType,
+          typename VectorViewType, typename KrylovHandleType,
+          typename InnerKrylovHandleType, typename InnerTMPViewType,
+          typename InnerTMPNormViewType>
+KOKKOS_INLINE_FUNCTION int
+TeamVectorIterativeRefinement<MemberType, InnerSolverType>::invoke(
+    const MemberType &member, const OperatorType &A,
+    const LowOperatorType &A_low, const VectorViewType &_B,
+    const VectorViewType &_X, const KrylovHandleType &handle,
+    const InnerKrylovHandleType &inner_handle,
+    const InnerTMPViewType &_InnerTMPView,
+    const InnerTMPNormViewType &_InnerTMPNormView) {
+  typedef int OrdinalType;
+  typedef typename VectorViewType::non_const_value_type ScalarType;
+  typedef typename Kokkos::ArithTraits<ScalarType>::mag_type MagnitudeType;
+
+  using ScratchPadVectorViewType = Kokkos::View<
+      ScalarType **, typename VectorViewType::array_layout,
+      typename VectorViewType::execution_space::scratch_memory_space>;
+  using ScratchPadNormViewType = Kokkos::View<
+      MagnitudeType **,
+      typename VectorViewType::execution_space::scratch_memory_space>;
+  using InnerSolver = Impl::IterativeRefinementInnerSolver<InnerSolverType>;
+
+  const size_t maximum_iteration = handle.get_max_iteration();
+  const MagnitudeType tolerance  = handle.get_tolerance();
+
+  const OrdinalType numMatrices = _X.extent(0);
+  const OrdinalType numRows     = _X.extent(1);
+
+  const int level = handle.get_scratch_pad_level();
+
+  ScratchPadVectorViewType R(member.team_scratch(level), numMatrices, numRows);
+  ScratchPadVectorViewType D(member.team_scratch(level), numMatrices, numRows);
+  ScratchPadNormViewType _TMPNormView(member.team_scratch(level), numMatrices,
+                                      4);
+
+  auto sqr_norm_0 = Kokkos::subview(_TMPNormView, Kokkos::ALL, 0);
+  auto sqr_norm_j = Kokkos::subview(_TMPNormView, Kokkos::ALL, 1);
+  auto one        = Kokkos::subview(_TMPNormView, Kokkos::ALL, 2);
+  auto mask       = Kokkos::subview(_TMPNormView, Kokkos::ALL, 3);
+
+  Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, numMatrices),
+                       [&](const OrdinalType &i) {
+                         one(i)  = 1.;
+                         mask(i) = 1.;
+                       });
+
+  // r_0 := b - A x_0
+  TeamVectorCopy<MemberType>::invoke(member, _B, R);
+  member.team_barrier();
+  A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, _X, R, -1, 1);
+  member.team_barrier();
+
+  TeamVectorDot<MemberType>::invoke(member, R, R, sqr_norm_0);
+  member.team_barrier();
+
+  int status = 1;
+
+  for (size_t j = 0; j < maximum_iteration; ++j) {
+    // d := A_low^{-1} r_j, up to the tolerance of inner_handle; every step
+    // reuses the same inner workspace
+    Kokkos::parallel_for(
+        Kokkos::TeamVectorRange(member, 0, numMatrices * numRows),
+        [&](const OrdinalType &k) { D(k / numRows, k % numRows) = 0.; });
+    member.team_barrier();
+
+    InnerSolver::invoke(member, A_low, R, D, inner_handle, _InnerTMPView,
+                        _InnerTMPNormView);
+    member.team_barrier();
+
+    // x_{j+1} := x_j + d
+    TeamVectorAxpy<MemberType>::invoke(member, one, D, _X);
+    member.team_barrier();
+
+    // r_{j+1} := b - A x_{j+1}
+    TeamVectorCopy<MemberType>::invoke(member, _B, R);
+    member.team_barrier();
+    A.template apply<Trans::NoTranspose, Mode::TeamVector>(member, _X, R, -1,
+                                                           1);
+    member.team_barrier();
+
+    TeamVectorDot<MemberType>::invoke(member, R, R, sqr_norm_j);
+    member.team_barrier();
+
+    // Relative convergence check:
+    int number_not_converged = 0;
+    Kokkos::parallel_reduce(
+        Kokkos::TeamVectorRange(member, 0, numMatrices),
+        [&](const OrdinalType &i, int &lnumber_not_converged) {
+          if (sqr_norm_j(i) > tolerance * tolerance * sqr_norm_0(i)) {
+            ++lnumber_not_converged;
+          } else if (mask(i) != 0.) {
+            mask(i) = 0.;
+            handle.set_iteration(member.league_rank(), i, j + 1);
+          }
+        },
+        number_not_converged);
+    member.team_barrier();
+
+    if (number_not_converged == 0) {
+      status = 0;
+      break;
+    }
+  }
+
+  return status;
+}
+
+template <typename MemberType, typename InnerSolverType>
+template <typename OperatorType, typename LowOperatorType,
+          typename VectorViewType, typename KrylovHandleType,
+          typename InnerKrylovHandleType>
+KOKKOS_INLINE_FUNCTION int
+TeamVectorIterativeRefinement<MemberType, InnerSolverType>::invoke(
+    const MemberType &member, const OperatorType &A,
+    const LowOperatorType &A_low, const VectorViewType &_B,
+    const VectorViewType &_X, const KrylovHandleType &handle,
+    const InnerKrylovHandleType &inner_handle) {
+  using ScratchPadVectorViewType = Kokkos::View<
+      typename VectorViewType::non_const_value_type **,
+      typename VectorViewType::array_layout,
+      typename VectorViewType::execution_space::scratch_memory_space>;
+  using ScratchPadNormViewType = Kokkos::View<
+      typename Kokkos::ArithTraits<
+          typename VectorViewType::non_const_value_type>::mag_type **,
+      typename VectorViewType::execution_space::scratch_memory_space>;
+  using InnerSolver = Impl::IterativeRefinementInnerSolver<InnerSolverType>;
+
+  const int strategy = inner_handle.get_memory_strategy();
+
+  const int numMatrices = _X.extent(0);
+  const int numRows     = _X.extent(1);
+
+  ScratchPadNormViewType _InnerTMPNormView(
+      member.team_scratch(inner_handle.get_scratch_pad_level()), numMatrices,
+      InnerSolver::n_norms);
+
+  if (strategy == 0) {
+    ScratchPadVectorViewType _InnerTMPView(
+        member.team_scratch(inner_handle.get_scratch_pad_level()),
+        numMatrices, InnerSolver::n_vectors * numRows);
+
+    return invoke(member, A, A_low, _B, _X, handle, inner_handle,
+                  _InnerTMPView, _InnerTMPNormView);
+  }
+  if (strategy == 1) {
+    const int first_matrix = inner_handle.first_index(member.league_rank());
+    const int last_matrix  = inner_handle.last_index(member.league_rank());
+
+    auto _InnerTMPView = Kokkos::subview(
+        inner_handle.tmp_view, Kokkos::make_pair(first_matrix, last_matrix),
+        Kokkos::make_pair(0, InnerSolver::n_vectors * numRows));
+
+    return invoke(member, A, A_low, _B, _X, handle, inner_handle,
+                  _InnerTMPView, _InnerTMPNormView);
+  }
+  return 0;
+}
+
+}  // namespace KokkosBatched
+
+#endif
@@ -19,6 +19,7 @@
 /// \author Kim Liegeois (knliege@sandia.gov)
 
 #include "KokkosBatched_Util.hpp"
+#include "KokkosKernels_AccumulationType.hpp"
 
 namespace KokkosBatched {
 
@@ -27,11 +28,11 @@ namespace KokkosBatched {
 /// ====================
 struct SerialSpmvInternal {
   template <typename ScalarType, typename ValueType, typename OrdinalType,
-            typename layout, int dobeta>
+            typename layout, int dobeta, typename MatrixValueType>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const OrdinalType numMatrices, const OrdinalType numRows,
       const ScalarType* KOKKOS_RESTRICT alpha, const OrdinalType alphas0,
-      const ValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
+      const MatrixValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
       const OrdinalType valuess1, const OrdinalType* KOKKOS_RESTRICT row_ptr,
       const OrdinalType row_ptrs0,
       const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -49,8 +50,9 @@ struct SerialSpmvInternal {
 #pragma unroll
 #endif
         for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-          sum += values[iMatrix * valuess0 +
-                        (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
+          sum += KokkosKernels::Impl::widen<ValueType>(
+                     values[iMatrix * valuess0 +
+                            (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]) *
                  X[iMatrix * xs0 +
                    colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
                               colIndicess0] *
@@ -72,10 +74,10 @@ struct SerialSpmvInternal {
   }
 
   template <typename ScalarType, typename ValueType, typename OrdinalType,
-            typename layout, int dobeta>
+            typename layout, int dobeta, typename MatrixValueType>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const OrdinalType numMatrices, const OrdinalType numRows,
-      const ScalarType alpha, const ValueType* KOKKOS_RESTRICT values,
+      const ScalarType alpha, const MatrixValueType* KOKKOS_RESTRICT values,
       const OrdinalType valuess0, const OrdinalType valuess1,
       const OrdinalType* KOKKOS_RESTRICT row_ptr, const OrdinalType row_ptrs0,
       const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -92,8 +94,9 @@ struct SerialSpmvInternal {
 #pragma unroll
 #endif
         for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-          sum += values[iMatrix * valuess0 +
-                        (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
+          sum += KokkosKernels::Impl::widen<ValueType>(
+                     values[iMatrix * valuess0 +
+                            (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]) *
                  X[iMatrix * xs0 +
                    colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
                               colIndicess0] *
@@ -248,7 +251,7 @@ struct SerialSpmv<Trans::NoTranspose> {
 
     return SerialSpmvInternal::template invoke<
         typename alphaViewType::non_const_value_type,
-        typename ValuesViewType::non_const_value_type,
+        typename yViewType::non_const_value_type,
         typename IntView::non_const_value_type,
         typename ValuesViewType::array_layout, dobeta>(
         X.extent(0), X.extent(1), alpha.data(), alpha.stride_0(), values.data(),
@@ -262,11 +265,11 @@ struct SerialSpmv<Trans::NoTranspose> {
             typename yViewType, int dobeta>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type& alpha,
+          typename yViewType::non_const_value_type>::mag_type& alpha,
       const ValuesViewType& values, const IntView& row_ptr,
       const IntView& colIndices, const xViewType& X,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type& beta,
+          typename yViewType::non_const_value_type>::mag_type& beta,
       const yViewType& Y) {
 #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
     static_assert(Kokkos::is_view<ValuesViewType>::value,
@@ -356,8 +359,8 @@ struct SerialSpmv<Trans::NoTranspose> {
 
     return SerialSpmvInternal::template invoke<
         typename Kokkos::ArithTraits<
-            typename ValuesViewType::non_const_value_type>::mag_type,
-        typename ValuesViewType::non_const_value_type,
+            typename yViewType::non_const_value_type>::mag_type,
+        typename yViewType::non_const_value_type,
         typename IntView::non_const_value_type,
         typename ValuesViewType::array_layout, dobeta>(
         X.extent(0), X.extent(1), alpha, values.data(), values.stride_0(),
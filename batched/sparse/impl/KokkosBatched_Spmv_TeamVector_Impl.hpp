@@ -19,6 +19,7 @@
 /// \author Kim Liegeois (knliege@sandia.gov)
 
 #include "KokkosBatched_Util.hpp"
+#include "KokkosKernels_AccumulationType.hpp"
 #include "KokkosSparse_spmv_team.hpp"
 
 namespace KokkosBatched {
@@ -28,11 +29,12 @@ namespace KokkosBatched {
 /// ====================
 struct TeamVectorSpmvInternal {
   template <typename MemberType, typename ScalarType, typename ValueType,
-            typename OrdinalType, typename layout, int dobeta, unsigned N_team>
+            typename OrdinalType, typename layout, int dobeta, unsigned N_team,
+            typename MatrixValueType>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType& member, const OrdinalType numMatrices,
       const OrdinalType numRows, const ScalarType* KOKKOS_RESTRICT alpha,
-      const OrdinalType alphas0, const ValueType* KOKKOS_RESTRICT values,
+      const OrdinalType alphas0, const MatrixValueType* KOKKOS_RESTRICT values,
       const OrdinalType valuess0, const OrdinalType valuess1,
       const OrdinalType* KOKKOS_RESTRICT row_ptr, const OrdinalType row_ptrs0,
       const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -43,11 +45,12 @@ struct TeamVectorSpmvInternal {
       const OrdinalType ys1);
 
   template <typename MemberType, typename ScalarType, typename ValueType,
-            typename OrdinalType, typename layout, int dobeta, unsigned N_team>
+            typename OrdinalType, typename layout, int dobeta, unsigned N_team,
+            typename MatrixValueType>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType& member, const OrdinalType numMatrices,
       const OrdinalType numRows, const ScalarType alpha,
-      const ValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
+      const MatrixValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
       const OrdinalType valuess1, const OrdinalType* KOKKOS_RESTRICT row_ptr,
       const OrdinalType row_ptrs0,
       const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -58,11 +61,12 @@ struct TeamVectorSpmvInternal {
 };
 
 template <typename MemberType, typename ScalarType, typename ValueType,
-          typename OrdinalType, typename layout, int dobeta, unsigned N_team>
+          typename OrdinalType, typename layout, int dobeta, unsigned N_team,
+          typename MatrixValueType>
 KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
     const MemberType& member, const OrdinalType numMatrices,
     const OrdinalType numRows, const ScalarType* KOKKOS_RESTRICT alpha,
-    const OrdinalType alphas0, const ValueType* KOKKOS_RESTRICT values,
+    const OrdinalType alphas0, const MatrixValueType* KOKKOS_RESTRICT values,
     const OrdinalType valuess0, const OrdinalType valuess1,
     const OrdinalType* KOKKOS_RESTRICT row_ptr, const OrdinalType row_ptrs0,
     const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -73,71 +77,74 @@ KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
     const OrdinalType ys1) {
 #if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
   if (member.team_size() == 1) {
-    if (N_team > 1 && valuess0 == 1) {
-      /*
-        Left layout as valuess0 = 1 and non-zero vector length given at
-        compilation time. Here we use the SIMD data type which is using Intel
-        Intrinsics under the hood on Intel architectures.
-      */
-      typedef Vector<SIMD<ValueType>, N_team> VectorType;
+    if constexpr (std::is_same<MatrixValueType, ValueType>::value) {
+      if (N_team > 1 && valuess0 == 1) {
+        /*
+          Left layout as valuess0 = 1 and non-zero vector length given at
+          compilation time. Here we use the SIMD data type which is using Intel
+          Intrinsics under the hood on Intel architectures.
+        */
+        typedef Vector<SIMD<ValueType>, N_team> VectorType;
 
-      VectorType alpha_v, beta_v, values_v, y_v, x_v;
+        VectorType alpha_v, beta_v, values_v, y_v, x_v;
 
-      alpha_v.loadAligned(alpha);
-      beta_v.loadAligned(beta);
+        alpha_v.loadAligned(alpha);
+        beta_v.loadAligned(beta);
 
-      for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
-        const OrdinalType rowLength =
-            row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
+        for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
+          const OrdinalType rowLength =
+              row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
 
-        VectorType sum_v(0);
+          VectorType sum_v(0);
 
 #if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
 #pragma unroll
 #endif
-        for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-          values_v.loadAligned(
-              &values[(row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]);
-          x_v.loadAligned(&X[colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
-                                        colIndicess0] *
-                             xs1]);
-          sum_v += values_v * x_v;
-        }
-        sum_v *= alpha_v;
-        if (dobeta != 0) {
-          y_v.loadAligned(&Y[iRow * ys1]);
-          sum_v += y_v * beta_v;
+          for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
+            values_v.loadAligned(
+                &values[(row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]);
+            x_v.loadAligned(&X[colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
+                                          colIndicess0] *
+                               xs1]);
+            sum_v += values_v * x_v;
+          }
+          sum_v *= alpha_v;
+          if (dobeta != 0) {
+            y_v.loadAligned(&Y[iRow * ys1]);
+            sum_v += y_v * beta_v;
+          }
+          sum_v.storeAligned(&Y[iRow * ys1]);
         }
-        sum_v.storeAligned(&Y[iRow * ys1]);
+        return 0;
       }
-    } else {
-      for (unsigned iMatrix = 0; iMatrix < unsigned(numMatrices); ++iMatrix) {
-        for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
-          const OrdinalType rowLength =
-              row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
-
-          ValueType sum = 0;
-          Kokkos::parallel_reduce(
-              Kokkos::ThreadVectorRange(member, rowLength),
-              [&](const OrdinalType& iEntry, ValueType& lsum) {
-                lsum +=
-                    values[iMatrix * valuess0 +
-                           (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
-                    X[iMatrix * xs0 +
-                      colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
-                                 colIndicess0] *
-                          xs1];
-              },
-              sum);
-
-          sum *= alpha[iMatrix * alphas0];
+    }
+    for (unsigned iMatrix = 0; iMatrix < unsigned(numMatrices); ++iMatrix) {
+      for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
+        const OrdinalType rowLength =
+            row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
 
-          if (dobeta == 0) {
-            Y[iMatrix * ys0 + iRow * ys1] = sum;
-          } else {
-            Y[iMatrix * ys0 + iRow * ys1] =
-                beta[iMatrix * betas0] * Y[iMatrix * ys0 + iRow * ys1] + sum;
-          }
+        ValueType sum = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::ThreadVectorRange(member, rowLength),
+            [&](const OrdinalType& iEntry, ValueType& lsum) {
+              lsum +=
+                  KokkosKernels::Impl::widen<ValueType>(
+                      values[iMatrix * valuess0 +
+                             (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]) *
+                  X[iMatrix * xs0 +
+                    colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
+                               colIndicess0] *
+                        xs1];
+            },
+            sum);
+
+        sum *= alpha[iMatrix * alphas0];
+
+        if (dobeta == 0) {
+          Y[iMatrix * ys0 + iRow * ys1] = sum;
+        } else {
+          Y[iMatrix * ys0 + iRow * ys1] =
+              beta[iMatrix * betas0] * Y[iMatrix * ys0 + iRow * ys1] + sum;
         }
       }
     }
@@ -157,8 +164,10 @@ KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
 #pragma unroll
 #endif
           for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-            sum += values[iMatrix * valuess0 +
-                          (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
+            sum += KokkosKernels::Impl::widen<ValueType>(
+                       values[iMatrix * valuess0 +
+                              (row_ptr[iRow * row_ptrs0] + iEntry) *
+                                  valuess1]) *
                    X[iMatrix * xs0 +
                      colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
                                 colIndicess0] *
@@ -181,11 +190,12 @@ KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
 }
 
 template <typename MemberType, typename ScalarType, typename ValueType,
-          typename OrdinalType, typename layout, int dobeta, unsigned N_team>
+          typename OrdinalType, typename layout, int dobeta, unsigned N_team,
+          typename MatrixValueType>
 KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
     const MemberType& member, const OrdinalType numMatrices,
     const OrdinalType numRows, const ScalarType alpha,
-    const ValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
+    const MatrixValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
     const OrdinalType valuess1, const OrdinalType* KOKKOS_RESTRICT row_ptr,
     const OrdinalType row_ptrs0, const OrdinalType* KOKKOS_RESTRICT colIndices,
     const OrdinalType colIndicess0, const ValueType* KOKKOS_RESTRICT X,
@@ -194,68 +204,71 @@ KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
     const OrdinalType ys1) {
 #if !defined(__CUDA_ARCH__) && !defined(__HIP_DEVICE_COMPILE__)
   if (member.team_size() == 1) {
-    if (N_team > 1 && valuess0 == 1 && valuess1 % N_team == 0) {
-      /*
-        Left layout as valuess0 = 1 and non-zero vector length given at
-        compilation time Here we use the SIMD data type which is using Intel
-        Intrinsics under the hood on Intel architectures.
-      */
-      typedef Vector<SIMD<ValueType>, N_team> VectorType;
+    if constexpr (std::is_same<MatrixValueType, ValueType>::value) {
+      if (N_team > 1 && valuess0 == 1 && valuess1 % N_team == 0) {
+        /*
+          Left layout as valuess0 = 1 and non-zero vector length given at
+          compilation time Here we use the SIMD data type which is using Intel
+          Intrinsics under the hood on Intel architectures.
+        */
+        typedef Vector<SIMD<ValueType>, N_team> VectorType;
 
-      VectorType alpha_v(alpha), beta_v(beta), values_v, y_v, x_v;
+        VectorType alpha_v(alpha), beta_v(beta), values_v, y_v, x_v;
 
-      for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
-        const OrdinalType rowLength =
-            row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
+        for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
+          const OrdinalType rowLength =
+              row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
 
-        VectorType sum_v(0);
+          VectorType sum_v(0);
 
 #if defined(KOKKOS_ENABLE_PRAGMA_UNROLL)
 #pragma unroll
 #endif
-        for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-          values_v.loadAligned(
-              &values[(row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]);
-          x_v.loadAligned(&X[colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
-                                        colIndicess0] *
-                             xs1]);
-          sum_v += values_v * x_v;
-        }
-        sum_v *= alpha_v;
-        if (dobeta != 0) {
-          y_v.loadAligned(&Y[iRow * ys1]);
-          sum_v += y_v * beta_v;
+          for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
+            values_v.loadAligned(
+                &values[(row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]);
+            x_v.loadAligned(&X[colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
+                                          colIndicess0] *
+                               xs1]);
+            sum_v += values_v * x_v;
+          }
+          sum_v *= alpha_v;
+          if (dobeta != 0) {
+            y_v.loadAligned(&Y[iRow * ys1]);
+            sum_v += y_v * beta_v;
+          }
+          sum_v.storeAligned(&Y[iRow * ys1]);
         }
-        sum_v.storeAligned(&Y[iRow * ys1]);
+        return 0;
       }
-    } else {
-      for (unsigned iMatrix = 0; iMatrix < unsigned(numMatrices); ++iMatrix) {
-        for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
-          const OrdinalType rowLength =
-              row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
-
-          ValueType sum = 0;
-          Kokkos::parallel_reduce(
-              Kokkos::ThreadVectorRange(member, rowLength),
-              [&](const OrdinalType& iEntry, ValueType& lsum) {
-                lsum +=
-                    values[iMatrix * valuess0 +
-                           (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
-                    X[iMatrix * xs0 +
-                      colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
-                                 colIndicess0] *
-                          xs1];
-              },
-              sum);
-
-          sum *= alpha;
+    }
+    for (unsigned iMatrix = 0; iMatrix < unsigned(numMatrices); ++iMatrix) {
+      for (OrdinalType iRow = 0; iRow < numRows; ++iRow) {
+        const OrdinalType rowLength =
+            row_ptr[(iRow + 1) * row_ptrs0] - row_ptr[iRow * row_ptrs0];
 
-          if (dobeta == 0) {
-            Y[iMatrix * ys0 + iRow * ys1] = sum;
-          } else {
-            Y[iMatrix * ys0 + iRow * ys1] =
-                beta * Y[iMatrix * ys0 + iRow * ys1] + sum;
-          }
+        ValueType sum = 0;
+        Kokkos::parallel_reduce(
+            Kokkos::ThreadVectorRange(member, rowLength),
+            [&](const OrdinalType& iEntry, ValueType& lsum) {
+              lsum +=
+                  KokkosKernels::Impl::widen<ValueType>(
+                      values[iMatrix * valuess0 +
+                             (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]) *
+                  X[iMatrix * xs0 +
+                    colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
+                               colIndicess0] *
+                        xs1];
+            },
+            sum);
+
+        sum *= alpha;
+
+        if (dobeta == 0) {
+          Y[iMatrix * ys0 + iRow * ys1] = sum;
+        } else {
+          Y[iMatrix * ys0 + iRow * ys1] =
+              beta * Y[iMatrix * ys0 + iRow * ys1] + sum;
         }
       }
     }
@@ -275,8 +288,10 @@ KOKKOS_INLINE_FUNCTION int TeamVectorSpmvInternal::invoke(
 #pragma unroll
 #endif
           for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-            sum += values[iMatrix * valuess0 +
-                          (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
+            sum += KokkosKernels::Impl::widen<ValueType>(
+                       values[iMatrix * valuess0 +
+                              (row_ptr[iRow * row_ptrs0] + iEntry) *
+                                  valuess1]) *
                    X[iMatrix * xs0 +
                      colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
                                 colIndicess0] *
@@ -442,7 +457,7 @@ struct TeamVectorSpmv<MemberType, Trans::NoTranspose, N_team> {
 
     return TeamVectorSpmvInternal::template invoke<
         MemberType, typename alphaViewType::non_const_value_type,
-        typename ValuesViewType::non_const_value_type,
+        typename yViewType::non_const_value_type,
         typename IntView::non_const_value_type,
         typename ValuesViewType::array_layout, dobeta, N_team>(
         member, X.extent(0), X.extent(1), alpha.data(), alpha.stride_0(),
@@ -457,11 +472,11 @@ struct TeamVectorSpmv<MemberType, Trans::NoTranspose, N_team> {
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType& member,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type& alpha,
+          typename yViewType::non_const_value_type>::mag_type& alpha,
       const ValuesViewType& values, const IntView& row_ptr,
       const IntView& colIndices, const xViewType& X,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type& beta,
+          typename yViewType::non_const_value_type>::mag_type& beta,
       const yViewType& Y) {
 #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
     static_assert(Kokkos::is_view<ValuesViewType>::value,
@@ -558,8 +573,8 @@ struct TeamVectorSpmv<MemberType, Trans::NoTranspose, N_team> {
     return TeamVectorSpmvInternal::template invoke<
         MemberType,
         typename Kokkos::ArithTraits<
-            typename ValuesViewType::non_const_value_type>::mag_type,
-        typename ValuesViewType::non_const_value_type,
+            typename yViewType::non_const_value_type>::mag_type,
+        typename yViewType::non_const_value_type,
         typename IntView::non_const_value_type,
         typename ValuesViewType::array_layout, dobeta, N_team>(
         member, X.extent(0), X.extent(1), alpha, values.data(),
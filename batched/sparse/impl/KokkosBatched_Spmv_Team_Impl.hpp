@@ -19,6 +19,7 @@
 /// \author Kim Liegeois (knliege@sandia.gov)
 
 #include "KokkosBatched_Util.hpp"
+#include "KokkosKernels_AccumulationType.hpp"
 #include "KokkosSparse_spmv_team.hpp"
 
 namespace KokkosBatched {
@@ -28,11 +29,12 @@ namespace KokkosBatched {
 /// ====================
 struct TeamSpmvInternal {
   template <typename MemberType, typename ScalarType, typename ValueType,
-            typename OrdinalType, typename layout, int dobeta>
+            typename OrdinalType, typename layout, int dobeta,
+            typename MatrixValueType>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType& member, const OrdinalType numMatrices,
       const OrdinalType numRows, const ScalarType* KOKKOS_RESTRICT alpha,
-      const OrdinalType alphas0, const ValueType* KOKKOS_RESTRICT values,
+      const OrdinalType alphas0, const MatrixValueType* KOKKOS_RESTRICT values,
       const OrdinalType valuess0, const OrdinalType valuess1,
       const OrdinalType* KOKKOS_RESTRICT row_ptr, const OrdinalType row_ptrs0,
       const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -43,11 +45,12 @@ struct TeamSpmvInternal {
       const OrdinalType ys1);
 
   template <typename MemberType, typename ScalarType, typename ValueType,
-            typename OrdinalType, typename layout, int dobeta>
+            typename OrdinalType, typename layout, int dobeta,
+            typename MatrixValueType>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType& member, const OrdinalType numMatrices,
       const OrdinalType numRows, const ScalarType alpha,
-      const ValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
+      const MatrixValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
       const OrdinalType valuess1, const OrdinalType* KOKKOS_RESTRICT row_ptr,
       const OrdinalType row_ptrs0,
       const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -58,11 +61,12 @@ struct TeamSpmvInternal {
 };
 
 template <typename MemberType, typename ScalarType, typename ValueType,
-          typename OrdinalType, typename layout, int dobeta>
+          typename OrdinalType, typename layout, int dobeta,
+          typename MatrixValueType>
 KOKKOS_INLINE_FUNCTION int TeamSpmvInternal::invoke(
     const MemberType& member, const OrdinalType numMatrices,
     const OrdinalType numRows, const ScalarType* KOKKOS_RESTRICT alpha,
-    const OrdinalType alphas0, const ValueType* KOKKOS_RESTRICT values,
+    const OrdinalType alphas0, const MatrixValueType* KOKKOS_RESTRICT values,
     const OrdinalType valuess0, const OrdinalType valuess1,
     const OrdinalType* KOKKOS_RESTRICT row_ptr, const OrdinalType row_ptrs0,
     const OrdinalType* KOKKOS_RESTRICT colIndices,
@@ -85,8 +89,9 @@ KOKKOS_INLINE_FUNCTION int TeamSpmvInternal::invoke(
 #pragma unroll
 #endif
         for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-          sum += values[iMatrix * valuess0 +
-                        (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
+          sum += KokkosKernels::Impl::widen<ValueType>(
+                     values[iMatrix * valuess0 +
+                            (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]) *
                  X[iMatrix * xs0 +
                    colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
                               colIndicess0] *
@@ -107,11 +112,12 @@ KOKKOS_INLINE_FUNCTION int TeamSpmvInternal::invoke(
 }
 
 template <typename MemberType, typename ScalarType, typename ValueType,
-          typename OrdinalType, typename layout, int dobeta>
+          typename OrdinalType, typename layout, int dobeta,
+          typename MatrixValueType>
 KOKKOS_INLINE_FUNCTION int TeamSpmvInternal::invoke(
     const MemberType& member, const OrdinalType numMatrices,
     const OrdinalType numRows, const ScalarType alpha,
-    const ValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
+    const MatrixValueType* KOKKOS_RESTRICT values, const OrdinalType valuess0,
     const OrdinalType valuess1, const OrdinalType* KOKKOS_RESTRICT row_ptr,
     const OrdinalType row_ptrs0, const OrdinalType* KOKKOS_RESTRICT colIndices,
     const OrdinalType colIndicess0, const ValueType* KOKKOS_RESTRICT X,
@@ -132,8 +138,9 @@ KOKKOS_INLINE_FUNCTION int TeamSpmvInternal::invoke(
 #pragma unroll
 #endif
         for (OrdinalType iEntry = 0; iEntry < rowLength; ++iEntry) {
-          sum += values[iMatrix * valuess0 +
-                        (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1] *
+          sum += KokkosKernels::Impl::widen<ValueType>(
+                     values[iMatrix * valuess0 +
+                            (row_ptr[iRow * row_ptrs0] + iEntry) * valuess1]) *
                  X[iMatrix * xs0 +
                    colIndices[(row_ptr[iRow * row_ptrs0] + iEntry) *
                               colIndicess0] *
@@ -293,7 +300,7 @@ struct TeamSpmv<MemberType, Trans::NoTranspose> {
 
     return TeamSpmvInternal::template invoke<
         MemberType, typename alphaViewType::non_const_value_type,
-        typename ValuesViewType::non_const_value_type,
+        typename yViewType::non_const_value_type,
         typename IntView::non_const_value_type,
         typename ValuesViewType::array_layout, dobeta>(
         member, X.extent(0), X.extent(1), alpha.data(), alpha.stride_0(),
@@ -308,11 +315,11 @@ struct TeamSpmv<MemberType, Trans::NoTranspose> {
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType& member,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type& alpha,
+          typename yViewType::non_const_value_type>::mag_type& alpha,
       const ValuesViewType& values, const IntView& row_ptr,
       const IntView& colIndices, const xViewType& X,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type& beta,
+          typename yViewType::non_const_value_type>::mag_type& beta,
       const yViewType& Y) {
 #if (KOKKOSKERNELS_DEBUG_LEVEL > 0)
     static_assert(Kokkos::is_view<ValuesViewType>::value,
@@ -409,8 +416,8 @@ struct TeamSpmv<MemberType, Trans::NoTranspose> {
     return TeamSpmvInternal::template invoke<
         MemberType,
         typename Kokkos::ArithTraits<
-            typename ValuesViewType::non_const_value_type>::mag_type,
-        typename ValuesViewType::non_const_value_type,
+            typename yViewType::non_const_value_type>::mag_type,
+        typename yViewType::non_const_value_type,
         typename IntView::non_const_value_type,
         typename ValuesViewType::array_layout, dobeta>(
         member, X.extent(0), X.extent(1), alpha, values.data(),
@@ -0,0 +1,89 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_BICGSTAB_HPP__
+#define __KOKKOSBATCHED_BICGSTAB_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+/// \brief Batched BiCGStab: Selective Interface
+///
+/// Right-preconditioned BiCGStab for batches of nonsymmetric systems. In
+/// contrast to GMRES, the work space is fixed (six vectors per system) and
+/// does not depend on the number of iterations.
+///
+/// \tparam OperatorType: The type of the operator of the system
+/// \tparam VectorViewType: Input type for the right-hand side and the solution,
+/// needs to be a 2D view
+/// \tparam PrecOperatorType: The type of the (right) preconditioner, for
+/// instance JacobiPrec or ILU0Prec
+///
+/// \param member [in]: TeamPolicy member
+/// \param A [in]: batched operator
+/// \param B [in]: right-hand side, a rank 2 view
+/// \param X [in/out]: initial guess and solution, a rank 2 view
+/// \param P [in]: batched preconditioner
+/// \param handle [in]: a handle which provides different information such as
+/// the tolerance or the maximal number of iterations of the solver.
+/// \return 0 if every system converged; nonzero if a system reached the
+/// maximal number of iterations or broke down. A system that broke down
+/// stops, and the handle records the number of iterations it completed.
+
+#include <KokkosBatched_Krylov_Solvers.hpp>
+#include "KokkosBatched_Krylov_Handle.hpp"
+#include "KokkosBatched_BiCGStab_Team_Impl.hpp"
+#include "KokkosBatched_BiCGStab_TeamVector_Impl.hpp"
+
+namespace KokkosBatched {
+
+template <typename MemberType, typename ArgMode>
+struct BiCGStab {
+  template <typename OperatorType, typename VectorViewType,
+            typename PrecOperatorType, typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const OperatorType &A,
+                                           const VectorViewType &B,
+                                           const VectorViewType &X,
+                                           const PrecOperatorType &P,
+                                           const KrylovHandleType &handle) {
+    int status = 0;
+    if (std::is_same<ArgMode, Mode::Team>::value) {
+      status = TeamBiCGStab<MemberType>::template invoke<
+          OperatorType, VectorViewType, PrecOperatorType>(member, A, B, X, P,
+                                                          handle);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      status = TeamVectorBiCGStab<MemberType>::template invoke<
+          OperatorType, VectorViewType, PrecOperatorType>(member, A, B, X, P,
+                                                          handle);
+    }
+    return status;
+  }
+
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType &member,
+                                           const OperatorType &A,
+                                           const VectorViewType &B,
+                                           const VectorViewType &X,
+                                           const KrylovHandleType &handle) {
+    Identity P;
+    return invoke<OperatorType, VectorViewType, Identity>(member, A, B, X, P,
+                                                          handle);
+  }
+};
+
+}  // namespace KokkosBatched
+#endif
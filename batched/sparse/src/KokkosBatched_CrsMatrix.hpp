@@ -32,6 +32,13 @@ class CrsMatrix {
   using ScalarType    = typename ValuesViewType::non_const_value_type;
   using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
 
+  /// alpha and beta are applied in the precision of the vectors, which can be
+  /// higher than the one of the stored values (e.g. half_t values with float
+  /// vectors).
+  template <typename ViewType>
+  using VectorMagnitudeType = typename Kokkos::ArithTraits<
+      typename ViewType::non_const_value_type>::mag_type;
+
  private:
   ValuesViewType values;
   IntViewType row_ptr;
@@ -81,9 +88,11 @@ class CrsMatrix {
             typename XViewType, typename YViewType>
   KOKKOS_INLINE_FUNCTION void apply(
       const MemberType &member, const XViewType &X, const YViewType &Y,
-      MagnitudeType alpha = Kokkos::ArithTraits<MagnitudeType>::one(),
-      MagnitudeType beta  = Kokkos::ArithTraits<MagnitudeType>::zero()) const {
-    if (beta == Kokkos::ArithTraits<MagnitudeType>::zero()) {
+      VectorMagnitudeType<YViewType> alpha =
+          Kokkos::ArithTraits<VectorMagnitudeType<YViewType>>::one(),
+      VectorMagnitudeType<YViewType> beta =
+          Kokkos::ArithTraits<VectorMagnitudeType<YViewType>>::zero()) const {
+    if (beta == Kokkos::ArithTraits<VectorMagnitudeType<YViewType>>::zero()) {
       if (member.team_size() == 1 && n_operators == 8)
         KokkosBatched::TeamVectorSpmv<MemberType, ArgTrans, 8>::template invoke<
             ValuesViewType, IntViewType, XViewType, YViewType, 0>(
@@ -107,9 +116,11 @@ class CrsMatrix {
   template <typename ArgTrans, typename XViewType, typename YViewType>
   KOKKOS_INLINE_FUNCTION void apply(
       const XViewType &X, const YViewType &Y,
-      MagnitudeType alpha = Kokkos::ArithTraits<MagnitudeType>::one(),
-      MagnitudeType beta  = Kokkos::ArithTraits<MagnitudeType>::zero()) const {
-    if (beta == Kokkos::ArithTraits<MagnitudeType>::zero())
+      VectorMagnitudeType<YViewType> alpha =
+          Kokkos::ArithTraits<VectorMagnitudeType<YViewType>>::one(),
+      VectorMagnitudeType<YViewType> beta =
+          Kokkos::ArithTraits<VectorMagnitudeType<YViewType>>::zero()) const {
+    if (beta == Kokkos::ArithTraits<VectorMagnitudeType<YViewType>>::zero())
       KokkosBatched::SerialSpmv<ArgTrans>::template invoke<
           ValuesViewType, IntViewType, XViewType, YViewType, 0>(
           alpha, values, row_ptr, colIndices, X, beta, Y);
@@ -0,0 +1,220 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_ILU0PREC_HPP__
+#define __KOKKOSBATCHED_ILU0PREC_HPP__
+
+#include "KokkosBatched_Util.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Batched ILU(0) Preconditioner:
+///
+/// Incomplete LU factorization without fill-in of N sparse matrices which
+/// share the same sparsity pattern. The factors are stored in place of the
+/// values of the matrices: the strictly lower part holds L (with an implicit
+/// unit diagonal) and the upper part, diagonal included, holds U. The values
+/// given to the preconditioner are therefore overwritten and should be a copy
+/// of the values of the batched matrix.
+///
+/// The column indices of each row have to be sorted and every row has to
+/// store its diagonal entry. The factorization is computed the first time the
+/// preconditioner is applied unless setFactorized() is called.
+///
+/// Each matrix is factorized and solved sequentially; the parallelism is
+/// expressed across the matrices of the batch.
+///
+/// \tparam ValuesViewType: Input type for the values of the batched crs
+/// matrix, needs to be a 2D view
+/// \tparam IntViewType: Input type for row offset array and column-index
+/// array, needs to be a 1D view
+
+template <class ValuesViewType, class IntViewType>
+class ILU0Prec {
+ public:
+  using ScalarType    = typename ValuesViewType::non_const_value_type;
+  using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+
+ private:
+  ValuesViewType values;
+  IntViewType row_ptr;
+  IntViewType colIndices;
+  int n_operators;
+  int n_rows;
+  mutable bool factorized = false;
+
+  KOKKOS_INLINE_FUNCTION int diagonalIndex(const int row) const {
+    int k = row_ptr(row);
+    while (k < row_ptr(row + 1) - 1 && colIndices(k) < row) ++k;
+    return k;
+  }
+
+  /// IKJ variant of the ILU(0) factorization of the matrix l of the batch,
+  /// returns the number of pivots which have been replaced by one.
+  KOKKOS_INLINE_FUNCTION int factorizeOne(const int l) const {
+    const auto one     = Kokkos::ArithTraits<ScalarType>::one();
+    const auto epsilon = Kokkos::ArithTraits<MagnitudeType>::epsilon();
+    int tooSmall       = 0;
+
+    for (int i = 0; i < n_rows; ++i) {
+      const int row_end = row_ptr(i + 1);
+      for (int ik = row_ptr(i); ik < row_end; ++ik) {
+        const int k = colIndices(ik);
+        if (k >= i) break;
+        values(l, ik) /= values(l, diagonalIndex(k));
+
+        // a_ij -= a_ik * a_kj for all j > k in the pattern of both rows
+        int kj           = diagonalIndex(k) + 1;
+        const int kj_end = row_ptr(k + 1);
+        for (int ij = ik + 1; ij < row_end && kj < kj_end; ++ij) {
+          const int j = colIndices(ij);
+          while (kj < kj_end && colIndices(kj) < j) ++kj;
+          if (kj < kj_end && colIndices(kj) == j)
+            values(l, ij) -= values(l, ik) * values(l, kj);
+        }
+      }
+      const int ii = diagonalIndex(i);
+      if (Kokkos::ArithTraits<ScalarType>::abs(values(l, ii)) <= epsilon) {
+        ++tooSmall;
+        values(l, ii) = one;
+      }
+    }
+    return tooSmall;
+  }
+
+  /// y_l := U_l^{-1} L_l^{-1} x_l
+  template <int sameXY, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void solveOne(const int l, const XViewType &X,
+                                       const YViewType &Y) const {
+    if (sameXY == 0)
+      for (int i = 0; i < n_rows; ++i) Y(l, i) = X(l, i);
+
+    for (int i = 1; i < n_rows; ++i) {
+      ScalarType y_i = Y(l, i);
+      for (int ik = row_ptr(i); ik < row_ptr(i + 1); ++ik) {
+        const int k = colIndices(ik);
+        if (k >= i) break;
+        y_i -= values(l, ik) * Y(l, k);
+      }
+      Y(l, i) = y_i;
+    }
+
+    for (int i = n_rows - 1; i >= 0; --i) {
+      const int ii   = diagonalIndex(i);
+      ScalarType y_i = Y(l, i);
+      for (int ik = ii + 1; ik < row_ptr(i + 1); ++ik)
+        y_i -= values(l, ik) * Y(l, colIndices(ik));
+      Y(l, i) = y_i / values(l, ii);
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION void reportTooSmall(const int tooSmall) const {
+    if (tooSmall > 0)
+#if KOKKOS_VERSION < 40199
+      KOKKOS_IMPL_DO_NOT_USE_PRINTF(
+          "KokkosBatched::ILU0Prec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#else
+      Kokkos::printf(
+          "KokkosBatched::ILU0Prec: %d pivot(s) has/have a too small "
+          "magnitude and have been replaced by one, \n",
+          (int)tooSmall);
+#endif
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  ILU0Prec(const ValuesViewType &_values, const IntViewType &_row_ptr,
+           const IntViewType &_colIndices)
+      : values(_values), row_ptr(_row_ptr), colIndices(_colIndices) {
+    n_operators = _values.extent(0);
+    n_rows      = _row_ptr.extent(0) - 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~ILU0Prec() {}
+
+  KOKKOS_INLINE_FUNCTION void setFactorized() { factorized = true; }
+
+  template <typename MemberType, typename ArgMode>
+  KOKKOS_INLINE_FUNCTION void factorize(const MemberType &member) const {
+    int tooSmall = 0;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l) tooSmall += factorizeOne(l);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_reduce(
+          Kokkos::TeamThreadRange(member, 0, n_operators),
+          [&](const int &l, int &ltooSmall) { ltooSmall += factorizeOne(l); },
+          tooSmall);
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_reduce(
+          Kokkos::TeamVectorRange(member, 0, n_operators),
+          [&](const int &l, int &ltooSmall) { ltooSmall += factorizeOne(l); },
+          tooSmall);
+    }
+    reportTooSmall(tooSmall);
+    factorized = true;
+  }
+
+  KOKKOS_INLINE_FUNCTION void factorize() const {
+    int tooSmall = 0;
+    for (int l = 0; l < n_operators; ++l) tooSmall += factorizeOne(l);
+    reportTooSmall(tooSmall);
+    factorized = true;
+  }
+
+  template <typename ArgTrans, typename ArgMode, int sameXY,
+            typename MemberType, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(const MemberType &member,
+                                    const XViewType &X,
+                                    const YViewType &Y) const {
+    if (!factorized) {
+      this->factorize<MemberType, ArgMode>(member);
+      member.team_barrier();  // Finish writing to this->values
+    }
+
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int l = 0; l < n_operators; ++l)
+        solveOne<sameXY, XViewType, YViewType>(l, X, Y);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_for(Kokkos::TeamThreadRange(member, 0, n_operators),
+                           [&](const int &l) {
+                             solveOne<sameXY, XViewType, YViewType>(l, X, Y);
+                           });
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_for(Kokkos::TeamVectorRange(member, 0, n_operators),
+                           [&](const int &l) {
+                             solveOne<sameXY, XViewType, YViewType>(l, X, Y);
+                           });
+    }
+  }
+
+  template <typename ArgTrans, int sameXY, typename XViewType,
+            typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(const XViewType &X,
+                                    const YViewType &Y) const {
+    if (!factorized) {
+      this->factorize();
+    }
+
+    for (int l = 0; l < n_operators; ++l)
+      solveOne<sameXY, XViewType, YViewType>(l, X, Y);
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
@@ -0,0 +1,226 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_INTERLEAVEDCRSMATRIX_HPP__
+#define __KOKKOSBATCHED_INTERLEAVEDCRSMATRIX_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Pack the values of a batched crs matrix into the interleaved layout
+///
+///   packed(p, k)[v] = values(p * l + v, k)
+///
+/// where l is the vector length of the SIMD type. The lanes of the last pack
+/// which do not correspond to a matrix are set to zero.
+///
+/// \tparam ValuesViewType: Input type for the values, needs to be a 2D view of
+/// scalars of extent N x nnz
+/// \tparam PackedValuesViewType: Output type, needs to be a 2D view of
+/// Vector<SIMD<T>, l> of extent ceil(N / l) x nnz
+template <typename ValuesViewType, typename PackedValuesViewType>
+void packInterleaved(const ValuesViewType &values,
+                     const PackedValuesViewType &packed) {
+  using execution_space = typename PackedValuesViewType::execution_space;
+  using vector_type     = typename PackedValuesViewType::non_const_value_type;
+  constexpr int l       = vector_type::vector_length;
+
+  const int N       = values.extent(0);
+  const int nnz     = values.extent(1);
+  const int n_packs = packed.extent(0);
+
+  Kokkos::parallel_for(
+      "KokkosBatched::packInterleaved",
+      Kokkos::RangePolicy<execution_space>(0, n_packs * nnz),
+      KOKKOS_LAMBDA(const int &iTemp) {
+        const int p = iTemp / nnz;
+        const int k = iTemp % nnz;
+        vector_type v(0);
+        for (int iLane = 0; iLane < l && p * l + iLane < N; ++iLane)
+          v[iLane] = values(p * l + iLane, k);
+        packed(p, k) = v;
+      });
+}
+
+/// \brief Batched CrsMatrix with interleaved values:
+///
+/// The N matrices share the same sparsity pattern and their values are
+/// interleaved by packs of l matrices, where l is the vector length of
+/// Vector<SIMD<T>, l>: one traversal of a row updates l systems at once with
+/// vector instructions instead of walking the matrices one after the other.
+///
+/// The operator can be used in place of CrsMatrix in the batched Krylov
+/// solvers (CG, GMRES, BiCGStab): the right-hand sides and the solutions keep
+/// their usual N x n layout, only the matrix values are packed. The left
+/// layout for X and Y is preferred as the l entries of a pack are then
+/// contiguous in memory.
+///
+/// When a team handles a subset of the matrices, the first matrix of the
+/// subset has to be the first matrix of a pack; i.e. the number of systems
+/// per team has to be a multiple of l.
+///
+/// \tparam PackedValuesViewType: Input type for the packed values, needs to
+/// be a 2D view of Vector<SIMD<T>, l> of extent ceil(N / l) x nnz
+/// \tparam IntViewType: Input type for row offset array and column-index
+/// array, needs to be a 1D view
+
+template <class PackedValuesViewType, class IntViewType>
+class InterleavedCrsMatrix {
+ public:
+  using VectorType = typename PackedValuesViewType::non_const_value_type;
+  using ScalarType = typename VectorType::value_type;
+  using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+
+  enum : int { vector_length = VectorType::vector_length };
+
+ private:
+  PackedValuesViewType values;
+  IntViewType row_ptr;
+  IntViewType colIndices;
+  int n_rows;
+
+  /// Computes row iRow of the pack iPack: gathers the l entries of X, runs the
+  /// sparse dot product on SIMD vectors and scatters the l results into Y.
+  template <int dobeta, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void applyRow(const int iPack, const int iRow,
+                                       const XViewType &X, const YViewType &Y,
+                                       const MagnitudeType alpha,
+                                       const MagnitudeType beta) const {
+    const int first_matrix = iPack * vector_length;
+    const int n_lanes =
+        (int(X.extent(0)) - first_matrix < vector_length
+             ? int(X.extent(0)) - first_matrix
+             : int(vector_length));
+    const bool contiguous = X.stride_0() == 1 && n_lanes == vector_length;
+
+    VectorType sum(0), x_v(0);
+    for (int k = row_ptr(iRow); k < row_ptr(iRow + 1); ++k) {
+      const int iCol = colIndices(k);
+      if (contiguous)
+        x_v.loadUnaligned(&X(first_matrix, iCol));
+      else
+        for (int iLane = 0; iLane < n_lanes; ++iLane)
+          x_v[iLane] = X(first_matrix + iLane, iCol);
+      sum += values(iPack, k) * x_v;
+    }
+
+    for (int iLane = 0; iLane < n_lanes; ++iLane) {
+      if (dobeta == 0)
+        Y(first_matrix + iLane, iRow) = alpha * sum[iLane];
+      else
+        Y(first_matrix + iLane, iRow) =
+            alpha * sum[iLane] + beta * Y(first_matrix + iLane, iRow);
+    }
+  }
+
+  template <int dobeta, typename ArgMode, typename MemberType,
+            typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void applyAll(const MemberType &member,
+                                       const XViewType &X, const YViewType &Y,
+                                       const MagnitudeType alpha,
+                                       const MagnitudeType beta) const {
+    const int n_local_packs =
+        (int(X.extent(0)) + vector_length - 1) / vector_length;
+    if (std::is_same<ArgMode, Mode::Serial>::value) {
+      for (int iPack = 0; iPack < n_local_packs; ++iPack)
+        for (int iRow = 0; iRow < n_rows; ++iRow)
+          applyRow<dobeta>(iPack, iRow, X, Y, alpha, beta);
+    } else if (std::is_same<ArgMode, Mode::Team>::value) {
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(member, 0, n_local_packs * n_rows),
+          [&](const int &iTemp) {
+            applyRow<dobeta>(iTemp / n_rows, iTemp % n_rows, X, Y, alpha,
+                             beta);
+          });
+    } else if (std::is_same<ArgMode, Mode::TeamVector>::value) {
+      Kokkos::parallel_for(
+          Kokkos::TeamVectorRange(member, 0, n_local_packs * n_rows),
+          [&](const int &iTemp) {
+            applyRow<dobeta>(iTemp / n_rows, iTemp % n_rows, X, Y, alpha,
+                             beta);
+          });
+    }
+  }
+
+ public:
+  KOKKOS_INLINE_FUNCTION
+  InterleavedCrsMatrix(const PackedValuesViewType &_values,
+                       const IntViewType &_row_ptr,
+                       const IntViewType &_colIndices)
+      : values(_values), row_ptr(_row_ptr), colIndices(_colIndices) {
+    n_rows = _row_ptr.extent(0) - 1;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  ~InterleavedCrsMatrix() {}
+
+  /// \brief apply version that uses constant coefficients alpha and beta
+  ///
+  ///   y_l <- alpha * A_l * x_l + beta * y_l for all l = 1, ..., N
+  ///
+  /// Only Trans::NoTranspose is supported.
+  ///
+  /// \tparam MemberType: Input type for the TeamPolicy member
+  /// \tparam XViewType: Input type for X, needs to be a 2D view
+  /// \tparam YViewType: Input type for Y, needs to be a 2D view
+  /// \tparam ArgTrans: Argument for transpose or notranspose
+  /// \tparam ArgMode: Argument for the parallelism used in the apply
+  ///
+  /// \param member [in]: TeamPolicy member
+  /// \param alpha [in]: input coefficient for X (default value 1.)
+  /// \param X [in]: Input vector X, a rank 2 view
+  /// \param beta [in]: input coefficient for Y (default value 0.)
+  /// \param Y [in/out]: Output vector Y, a rank 2 view
+
+  template <typename ArgTrans, typename ArgMode, typename MemberType,
+            typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(
+      const MemberType &member, const XViewType &X, const YViewType &Y,
+      MagnitudeType alpha = Kokkos::ArithTraits<MagnitudeType>::one(),
+      MagnitudeType beta  = Kokkos::ArithTraits<MagnitudeType>::zero()) const {
+    static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value,
+                  "KokkosBatched::InterleavedCrsMatrix: only "
+                  "Trans::NoTranspose is supported.");
+    if (beta == Kokkos::ArithTraits<MagnitudeType>::zero())
+      applyAll<0, ArgMode>(member, X, Y, alpha, beta);
+    else
+      applyAll<1, ArgMode>(member, X, Y, alpha, beta);
+  }
+
+  template <typename ArgTrans, typename XViewType, typename YViewType>
+  KOKKOS_INLINE_FUNCTION void apply(
+      const XViewType &X, const YViewType &Y,
+      MagnitudeType alpha = Kokkos::ArithTraits<MagnitudeType>::one(),
+      MagnitudeType beta  = Kokkos::ArithTraits<MagnitudeType>::zero()) const {
+    static_assert(std::is_same<ArgTrans, Trans::NoTranspose>::value,
+                  "KokkosBatched::InterleavedCrsMatrix: only "
+                  "Trans::NoTranspose is supported.");
+    const int n_local_packs =
+        (int(X.extent(0)) + vector_length - 1) / vector_length;
+    for (int iPack = 0; iPack < n_local_packs; ++iPack)
+      for (int iRow = 0; iRow < n_rows; ++iRow) {
+        if (beta == Kokkos::ArithTraits<MagnitudeType>::zero())
+          applyRow<0>(iPack, iRow, X, Y, alpha, beta);
+        else
+          applyRow<1>(iPack, iRow, X, Y, alpha, beta);
+      }
+  }
+};
+
+}  // namespace KokkosBatched
+
+#endif
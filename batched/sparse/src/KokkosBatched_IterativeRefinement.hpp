@@ -0,0 +1,89 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef __KOKKOSBATCHED_ITERATIVEREFINEMENT_HPP__
+#define __KOKKOSBATCHED_ITERATIVEREFINEMENT_HPP__
+
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_CG.hpp"
+#include "KokkosBatched_BiCGStab.hpp"
+
+namespace KokkosBatched {
+
+/// \brief Batched mixed-precision iterative refinement
+///
+///   r_0 := b - A x_0
+///   for j = 0, 1, ...:
+///     solve A_low d = r_j with InnerSolverType
+///     x_{j+1} := x_j + d
+///     r_{j+1} := b - A x_{j+1}
+///
+/// The residuals are computed with A, typically stored in the precision of
+/// the vectors, while the correction equations use A_low, typically a
+/// CrsMatrix sharing the graph of A with values stored in half_t or bhalf_t.
+/// The inner solver then streams half of the bytes per iteration and only
+/// needs to reach the loose tolerance of inner_handle.
+///
+/// \tparam InnerSolverType: solver used for the correction equations,
+/// TeamVectorCG or TeamVectorBiCGStab
+///
+/// \param member [in]: TeamPolicy member
+/// \param A [in]: batched operator used for the residuals
+/// \param A_low [in]: batched operator used for the corrections
+/// \param B [in]: right-hand side, a rank 2 view
+/// \param X [in/out]: initial guess and solution, a rank 2 view
+/// \param handle [in]: the tolerance and the maximal number of refinement
+/// steps; the number of steps of each converged system is stored in it
+/// \param inner_handle [in]: the handle passed to InnerSolverType
+///
+/// The workspace of InnerSolverType is allocated once and reused by every
+/// refinement step, since team scratch is not released within a kernel.
+/// The team needs two vectors and four norms per system at the scratch pad
+/// level of handle, and the norms of the inner solver (five for CG, eight
+/// for BiCGStab) at the scratch pad level of inner_handle. The work vectors
+/// of the inner solver (four for CG, six for BiCGStab) come from the same
+/// scratch with the memory strategy 0 of inner_handle and from its tmp_view
+/// with the memory strategy 1. Returns 0 when every system converged, 1
+/// otherwise.
+template <typename MemberType,
+          typename InnerSolverType = TeamVectorCG<MemberType>>
+struct TeamVectorIterativeRefinement {
+  template <typename OperatorType, typename LowOperatorType,
+            typename VectorViewType, typename KrylovHandleType,
+            typename InnerKrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const OperatorType &A,
+      const LowOperatorType &A_low, const VectorViewType &_B,
+      const VectorViewType &_X, const KrylovHandleType &handle,
+      const InnerKrylovHandleType &inner_handle);
+  template <typename OperatorType, typename LowOperatorType,
+            typename VectorViewType, typename KrylovHandleType,
+            typename InnerKrylovHandleType, typename InnerTMPViewType,
+            typename InnerTMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType &member, const OperatorType &A,
+      const LowOperatorType &A_low, const VectorViewType &_B,
+      const VectorViewType &_X, const KrylovHandleType &handle,
+      const InnerKrylovHandleType &inner_handle,
+      const InnerTMPViewType &_InnerTMPView,
+      const InnerTMPNormViewType &_InnerTMPNormView);
+};
+
+}  // namespace KokkosBatched
+
+#include "KokkosBatched_IterativeRefinement_TeamVector_Impl.hpp"
+
+#endif
@@ -41,6 +41,10 @@ namespace KokkosBatched {
 ///  - iteration_numbers is a 1D view of length batched_size;
 ///  - first_index and last_index are 1D of length n_teams.
 ///
+/// In the case of the Batched BiCGStab, Arnoldi_view is not used and tmp_view
+/// is only used with the memory strategy 1 and should be batched_size x
+/// (6 * n_rows).
+///
 /// \tparam NormViewType: type of the view used to store the convergence history
 /// \tparam IntViewType: type of the view used to store the number of iteration
 /// per system \tparam ViewType3D: type of the 3D temporary views
@@ -480,6 +484,14 @@ class KrylovHandle {
   friend struct TeamCG;
   template <typename MemberType>
   friend struct TeamVectorCG;
+
+  template <typename MemberType>
+  friend struct TeamBiCGStab;
+  template <typename MemberType>
+  friend struct TeamVectorBiCGStab;
+
+  template <typename MemberType, typename InnerSolverType>
+  friend struct TeamVectorIterativeRefinement;
 };
 
 }  // namespace KokkosBatched
@@ -126,6 +126,60 @@ struct TeamVectorCG {
                                            const KrylovHandleType& handle);
 };
 
+template <typename MemberType>
+struct TeamBiCGStab {
+  template <typename OperatorType, typename VectorViewType,
+            typename PrecOperatorType, typename KrylovHandleType,
+            typename TMPViewType, typename TMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+      const VectorViewType& _X, const PrecOperatorType& P,
+      const KrylovHandleType& handle, const TMPViewType& _TMPView,
+      const TMPNormViewType& _TMPNormView);
+  template <typename OperatorType, typename VectorViewType,
+            typename PrecOperatorType, typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType& member,
+                                           const OperatorType& A,
+                                           const VectorViewType& _B,
+                                           const VectorViewType& _X,
+                                           const PrecOperatorType& P,
+                                           const KrylovHandleType& handle);
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType& member,
+                                           const OperatorType& A,
+                                           const VectorViewType& _B,
+                                           const VectorViewType& _X,
+                                           const KrylovHandleType& handle);
+};
+
+template <typename MemberType>
+struct TeamVectorBiCGStab {
+  template <typename OperatorType, typename VectorViewType,
+            typename PrecOperatorType, typename KrylovHandleType,
+            typename TMPViewType, typename TMPNormViewType>
+  KOKKOS_INLINE_FUNCTION static int invoke(
+      const MemberType& member, const OperatorType& A, const VectorViewType& _B,
+      const VectorViewType& _X, const PrecOperatorType& P,
+      const KrylovHandleType& handle, const TMPViewType& _TMPView,
+      const TMPNormViewType& _TMPNormView);
+  template <typename OperatorType, typename VectorViewType,
+            typename PrecOperatorType, typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType& member,
+                                           const OperatorType& A,
+                                           const VectorViewType& _B,
+                                           const VectorViewType& _X,
+                                           const PrecOperatorType& P,
+                                           const KrylovHandleType& handle);
+  template <typename OperatorType, typename VectorViewType,
+            typename KrylovHandleType>
+  KOKKOS_INLINE_FUNCTION static int invoke(const MemberType& member,
+                                           const OperatorType& A,
+                                           const VectorViewType& _B,
+                                           const VectorViewType& _X,
+                                           const KrylovHandleType& handle);
+};
+
 }  // namespace KokkosBatched
 
 #endif
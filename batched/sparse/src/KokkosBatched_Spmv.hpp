@@ -76,11 +76,11 @@ struct SerialSpmv {
             typename yViewType, int dobeta>
   KOKKOS_INLINE_FUNCTION static int invoke(
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &alpha,
+          typename yViewType::non_const_value_type>::mag_type &alpha,
       const ValuesViewType &values, const IntView &row_ptr,
       const IntView &colIndices, const xViewType &X,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &beta,
+          typename yViewType::non_const_value_type>::mag_type &beta,
       const yViewType &Y);
 };
 
@@ -140,11 +140,11 @@ struct TeamSpmv {
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType &member,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &alpha,
+          typename yViewType::non_const_value_type>::mag_type &alpha,
       const ValuesViewType &values, const IntView &row_ptr,
       const IntView &colIndices, const xViewType &x,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &beta,
+          typename yViewType::non_const_value_type>::mag_type &beta,
       const yViewType &y);
 };
 
@@ -206,11 +206,11 @@ struct TeamVectorSpmv {
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType &member,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &alpha,
+          typename yViewType::non_const_value_type>::mag_type &alpha,
       const ValuesViewType &values, const IntView &row_ptr,
       const IntView &colIndices, const xViewType &x,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &beta,
+          typename yViewType::non_const_value_type>::mag_type &beta,
       const yViewType &y);
 };
 
@@ -277,11 +277,11 @@ struct Spmv {
   KOKKOS_INLINE_FUNCTION static int invoke(
       const MemberType &member,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &alpha,
+          typename yViewType::non_const_value_type>::mag_type &alpha,
       const ValuesViewType &values, const IntView &row_ptr,
       const IntView &colIndices, const xViewType &x,
       const typename Kokkos::ArithTraits<
-          typename ValuesViewType::non_const_value_type>::mag_type &beta,
+          typename yViewType::non_const_value_type>::mag_type &beta,
       const yViewType &y) {
     int r_val = 0;
     if (std::is_same<ArgMode, Mode::Serial>::value) {
@@ -0,0 +1,275 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+
+// Note: the interleaved layout packs matrices in KokkosBatched::Vector<SIMD>
+//       which is meant for host architectures, so the whole file is guarded
+//       to ensure it is not included in the device backends unit-test
+
+#if !defined(TEST_CUDA_BATCHED_SPARSE_CPP) &&  \
+    !defined(TEST_HIP_BATCHED_SPARSE_CPP) &&   \
+    !defined(TEST_SYCL_BATCHED_SPARSE_CPP) &&  \
+    !defined(TEST_OPENMPTARGET_BATCHED_SPARSE_CPP)
+
+#include "gtest/gtest.h"
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Random.hpp"
+#include "KokkosBatched_CG.hpp"
+#include "KokkosBatched_GMRES.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosBatched_InterleavedCrsMatrix.hpp"
+#include "Test_Batched_SparseUtils.hpp"
+
+using namespace KokkosBatched;
+
+namespace Test {
+namespace InterleavedCrsMatrix {
+
+/// \tparam Solver: 0 spmv, 1 CG, 2 GMRES
+template <typename DeviceType, typename PackedViewType, typename IntView,
+          typename VectorViewType, typename KrylovHandleType, typename ArgMode,
+          int Solver>
+struct Functor_TestBatchedInterleavedCrsMatrix {
+  using execution_space = typename DeviceType::execution_space;
+  const PackedViewType _D;
+  const IntView _r;
+  const IntView _c;
+  const VectorViewType _X;
+  const VectorViewType _Y;
+  const int _N_team;
+  KrylovHandleType _handle;
+
+  Functor_TestBatchedInterleavedCrsMatrix(const PackedViewType &D,
+                                          const IntView &r, const IntView &c,
+                                          const VectorViewType &X,
+                                          const VectorViewType &Y,
+                                          const int N_team,
+                                          KrylovHandleType &handle)
+      : _D(D), _r(r), _c(c), _X(X), _Y(Y), _N_team(N_team), _handle(handle) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    using Operator =
+        KokkosBatched::InterleavedCrsMatrix<PackedViewType, IntView>;
+    const int l = Operator::vector_length;
+
+    const int first_matrix = _handle.first_index(member.league_rank());
+    const int last_matrix  = _handle.last_index(member.league_rank());
+
+    auto d = Kokkos::subview(
+        _D, Kokkos::make_pair(first_matrix / l, (last_matrix + l - 1) / l),
+        Kokkos::ALL);
+    auto x = Kokkos::subview(_X, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto y = Kokkos::subview(_Y, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+
+    Operator A(d, _r, _c);
+
+    if (Solver == 0) {
+      A.template apply<Trans::NoTranspose, ArgMode>(member, x, y);
+    } else if (Solver == 1) {
+      KokkosBatched::CG<MemberType, ArgMode>::template invoke<Operator>(
+          member, A, y, x, _handle);
+    } else {
+      KokkosBatched::GMRES<MemberType, ArgMode>::template invoke<Operator>(
+          member, A, y, x, _handle);
+    }
+  }
+
+  inline void run() {
+    typedef typename VectorViewType::value_type value_type;
+    std::string name_region("KokkosBatched::Test::InterleavedCrsMatrix");
+    const std::string name_value_type = Test::value_type_name<value_type>();
+    std::string name                  = name_region + name_value_type;
+    Kokkos::Profiling::pushRegion(name.c_str());
+    Kokkos::TeamPolicy<execution_space> policy(_handle.get_number_of_teams(),
+                                               Kokkos::AUTO(), Kokkos::AUTO());
+
+    const int n                 = _X.extent(1);
+    const int maximum_iteration = _handle.get_max_iteration();
+
+    _handle.set_compute_last_residual(false);
+    _handle.set_tolerance(1e-8);
+
+    using ViewType2D =
+        Kokkos::View<value_type **, typename VectorViewType::array_layout,
+                     execution_space>;
+
+    size_t bytes_tmp = 0;
+    if (Solver == 1) {
+      bytes_tmp = 4 * ViewType2D::shmem_size(_N_team, n) +
+                  ViewType2D::shmem_size(_N_team, 5);
+    }
+    if (Solver == 2) {
+      _handle.set_ortho_strategy(0);
+      _handle.Arnoldi_view = typename KrylovHandleType::ArnoldiViewType(
+          "", _X.extent(0), maximum_iteration, n + maximum_iteration + 3);
+      bytes_tmp = 2 * ViewType2D::shmem_size(_N_team, n) +
+                  2 * ViewType2D::shmem_size(_N_team, 1) +
+                  ViewType2D::shmem_size(_N_team, maximum_iteration + 1);
+    }
+    policy.set_scratch_size(0, Kokkos::PerTeam(bytes_tmp));
+
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    Kokkos::Profiling::popRegion();
+  }
+};
+
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType, int VectorLength, typename ArgMode,
+          int Solver>
+void impl_test_batched_interleaved(const int N, const int BlkSize) {
+  typedef typename ValuesViewType::value_type value_type;
+  typedef Kokkos::ArithTraits<value_type> ats;
+
+  using VectorType     = Vector<SIMD<value_type>, VectorLength>;
+  using PackedViewType = Kokkos::View<VectorType **, DeviceType>;
+
+  const int nnz     = (BlkSize - 2) * 3 + 2 * 2;
+  const int n_packs = (N + VectorLength - 1) / VectorLength;
+  // The first matrix of every team has to be the first matrix of a pack
+  const int N_team = 2 * VectorLength;
+
+  VectorViewType X("x0", N, BlkSize);
+  VectorViewType Y("y", N, BlkSize);
+  VectorViewType R("r", N, BlkSize);
+  ValuesViewType D("D", N, nnz);
+  PackedViewType D_packed("D_packed", n_packs, nnz);
+  IntView r("r", BlkSize + 1);
+  IntView c("c", nnz);
+
+  using ScalarType    = typename ValuesViewType::non_const_value_type;
+  using Layout        = typename ValuesViewType::array_layout;
+  using EXSP          = typename ValuesViewType::execution_space;
+  using MagnitudeType = typename Kokkos::ArithTraits<ScalarType>::mag_type;
+
+  using Norm2DViewType   = Kokkos::View<MagnitudeType **, Layout, EXSP>;
+  using Scalar3DViewType = Kokkos::View<ScalarType ***, Layout, EXSP>;
+  using IntViewType      = Kokkos::View<int *, Layout, EXSP>;
+
+  using KrylovHandleType =
+      KrylovHandle<Norm2DViewType, IntViewType, Scalar3DViewType>;
+
+  create_tridiagonal_batched_matrices(nnz, BlkSize, N, r, c, D, X, Y);
+
+  // Scale the matrices differently so that mixing the lanes of a pack would
+  // be detected; the matrices stay symmetric positive definite.
+  auto D_host = Kokkos::create_mirror_view(D);
+  Kokkos::deep_copy(D_host, D);
+  for (int l = 0; l < N; ++l)
+    for (int k = 0; k < nnz; ++k) D_host(l, k) *= value_type(1 + (l % 7));
+  Kokkos::deep_copy(D, D_host);
+
+  packInterleaved(D, D_packed);
+
+  auto r_host = Kokkos::create_mirror_view(r);
+  auto c_host = Kokkos::create_mirror_view(c);
+  auto X_host = Kokkos::create_mirror_view(X);
+  auto Y_host = Kokkos::create_mirror_view(Y);
+  auto R_host = Kokkos::create_mirror_view(R);
+  Kokkos::deep_copy(r_host, r);
+  Kokkos::deep_copy(c_host, c);
+
+  const int n_iterations = 2 * BlkSize;
+  KrylovHandleType handle(N, N_team, n_iterations);
+
+  if (Solver == 0) {
+    // Reference y = A x computed with the non interleaved kernel
+    Kokkos::deep_copy(X_host, X);
+    KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
+        typename ValuesViewType::HostMirror, typename IntView::HostMirror,
+        typename VectorViewType::HostMirror,
+        typename VectorViewType::HostMirror, 0>(1, D_host, r_host, c_host,
+                                                X_host, 0, R_host);
+  }
+
+  Functor_TestBatchedInterleavedCrsMatrix<DeviceType, PackedViewType, IntView,
+                                          VectorViewType, KrylovHandleType,
+                                          ArgMode, Solver>(D_packed, r, c, X, Y,
+                                                           N_team, handle)
+      .run();
+
+  Kokkos::fence();
+
+  if (Solver == 0) {
+    Kokkos::deep_copy(Y_host, Y);
+
+    const MagnitudeType eps = 1.0e3 * ats::epsilon();
+    for (int l = 0; l < N; ++l)
+      for (int i = 0; i < BlkSize; ++i)
+        EXPECT_NEAR_KK(Y_host(l, i), R_host(l, i), eps);
+  } else {
+    // Relative residual of the solution
+    Kokkos::deep_copy(X_host, X);
+    Kokkos::deep_copy(Y_host, Y);
+    Kokkos::deep_copy(R_host, Y_host);
+    KokkosBatched::SerialSpmv<Trans::NoTranspose>::template invoke<
+        typename ValuesViewType::HostMirror, typename IntView::HostMirror,
+        typename VectorViewType::HostMirror,
+        typename VectorViewType::HostMirror, 1>(-1, D_host, r_host, c_host,
+                                                X_host, 1, R_host);
+
+    const MagnitudeType eps = 1.0e5 * ats::epsilon();
+    for (int l = 0; l < N; ++l) {
+      MagnitudeType sqr_norm_r = 0, sqr_norm_b = 0;
+      for (int i = 0; i < BlkSize; ++i) {
+        sqr_norm_r += R_host(l, i) * R_host(l, i);
+        sqr_norm_b += Y_host(l, i) * Y_host(l, i);
+      }
+      EXPECT_NEAR_KK(std::sqrt(sqr_norm_r) / std::sqrt(sqr_norm_b), 0, eps);
+    }
+  }
+}
+}  // namespace InterleavedCrsMatrix
+}  // namespace Test
+
+template <typename DeviceType, typename ValueType, int Solver>
+int test_batched_interleaved_crs_matrix() {
+#if defined(KOKKOSKERNELS_INST_LAYOUTLEFT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutLeft, DeviceType> ViewType;
+    typedef Kokkos::View<int *, Kokkos::LayoutLeft, DeviceType> IntView;
+
+    for (int i = 3; i < 10; ++i) {
+      Test::InterleavedCrsMatrix::impl_test_batched_interleaved<
+          DeviceType, ViewType, IntView, ViewType, 4, Mode::Team, Solver>(1021,
+                                                                          i);
+      Test::InterleavedCrsMatrix::impl_test_batched_interleaved<
+          DeviceType, ViewType, IntView, ViewType, 8, Mode::TeamVector,
+          Solver>(1021, i);
+    }
+  }
+#endif
+#if defined(KOKKOSKERNELS_INST_LAYOUTRIGHT)
+  {
+    typedef Kokkos::View<ValueType **, Kokkos::LayoutRight, DeviceType>
+        ViewType;
+    typedef Kokkos::View<int *, Kokkos::LayoutRight, DeviceType> IntView;
+
+    for (int i = 3; i < 10; ++i) {
+      Test::InterleavedCrsMatrix::impl_test_batched_interleaved<
+          DeviceType, ViewType, IntView, ViewType, 4, Mode::Team, Solver>(1021,
+                                                                          i);
+      Test::InterleavedCrsMatrix::impl_test_batched_interleaved<
+          DeviceType, ViewType, IntView, ViewType, 8, Mode::TeamVector,
+          Solver>(1021, i);
+    }
+  }
+#endif
+
+  return 0;
+}
+
+#endif
@@ -0,0 +1,45 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+
+#if !defined(TEST_CUDA_BATCHED_SPARSE_CPP) &&  \
+    !defined(TEST_HIP_BATCHED_SPARSE_CPP) &&   \
+    !defined(TEST_SYCL_BATCHED_SPARSE_CPP) &&  \
+    !defined(TEST_OPENMPTARGET_BATCHED_SPARSE_CPP)
+
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory, batched_scalar_interleaved_spmv_float) {
+  test_batched_interleaved_crs_matrix<TestDevice, float, 0>();
+}
+TEST_F(TestCategory, batched_scalar_interleaved_CG_float) {
+  test_batched_interleaved_crs_matrix<TestDevice, float, 1>();
+}
+TEST_F(TestCategory, batched_scalar_interleaved_GMRES_float) {
+  test_batched_interleaved_crs_matrix<TestDevice, float, 2>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory, batched_scalar_interleaved_spmv_double) {
+  test_batched_interleaved_crs_matrix<TestDevice, double, 0>();
+}
+TEST_F(TestCategory, batched_scalar_interleaved_CG_double) {
+  test_batched_interleaved_crs_matrix<TestDevice, double, 1>();
+}
+TEST_F(TestCategory, batched_scalar_interleaved_GMRES_double) {
+  test_batched_interleaved_crs_matrix<TestDevice, double, 2>();
+}
+#endif
+
+#endif
@@ -0,0 +1,42 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#if defined(KOKKOS_HALF_T_IS_FLOAT)
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory,
+       batched_scalar_team_vector_iterative_refinement_half_float) {
+  test_batched_team_vector_iterative_refinement<TestDevice, float,
+                                                ::Test::halfScalarType>();
+}
+#endif
+
+#if defined(KOKKOSKERNELS_INST_DOUBLE)
+TEST_F(TestCategory,
+       batched_scalar_team_vector_iterative_refinement_half_double) {
+  test_batched_team_vector_iterative_refinement<TestDevice, double,
+                                                ::Test::halfScalarType>();
+}
+#endif
+#endif  // KOKKOS_HALF_T_IS_FLOAT
+
+#if defined(KOKKOS_BHALF_T_IS_FLOAT)
+#if defined(KOKKOSKERNELS_INST_FLOAT)
+TEST_F(TestCategory,
+       batched_scalar_team_vector_iterative_refinement_bhalf_float) {
+  test_batched_team_vector_iterative_refinement<TestDevice, float,
+                                                ::Test::bhalfScalarType>();
+}
+#endif
+#endif  // KOKKOS_BHALF_T_IS_FLOAT
@@ -81,6 +81,7 @@ struct Algo {
   using Trmm      = Level3;
   using Trtri     = Level3;
   using LU        = Level3;
+  using Cholesky  = Level3;
   using InverseLU = Level3;
   using SolveLU   = Level3;
   using QR        = Level3;
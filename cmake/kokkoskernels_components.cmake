@@ -59,6 +59,12 @@ KOKKOSKERNELS_ADD_OPTION(
 )
 
 
+# ODE relies on the graph coloring for its finite
+# difference Jacobians.
+IF (KokkosKernels_ENABLE_COMPONENT_ODE)
+  SET(KokkosKernels_ENABLE_COMPONENT_GRAPH ON CACHE BOOL "" FORCE)
+ENDIF()
+
 # Graph depends on everything else because it depends
 # on Sparse at the moment, breaking that dependency will
 # allow for Graph to build pretty much as a standalone
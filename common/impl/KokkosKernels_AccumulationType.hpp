@@ -0,0 +1,45 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSKERNELS_ACCUMULATIONTYPE_HPP
+#define KOKKOSKERNELS_ACCUMULATIONTYPE_HPP
+
+#include <type_traits>
+#include "Kokkos_Core.hpp"
+
+namespace KokkosKernels::Impl {
+
+// half_t and bhalf_t are storage formats: arithmetic on them is performed
+// in float.
+template <typename T>
+inline constexpr bool is_reduced_precision_v =
+    std::is_same_v<std::remove_cv_t<T>, Kokkos::Experimental::half_t> ||
+    std::is_same_v<std::remove_cv_t<T>, Kokkos::Experimental::bhalf_t>;
+
+// Converts a value stored in reduced precision to AccumType before it enters
+// an arithmetic expression. Other values are returned unchanged, so that the
+// usual promotions still apply to them.
+template <typename AccumType, typename T>
+KOKKOS_FORCEINLINE_FUNCTION auto widen(const T& v) {
+  if constexpr (is_reduced_precision_v<T>)
+    return static_cast<AccumType>(v);
+  else
+    return v;
+}
+
+}  // namespace KokkosKernels::Impl
+
+#endif  // KOKKOSKERNELS_ACCUMULATIONTYPE_HPP
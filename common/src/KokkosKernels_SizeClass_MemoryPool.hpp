@@ -0,0 +1,363 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef _KOKKOSKERNELS_SIZECLASS_MEMPOOL_HPP
+#define _KOKKOSKERNELS_SIZECLASS_MEMPOOL_HPP
+
+#include <Kokkos_Core.hpp>
+#include <sstream>
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosKernels {
+
+namespace Impl {
+
+/*! \brief Returns the smallest c such that (min_chunk_size << c) >= size.
+ */
+KOKKOS_INLINE_FUNCTION
+int get_size_class(const size_t size, const size_t min_chunk_size) {
+  int c = 0;
+  while (c < 63 && (min_chunk_size << c) < size) ++c;
+  return c;
+}
+
+/*! \brief Counts, for each size class, the number of entries of sizes that
+ * fall into it. Entries larger than the last class cannot be served by the
+ * pool: they are not counted in any class, their number is returned in
+ * num_oversized and the caller has to handle them on another path. The result
+ * is the natural input of SizeClassMemoryPool once capped by the number of
+ * concurrent users, e.g. min(count, concurrency).
+ */
+template <typename MyExecSpace, typename size_view_t>
+Kokkos::View<size_t *, Kokkos::HostSpace> get_size_class_histogram(
+    const size_view_t &sizes, const size_t min_chunk_size,
+    const int num_classes, size_t &num_oversized) {
+  // the last entry counts the oversized sizes
+  Kokkos::View<size_t *, MyExecSpace> counts("size class counts",
+                                             num_classes + 1);
+  Kokkos::parallel_for(
+      "KokkosKernels::SizeClassHistogram",
+      Kokkos::RangePolicy<MyExecSpace>(0, sizes.extent(0)),
+      KOKKOS_LAMBDA(const size_t i) {
+        int c = get_size_class(sizes(i), min_chunk_size);
+        if (c > num_classes) c = num_classes;
+        Kokkos::atomic_increment(&counts(c));
+      });
+  auto h_counts =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), counts);
+  Kokkos::View<size_t *, Kokkos::HostSpace> class_counts("size class counts",
+                                                        num_classes);
+  for (int c = 0; c < num_classes; ++c) class_counts(c) = h_counts(c);
+  num_oversized = h_counts(num_classes);
+  return class_counts;
+}
+
+/*! \brief Memory pool with power-of-two size classes.
+ *
+ *  Class c holds num_chunks(c) chunks of min_chunk_size * 2^c entries, all
+ *  initialized to initialized_value. A request of n entries is served from
+ *  the smallest class whose chunks hold n entries, or from the next larger
+ *  class that still has a free chunk, so kernels size their workspace by the
+ *  actual work of a row instead of the worst row. Like ManyThread2OneChunk
+ *  in UniformMemoryPool, allocate_chunk returns NULL when no chunk is free
+ *  and the caller is expected to retry, and chunks must be handed back in
+ *  their initialized state. Requests larger than get_max_chunk_size() can
+ *  never be served, so retrying them would spin forever: allocate_chunk
+ *  aborts on them and callers must route such rows to another path, using
+ *  can_allocate() or the num_oversized count of get_size_class_histogram.
+ *
+ *  Each class keeps its free chunks in a lock-free stack. The head packs the
+ *  index of the top chunk (plus one, 0 meaning empty) in its lower 32 bits
+ *  and a counter in its upper 32 bits that is bumped by every update, which
+ *  protects the compare-and-swap against ABA.
+ *
+ *    typedef KokkosKernels::Impl::SizeClassMemoryPool<ExecSpace, idx> pool_t;
+ *    size_t num_oversized;
+ *    auto counts = get_size_class_histogram<ExecSpace>(row_sizes, 64, 8,
+ *                                                      num_oversized);
+ *    for (int c = 0; c < 8; ++c)
+ *      counts(c) = std::min(counts(c), ExecSpace().concurrency());
+ *    pool_t pool(64, counts, 0);
+ *
+ *    // in the kernel
+ *    if (!pool.can_allocate(row_size)) {
+ *      // handle the row on the fallback path
+ *      return;
+ *    }
+ *    size_t chunk_size;
+ *    idx *mem = NULL;
+ *    while (mem == NULL) mem = pool.allocate_chunk(row_size, chunk_size);
+ *    /////..............work on mem, then reset it................../////
+ *    pool.release_chunk(mem);
+ */
+template <typename MyExecSpace, typename data_type>
+class SizeClassMemoryPool {
+ private:
+  typedef unsigned long long head_type;
+  typedef int next_type;
+  typedef typename Kokkos::View<head_type *, MyExecSpace> head_view_t;
+  typedef typename Kokkos::View<next_type *, MyExecSpace> next_view_t;
+  typedef typename Kokkos::View<size_t *, MyExecSpace> offset_view_t;
+  typedef typename Kokkos::View<data_type *, MyExecSpace> data_view_t;
+
+  size_t min_chunk_size;
+  int num_classes;
+  size_t num_chunks;
+  size_t overall_size;
+
+  // chunk_begin(c) is the index of the first chunk of class c, data_begin(c)
+  // its offset in data; both have num_classes + 1 entries.
+  offset_view_t chunk_begin;
+  offset_view_t data_begin;
+  head_view_t heads;
+  next_view_t nexts;
+  data_view_t data_view;
+  data_type *data;
+  data_type init_value;
+
+  KOKKOS_INLINE_FUNCTION
+  static head_type make_head(const head_type old_head, const size_t top) {
+    return (((old_head >> 32) + 1) << 32) | static_cast<head_type>(top);
+  }
+
+  /// Pops a chunk of class c, returns its index or -1 if the class is empty.
+  KOKKOS_INLINE_FUNCTION
+  long pop(const int c) const {
+    head_type *head    = &heads(c);
+    head_type old_head = Kokkos::atomic_load(head);
+    while (true) {
+      const size_t top = old_head & 0xffffffffULL;
+      if (top == 0) return -1;
+      const next_type next     = Kokkos::atomic_load(&nexts(top - 1));
+      const head_type new_head = make_head(old_head, next);
+      const head_type prev =
+          Kokkos::atomic_compare_exchange(head, old_head, new_head);
+      if (prev == old_head) return static_cast<long>(top - 1);
+      old_head = prev;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void push(const int c, const size_t chunk_index) const {
+    head_type *head = &heads(c);
+    // make the reset of the chunk visible before it can be popped again
+    Kokkos::memory_fence();
+    head_type old_head = Kokkos::atomic_load(head);
+    while (true) {
+      Kokkos::atomic_store(&nexts(chunk_index),
+                           static_cast<next_type>(old_head & 0xffffffffULL));
+      const head_type new_head = make_head(old_head, chunk_index + 1);
+      const head_type prev =
+          Kokkos::atomic_compare_exchange(head, old_head, new_head);
+      if (prev == old_head) return;
+      old_head = prev;
+    }
+  }
+
+ public:
+  using execution_space = typename MyExecSpace::execution_space;
+  using memory_space    = typename MyExecSpace::memory_space;
+  using value_type      = data_type;
+
+  /**
+   * \brief SizeClassMemoryPool constructor.
+   * \param min_chunk_size_: size of the chunks of class 0, in number of
+   * data_type entries. \param num_chunks_per_class: number of chunks of each
+   * class, its extent sets the number of classes. \param initialized_value:
+   * the value to initialize \param initialize: whether to initialize the data
+   */
+  template <typename count_view_t>
+  SizeClassMemoryPool(const size_t min_chunk_size_,
+                      const count_view_t &num_chunks_per_class,
+                      const data_type initialized_value = 0,
+                      bool initialize                   = true)
+      : min_chunk_size(min_chunk_size_),
+        num_classes(num_chunks_per_class.extent(0)),
+        num_chunks(0),
+        overall_size(0),
+        chunk_begin("size class chunk begin",
+                    num_chunks_per_class.extent(0) + 1),
+        data_begin("size class data begin",
+                   num_chunks_per_class.extent(0) + 1),
+        heads("size class heads", num_chunks_per_class.extent(0)),
+        nexts(),
+        data_view(),
+        data(),
+        init_value(initialized_value) {
+    if (min_chunk_size == 0 || num_classes == 0 || num_classes > 32) {
+      std::ostringstream os;
+      os << "KokkosKernels::Impl::SizeClassMemoryPool: invalid size classes, "
+            "min_chunk_size: "
+         << min_chunk_size << ", num_classes: " << num_classes;
+      throw_runtime_exception(os.str());
+    }
+    auto h_chunk_begin = Kokkos::create_mirror_view(chunk_begin);
+    auto h_data_begin  = Kokkos::create_mirror_view(data_begin);
+    auto h_heads       = Kokkos::create_mirror_view(heads);
+    h_chunk_begin(0)   = 0;
+    h_data_begin(0)    = 0;
+    for (int c = 0; c < num_classes; ++c) {
+      const size_t count   = num_chunks_per_class(c);
+      h_chunk_begin(c + 1) = h_chunk_begin(c) + count;
+      h_data_begin(c + 1) =
+          h_data_begin(c) + count * this->get_class_chunk_size(c);
+      h_heads(c) = count ? h_chunk_begin(c) + 1 : 0;
+    }
+    num_chunks   = h_chunk_begin(num_classes);
+    overall_size = h_data_begin(num_classes);
+    if (num_chunks >= 0x7fffffffULL) {
+      throw_runtime_exception(
+          "KokkosKernels::Impl::SizeClassMemoryPool: too many chunks");
+    }
+
+    // chain the chunks of each class in order
+    nexts = next_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "size class nexts"),
+        num_chunks);
+    auto h_nexts = Kokkos::create_mirror_view(nexts);
+    for (int c = 0; c < num_classes; ++c)
+      for (size_t i = h_chunk_begin(c); i < h_chunk_begin(c + 1); ++i)
+        h_nexts(i) = i + 1 < h_chunk_begin(c + 1) ? i + 2 : 0;
+
+    Kokkos::deep_copy(chunk_begin, h_chunk_begin);
+    Kokkos::deep_copy(data_begin, h_data_begin);
+    Kokkos::deep_copy(heads, h_heads);
+    Kokkos::deep_copy(nexts, h_nexts);
+
+    if (overall_size) {
+      data_view = data_view_t(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "pool data"),
+          overall_size);
+    }
+    data = data_view.data();
+    if (initialize) {
+      Kokkos::deep_copy(data_view, initialized_value);
+    }
+  }
+
+  SizeClassMemoryPool()
+      : min_chunk_size(0),
+        num_classes(0),
+        num_chunks(0),
+        overall_size(0),
+        chunk_begin(),
+        data_begin(),
+        heads(),
+        nexts(),
+        data_view(),
+        data(),
+        init_value() {}
+
+  ~SizeClassMemoryPool() = default;
+
+  SizeClassMemoryPool(SizeClassMemoryPool &&)      = default;
+  SizeClassMemoryPool(const SizeClassMemoryPool &) = default;
+  SizeClassMemoryPool &operator=(SizeClassMemoryPool &&) = default;
+  SizeClassMemoryPool &operator=(const SizeClassMemoryPool &) = default;
+
+  /**
+   * \brief Returns the number of size classes.
+   */
+  KOKKOS_INLINE_FUNCTION
+  int get_num_classes() const { return num_classes; }
+
+  /**
+   * \brief Returns the size of the chunks of class c, in number of data_type
+   * entries.
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_t get_class_chunk_size(const int c) const {
+    return min_chunk_size << c;
+  }
+
+  /**
+   * \brief Returns the size of the largest request the pool can serve.
+   */
+  KOKKOS_INLINE_FUNCTION
+  size_t get_max_chunk_size() const {
+    return this->get_class_chunk_size(num_classes - 1);
+  }
+
+  /**
+   * \brief Returns whether a request of size entries fits in a class of the
+   * pool, i.e. whether allocate_chunk can eventually serve it.
+   */
+  KOKKOS_INLINE_FUNCTION
+  bool can_allocate(const size_t size) const {
+    return get_size_class(size, min_chunk_size) < num_classes;
+  }
+
+  /**
+   * \brief Returns the total number of chunks over all classes.
+   */
+  size_t get_num_chunks() const { return num_chunks; }
+
+  /**
+   * \brief Returns the number of bytes held by the pool.
+   */
+  size_t get_memory_footprint() const {
+    return data_view.span() * sizeof(data_type) +
+           nexts.span() * sizeof(next_type) +
+           heads.span() * sizeof(head_type) +
+           (chunk_begin.span() + data_begin.span()) * sizeof(size_t);
+  }
+
+  /**
+   * \brief Returns a chunk of at least size entries, or NULL if none of the
+   * classes able to hold size entries has a free chunk. chunk_size is set to
+   * the size of the returned chunk, which can be larger than size. Aborts if
+   * size is larger than get_max_chunk_size(), see can_allocate().
+   */
+  KOKKOS_INLINE_FUNCTION
+  data_type *allocate_chunk(const size_t size, size_t &chunk_size) const {
+    const int first_class = get_size_class(size, min_chunk_size);
+    if (first_class >= num_classes)
+      Kokkos::abort(
+          "SizeClassMemoryPool::allocate_chunk: request larger than the "
+          "largest size class");
+    for (int c = first_class; c < num_classes; ++c) {
+      const long index = this->pop(c);
+      if (index >= 0) {
+        chunk_size = this->get_class_chunk_size(c);
+        return data + data_begin(c) + (index - chunk_begin(c)) * chunk_size;
+      }
+    }
+    chunk_size = 0;
+    return NULL;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  data_type *allocate_chunk(const size_t size) const {
+    size_t chunk_size;
+    return this->allocate_chunk(size, chunk_size);
+  }
+
+  /**
+   * \brief Releases a chunk returned by allocate_chunk.
+   */
+  KOKKOS_INLINE_FUNCTION
+  void release_chunk(const data_type *chunk_ptr) const {
+    const size_t offset = chunk_ptr - data;
+    int c               = 0;
+    while (offset >= data_begin(c + 1)) ++c;
+    this->push(c, chunk_begin(c) + (offset - data_begin(c)) /
+                                       this->get_class_chunk_size(c));
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosKernels
+
+#endif
@@ -164,10 +164,13 @@ class UniformMemoryPool {
   data_view_t data_view;
   data_type *data;
   PoolType pool_type;
+  data_type init_value;
+  bool is_initialized;
 
  public:
   using execution_space = typename MyExecSpace::execution_space;
   using memory_space    = typename MyExecSpace::memory_space;
+  using value_type      = data_type;
 
   /**
    * \brief UniformMemoryPool constructor.
@@ -192,7 +195,9 @@ class UniformMemoryPool {
         pchunk_locks(),
         data_view(),
         data(),
-        pool_type(pool_type_) {
+        pool_type(pool_type_),
+        init_value(initialized_value),
+        is_initialized(initialize) {
     num_chunks = 1;
     while (num_set_chunks > num_chunks) {
       num_chunks *= 2;
@@ -229,7 +234,9 @@ class UniformMemoryPool {
         pchunk_locks(),
         data_view(),
         data(),
-        pool_type() {}
+        pool_type(),
+        init_value(),
+        is_initialized(false) {}
 
   ~UniformMemoryPool() = default;
 
@@ -251,6 +258,42 @@ class UniformMemoryPool {
     }
   }
 
+  /**
+   * \brief Returns the number of chunks requested at construction.
+   */
+  size_t get_num_set_chunks() const { return num_set_chunks; }
+
+  /**
+   * \brief Returns the size of each chunk, in number of data_type entries.
+   */
+  size_t get_chunk_size() const { return chunk_size; }
+
+  PoolType get_pool_type() const { return pool_type; }
+
+  /**
+   * \brief Returns the number of bytes held by the pool (data and locks).
+   */
+  size_t get_memory_footprint() const {
+    return data_view.span() * sizeof(data_type) +
+           chunk_locks.span() * sizeof(lock_type);
+  }
+
+  /**
+   * \brief Returns true if this pool can serve requests of a pool constructed
+   * with the given parameters, i.e. it has at least num_chunks_ chunks of
+   * exactly chunk_size_ entries, all initialized to initialized_value, and
+   * uses the same pool type. Chunks are expected to be handed back in their
+   * initialized state by the kernels using the pool.
+   */
+  bool is_compatible(const size_t num_chunks_, const size_t chunk_size_,
+                     const data_type initialized_value,
+                     const PoolType pool_type_) const {
+    return is_initialized && data_view.data() != nullptr &&
+           num_set_chunks >= num_chunks_ &&
+           chunk_size == chunk_size_ && init_value == initialized_value &&
+           pool_type == pool_type_;
+  }
+
   /**
    * \brief Print the content of memory pool
    */
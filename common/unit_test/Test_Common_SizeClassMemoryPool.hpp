@@ -0,0 +1,148 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+#ifndef TEST_COMMON_SIZECLASS_MEMORYPOOL_HPP
+#define TEST_COMMON_SIZECLASS_MEMORYPOOL_HPP
+
+#include <algorithm>
+
+#include "KokkosKernels_SizeClass_MemoryPool.hpp"
+
+template <typename Device>
+void testSizeClassHistogram() {
+  using exec_space = typename Device::execution_space;
+  Kokkos::View<size_t *, Device> sizes("sizes", 8);
+  auto h_sizes = Kokkos::create_mirror_view(sizes);
+  // classes of 64, 128, 256 and 512 entries, larger sizes are in none of them
+  const size_t s[] = {1, 64, 65, 200, 256, 512, 1000, 5000};
+  for (int i = 0; i < 8; ++i) h_sizes(i) = s[i];
+  Kokkos::deep_copy(sizes, h_sizes);
+
+  size_t num_oversized;
+  auto counts = KokkosKernels::Impl::get_size_class_histogram<exec_space>(
+      sizes, 64, 4, num_oversized);
+  ASSERT_EQ(counts.extent(0), 4);
+  EXPECT_EQ(counts(0), 2);
+  EXPECT_EQ(counts(1), 1);
+  EXPECT_EQ(counts(2), 2);
+  EXPECT_EQ(counts(3), 1);
+  EXPECT_EQ(num_oversized, 2);
+}
+
+template <typename Device>
+void testSizeClassMemoryPoolFallback() {
+  using exec_space = typename Device::execution_space;
+  using pool_t     = KokkosKernels::Impl::SizeClassMemoryPool<exec_space, int>;
+
+  // no chunk of class 0, a single chunk of class 1
+  Kokkos::View<size_t *, Kokkos::HostSpace> counts("counts", 2);
+  counts(0) = 0;
+  counts(1) = 1;
+  pool_t pool(8, counts, -1);
+  EXPECT_EQ(pool.get_num_chunks(), 1);
+  EXPECT_EQ(pool.get_max_chunk_size(), 16);
+
+  Kokkos::View<int *, Device> result("result", 5);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, 1), KOKKOS_LAMBDA(const int) {
+        size_t chunk_size;
+        // served by the larger class
+        int *a    = pool.allocate_chunk(3, chunk_size);
+        result(0) = a != NULL;
+        result(1) = chunk_size;
+        // the pool is empty
+        result(2) = pool.allocate_chunk(3) == NULL;
+        pool.release_chunk(a);
+        // too large for any class, allocate_chunk would abort
+        result(3) = pool.can_allocate(16);
+        result(4) = !pool.can_allocate(17);
+      });
+  auto h_result = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      result);
+  EXPECT_EQ(h_result(0), 1);
+  EXPECT_EQ(h_result(1), 16);
+  EXPECT_EQ(h_result(2), 1);
+  EXPECT_EQ(h_result(3), 1);
+  EXPECT_EQ(h_result(4), 1);
+}
+
+template <typename Device>
+void testSizeClassMemoryPoolConcurrent(const int num_rows) {
+  using exec_space = typename Device::execution_space;
+  using pool_t     = KokkosKernels::Impl::SizeClassMemoryPool<exec_space, int>;
+
+  const size_t min_chunk_size = 4;
+  const int num_classes       = 5;
+
+  // irregular row sizes between 1 and 64
+  Kokkos::View<size_t *, Device> sizes("sizes", num_rows);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, num_rows),
+      KOKKOS_LAMBDA(const int i) { sizes(i) = (i * 37) % 64 + 1; });
+  size_t num_oversized;
+  auto counts = KokkosKernels::Impl::get_size_class_histogram<exec_space>(
+      sizes, min_chunk_size, num_classes, num_oversized);
+  EXPECT_EQ(num_oversized, 0);
+  size_t total = 0;
+  for (int c = 0; c < num_classes; ++c) {
+    counts(c) = std::min<size_t>(counts(c), exec_space().concurrency());
+    total += counts(c);
+  }
+  pool_t pool(min_chunk_size, counts, -1);
+  EXPECT_EQ(pool.get_num_chunks(), total);
+
+  // every row writes its index to its chunk, checks it and resets it
+  int num_errors = 0;
+  Kokkos::parallel_reduce(
+      Kokkos::RangePolicy<exec_space>(0, num_rows),
+      KOKKOS_LAMBDA(const int i, int &errors) {
+        size_t chunk_size = 0;
+        int *mem          = NULL;
+        while (mem == NULL) mem = pool.allocate_chunk(sizes(i), chunk_size);
+        if (chunk_size < sizes(i)) ++errors;
+        for (size_t j = 0; j < chunk_size; ++j)
+          if (mem[j] != -1) ++errors;
+        for (size_t j = 0; j < sizes(i); ++j) mem[j] = i;
+        for (size_t j = 0; j < sizes(i); ++j)
+          if (mem[j] != i) ++errors;
+        for (size_t j = 0; j < sizes(i); ++j) mem[j] = -1;
+        pool.release_chunk(mem);
+      },
+      num_errors);
+  EXPECT_EQ(num_errors, 0);
+
+  // all the chunks are free again and can be taken at once, starting from
+  // the largest class so that requests never fall back to a larger one
+  Kokkos::View<int *, Device> taken("taken", num_classes);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<exec_space>(0, 1), KOKKOS_LAMBDA(const int) {
+        for (int c = num_classes - 1; c >= 0; --c)
+          while (pool.allocate_chunk(pool.get_class_chunk_size(c)) != NULL)
+            ++taken(c);
+      });
+  auto h_taken =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), taken);
+  for (int c = 0; c < num_classes; ++c)
+    EXPECT_EQ(static_cast<size_t>(h_taken(c)), counts(c));
+}
+
+TEST_F(TestCategory, common_size_class_memory_pool) {
+  testSizeClassHistogram<TestDevice>();
+  testSizeClassMemoryPoolFallback<TestDevice>();
+  testSizeClassMemoryPoolConcurrent<TestDevice>(1);
+  testSizeClassMemoryPoolConcurrent<TestDevice>(10000);
+}
+
+#endif  // TEST_COMMON_SIZECLASS_MEMORYPOOL_HPP
@@ -3095,6 +3095,291 @@ class GraphColor_EB : public GraphColor<HandleType, in_row_index_view_type_,
   };
 };
 
+/*! \brief Uncolors the listed vertices that are uncolored or share their
+ *  color with a neighbor, and gathers them into the recolor list. This
+ *  repairs a coloring after the adjacency of the listed vertices changed,
+ *  without looking at the rest of the graph.
+ */
+template <typename rowmap_t, typename entries_t, typename colors_t,
+          typename in_list_t, typename list_t, typename list_length_t>
+struct functorUncolorRepairConflicts {
+  typedef typename list_t::non_const_value_type nnz_lno_t;
+  typedef typename rowmap_t::non_const_value_type size_type;
+  typedef typename colors_t::non_const_value_type color_t;
+
+  nnz_lno_t nv;
+  rowmap_t _idx;
+  entries_t _adj;
+  colors_t _colors;
+  in_list_t _vertexList;
+  list_t _recolorList;
+  list_length_t _recolorListLength;
+
+  functorUncolorRepairConflicts(nnz_lno_t nv_, rowmap_t xadj_, entries_t adj_,
+                                colors_t colors, in_list_t vertexList,
+                                list_t recolorList,
+                                list_length_t recolorListLength)
+      : nv(nv_),
+        _idx(xadj_),
+        _adj(adj_),
+        _colors(colors),
+        _vertexList(vertexList),
+        _recolorList(recolorList),
+        _recolorListLength(recolorListLength) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const nnz_lno_t ii, nnz_lno_t &numConflicts) const {
+    const nnz_lno_t i      = _vertexList(ii);
+    const color_t my_color = _colors(i);
+
+    bool conflict = my_color == 0;
+    for (size_type j = _idx(i); !conflict && j < _idx(i + 1); j++) {
+      const nnz_lno_t neighbor = _adj(j);
+      conflict =
+          neighbor != i && neighbor < nv && _colors(neighbor) == my_color;
+    }
+    if (conflict) {
+      _colors(i) = 0;  // Uncolor vertex i
+      const nnz_lno_t k =
+          Kokkos::atomic_fetch_add(&_recolorListLength(), nnz_lno_t(1));
+      _recolorList(k) = i;
+      numConflicts += 1;
+    }
+  }
+};
+
+/*! \brief Rebalances the color classes of a valid distance-1 coloring
+ *  without adding colors, so that multicolor Gauss-Seidel sweeps over
+ *  colors of similar sizes. In every round the vertices of classes larger
+ *  than the average speculatively move to an underfull class that none of
+ *  their neighbors use. If two adjacent vertices move to the same class,
+ *  the one with the larger id moves back.
+ */
+template <typename HandleType, typename lno_row_view_t_,
+          typename lno_nnz_view_t_>
+class GraphColor_Balance {
+ public:
+  typedef lno_row_view_t_ in_lno_row_view_t;
+  typedef lno_nnz_view_t_ in_lno_nnz_view_t;
+  typedef typename HandleType::color_view_t color_view_type;
+
+  typedef typename HandleType::size_type size_type;
+  typedef typename HandleType::nnz_lno_t nnz_lno_t;
+  typedef typename HandleType::color_t color_t;
+
+  typedef typename HandleType::HandleExecSpace MyExecSpace;
+  typedef Kokkos::RangePolicy<MyExecSpace> my_exec_space;
+
+  typedef
+      typename HandleType::nnz_lno_temp_work_view_t nnz_lno_temp_work_view_t;
+
+ protected:
+  nnz_lno_t nv;            // # vertices
+  in_lno_row_view_t xadj;  // rowmap
+  in_lno_nnz_view_t adj;   // entries
+  HandleType *cp;          // the handle.
+
+ public:
+  GraphColor_Balance(nnz_lno_t nv_, in_lno_row_view_t row_map,
+                     in_lno_nnz_view_t entries, HandleType *coloring_handle)
+      : nv(nv_), xadj(row_map), adj(entries), cp(coloring_handle) {}
+
+  /** \brief Moves a vertex of an overfull class to an underfull class that
+   * none of its neighbors use. A move consumes one unit of the excess of
+   * the source class and one unit of the deficit of the target class.
+   */
+  struct MoveFunctor {
+    nnz_lno_t nv;
+    in_lno_row_view_t xadj;
+    in_lno_nnz_view_t adj;
+    color_view_type colors;              // colors at the start of the round
+    color_view_type tentative;           // colors after the moves
+    nnz_lno_temp_work_view_t excess;     // per color
+    nnz_lno_temp_work_view_t deficit;    // per color
+    nnz_lno_temp_work_view_t underfull;  // the colors with a deficit
+    nnz_lno_temp_work_view_t slot;       // index in underfull, or -1
+    nnz_lno_t num_underfull;
+
+    MoveFunctor(nnz_lno_t nv_, in_lno_row_view_t xadj_,
+                in_lno_nnz_view_t adj_, color_view_type colors_,
+                color_view_type tentative_, nnz_lno_temp_work_view_t excess_,
+                nnz_lno_temp_work_view_t deficit_,
+                nnz_lno_temp_work_view_t underfull_,
+                nnz_lno_temp_work_view_t slot_, nnz_lno_t num_underfull_)
+        : nv(nv_),
+          xadj(xadj_),
+          adj(adj_),
+          colors(colors_),
+          tentative(tentative_),
+          excess(excess_),
+          deficit(deficit_),
+          underfull(underfull_),
+          slot(slot_),
+          num_underfull(num_underfull_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t &i) const {
+      const color_t c = colors(i);
+      tentative(i)    = c;
+      if (excess(c) <= 0 ||
+          Kokkos::atomic_fetch_sub(&excess(c), nnz_lno_t(1)) <= 0)
+        return;
+
+      // look at the underfull colors 64 at a time, starting at a chunk that
+      // depends on the vertex so that vertices spread over the targets.
+      const nnz_lno_t num_chunks = (num_underfull + 63) / 64;
+      for (nnz_lno_t k = 0; k < num_chunks; ++k) {
+        const nnz_lno_t chunk = ((i + k) % num_chunks) * 64;
+        uint64_t forbidden    = 0;
+        for (size_type j = xadj(i); j < xadj(i + 1); ++j) {
+          const nnz_lno_t n = adj(j);
+          if (n == i || n >= nv) continue;
+          const nnz_lno_t s = slot(colors(n)) - chunk;
+          if (s >= 0 && s < 64) forbidden |= uint64_t(1) << s;
+        }
+        for (nnz_lno_t s = 0; s < 64 && chunk + s < num_underfull; ++s) {
+          if (forbidden & (uint64_t(1) << s)) continue;
+          const nnz_lno_t target = underfull(chunk + s);
+          if (deficit(target) > 0 &&
+              Kokkos::atomic_fetch_sub(&deficit(target), nnz_lno_t(1)) > 0) {
+            tentative(i) = target;
+            return;
+          }
+        }
+      }
+      // nowhere to go, give the excess back.
+      Kokkos::atomic_fetch_add(&excess(c), nnz_lno_t(1));
+    }
+  };
+
+  /** \brief Undoes the moves that conflict with the move of a neighbor with
+   * a smaller id, and counts the moves that are kept. A vertex never moves
+   * to a color that one of its neighbors had at the start of the round, so
+   * these are the only conflicts.
+   */
+  struct ResolveFunctor {
+    in_lno_row_view_t xadj;
+    in_lno_nnz_view_t adj;
+    color_view_type colors;
+    color_view_type tentative;
+    color_view_type new_colors;
+
+    ResolveFunctor(in_lno_row_view_t xadj_, in_lno_nnz_view_t adj_,
+                   color_view_type colors_, color_view_type tentative_,
+                   color_view_type new_colors_)
+        : xadj(xadj_),
+          adj(adj_),
+          colors(colors_),
+          tentative(tentative_),
+          new_colors(new_colors_) {}
+
+    KOKKOS_INLINE_FUNCTION
+    void operator()(const nnz_lno_t &i, nnz_lno_t &num_moved) const {
+      color_t c = tentative(i);
+      if (c != colors(i)) {
+        for (size_type j = xadj(i); j < xadj(i + 1); ++j) {
+          const nnz_lno_t n = adj(j);
+          if (n < i && tentative(n) == c) {
+            c = colors(i);
+            break;
+          }
+        }
+      }
+      if (c != colors(i)) num_moved += 1;
+      new_colors(i) = c;
+    }
+  };
+
+  /** \brief Rebalances the color classes in place.
+   *  \param colors: a valid coloring, overwritten with the balanced coloring.
+   *  \param num_rounds: the number of rounds performed.
+   */
+  void balance(color_view_type colors, int &num_rounds) {
+    num_rounds = 0;
+    if (nv == 0) return;
+
+    color_t num_colors = 0;
+    Kokkos::parallel_reduce(
+        "KokkosGraph::GraphColoring::BalanceNumColors", my_exec_space(0, nv),
+        typename HandleType::ReduceMaxFunctor(colors), num_colors);
+    if (num_colors < 2) return;
+
+    // class sizes within [lower, upper] need no balancing; classes above
+    // upper shed vertices and classes below lower take them.
+    const double avg    = double(nv) / num_colors;
+    const double tol    = cp->get_balance_tolerance();
+    const nnz_lno_t lo  = nv / num_colors;
+    const nnz_lno_t hi  = (nv + num_colors - 1) / num_colors;
+    const int max_round = cp->get_max_number_of_iterations();
+
+    nnz_lno_temp_work_view_t sizes("Color Set Sizes", num_colors + 1);
+    nnz_lno_temp_work_view_t excess("Color Set Excess", num_colors + 1);
+    nnz_lno_temp_work_view_t deficit("Color Set Deficit", num_colors + 1);
+    nnz_lno_temp_work_view_t slot("Underfull Slot", num_colors + 1);
+    nnz_lno_temp_work_view_t underfull("Underfull Colors", num_colors);
+    auto h_sizes     = Kokkos::create_mirror_view(sizes);
+    auto h_excess    = Kokkos::create_mirror_view(excess);
+    auto h_deficit   = Kokkos::create_mirror_view(deficit);
+    auto h_slot      = Kokkos::create_mirror_view(slot);
+    auto h_underfull = Kokkos::create_mirror_view(underfull);
+
+    color_view_type tentative(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Tentative Colors"),
+        nv);
+    color_view_type new_colors(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Balanced Colors"),
+        nv);
+
+    while (num_rounds < max_round) {
+      Kokkos::deep_copy(sizes, nnz_lno_t(0));
+      KokkosKernels::Impl::kk_get_histogram<
+          color_view_type, nnz_lno_temp_work_view_t, MyExecSpace>(nv, colors,
+                                                                  sizes);
+      Kokkos::deep_copy(h_sizes, sizes);
+
+      nnz_lno_t min_size = nv, max_size = 0, num_underfull = 0;
+      for (color_t c = 1; c <= num_colors; ++c) {
+        const nnz_lno_t size = h_sizes(c);
+        if (size < min_size) min_size = size;
+        if (size > max_size) max_size = size;
+        h_excess(c)  = size > hi ? size - hi : 0;
+        h_deficit(c) = size < lo ? lo - size : 0;
+        h_slot(c)    = -1;
+        if (h_deficit(c) > 0) {
+          h_slot(c)                  = num_underfull;
+          h_underfull(num_underfull) = c;
+          ++num_underfull;
+        }
+      }
+      if (max_size <= (1 + tol) * avg && min_size >= (1 - tol) * avg) break;
+      if (num_underfull == 0) break;
+
+      Kokkos::deep_copy(excess, h_excess);
+      Kokkos::deep_copy(deficit, h_deficit);
+      Kokkos::deep_copy(slot, h_slot);
+      Kokkos::deep_copy(underfull, h_underfull);
+
+      Kokkos::parallel_for(
+          "KokkosGraph::GraphColoring::BalanceMove", my_exec_space(0, nv),
+          MoveFunctor(nv, xadj, adj, colors, tentative, excess, deficit,
+                      underfull, slot, num_underfull));
+      nnz_lno_t num_moved = 0;
+      Kokkos::parallel_reduce(
+          "KokkosGraph::GraphColoring::BalanceResolve", my_exec_space(0, nv),
+          ResolveFunctor(xadj, adj, colors, tentative, new_colors),
+          num_moved);
+      Kokkos::deep_copy(colors, new_colors);
+      ++num_rounds;
+
+      if (cp->get_tictoc()) {
+        std::cout << "\tBalance round:" << num_rounds
+                  << " moved vertices:" << num_moved << std::endl;
+      }
+      if (num_moved == 0) break;
+    }
+  }
+};
+
 template <class KernelHandle, typename lno_row_view_t_,
           typename lno_nnz_view_t_>
 void graph_color_impl(KernelHandle *handle,
@@ -3170,6 +3455,14 @@ void graph_color_impl(KernelHandle *handle,
   gc->color_graph(colors_out, num_phases);
 
   delete gc;
+
+  if (gch->get_balance_colors()) {
+    Impl::GraphColor_Balance<typename KernelHandle::GraphColoringHandleType,
+                             lno_row_view_t_, lno_nnz_view_t_>
+        gb(num_rows, row_map, entries, gch);
+    int num_rounds = 0;
+    gb.balance(colors_out, num_rounds);
+  }
   double coloring_time = timer.seconds();
   gch->add_to_overall_coloring_time(coloring_time);
   gch->set_coloring_time(coloring_time);
@@ -1607,6 +1607,71 @@ class GraphColorDistance2 {
   };     // struct functorFindConflicts_Atomic (end)
 };       // end class GraphColorDistance2
 
+/*!
+ * \brief Uncolors the listed vertices that are uncolored or share their color
+ * with a distance-1 or distance-2 neighbor, and gathers them into the recolor
+ * list. This repairs a distance-2 coloring of a symmetric graph after the
+ * adjacency of the listed vertices changed.
+ */
+template <typename rowmap_t, typename entries_t, typename colors_t,
+          typename in_list_t, typename list_t, typename list_length_t>
+struct functorUncolorDistance2RepairConflicts {
+  using lno_t      = typename list_t::non_const_value_type;
+  using size_type  = typename rowmap_t::non_const_value_type;
+  using color_type = typename colors_t::non_const_value_type;
+
+  lno_t nv;
+  rowmap_t _idx;
+  entries_t _adj;
+  colors_t _colors;
+  in_list_t _vertexList;
+  list_t _recolorList;
+  list_length_t _recolorListLength;
+
+  functorUncolorDistance2RepairConflicts(lno_t nv_, rowmap_t xadj_,
+                                         entries_t adj_, colors_t colors,
+                                         in_list_t vertexList,
+                                         list_t recolorList,
+                                         list_length_t recolorListLength)
+      : nv(nv_),
+        _idx(xadj_),
+        _adj(adj_),
+        _colors(colors),
+        _vertexList(vertexList),
+        _recolorList(recolorList),
+        _recolorListLength(recolorListLength) {}
+
+  KOKKOS_INLINE_FUNCTION
+  bool conflicts(const lno_t vid, const lno_t nbor,
+                 const color_type my_color) const {
+    return nbor != vid && nbor < nv && _colors(nbor) == my_color;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t i, lno_t& numConflicts) const {
+    const lno_t vid           = _vertexList(i);
+    const color_type my_color = _colors(vid);
+
+    bool conflict = my_color == 0;
+    for (size_type d1_adj = _idx(vid); !conflict && d1_adj < _idx(vid + 1);
+         d1_adj++) {
+      const lno_t vid_d1 = _adj(d1_adj);
+      if (vid_d1 >= nv) continue;
+      conflict = conflicts(vid, vid_d1, my_color);
+      for (size_type d2_adj = _idx(vid_d1);
+           !conflict && d2_adj < _idx(vid_d1 + 1); d2_adj++) {
+        conflict = conflicts(vid, _adj(d2_adj), my_color);
+      }
+    }
+    if (conflict) {
+      _colors(vid) = 0;  // uncolor vertex
+      const lno_t k = Kokkos::atomic_fetch_add(&_recolorListLength(), lno_t(1));
+      _recolorList(k) = vid;
+      numConflicts++;
+    }
+  }
+};
+
 /**
  * Prints out a histogram of graph colors for Distance-2 Graph Coloring
  *
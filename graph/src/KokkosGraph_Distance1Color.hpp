@@ -73,6 +73,85 @@ void graph_color(KernelHandle *handle,
                        is_symmetric);
 }
 
+/**
+ * \brief Repairs the coloring stored in the handle after the adjacency of a
+ * few vertices changed, instead of recoloring the whole graph. The listed
+ * vertices that are uncolored or conflict with a neighbor are recolored with
+ * the vertex-based speculative algorithm, keeping the colors of all other
+ * vertices fixed, so the work is proportional to the size of the change.
+ *
+ * \param handle: a handle that colored the previous version of the graph.
+ * \param row_map, entries: the modified, symmetric graph.
+ * \param modified_vertices: the vertices whose adjacency changed, without
+ * duplicates. Both endpoints of every added edge and every new vertex must be
+ * listed. If the graph grew, the new vertices start uncolored.
+ *
+ * The algorithm is switched to COLORING_VBBIT for the repair unless the
+ * handle uses COLORING_VB, and is restored afterwards. The color balancing
+ * pass visits every vertex, so it is skipped by the repair.
+ */
+template <class KernelHandle, typename lno_row_view_t_,
+          typename lno_nnz_view_t_, typename lno_list_view_t_>
+void graph_color_repair(KernelHandle *handle,
+                        typename KernelHandle::nnz_lno_t num_rows,
+                        typename KernelHandle::nnz_lno_t num_cols,
+                        lno_row_view_t_ row_map, lno_nnz_view_t_ entries,
+                        lno_list_view_t_ modified_vertices,
+                        bool is_symmetric = true) {
+  typedef typename KernelHandle::HandleExecSpace ExecSpace;
+  typedef typename KernelHandle::nnz_lno_t nnz_lno_t;
+  typedef typename KernelHandle::GraphColoringHandleType
+      GraphColoringHandleType;
+  typedef typename GraphColoringHandleType::color_view_t color_view_t;
+  typedef typename GraphColoringHandleType::nnz_lno_temp_work_view_t
+      nnz_lno_temp_work_view_t;
+  typedef Kokkos::View<nnz_lno_t,
+                       typename nnz_lno_temp_work_view_t::device_type>
+      single_dim_index_view_type;
+
+  GraphColoringHandleType *gch = handle->get_graph_coloring_handle();
+
+  color_view_t colors = gch->get_vertex_colors();
+  if (colors.extent(0) != size_t(num_rows)) Kokkos::resize(colors, num_rows);
+
+  const nnz_lno_t num_modified = modified_vertices.extent(0);
+  nnz_lno_temp_work_view_t recolor_list(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "recolorList"),
+      num_modified);
+  single_dim_index_view_type recolor_list_length("recolorListLength");
+  nnz_lno_t num_recolor = 0;
+  Kokkos::parallel_reduce(
+      "KokkosGraph::GraphColoring::RepairConflicts",
+      Kokkos::RangePolicy<ExecSpace>(0, num_modified),
+      KokkosGraph::Impl::functorUncolorRepairConflicts<
+          lno_row_view_t_, lno_nnz_view_t_, color_view_t, lno_list_view_t_,
+          nnz_lno_temp_work_view_t, single_dim_index_view_type>(
+          num_rows, row_map, entries, colors, modified_vertices, recolor_list,
+          recolor_list_length),
+      num_recolor);
+  gch->set_vertex_colors(colors);
+  if (num_recolor == 0) return;
+
+  // only the vertex-based algorithms color a vertex list around fixed colors.
+  const ColoringAlgorithm algorithm = gch->get_coloring_algo_type();
+  const ConflictList conflict_list  = gch->get_conflict_list_type();
+  const bool balance_colors         = gch->get_balance_colors();
+  if (algorithm != COLORING_VB && algorithm != COLORING_VBBIT)
+    gch->set_coloring_algo_type(COLORING_VBBIT);
+  if (conflict_list == COLORING_NOCONFLICT)
+    gch->set_conflict_list_type(COLORING_ATOMIC);
+  gch->set_balance_colors(false);
+
+  gch->set_vertex_list(recolor_list, num_recolor);
+  graph_color_symbolic(handle, num_rows, num_cols, row_map, entries,
+                       is_symmetric);
+  gch->clear_vertex_list();
+
+  gch->set_coloring_algo_type(algorithm);
+  gch->set_conflict_list_type(conflict_list);
+  gch->set_balance_colors(balance_colors);
+}
+
 }  // end namespace Experimental
 }  // end namespace KokkosGraph
 
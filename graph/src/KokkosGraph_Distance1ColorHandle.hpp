@@ -148,6 +148,13 @@ class GraphColoringHandle {
   bool is_coloring_called_before;
   nnz_lno_t num_colors;
 
+  bool balance_colors;       // equalize the color class sizes after coloring
+  double balance_tolerance;  // allowed relative deviation of a class size
+                             // from the average class size
+  nnz_lno_persistent_work_view_t color_set_sizes;  // vertices per color
+  nnz_lno_t min_color_set_size;
+  nnz_lno_t max_color_set_size;
+
  public:
   /**
    * \brief Default constructor.
@@ -178,7 +185,12 @@ class GraphColoringHandle {
         use_vtx_list(false),
         vertex_colors(),
         is_coloring_called_before(false),
-        num_colors(0) {
+        num_colors(0),
+        balance_colors(false),
+        balance_tolerance(0.1),
+        color_set_sizes(),
+        min_color_set_size(0),
+        max_color_set_size(0) {
     this->choose_default_algorithm();
     this->set_defaults(this->coloring_algorithm_type);
   }
@@ -554,6 +566,53 @@ class GraphColoringHandle {
     return num_colors;
   }
 
+  /** \brief Returns the number of vertices of each color, indexed by color.
+   * Entry 0 counts the uncolored vertices. The sizes are computed on the
+   * first call after a coloring.
+   */
+  nnz_lno_persistent_work_view_t get_color_set_sizes() {
+    if (color_set_sizes.extent(0) == 0) {
+      color_set_sizes = nnz_lno_persistent_work_view_t("Color Set Sizes",
+                                                       get_num_colors() + 1);
+      KokkosKernels::Impl::kk_get_histogram<
+          color_view_t, nnz_lno_persistent_work_view_t, ExecutionSpace>(
+          vertex_colors.extent(0), vertex_colors, color_set_sizes);
+
+      auto h_sizes = Kokkos::create_mirror_view(color_set_sizes);
+      Kokkos::deep_copy(h_sizes, color_set_sizes);
+      min_color_set_size = max_color_set_size = 0;
+      for (size_t c = 1; c < h_sizes.extent(0); ++c) {
+        if (c == 1 || h_sizes(c) < min_color_set_size)
+          min_color_set_size = h_sizes(c);
+        if (h_sizes(c) > max_color_set_size) max_color_set_size = h_sizes(c);
+      }
+    }
+    return color_set_sizes;
+  }
+
+  /** \brief Returns the size of the smallest color class.
+   */
+  nnz_lno_t get_min_color_set_size() {
+    get_color_set_sizes();
+    return min_color_set_size;
+  }
+
+  /** \brief Returns the size of the largest color class.
+   */
+  nnz_lno_t get_max_color_set_size() {
+    get_color_set_sizes();
+    return max_color_set_size;
+  }
+
+  /** \brief Returns the ratio of the largest color class size to the average
+   * color class size. A perfectly balanced coloring returns 1.
+   */
+  double get_color_set_imbalance() {
+    const nnz_lno_t nc = get_num_colors();
+    if (nc == 0) return 1.0;
+    return double(get_max_color_set_size()) * nc / vertex_colors.extent(0);
+  }
+
   /** \brief Sets Default Parameter settings for the given algorithm.
    */
   void set_defaults(const ColoringAlgorithm &col_algo) {
@@ -642,6 +701,8 @@ class GraphColoringHandle {
   bool get_use_vtx_list() const { return this->use_vtx_list; }
   nnz_lno_temp_work_view_t get_vertex_list() const { return this->vertex_list; }
   size_type get_vertex_list_size() const { return this->vertex_list_size; }
+  bool get_balance_colors() const { return this->balance_colors; }
+  double get_balance_tolerance() const { return this->balance_tolerance; }
   // setters
   void set_vertex_list(nnz_lno_temp_work_view_t vertex_list_,
                        size_type vertex_list_size_) {
@@ -649,6 +710,11 @@ class GraphColoringHandle {
     this->vertex_list_size = vertex_list_size_;
     this->use_vtx_list     = true;
   }
+  void clear_vertex_list() {
+    this->vertex_list      = nnz_lno_temp_work_view_t();
+    this->vertex_list_size = 0;
+    this->use_vtx_list     = false;
+  }
   void set_coloring_algo_type(const ColoringAlgorithm &col_algo) {
     this->coloring_algorithm_type = col_algo;
   }
@@ -678,6 +744,19 @@ class GraphColoringHandle {
   void set_eb_num_initial_colors(const int &num_initial_colors) {
     this->eb_num_initial_colors = num_initial_colors;
   }
+  /** \brief Whether to rebalance the color classes after coloring, so that
+   * multicolor Gauss-Seidel gets colors of similar sizes. The rebalancing
+   * never increases the number of colors.
+   */
+  void set_balance_colors(const bool &balance_colors_) {
+    this->balance_colors = balance_colors_;
+  }
+  /** \brief Rebalancing stops once all color class sizes are within
+   * (1 +/- tolerance) times the average class size.
+   */
+  void set_balance_tolerance(const double &balance_tolerance_) {
+    this->balance_tolerance = balance_tolerance_;
+  }
   void add_to_overall_coloring_time(const double &coloring_time_) {
     this->overall_coloring_time += coloring_time_;
   }
@@ -706,6 +785,7 @@ class GraphColoringHandle {
     this->vertex_colors             = vertex_colors_;
     this->is_coloring_called_before = true;
     this->num_colors                = 0;
+    this->color_set_sizes           = nnz_lno_persistent_work_view_t();
   }
 };
 
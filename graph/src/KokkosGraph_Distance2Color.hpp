@@ -71,6 +71,78 @@ void graph_color_distance2(KernelHandle *handle,
   gch_d2->set_coloring_time(timer.seconds());
 }
 
+/**
+ * Repair the distance-2 coloring stored in the handle after the adjacency of a
+ * few vertices changed, instead of recoloring the whole graph.
+ *
+ * The listed vertices that are uncolored or have the same color as a
+ * distance-1 or distance-2 neighbor are recolored with the vertex-based
+ * algorithm. The colors of all other vertices stay fixed, so the work is
+ * proportional to the size of the change.
+ *
+ * @param[in]  handle             The Kernel Handle, holding the coloring of
+ *                                the previous version of the graph
+ * @param[in]  num_verts          Number of vertices in the modified graph
+ * @param[in]  row_map            Row map of the modified, symmetric graph
+ * @param[in]  row_entries        Row entries of the modified graph
+ * @param[in]  modified_vertices  Vertices whose adjacency changed, without
+ *                                duplicates. Both endpoints of every added
+ *                                edge and every new vertex must be listed.
+ *
+ * The repair runs COLORING_D2_VB_BIT unless the handle uses COLORING_D2_VB;
+ * the handle's algorithm is restored afterwards.
+ */
+template <class KernelHandle, typename InRowmap, typename InEntries,
+          typename InList>
+void graph_color_distance2_repair(KernelHandle *handle,
+                                  typename KernelHandle::nnz_lno_t num_verts,
+                                  InRowmap row_map, InEntries row_entries,
+                                  InList modified_vertices) {
+  using execution_space = typename KernelHandle::HandleExecSpace;
+  using lno_t           = typename KernelHandle::nnz_lno_t;
+  using D2Handle        = typename KernelHandle::GraphColorDistance2HandleType;
+  using color_view_t    = typename D2Handle::color_view_type;
+  using lno_view_t      = typename D2Handle::nnz_lno_temp_work_view_type;
+  using single_lno_view_t =
+      Kokkos::View<lno_t, typename lno_view_t::device_type>;
+
+  D2Handle *gch_d2 = handle->get_distance2_graph_coloring_handle();
+
+  color_view_t colors = gch_d2->get_vertex_colors();
+  if (colors.extent(0) != size_t(num_verts))
+    Kokkos::resize(colors, num_verts);
+
+  const lno_t num_modified = modified_vertices.extent(0);
+  lno_view_t recolor_list(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "recolorList"),
+      num_modified);
+  single_lno_view_t recolor_list_length("recolorListLength");
+  lno_t num_recolor = 0;
+  Kokkos::parallel_reduce(
+      "KokkosGraph::GraphColorDistance2::RepairConflicts",
+      Kokkos::RangePolicy<execution_space>(0, num_modified),
+      KokkosGraph::Impl::functorUncolorDistance2RepairConflicts<
+          InRowmap, InEntries, color_view_t, InList, lno_view_t,
+          single_lno_view_t>(num_verts, row_map, row_entries, colors,
+                             modified_vertices, recolor_list,
+                             recolor_list_length),
+      num_recolor);
+  gch_d2->set_vertex_colors(colors);
+  if (num_recolor == 0) return;
+
+  // only the vertex-based algorithms color a vertex list around fixed colors.
+  const GraphColoringAlgorithmDistance2 algorithm =
+      gch_d2->get_coloring_algo_type();
+  if (algorithm != COLORING_D2_VB)
+    gch_d2->set_coloring_algo_type(COLORING_D2_VB_BIT);
+
+  gch_d2->set_vertex_list(recolor_list, num_recolor);
+  graph_color_distance2(handle, num_verts, row_map, row_entries);
+  gch_d2->clear_vertex_list();
+
+  gch_d2->set_coloring_algo_type(algorithm);
+}
+
 /**
  * Color the left part (rows) of a bipartite graph: rows r1 and r2 can have the
  * same color if there is no column c such that edges (r1, c) and (r2, c) exist.
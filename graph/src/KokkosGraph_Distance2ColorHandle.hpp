@@ -284,6 +284,11 @@ class GraphColorDistance2Handle {
     this->vertex_list_size = vertex_list_size_;
     this->use_vtx_list     = true;
   }
+  void clear_vertex_list() {
+    this->vertex_list      = nnz_lno_temp_work_view_type();
+    this->vertex_list_size = 0;
+    this->use_vtx_list     = false;
+  }
   void set_coloring_called() { this->is_coloring_called_before = true; }
 
   void set_coloring_algo_type(const GraphColoringAlgorithmDistance2& col_algo) {
@@ -0,0 +1,315 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#pragma once
+// exclude from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#include <algorithm>
+#include <iterator>
+#include <list>
+#include <vector>
+#include <Kokkos_Core.hpp>
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosGraph_CoarsenConstruct.hpp"
+
+namespace KokkosGraph {
+
+namespace Experimental {
+
+// Multilevel k-way partitioner for undirected graphs stored as symmetric
+// matrices (values are edge weights). The graph is coarsened with
+// coarse_builder, the coarsest graph is partitioned by greedy graph growing on
+// the host, and the partition is projected back level by level. On every
+// level the partition is refined by parallel, size-constrained label
+// propagation: boundary vertices move to the neighboring part they are most
+// connected to, alternating between moves to higher and to lower part ids so
+// that two adjacent vertices never swap parts in the same round.
+template <class crsMat>
+class partitioner {
+ public:
+  // define internal types
+  using matrix_t      = crsMat;
+  using exec_space    = typename matrix_t::execution_space;
+  using Device        = typename matrix_t::device_type;
+  using ordinal_t     = typename matrix_t::ordinal_type;
+  using edge_offset_t = typename matrix_t::size_type;
+  using scalar_t      = typename matrix_t::value_type;
+  using vtx_view_t    = Kokkos::View<ordinal_t*, Device>;
+  using policy_t      = Kokkos::RangePolicy<exec_space>;
+  using coarsener_t   = coarse_builder<crsMat>;
+  using coarse_level_triple = typename coarsener_t::coarse_level_triple;
+
+  struct partition_handle {
+    // coarsening parameters (heuristic, builder, cutoffs) and hierarchy
+    typename coarsener_t::coarsen_handle coarsen;
+    ordinal_t num_parts = 2;
+    // a part may weigh at most imbalance_tol times the average part weight
+    double imbalance_tol = 1.03;
+    // maximum number of label propagation rounds per level
+    int refine_iters = 16;
+    // results
+    vtx_view_t part;
+    scalar_t edge_cut         = 0;
+    ordinal_t max_part_weight = 0;
+    double imbalance          = 0;
+  };
+
+  // greedy graph growing on the host: part p grows from an unassigned seed,
+  // always adding the unassigned vertex most connected to it, until it reaches
+  // the average part weight. The last part takes the remaining vertices.
+  static void initial_partition(const partition_handle& handle,
+                                const coarse_level_triple& level,
+                                vtx_view_t part) {
+    const matrix_t g  = level.mtx;
+    const ordinal_t n = g.numRows();
+    const ordinal_t k = handle.num_parts;
+    Kokkos::HostSpace host;
+    auto rowmap   = Kokkos::create_mirror_view_and_copy(host, g.graph.row_map);
+    auto entries  = Kokkos::create_mirror_view_and_copy(host, g.graph.entries);
+    auto values   = Kokkos::create_mirror_view_and_copy(host, g.values);
+    auto vtx_wgts = Kokkos::create_mirror_view_and_copy(host, level.vtx_wgts);
+    auto h_part   = Kokkos::create_mirror_view(part);
+
+    double total_wgt = 0;
+    for (ordinal_t i = 0; i < n; i++) {
+      h_part(i) = k;  // unassigned
+      total_wgt += vtx_wgts(i);
+    }
+    const double target = total_wgt / k;
+
+    std::vector<scalar_t> conn(n);
+    ordinal_t next_seed = 0;
+    for (ordinal_t p = 0; p < k; p++) {
+      if (p == k - 1) {
+        for (ordinal_t i = 0; i < n; i++)
+          if (h_part(i) == k) h_part(i) = p;
+        break;
+      }
+      std::fill(conn.begin(), conn.end(), scalar_t(0));
+      double part_wgt = 0;
+      while (part_wgt < target) {
+        // the unassigned vertex most connected to p, or a new seed
+        ordinal_t best = n;
+        for (ordinal_t i = 0; i < n; i++) {
+          if (h_part(i) == k && conn[i] > 0 &&
+              (best == n || conn[i] > conn[best]))
+            best = i;
+        }
+        if (best == n) {
+          while (next_seed < n && h_part(next_seed) != k) next_seed++;
+          if (next_seed == n) break;
+          best = next_seed;
+        }
+        h_part(best) = p;
+        part_wgt += vtx_wgts(best);
+        for (edge_offset_t j = rowmap(best); j < rowmap(best + 1); j++) {
+          conn[entries(j)] += values(j);
+        }
+      }
+    }
+    Kokkos::deep_copy(part, h_part);
+  }
+
+  // coarse_part is indexed by the vertices of the level that interp maps to
+  static void project(const matrix_t interp, const vtx_view_t coarse_part,
+                      vtx_view_t fine_part) {
+    auto rowmap  = interp.graph.row_map;
+    auto entries = interp.graph.entries;
+    Kokkos::parallel_for(
+        "project partition", policy_t(0, interp.numRows()),
+        KOKKOS_LAMBDA(const ordinal_t i) {
+          fine_part(i) = coarse_part(entries(rowmap(i)));
+        });
+  }
+
+  static vtx_view_t part_weights(const ordinal_t k, const vtx_view_t vtx_wgts,
+                                 const vtx_view_t part) {
+    vtx_view_t weights("part weights", k);
+    Kokkos::parallel_for(
+        "part weights", policy_t(0, part.extent(0)),
+        KOKKOS_LAMBDA(const ordinal_t i) {
+          Kokkos::atomic_add(&weights(part(i)), vtx_wgts(i));
+        });
+    return weights;
+  }
+
+  static void refine(const partition_handle& handle,
+                     const coarse_level_triple& level, vtx_view_t part) {
+    const matrix_t g  = level.mtx;
+    const ordinal_t n = g.numRows();
+    const ordinal_t k = handle.num_parts;
+    auto rowmap       = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    auto values       = g.values;
+    auto vtx_wgts     = level.vtx_wgts;
+
+    vtx_view_t weights = part_weights(k, vtx_wgts, part);
+    auto h_weights     = Kokkos::create_mirror_view(weights);
+    Kokkos::deep_copy(h_weights, weights);
+    double total_wgt = 0;
+    for (ordinal_t p = 0; p < k; p++) total_wgt += h_weights(p);
+    const ordinal_t max_wgt =
+        static_cast<ordinal_t>(handle.imbalance_tol * total_wgt / k) + 1;
+
+    vtx_view_t next_part(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "next partition"), n);
+    int idle_rounds = 0;
+    for (int iter = 0; iter < handle.refine_iters && idle_rounds < 2; iter++) {
+      const bool upward = iter % 2 == 0;
+      // lightest part, the fallback target of overweight interior vertices
+      Kokkos::deep_copy(h_weights, weights);
+      ordinal_t lightest = 0;
+      for (ordinal_t p = 1; p < k; p++)
+        if (h_weights(p) < h_weights(lightest)) lightest = p;
+
+      ordinal_t moved = 0;
+      Kokkos::parallel_reduce(
+          "label propagation", policy_t(0, n),
+          KOKKOS_LAMBDA(const ordinal_t i, ordinal_t& update) {
+            const ordinal_t p     = part(i);
+            const ordinal_t w     = vtx_wgts(i);
+            const bool overweight = weights(p) > max_wgt;
+            next_part(i)          = p;
+
+            const edge_offset_t row_begin = rowmap(i);
+            const edge_offset_t row_end   = rowmap(i + 1);
+            scalar_t own = 0;
+            for (edge_offset_t j = row_begin; j < row_end; j++) {
+              const ordinal_t v = entries(j);
+              if (v != i && part(v) == p) own += values(j);
+            }
+            ordinal_t best     = p;
+            scalar_t best_conn = 0;
+            for (edge_offset_t j = row_begin; j < row_end; j++) {
+              const ordinal_t v = entries(j);
+              const ordinal_t q = part(v);
+              if (v == i || q == p) continue;
+              if (!overweight && (upward ? q < p : q > p)) continue;
+              // evaluate every neighboring part once, at its first entry
+              bool seen = false;
+              for (edge_offset_t jj = row_begin; !seen && jj < j; jj++)
+                seen = entries(jj) != i && part(entries(jj)) == q;
+              if (seen) continue;
+              scalar_t conn = 0;
+              for (edge_offset_t jj = j; jj < row_end; jj++)
+                if (entries(jj) != i && part(entries(jj)) == q)
+                  conn += values(jj);
+              if (best == p || conn > best_conn ||
+                  (conn == best_conn && weights(q) < weights(best))) {
+                best      = q;
+                best_conn = conn;
+              }
+            }
+            if (overweight && best == p && lightest != p) best = lightest;
+            if (best == p) return;
+            // outside of balancing only moves that reduce the cut, or keep it
+            // and improve the balance, are taken
+            if (!overweight &&
+                !(best_conn > own ||
+                  (best_conn == own && weights(best) + w < weights(p))))
+              return;
+            // reserve room in the target part, and when balancing make sure
+            // the source part is still overweight
+            if (Kokkos::atomic_fetch_add(&weights(best), w) + w > max_wgt) {
+              Kokkos::atomic_add(&weights(best), -w);
+              return;
+            }
+            const ordinal_t old_wgt = Kokkos::atomic_fetch_add(&weights(p), -w);
+            if (overweight && old_wgt <= max_wgt) {
+              Kokkos::atomic_add(&weights(p), w);
+              Kokkos::atomic_add(&weights(best), -w);
+              return;
+            }
+            next_part(i) = best;
+            update++;
+          },
+          moved);
+      Kokkos::deep_copy(part, next_part);
+      idle_rounds = moved == 0 ? idle_rounds + 1 : 0;
+    }
+  }
+
+  // fills in the edge cut, the heaviest part and the imbalance of handle.part
+  static void compute_stats(partition_handle& handle, const matrix_t g,
+                            const vtx_view_t vtx_wgts) {
+    const ordinal_t k = handle.num_parts;
+    auto rowmap       = g.graph.row_map;
+    auto entries      = g.graph.entries;
+    auto values       = g.values;
+    auto part         = handle.part;
+
+    scalar_t cut = 0;
+    Kokkos::parallel_reduce(
+        "edge cut", policy_t(0, g.numRows()),
+        KOKKOS_LAMBDA(const ordinal_t i, scalar_t& update) {
+          for (edge_offset_t j = rowmap(i); j < rowmap(i + 1); j++)
+            if (part(entries(j)) != part(i)) update += values(j);
+        },
+        cut);
+    // every cut edge is stored in both directions
+    handle.edge_cut = cut / 2;
+
+    auto h_weights = Kokkos::create_mirror_view_and_copy(
+        Kokkos::HostSpace(), part_weights(k, vtx_wgts, part));
+    double total_wgt       = 0;
+    handle.max_part_weight = 0;
+    for (ordinal_t p = 0; p < k; p++) {
+      total_wgt += h_weights(p);
+      if (h_weights(p) > handle.max_part_weight)
+        handle.max_part_weight = h_weights(p);
+    }
+    handle.imbalance =
+        total_wgt > 0 ? handle.max_part_weight * k / total_wgt : 1.0;
+  }
+
+  // partitions the symmetric graph g into handle.num_parts parts; the result
+  // and its statistics are stored in the handle
+  static void partition(partition_handle& handle, const matrix_t g,
+                        bool uniform_weights = false) {
+    const ordinal_t k = handle.num_parts;
+    // keep enough coarse vertices for the initial partition to be balanced
+    if (handle.coarsen.coarse_vtx_cutoff < 8 * k)
+      handle.coarsen.coarse_vtx_cutoff = 8 * k;
+    if (handle.coarsen.min_allowed_vtx < 4 * k)
+      handle.coarsen.min_allowed_vtx = 4 * k;
+
+    coarsener_t::generate_coarse_graphs(handle.coarsen, g, uniform_weights);
+    std::list<coarse_level_triple>& levels = handle.coarsen.results;
+
+    auto coarse = levels.rbegin();
+    vtx_view_t part("partition", coarse->mtx.numRows());
+    if (k > 1) {
+      initial_partition(handle, *coarse, part);
+      refine(handle, *coarse, part);
+      for (auto fine = std::next(coarse); fine != levels.rend();
+           coarse = fine, fine++) {
+        vtx_view_t fine_part("partition", fine->mtx.numRows());
+        project(coarse->interp_mtx, part, fine_part);
+        part = fine_part;
+        refine(handle, *fine, part);
+      }
+    } else {
+      part = vtx_view_t("partition", g.numRows());
+    }
+    handle.part = part;
+    compute_stats(handle, g, levels.begin()->vtx_wgts);
+  }
+};
+
+}  // end namespace Experimental
+}  // end namespace KokkosGraph
+// exclude from Cuda builds without lambdas enabled
+#endif
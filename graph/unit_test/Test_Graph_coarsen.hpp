@@ -15,12 +15,15 @@
 //@HEADER
 
 #include <gtest/gtest.h>
+#include <algorithm>
 #include <random>
 #include <set>
 #include <list>
+#include <vector>
 #include <Kokkos_Core.hpp>
 
 #include "KokkosGraph_CoarsenConstruct.hpp"
+#include "KokkosGraph_Partition.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosKernels_IOUtils.hpp"
 #include "KokkosKernels_Handle.hpp"
@@ -395,6 +398,43 @@ void test_coarsen_random(lno_t numVerts, size_type nnz, lno_t bandwidth,
   }
 }
 
+template <typename scalar, typename lno_t, typename size_type, typename device>
+void test_partition_grid(lno_t num_parts) {
+  using crsMat =
+      KokkosSparse::CrsMatrix<scalar, lno_t, device, void, size_type>;
+  crsMat A            = gen_grid<crsMat>();
+  using partitioner_t = partitioner<crsMat>;
+  typename partitioner_t::partition_handle handle;
+  handle.num_parts = num_parts;
+  partitioner_t::partition(handle, A, true);
+
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  auto part =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.part);
+  ASSERT_EQ(part.extent(0), static_cast<size_t>(A.numRows()));
+  std::vector<lno_t> part_size(num_parts, 0);
+  size_type cut = 0;
+  for (lno_t i = 0; i < A.numRows(); i++) {
+    ASSERT_TRUE(part(i) >= 0 && part(i) < num_parts);
+    part_size[part(i)]++;
+    for (size_type j = rowmap(i); j < rowmap(i + 1); j++) {
+      if (part(entries(j)) != part(i)) cut++;
+    }
+  }
+  lno_t max_size = *std::max_element(part_size.begin(), part_size.end());
+  EXPECT_EQ(handle.max_part_weight, max_size);
+  EXPECT_EQ(handle.edge_cut, static_cast<scalar>(cut / 2));
+  EXPECT_LE(handle.imbalance, 1.1)
+      << "Partition of the grid into " << num_parts << " parts is unbalanced";
+  // a 200x300 grid can be split into k parts by cutting a few hundred edges,
+  // a random assignment would cut most of its ~120k edges
+  EXPECT_LT(handle.edge_cut, static_cast<scalar>(num_parts * 500))
+      << "Partition of the grid into " << num_parts << " parts has a poor cut";
+}
+
 #define EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)                                         \
   TEST_F(                                                                                     \
       TestCategory,                                                                           \
@@ -413,6 +453,12 @@ void test_coarsen_random(lno_t numVerts, size_type nnz, lno_t bandwidth,
       TestCategory,                                                                           \
       graph##_##grid_graph_multilevel_coarsen##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
     test_multilevel_coarsen_grid<SCALAR, ORDINAL, OFFSET, DEVICE>();                          \
+  }                                                                                           \
+  TEST_F(                                                                                     \
+      TestCategory,                                                                           \
+      graph##_##grid_graph_partition##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {          \
+    test_partition_grid<SCALAR, ORDINAL, OFFSET, DEVICE>(2);                                  \
+    test_partition_grid<SCALAR, ORDINAL, OFFSET, DEVICE>(8);                                  \
   }
 
 // FIXME_SYCL
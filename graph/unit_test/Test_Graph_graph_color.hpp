@@ -178,6 +178,101 @@ void test_coloring(lno_t numRows, size_type nnz, lno_t bandwidth,
 
     EXPECT_TRUE((num_conflict == 0));
   }
+
+  {
+    // balancing the serial greedy coloring keeps it valid, never adds colors
+    // and never grows the largest color class.
+    typedef KokkosKernelsHandle<size_type, lno_t, scalar_t,
+                                typename device::execution_space,
+                                typename device::memory_space,
+                                typename device::memory_space>
+        KernelHandle;
+
+    lno_t num_colors[2], max_set_size[2];
+    for (int balance = 0; balance < 2; ++balance) {
+      KernelHandle kh;
+      kh.create_graph_coloring_handle(COLORING_SERIAL);
+      auto gch = kh.get_graph_coloring_handle();
+      gch->set_balance_colors(balance == 1);
+      graph_color<KernelHandle, lno_view_t, lno_nnz_view_t>(
+          &kh, numRows, numCols, input_mat.graph.row_map,
+          input_mat.graph.entries);
+
+      color_view_t vector_colors = gch->get_vertex_colors();
+      lno_t num_conflict = KokkosSparse::Impl::kk_is_d1_coloring_valid<
+          lno_view_t, lno_nnz_view_t, color_view_t,
+          typename device::execution_space>(numRows, numCols,
+                                            input_mat.graph.row_map,
+                                            input_mat.graph.entries,
+                                            vector_colors);
+      EXPECT_TRUE((num_conflict == 0));
+
+      num_colors[balance]   = gch->get_num_colors();
+      max_set_size[balance] = gch->get_max_color_set_size();
+      EXPECT_TRUE((gch->get_min_color_set_size() <= max_set_size[balance]));
+      EXPECT_TRUE((gch->get_color_set_imbalance() >= 1.0));
+      kh.destroy_graph_coloring_handle();
+    }
+    EXPECT_TRUE((num_colors[1] <= num_colors[0]));
+    EXPECT_TRUE((max_set_size[1] <= max_set_size[0]));
+  }
+
+  {
+    // corrupt the colors of a few vertices and repair only those vertices.
+    typedef KokkosKernelsHandle<size_type, lno_t, scalar_t,
+                                typename device::execution_space,
+                                typename device::memory_space,
+                                typename device::memory_space>
+        KernelHandle;
+
+    KernelHandle kh;
+    kh.create_graph_coloring_handle(COLORING_SERIAL);
+    auto gch = kh.get_graph_coloring_handle();
+    graph_color<KernelHandle, lno_view_t, lno_nnz_view_t>(
+        &kh, numRows, numCols, input_mat.graph.row_map,
+        input_mat.graph.entries);
+
+    color_view_t vector_colors = gch->get_vertex_colors();
+    typename color_view_t::HostMirror hcolor =
+        Kokkos::create_mirror_view(vector_colors);
+    Kokkos::deep_copy(hcolor, vector_colors);
+    const lno_t num_modified = (numRows + 96) / 97;
+    color_view_t modified("modified vertices", num_modified);
+    typename color_view_t::HostMirror hmodified =
+        Kokkos::create_mirror_view(modified);
+    for (lno_t i = 0; i < num_modified; ++i) {
+      hmodified(i)         = 97 * i;
+      hcolor(hmodified(i)) = 1;
+    }
+    Kokkos::deep_copy(vector_colors, hcolor);
+    Kokkos::deep_copy(modified, hmodified);
+
+    // the repair does not rebalance, the other vertices keep their colors
+    gch->set_balance_colors(true);
+    graph_color_repair<KernelHandle, lno_view_t, lno_nnz_view_t, color_view_t>(
+        &kh, numRows, numCols, input_mat.graph.row_map,
+        input_mat.graph.entries, modified);
+    EXPECT_TRUE(gch->get_balance_colors());
+    {
+      auto hrepaired = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), gch->get_vertex_colors());
+      lno_t num_changed = 0;
+      for (lno_t i = 0; i < numRows; ++i)
+        if (i % 97 != 0 && hrepaired(i) != hcolor(i)) ++num_changed;
+      EXPECT_EQ(num_changed, 0);
+    }
+
+    vector_colors      = gch->get_vertex_colors();
+    lno_t num_conflict = KokkosSparse::Impl::kk_is_d1_coloring_valid<
+        lno_view_t, lno_nnz_view_t, color_view_t,
+        typename device::execution_space>(numRows, numCols,
+                                          input_mat.graph.row_map,
+                                          input_mat.graph.entries,
+                                          vector_colors);
+    EXPECT_TRUE((num_conflict == 0));
+    EXPECT_TRUE((gch->get_coloring_algo_type() == COLORING_SERIAL));
+    kh.destroy_graph_coloring_handle();
+  }
   // device::execution_space::finalize();
 }
 
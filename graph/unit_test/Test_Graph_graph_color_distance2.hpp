@@ -169,6 +169,38 @@ void test_dist2_coloring(lno_t numVerts, size_type nnz, lno_t bandwidth,
                          << " produced invalid coloring";
     kh.destroy_distance2_graph_coloring_handle();
   }
+  {
+    // Corrupt the colors of a few vertices and repair only those vertices.
+    KernelHandle kh;
+    kh.create_distance2_graph_coloring_handle(COLORING_D2_NB_BIT);
+    graph_color_distance2<KernelHandle, c_rowmap_t, c_entries_t>(
+        &kh, numVerts, symRowmap, symEntries);
+    auto coloring_handle = kh.get_distance2_graph_coloring_handle();
+    auto colors          = coloring_handle->get_vertex_colors();
+    auto colorsHost =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), colors);
+    const lno_t numModified = (numVerts + 96) / 97;
+    entries_t modified("modified vertices", numModified);
+    auto modifiedHost = Kokkos::create_mirror_view(modified);
+    for (lno_t i = 0; i < numModified; i++) {
+      modifiedHost(i)             = 97 * i;
+      colorsHost(modifiedHost(i)) = 1;
+    }
+    Kokkos::deep_copy(colors, colorsHost);
+    Kokkos::deep_copy(modified, modifiedHost);
+    graph_color_distance2_repair<KernelHandle, c_rowmap_t, c_entries_t,
+                                 entries_t>(&kh, numVerts, symRowmap,
+                                            symEntries, modified);
+    Kokkos::deep_copy(colorsHost, coloring_handle->get_vertex_colors());
+    bool success =
+        Test::verifyD2Coloring<lno_t, size_type, decltype(rowmapHost),
+                               decltype(entriesHost), decltype(colorsHost)>(
+            numVerts, rowmapHost, entriesHost, colorsHost);
+    EXPECT_TRUE(success) << "Dist-2: repair produced invalid coloring";
+    EXPECT_EQ(coloring_handle->getD2AlgorithmName(),
+              std::string("COLORING_D2_NB_BIT"));
+    kh.destroy_distance2_graph_coloring_handle();
+  }
 }
 
 template <typename scalar_unused, typename lno_t, typename size_type,
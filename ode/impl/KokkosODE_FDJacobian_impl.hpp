@@ -0,0 +1,122 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_FDJACOBIAN_IMPL_HPP
+#define KOKKOSODE_FDJACOBIAN_IMPL_HPP
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+
+namespace KokkosODE {
+namespace Impl {
+
+// Perturbation used for the finite difference in direction y(j)
+template <class value_type>
+KOKKOS_INLINE_FUNCTION value_type fd_step(const value_type y) {
+  using ats = Kokkos::ArithTraits<value_type>;
+  const value_type scale =
+      ats::abs(y) > ats::one() ? value_type(ats::abs(y)) : ats::one();
+  return Kokkos::sqrt(ats::epsilon()) * scale;
+}
+
+// Fills J with the finite difference approximation of the Jacobian of
+// sys.residual at y. Columns with the same color share no row of the pattern
+// so they are perturbed together and one residual evaluation per color
+// provides all their entries. Entries outside of the pattern are set to zero.
+template <class system_type, class vec_type, class rowmap_type,
+          class entries_type, class colors_type, class mat_type>
+KOKKOS_FUNCTION void FDJacobianDense(
+    const system_type& sys, const vec_type& y, const vec_type& f0,
+    const vec_type& y_pert, const vec_type& f_pert, const rowmap_type& rowmap,
+    const entries_type& entries, const colors_type& colors,
+    const int num_colors, const mat_type& J) {
+  using value_type = typename vec_type::non_const_value_type;
+  const int nrows  = J.extent(0);
+  const int ncols  = J.extent(1);
+
+  for (int i = 0; i < nrows; ++i)
+    for (int j = 0; j < ncols; ++j)
+      J(i, j) = Kokkos::ArithTraits<value_type>::zero();
+
+  for (int color = 1; color <= num_colors; ++color) {
+    for (int j = 0; j < ncols; ++j)
+      y_pert(j) = colors(j) == color ? y(j) + fd_step(y(j)) : y(j);
+    sys.residual(y_pert, f_pert);
+
+    for (int i = 0; i < nrows; ++i) {
+      for (auto p = rowmap(i); p < rowmap(i + 1); ++p) {
+        const int j = entries(p);
+        // dividing by the representable step limits the rounding error
+        if (colors(j) == color)
+          J(i, j) = (f_pert(i) - f0(i)) / (y_pert(j) - y(j));
+      }
+    }
+  }
+}
+
+template <class vec_type, class colors_type, class color_type>
+struct FDPerturbFunctor {
+  vec_type y, y_pert;
+  colors_type colors;
+  color_type color;
+
+  FDPerturbFunctor(const vec_type& y_, const vec_type& y_pert_,
+                   const colors_type& colors_, const color_type color_)
+      : y(y_), y_pert(y_pert_), colors(colors_), color(color_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const int j) const {
+    y_pert(j) = colors(j) == color ? y(j) + fd_step(y(j)) : y(j);
+  }
+};
+
+template <class crsmat_type, class vec_type, class colors_type,
+          class color_type>
+struct FDSparseColumnsFunctor {
+  using ordinal_type = typename crsmat_type::non_const_ordinal_type;
+  using size_type    = typename crsmat_type::non_const_size_type;
+
+  crsmat_type J;
+  vec_type y, f0, y_pert, f_pert;
+  colors_type colors;
+  color_type color;
+
+  FDSparseColumnsFunctor(const crsmat_type& J_, const vec_type& y_,
+                         const vec_type& f0_, const vec_type& y_pert_,
+                         const vec_type& f_pert_, const colors_type& colors_,
+                         const color_type color_)
+      : J(J_),
+        y(y_),
+        f0(f0_),
+        y_pert(y_pert_),
+        f_pert(f_pert_),
+        colors(colors_),
+        color(color_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_type i) const {
+    for (size_type p = J.graph.row_map(i); p < J.graph.row_map(i + 1); ++p) {
+      const ordinal_type j = J.graph.entries(p);
+      if (colors(j) == color)
+        J.values(p) = (f_pert(i) - f0(i)) / (y_pert(j) - y(j));
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_FDJACOBIAN_IMPL_HPP
@@ -20,7 +20,8 @@
 #include "Kokkos_Core.hpp"
 #include "KokkosBatched_LU_Decl.hpp"
 #include "KokkosBatched_LU_Serial_Impl.hpp"
-#include "KokkosBatched_Gesv.hpp"
+#include "KokkosBatched_Trsm_Decl.hpp"
+#include "KokkosBatched_Trsm_Serial_Impl.hpp"
 #include "KokkosBlas1_nrm2.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosBlas1_axpby.hpp"
@@ -30,10 +31,107 @@
 namespace KokkosODE {
 namespace Impl {
 
+// Static pivoting and LU factorization of J, following
+// KokkosBatched::SerialGesv<Gesv::StaticPivoting>, except that the scalings
+// and the row permutation are kept so that the factors can be reused for later
+// right-hand sides: on output ws = [LU of P*D1*J*D2 | D1 | D2 | P | work].
+// J is overwritten and scratch is used as temporary storage.
+template <class mat_type, class vec_type>
+KOKKOS_FUNCTION int NewtonFactor(const mat_type& J, const mat_type& ws,
+                                 const vec_type& scratch) {
+  using value_type = typename mat_type::non_const_value_type;
+  using ats        = Kokkos::ArithTraits<value_type>;
+  const int n      = J.extent(0);
+
+  auto LU      = Kokkos::subview(ws, Kokkos::ALL, Kokkos::make_pair(0, n));
+  auto D1      = Kokkos::subview(ws, Kokkos::ALL, n);
+  auto D2      = Kokkos::subview(ws, Kokkos::ALL, n + 1);
+  auto P       = Kokkos::subview(ws, Kokkos::ALL, n + 2);
+  auto rowMax  = Kokkos::subview(ws, Kokkos::ALL, n + 3);
+  auto colFree = scratch;
+
+  // Scale the columns by their inverse maximal absolute value, and record
+  // the maximal absolute value of the unscaled rows.
+  for (int i = 0; i < n; ++i) {
+    D2(i)      = ats::zero();
+    rowMax(i)  = ats::zero();
+    colFree(i) = ats::one();
+    for (int j = 0; j < n; ++j) {
+      if (D2(i) < Kokkos::abs(J(j, i))) D2(i) = Kokkos::abs(J(j, i));
+      if (rowMax(i) < Kokkos::abs(J(i, j))) rowMax(i) = Kokkos::abs(J(i, j));
+    }
+    D2(i) = ats::one() / D2(i);
+  }
+  for (int i = 0; i < n; ++i)
+    for (int j = 0; j < n; ++j) J(i, j) *= D2(j);
+
+  // Then scale the rows of the column-scaled matrix the same way.
+  for (int i = 0; i < n; ++i) {
+    D1(i) = ats::zero();
+    for (int j = 0; j < n; ++j)
+      if (D1(i) < Kokkos::abs(J(i, j))) D1(i) = Kokkos::abs(J(i, j));
+    D1(i) = ats::one() / D1(i);
+    for (int j = 0; j < n; ++j) J(i, j) *= D1(i);
+  }
+
+  // Rows, by decreasing initial maximal value, are moved to the available
+  // column holding their largest entry.
+  for (int i = 0; i < n; ++i) {
+    int row = 0, col = 0;
+    value_type rowBest = ats::zero(), colBest = ats::zero();
+    for (int j = 0; j < n; ++j) {
+      if (rowBest < rowMax(j)) {
+        rowBest = rowMax(j);
+        row     = j;
+      }
+    }
+    for (int j = 0; j < n; ++j) {
+      if (colBest < Kokkos::abs(J(row, j) * colFree(j))) {
+        colBest = Kokkos::abs(J(row, j) * colFree(j));
+        col     = j;
+      }
+    }
+    if (colBest == ats::zero()) return 1;
+    rowMax(row)  = ats::zero();
+    colFree(col) = ats::zero();
+    for (int j = 0; j < n; ++j) LU(col, j) = J(row, j);
+    P(row) = col;
+  }
+
+  return KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Unblocked>::invoke(
+      LU);
+}
+
+// Solves J*x = rhs with the factors computed by NewtonFactor
+template <class mat_type, class vec_type>
+KOKKOS_FUNCTION int NewtonBackSolve(const mat_type& ws, const vec_type& rhs,
+                                    const vec_type& x) {
+  using namespace KokkosBatched;
+  const int n = ws.extent(0);
+
+  auto LU  = Kokkos::subview(ws, Kokkos::ALL, Kokkos::make_pair(0, n));
+  auto D1  = Kokkos::subview(ws, Kokkos::ALL, n);
+  auto D2  = Kokkos::subview(ws, Kokkos::ALL, n + 1);
+  auto P   = Kokkos::subview(ws, Kokkos::ALL, n + 2);
+  auto PDY = Kokkos::subview(ws, Kokkos::ALL, n + 3);
+
+  for (int i = 0; i < n; ++i) PDY(static_cast<int>(P(i))) = D1(i) * rhs(i);
+  int r_val = SerialTrsm<Side::Left, Uplo::Lower, Trans::NoTranspose,
+                         Diag::Unit, Algo::Trsm::Unblocked>::invoke(1.0, LU,
+                                                                     PDY);
+  if (r_val == 0)
+    r_val = SerialTrsm<Side::Left, Uplo::Upper, Trans::NoTranspose,
+                       Diag::NonUnit, Algo::Trsm::Unblocked>::invoke(1.0, LU,
+                                                                     PDY);
+  for (int i = 0; i < n; ++i) x(i) = D2(i) * PDY(i);
+  return r_val;
+}
+
 template <class system_type, class mat_type, class vec_type>
 KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
     system_type& sys, const KokkosODE::Experimental::Newton_params& params,
-    mat_type& J, mat_type& tmp, vec_type& y0, vec_type& rhs, vec_type& update) {
+    mat_type& J, mat_type& tmp, vec_type& y0, vec_type& rhs, vec_type& update,
+    bool& factors_valid) {
   using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
   using value_type           = typename vec_type::non_const_value_type;
 
@@ -41,36 +139,34 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
   // the norm of the residual.
   using norm_type = typename Kokkos::Details::InnerProductSpaceTraits<
       typename vec_type::non_const_value_type>::mag_type;
-  norm_type norm = Kokkos::ArithTraits<norm_type>::zero();
 
-  // LBV - 07/24/2023: for now assume that we take
-  // a full Newton step. Eventually this value can
-  // be computed using a line search algorithm to
-  // improve convergence for difficult problems.
-  const value_type alpha = Kokkos::ArithTraits<value_type>::one();
+  // compute initial rhs
+  sys.residual(y0, rhs);
+  norm_type norm = KokkosBlas::serial_nrm2(rhs);
+
+  // the update of the previous iteration, if it was applied
+  bool has_update = false;
 
   // Iterate until maxIts or the tolerance is reached
   for (int it = 0; it < params.max_iters; ++it) {  // handle.maxIters; ++it) {
-    // compute initial rhs
-    sys.residual(y0, rhs);
-
     // Solve the following linearized
     // problem at each iteration: J*update=-rhs
     // with J=du/dx, rhs=f(u_n+update)-f(u_n)
-    norm = KokkosBlas::serial_nrm2(rhs);
-
     if ((norm < params.rel_tol) ||
-        (it > 0 ? KokkosBlas::serial_nrm2(update) < params.abs_tol : false)) {
+        (has_update ? KokkosBlas::serial_nrm2(update) < params.abs_tol
+                    : false)) {
       return newton_solver_status::NLS_SUCCESS;
     }
 
-    // compute LHS
-    sys.jacobian(y0, J);
+    // compute and factor LHS, modified Newton keeps the previous factors
+    const bool refresh = !params.modified || !factors_valid;
+    if (refresh) {
+      sys.jacobian(y0, J);
+      factors_valid = NewtonFactor(J, tmp, update) == 0;
+    }
 
     // solve linear problem
-    int linSolverStat =
-        KokkosBatched::SerialGesv<KokkosBatched::Gesv::StaticPivoting>::invoke(
-            J, update, rhs, tmp);
+    int linSolverStat = factors_valid ? NewtonBackSolve(tmp, rhs, update) : 1;
     KokkosBlas::SerialScale::invoke(-1, update);
 
     if (linSolverStat == 1) {
@@ -84,11 +180,48 @@ KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
     }
 
     // update solution // x = x + alpha*update
+    // with the line search, alpha is halved until the residual decreases
+    value_type alpha = Kokkos::ArithTraits<value_type>::one();
     KokkosBlas::serial_axpy(alpha, update, y0);
+    sys.residual(y0, rhs);
+    norm_type new_norm = KokkosBlas::serial_nrm2(rhs);
+    for (int ls = 0; params.line_search && ls < params.max_line_search &&
+                     !(new_norm <= (1 - 1e-4 * alpha) * norm);
+         ++ls) {
+      alpha /= 2;
+      KokkosBlas::serial_axpy(-alpha, update, y0);
+      sys.residual(y0, rhs);
+      new_norm = KokkosBlas::serial_nrm2(rhs);
+    }
+    if (alpha != Kokkos::ArithTraits<value_type>::one())
+      KokkosBlas::SerialScale::invoke(alpha, update);
+    has_update = true;
+
+    // The convergence of modified Newton stalls: refresh the Jacobian at the
+    // next iteration, and undo the step if the stale factors made it worse.
+    if (params.modified && !(new_norm <= params.stall_ratio * norm)) {
+      factors_valid = false;
+      if (!refresh && !(new_norm <= norm)) {
+        KokkosBlas::serial_axpy(-Kokkos::ArithTraits<value_type>::one(), update,
+                                y0);
+        sys.residual(y0, rhs);
+        new_norm   = KokkosBlas::serial_nrm2(rhs);
+        has_update = false;
+      }
+    }
+    norm = new_norm;
   }
   return newton_solver_status::MAX_ITER;
 }
 
+template <class system_type, class mat_type, class vec_type>
+KOKKOS_FUNCTION KokkosODE::Experimental::newton_solver_status NewtonSolve(
+    system_type& sys, const KokkosODE::Experimental::Newton_params& params,
+    mat_type& J, mat_type& tmp, vec_type& y0, vec_type& rhs, vec_type& update) {
+  bool factors_valid = false;
+  return NewtonSolve(sys, params, J, tmp, y0, rhs, update, factors_valid);
+}
+
 }  // namespace Impl
 }  // namespace KokkosODE
 
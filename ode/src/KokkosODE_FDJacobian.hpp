@@ -0,0 +1,135 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSODE_FDJACOBIAN_HPP
+#define KOKKOSODE_FDJACOBIAN_HPP
+
+/// \file KokkosODE_FDJacobian.hpp
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Handle.hpp"
+#include "KokkosGraph_Distance2Color.hpp"
+
+#include "KokkosODE_FDJacobian_impl.hpp"
+
+namespace KokkosODE {
+namespace Experimental {
+
+/// \brief Finite difference Jacobians computed with one residual evaluation
+/// per color of a column coloring of the Jacobian sparsity pattern, instead
+/// of one evaluation per column.
+struct FDJacobian {
+  /// \brief Colors the columns of the sparsity pattern so that two columns
+  /// with the same color do not have entries in the same row, i.e. a
+  /// distance-2 coloring of the bipartite row/column graph.
+  ///
+  /// \param num_rows [in]: number of rows of the pattern
+  /// \param num_cols [in]: number of columns of the pattern
+  /// \param rowmap [in]: row map of the pattern
+  /// \param entries [in]: column indices of the pattern
+  /// \param colors [out]: view of length num_cols, receives colors in
+  ///   [1, num_colors]
+  /// \return num_colors, the number of residual evaluations per Jacobian
+  template <class rowmap_type, class entries_type, class colors_type>
+  static int Color(const int num_rows, const int num_cols,
+                   const rowmap_type& rowmap, const entries_type& entries,
+                   const colors_type& colors) {
+    using execution_space = typename colors_type::execution_space;
+    using memory_space    = typename colors_type::memory_space;
+    using size_type       = typename rowmap_type::non_const_value_type;
+    using ordinal_type    = typename entries_type::non_const_value_type;
+    using handle_type     = KokkosKernels::Experimental::KokkosKernelsHandle<
+        size_type, ordinal_type, double, execution_space, memory_space,
+        memory_space>;
+
+    handle_type handle;
+    handle.create_distance2_graph_coloring_handle();
+    KokkosGraph::Experimental::bipartite_color_columns(
+        &handle, num_rows, num_cols, rowmap, entries);
+    auto coloring = handle.get_distance2_graph_coloring_handle();
+    Kokkos::deep_copy(colors, coloring->get_vertex_colors());
+    const int num_colors = coloring->get_num_colors();
+    handle.destroy_distance2_graph_coloring_handle();
+    return num_colors;
+  }
+
+  /// \brief Device callable finite difference Jacobian of a small dense
+  /// system, e.g. the local system of a cell in a parallel_for.
+  ///
+  /// \param sys [in]: system providing residual(y, f)
+  /// \param y [in]: point at which the Jacobian is computed
+  /// \param f0 [in]: residual evaluated at y
+  /// \param y_pert, f_pert [in]: work vectors of length J.extent(1) and
+  ///   J.extent(0)
+  /// \param rowmap, entries [in]: sparsity pattern of the Jacobian
+  /// \param colors, num_colors [in]: column coloring computed by Color
+  /// \param J [out]: the Jacobian, zero outside of the pattern
+  template <class system_type, class vec_type, class rowmap_type,
+            class entries_type, class colors_type, class mat_type>
+  KOKKOS_FUNCTION static void Dense(
+      const system_type& sys, const vec_type& y, const vec_type& f0,
+      const vec_type& y_pert, const vec_type& f_pert,
+      const rowmap_type& rowmap, const entries_type& entries,
+      const colors_type& colors, const int num_colors, const mat_type& J) {
+    KokkosODE::Impl::FDJacobianDense(sys, y, f0, y_pert, f_pert, rowmap,
+                                     entries, colors, num_colors, J);
+  }
+
+  /// \brief Finite difference Jacobian of a large sparse system, stored in
+  /// the values of a CrsMatrix whose graph is the sparsity pattern.
+  ///
+  /// \param sys [in]: system providing residual(y, f), called from the host
+  ///   on the whole vectors
+  /// \param y [in]: point at which the Jacobian is computed
+  /// \param f0 [in]: residual evaluated at y
+  /// \param colors, num_colors [in]: coloring of the columns of J.graph
+  ///   computed by Color
+  /// \param J [in/out]: the values of J receive the Jacobian
+  template <class system_type, class vec_type, class colors_type,
+            class crsmat_type>
+  static void Sparse(const system_type& sys, const vec_type& y,
+                     const vec_type& f0, const colors_type& colors,
+                     const int num_colors, const crsmat_type& J) {
+    using execution_space = typename crsmat_type::execution_space;
+    using color_type      = typename colors_type::non_const_value_type;
+    using work_type       = typename vec_type::non_const_type;
+
+    work_type y_pert(Kokkos::view_alloc(Kokkos::WithoutInitializing, "y_pert"),
+                     J.numCols());
+    work_type f_pert(Kokkos::view_alloc(Kokkos::WithoutInitializing, "f_pert"),
+                     J.numRows());
+
+    for (int color = 1; color <= num_colors; ++color) {
+      Kokkos::parallel_for(
+          "KokkosODE::FDJacobian::perturb",
+          Kokkos::RangePolicy<execution_space>(0, J.numCols()),
+          KokkosODE::Impl::FDPerturbFunctor<vec_type, colors_type, color_type>(
+              y, y_pert, colors, color));
+      sys.residual(y_pert, f_pert);
+      Kokkos::parallel_for(
+          "KokkosODE::FDJacobian::columns",
+          Kokkos::RangePolicy<execution_space>(0, J.numRows()),
+          KokkosODE::Impl::FDSparseColumnsFunctor<crsmat_type, vec_type,
+                                                  colors_type, color_type>(
+              J, y, f0, y_pert, f_pert, colors, color));
+    }
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosODE
+
+#endif  // KOKKOSODE_FDJACOBIAN_HPP
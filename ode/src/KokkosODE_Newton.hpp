@@ -37,6 +37,20 @@ struct Newton {
       const vec_type& update) {
     return KokkosODE::Impl::NewtonSolve(sys, params, J, tmp, y0, rhs, update);
   }
+
+  /// \brief Same as above, but tmp holds the factors of the Jacobian between
+  /// calls: if factors_valid is true on input and params.modified is set,
+  /// the factors stored in tmp by a previous call are used until the
+  /// convergence stalls. On output, factors_valid tells whether tmp holds
+  /// usable factors for the next call.
+  template <class system_type, class mat_type, class vec_type>
+  KOKKOS_FUNCTION static newton_solver_status Solve(
+      const system_type& sys, const Newton_params& params, const mat_type& J,
+      const mat_type& tmp, const vec_type& y0, const vec_type& rhs,
+      const vec_type& update, bool& factors_valid) {
+    return KokkosODE::Impl::NewtonSolve(sys, params, J, tmp, y0, rhs, update,
+                                        factors_valid);
+  }
 };
 
 }  // namespace Experimental
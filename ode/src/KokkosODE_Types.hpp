@@ -61,6 +61,17 @@ struct Newton_params {
   int max_iters;
   double abs_tol, rel_tol;
 
+  // Modified Newton: the factors of the Jacobian are reused across
+  // iterations and only recomputed once the residual norm decreases by
+  // less than a factor stall_ratio in one iteration.
+  bool modified      = false;
+  double stall_ratio = 0.5;
+
+  // Backtracking line search: the step is halved, at most max_line_search
+  // times, until the residual norm decreases sufficiently.
+  bool line_search    = false;
+  int max_line_search = 8;
+
   // Constructor that only specify the desired number of steps.
   // In this case no adaptivity is provided, the time step will
   // be constant such that dt = (tend - tstart) / num_steps;
@@ -0,0 +1,227 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <gtest/gtest.h>
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+
+#include "KokkosODE_FDJacobian.hpp"
+
+namespace Test {
+
+// Discrete 1D reaction-diffusion equation with homogeneous Dirichlet
+// boundary conditions:
+//   f_i = 2*y_i - y_{i-1} - y_{i+1} + y_i**3 - 1
+// The Jacobian is tridiagonal:
+//   J_ii = 2 + 3*y_i**2,  J_{i,i-1} = J_{i,i+1} = -1
+template <class vec_type>
+struct ReactionDiffusion {
+  int neqs;
+
+  ReactionDiffusion(const int neqs_) : neqs(neqs_) {}
+
+  KOKKOS_FUNCTION void residual_row(const int i, const vec_type& y,
+                                    const vec_type& f) const {
+    f(i) = 2 * y(i) + y(i) * y(i) * y(i) - 1;
+    if (i > 0) f(i) -= y(i - 1);
+    if (i < neqs - 1) f(i) -= y(i + 1);
+  }
+
+  // Serial residual of the local problem, used within a kernel
+  KOKKOS_FUNCTION void residual(const vec_type& y, const vec_type& f) const {
+    for (int i = 0; i < neqs; ++i) residual_row(i, y, f);
+  }
+};
+
+// Same problem, the residual of the global system is evaluated with a kernel
+template <class execution_space, class vec_type>
+struct GlobalReactionDiffusion {
+  ReactionDiffusion<vec_type> local;
+
+  GlobalReactionDiffusion(const int neqs_) : local(neqs_) {}
+
+  void residual(const vec_type& y, const vec_type& f) const {
+    const ReactionDiffusion<vec_type> sys = local;
+    Kokkos::parallel_for(
+        Kokkos::RangePolicy<execution_space>(0, local.neqs),
+        KOKKOS_LAMBDA(const int i) { sys.residual_row(i, y, f); });
+  }
+};
+
+template <class rowmap_type, class entries_type>
+void tridiagonal_pattern(const int n, const rowmap_type& rowmap,
+                         const entries_type& entries) {
+  auto rowmap_h  = Kokkos::create_mirror_view(rowmap);
+  auto entries_h = Kokkos::create_mirror_view(entries);
+  int nnz        = 0;
+  for (int i = 0; i < n; ++i) {
+    rowmap_h(i) = nnz;
+    for (int j = i - 1; j <= i + 1; ++j)
+      if (0 <= j && j < n) entries_h(nnz++) = j;
+  }
+  rowmap_h(n) = nnz;
+  Kokkos::deep_copy(rowmap, rowmap_h);
+  Kokkos::deep_copy(entries, entries_h);
+}
+
+template <class scalar_type>
+scalar_type tridiagonal_jacobian(const int i, const int j,
+                                 const scalar_type yi) {
+  if (i == j) return 2 + 3 * yi * yi;
+  if (i - j == 1 || j - i == 1) return -1;
+  return 0;
+}
+
+template <class system_type, class vec_type, class mat_type,
+          class rowmap_type, class entries_type, class colors_type>
+struct FDJacobian_wrapper {
+  system_type sys;
+  vec_type y, f0, y_pert, f_pert;
+  rowmap_type rowmap;
+  entries_type entries;
+  colors_type colors;
+  int num_colors;
+  mat_type J;
+
+  FDJacobian_wrapper(const system_type& sys_, const vec_type& y_,
+                     const vec_type& f0_, const vec_type& y_pert_,
+                     const vec_type& f_pert_, const rowmap_type& rowmap_,
+                     const entries_type& entries_, const colors_type& colors_,
+                     const int num_colors_, const mat_type& J_)
+      : sys(sys_),
+        y(y_),
+        f0(f0_),
+        y_pert(y_pert_),
+        f_pert(f_pert_),
+        rowmap(rowmap_),
+        entries(entries_),
+        colors(colors_),
+        num_colors(num_colors_),
+        J(J_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int) const {
+    sys.residual(y, f0);
+    KokkosODE::Experimental::FDJacobian::Dense(sys, y, f0, y_pert, f_pert,
+                                               rowmap, entries, colors,
+                                               num_colors, J);
+  }
+};
+
+template <class Device, class scalar_type>
+void test_fd_jacobian_dense() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<scalar_type*, Device>;
+  using mat_type        = Kokkos::View<scalar_type**, Device>;
+  using rowmap_type     = Kokkos::View<int*, Device>;
+  using ats             = Kokkos::ArithTraits<scalar_type>;
+
+  constexpr int neqs = 10;
+  rowmap_type rowmap("rowmap", neqs + 1), entries("entries", 3 * neqs - 2);
+  rowmap_type colors("colors", neqs);
+  tridiagonal_pattern(neqs, rowmap, entries);
+
+  const int num_colors = KokkosODE::Experimental::FDJacobian::Color(
+      neqs, neqs, rowmap, entries, colors);
+  EXPECT_GE(num_colors, 3);
+  EXPECT_LT(num_colors, neqs);
+
+  vec_type y("y", neqs), f0("f0", neqs), y_pert("y_pert", neqs),
+      f_pert("f_pert", neqs);
+  mat_type J("J", neqs, neqs);
+  auto y_h = Kokkos::create_mirror_view(y);
+  for (int i = 0; i < neqs; ++i) y_h(i) = scalar_type(i) / neqs;
+  Kokkos::deep_copy(y, y_h);
+
+  ReactionDiffusion<vec_type> sys(neqs);
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1),
+      FDJacobian_wrapper(sys, y, f0, y_pert, f_pert, rowmap, entries, colors,
+                         num_colors, J));
+
+  auto J_h = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), J);
+  const double tol = 100 * Kokkos::sqrt(ats::epsilon());
+  for (int i = 0; i < neqs; ++i)
+    for (int j = 0; j < neqs; ++j)
+      EXPECT_NEAR(J_h(i, j), tridiagonal_jacobian(i, j, y_h(i)), tol)
+          << "J(" << i << ", " << j << ")";
+}
+
+template <class Device, class scalar_type>
+void test_fd_jacobian_sparse() {
+  using execution_space = typename Device::execution_space;
+  using vec_type        = Kokkos::View<scalar_type*, Device>;
+  using ats             = Kokkos::ArithTraits<scalar_type>;
+
+  using crsmat_type =
+      KokkosSparse::CrsMatrix<scalar_type, int, Device, void, int>;
+
+  using rowmap_type  = typename crsmat_type::row_map_type::non_const_type;
+  using entries_type = typename crsmat_type::index_type::non_const_type;
+  using values_type  = typename crsmat_type::values_type::non_const_type;
+
+  constexpr int neqs = 200;
+  const int nnz      = 3 * neqs - 2;
+  rowmap_type rowmap("rowmap", neqs + 1);
+  entries_type entries("entries", nnz);
+  tridiagonal_pattern(neqs, rowmap, entries);
+  crsmat_type J("J", neqs, neqs, nnz, values_type("values", nnz), rowmap,
+                entries);
+
+  Kokkos::View<int*, Device> colors("colors", neqs);
+  const int num_colors = KokkosODE::Experimental::FDJacobian::Color(
+      neqs, neqs, rowmap, entries, colors);
+  EXPECT_LT(num_colors, neqs);
+
+  vec_type y("y", neqs), f0("f0", neqs);
+  auto y_h = Kokkos::create_mirror_view(y);
+  for (int i = 0; i < neqs; ++i) y_h(i) = scalar_type(i % 10) / 10;
+  Kokkos::deep_copy(y, y_h);
+
+  GlobalReactionDiffusion<execution_space, vec_type> sys(neqs);
+  sys.residual(y, f0);
+  KokkosODE::Experimental::FDJacobian::Sparse(sys, y, f0, colors, num_colors,
+                                              J);
+
+  auto rowmap_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), rowmap);
+  auto entries_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), entries);
+  auto values_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), J.values);
+  const double tol = 100 * Kokkos::sqrt(ats::epsilon());
+  for (int i = 0; i < neqs; ++i)
+    for (int p = rowmap_h(i); p < rowmap_h(i + 1); ++p)
+      EXPECT_NEAR(values_h(p), tridiagonal_jacobian(i, entries_h(p), y_h(i)),
+                  tol)
+          << "J(" << i << ", " << entries_h(p) << ")";
+}
+
+}  // namespace Test
+
+TEST_F(TestCategory, FDJacobian_dense_float) {
+  ::Test::test_fd_jacobian_dense<TestDevice, float>();
+}
+TEST_F(TestCategory, FDJacobian_dense_double) {
+  ::Test::test_fd_jacobian_dense<TestDevice, double>();
+}
+
+TEST_F(TestCategory, FDJacobian_sparse_float) {
+  ::Test::test_fd_jacobian_sparse<TestDevice, float>();
+}
+TEST_F(TestCategory, FDJacobian_sparse_double) {
+  ::Test::test_fd_jacobian_sparse<TestDevice, double>();
+}
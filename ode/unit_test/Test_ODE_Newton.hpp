@@ -396,6 +396,29 @@ struct CircleHyperbolaIntersection {
   }
 };
 
+// Forwards to system_type and counts the evaluations of the Jacobian
+template <class system_type, class Device>
+struct JacobianCounter {
+  using vec_type = typename system_type::vec_type;
+  using mat_type = typename system_type::mat_type;
+
+  static constexpr int neqs = system_type::neqs;
+
+  system_type sys;
+  Kokkos::View<int, Device> num_jacobians;
+
+  JacobianCounter() : num_jacobians("number of jacobians") {}
+
+  KOKKOS_FUNCTION void residual(const vec_type& y, const vec_type& f) const {
+    sys.residual(y, f);
+  }
+
+  KOKKOS_FUNCTION void jacobian(const vec_type& y, const mat_type& jac) const {
+    ++num_jacobians();
+    sys.jacobian(y, jac);
+  }
+};
+
 template <typename Device, typename scalar_type>
 void test_simple_systems() {
   double abs_tol, rel_tol;
@@ -517,6 +540,231 @@ void test_newton_on_device() {
   }
 }
 
+// Runs one solve of system_type from initial_val and returns the number of
+// evaluations of the Jacobian
+template <class system_type, class Device, class scalar_type>
+int count_jacobians(const KokkosODE::Experimental::Newton_params& params,
+                    const scalar_type* const initial_val,
+                    KokkosODE::Experimental::newton_solver_status& status) {
+  using execution_space      = typename Device::execution_space;
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+  using vec_type             = typename Kokkos::View<scalar_type*, Device>;
+  using mat_type             = typename Kokkos::View<scalar_type**, Device>;
+  using counter_type         = JacobianCounter<system_type, Device>;
+
+  counter_type mySys{};
+  Kokkos::View<newton_solver_status*, Device> status_d("Newton status", 1);
+
+  vec_type x("solution vector", mySys.neqs), rhs("rhs", mySys.neqs),
+      update("update", mySys.neqs);
+  mat_type J("jacobian", mySys.neqs, mySys.neqs),
+      tmp("temp mem", mySys.neqs, mySys.neqs + 4);
+
+  auto x_h = Kokkos::create_mirror_view(x);
+  for (int eqIdx = 0; eqIdx < mySys.neqs; ++eqIdx) {
+    x_h(eqIdx) = initial_val[eqIdx];
+  }
+  Kokkos::deep_copy(x, x_h);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1),
+      NewtonSolve_wrapper(mySys, params, x, rhs, update, J, tmp, status_d));
+
+  auto status_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), status_d);
+  auto num_jacobians_h = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), mySys.num_jacobians);
+  status = status_h(0);
+  return num_jacobians_h();
+}
+
+////////////////////////////////////////////
+// Modified Newton reuses the factors of  //
+// the Jacobian, within and across solves //
+////////////////////////////////////////////
+
+template <class Device, class scalar_type>
+void test_modified_newton() {
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+
+  double abs_tol, rel_tol;
+  if (std::is_same_v<scalar_type, float>) {
+    rel_tol = 10e-5;
+    abs_tol = 10e-7;
+  } else if (std::is_same_v<scalar_type, double>) {
+    rel_tol = 10e-8;
+    abs_tol = 10e-15;
+  } else {
+    throw std::runtime_error("scalar_type is neither float, nor double!");
+  }
+
+  for (int variant = 0; variant < 3; ++variant) {
+    KokkosODE::Experimental::Newton_params params(50, abs_tol, rel_tol);
+    params.modified    = (variant != 1);
+    params.line_search = (variant != 0);
+
+    {
+      using system_type = LogarithmicEquation<Device, scalar_type>;
+      system_type mySys{};
+      scalar_type initial_value[1] = {static_cast<scalar_type>(0.5)},
+                  solution[1]      = {static_cast<scalar_type>(1.0) /
+                                 static_cast<scalar_type>(7.0)};
+      run_newton_test<system_type, Device, scalar_type>(
+          mySys, params, initial_value, solution);
+    }
+
+    {
+      using system_type = CirclesIntersections<Device, scalar_type>;
+      system_type mySys{};
+      scalar_type initial_values[2] = {1.5, 1.5};
+      scalar_type solution[2]       = {10.75 / 6, 0.8887803753};
+      run_newton_test<system_type, Device, scalar_type>(
+          mySys, params, initial_values, solution);
+    }
+
+    {
+      using system_type = CircleHyperbolaIntersection<Device, scalar_type>;
+      system_type mySys{};
+      scalar_type init_vals[2] = {0.0, 1.0};
+      scalar_type solutions[2] = {0.5176380902, 1.9318516525};
+      run_newton_test<system_type, Device, scalar_type>(mySys, params,
+                                                        init_vals, solutions);
+    }
+  }
+
+  // Count the evaluations of the Jacobian on the circle/hyperbola problem
+  {
+    using system_type = CircleHyperbolaIntersection<Device, scalar_type>;
+
+    KokkosODE::Experimental::Newton_params params(50, abs_tol, rel_tol);
+    scalar_type init_vals[2] = {0.0, 1.0};
+    newton_solver_status status;
+
+    // Newton evaluates the Jacobian at every step
+    const int newton_jacobians =
+        count_jacobians<system_type, Device>(params, init_vals, status);
+    EXPECT_EQ(status, newton_solver_status::NLS_SUCCESS);
+    EXPECT_GT(newton_jacobians, 1);
+
+    // Modified Newton reuses the factors while the residual norm decreases
+    // fast enough
+    params.modified = true;
+    const int modified_jacobians =
+        count_jacobians<system_type, Device>(params, init_vals, status);
+    EXPECT_EQ(status, newton_solver_status::NLS_SUCCESS);
+    EXPECT_GE(modified_jacobians, 1);
+    EXPECT_LT(modified_jacobians, newton_jacobians);
+
+    // It has not converged after as many steps as Jacobian evaluations, so
+    // some of its steps were taken with stale factors
+    params.max_iters = modified_jacobians + 1;
+    count_jacobians<system_type, Device>(params, init_vals, status);
+    EXPECT_EQ(status, newton_solver_status::MAX_ITER);
+    params.max_iters = 50;
+
+    // No step decreases the residual norm below stall_ratio = 0, so every
+    // step refactors and modified Newton falls back to Newton
+    params.stall_ratio = 0;
+    const int stalled_jacobians =
+        count_jacobians<system_type, Device>(params, init_vals, status);
+    EXPECT_EQ(status, newton_solver_status::NLS_SUCCESS);
+    EXPECT_EQ(stalled_jacobians, newton_jacobians);
+  }
+}
+
+// Two consecutive solves sharing the factors stored in tmp, as a time
+// integrator would do from one time step to the next.
+template <class system_type, class vec_type, class mat_type,
+          class status_view>
+struct NewtonReuse_wrapper {
+  using newton_params = KokkosODE::Experimental::Newton_params;
+
+  system_type my_nls;
+  newton_params params;
+
+  vec_type x, rhs, update;
+  mat_type J, tmp;
+  status_view status;
+
+  NewtonReuse_wrapper(const system_type& my_nls_, const newton_params& params_,
+                      const vec_type& x_, const vec_type& rhs_,
+                      const vec_type& update_, const mat_type& J_,
+                      const mat_type& tmp_, const status_view& status_)
+      : my_nls(my_nls_),
+        params(params_),
+        x(x_),
+        rhs(rhs_),
+        update(update_),
+        J(J_),
+        tmp(tmp_),
+        status(status_) {}
+
+  KOKKOS_FUNCTION
+  void operator()(const int) const {
+    bool factors_valid = false;
+    status(0) = KokkosODE::Experimental::Newton::Solve(
+        my_nls, params, J, tmp, x, rhs, update, factors_valid);
+    status(1) = factors_valid ? 1 : 0;
+    status(3) = my_nls.num_jacobians();
+
+    // restart close to the previous solution
+    x(0) += 0.01;
+    x(1) -= 0.01;
+    status(2) = KokkosODE::Experimental::Newton::Solve(
+        my_nls, params, J, tmp, x, rhs, update, factors_valid);
+  }
+};
+
+template <class Device, class scalar_type>
+void test_newton_reuse() {
+  using execution_space      = typename Device::execution_space;
+  using vec_type             = Kokkos::View<scalar_type*, Device>;
+  using mat_type             = Kokkos::View<scalar_type**, Device>;
+  using status_view          = Kokkos::View<int*, Device>;
+  using newton_solver_status = KokkosODE::Experimental::newton_solver_status;
+
+  // counts the evaluations of the Jacobian over both solves
+  using system_type =
+      JacobianCounter<CircleHyperbolaIntersection<Device, scalar_type>, Device>;
+
+  const double rel_tol = std::is_same_v<scalar_type, float> ? 10e-5 : 10e-8;
+  const double abs_tol = std::is_same_v<scalar_type, float> ? 10e-7 : 10e-15;
+  KokkosODE::Experimental::Newton_params params(50, abs_tol, rel_tol);
+  params.modified = true;
+
+  system_type mySys{};
+  vec_type x("solution vector", mySys.neqs), rhs("rhs", mySys.neqs),
+      update("update", mySys.neqs);
+  mat_type J("jacobian", mySys.neqs, mySys.neqs),
+      tmp("temp mem", mySys.neqs, mySys.neqs + 4);
+  status_view status("status", 4);
+
+  auto x_h = Kokkos::create_mirror_view(x);
+  x_h(0)   = 1.5;
+  x_h(1)   = 0.5;
+  Kokkos::deep_copy(x, x_h);
+
+  Kokkos::parallel_for(
+      Kokkos::RangePolicy<execution_space>(0, 1),
+      NewtonReuse_wrapper(mySys, params, x, rhs, update, J, tmp, status));
+
+  auto status_h =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), status);
+  auto num_jacobians_h = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), mySys.num_jacobians);
+  Kokkos::deep_copy(x_h, x);
+  EXPECT_EQ(status_h(0), static_cast<int>(newton_solver_status::NLS_SUCCESS));
+  EXPECT_EQ(status_h(1), 1);
+  EXPECT_EQ(status_h(2), static_cast<int>(newton_solver_status::NLS_SUCCESS));
+  // the first solve factors at least once, the second one starts close to
+  // the solution with valid factors and takes all its steps without
+  // evaluating the Jacobian
+  EXPECT_GE(status_h(3), 1);
+  EXPECT_EQ(num_jacobians_h(), status_h(3));
+  EXPECT_NEAR(x_h(0), 1.9318516525, 100 * rel_tol);
+  EXPECT_NEAR(x_h(1), 0.5176380902, 100 * rel_tol);
+}
+
 }  // namespace Test
 
 // No ETI is performed for these device routines
@@ -548,3 +796,17 @@ TEST_F(TestCategory, Newton_parallel_float) {
 TEST_F(TestCategory, Newton_parallel_double) {
   ::Test::test_newton_on_device<TestDevice, double>();
 }
+
+TEST_F(TestCategory, Newton_modified_float) {
+  ::Test::test_modified_newton<TestDevice, float>();
+}
+TEST_F(TestCategory, Newton_modified_double) {
+  ::Test::test_modified_newton<TestDevice, double>();
+}
+
+TEST_F(TestCategory, Newton_reuse_float) {
+  ::Test::test_newton_reuse<TestDevice, float>();
+}
+TEST_F(TestCategory, Newton_reuse_double) {
+  ::Test::test_newton_reuse<TestDevice, double>();
+}
@@ -27,23 +27,8 @@
 #include <KokkosBatched_Vector.hpp>
 #include <KokkosBatched_Copy_Decl.hpp>
 #include <KokkosBatched_Copy_Impl.hpp>
-#include <KokkosBatched_AddRadial_Decl.hpp>
-#include <KokkosBatched_AddRadial_Impl.hpp>
-#include <KokkosBatched_Gemm_Decl.hpp>
-#include <KokkosBatched_Gemm_Serial_Impl.hpp>
-#include <KokkosBatched_Gemm_Team_Impl.hpp>
 #include <KokkosBatched_Gemv_Decl.hpp>
-#include <KokkosBatched_Gemv_Serial_Impl.hpp>
-#include <KokkosBatched_Gemv_Team_Impl.hpp>
-#include <KokkosBatched_Trsm_Decl.hpp>
-#include <KokkosBatched_Trsm_Serial_Impl.hpp>
-#include <KokkosBatched_Trsm_Team_Impl.hpp>
-#include <KokkosBatched_Trsv_Decl.hpp>
-#include <KokkosBatched_Trsv_Serial_Impl.hpp>
-#include <KokkosBatched_Trsv_Team_Impl.hpp>
-#include <KokkosBatched_LU_Decl.hpp>
-#include <KokkosBatched_LU_Serial_Impl.hpp>
-#include <KokkosBatched_LU_Team_Impl.hpp>
+#include <KokkosBatched_BlockTridiag.hpp>
 
 #define KOKKOSBATCHED_PROFILE 1
 #if defined(KOKKOS_ENABLE_CUDA) && defined(KOKKOSBATCHED_PROFILE)
@@ -181,14 +166,13 @@ struct SetTridiagToIdentity {
   }
 };
 
-template <class VT, class LT>
+template <class VT>
 struct Factorize {
  private:
   VT __AA;
-  LT __L;
 
  public:
-  Factorize(VT AA, LT L) : __AA(AA), __L(L) {}
+  Factorize(VT AA) : __AA(AA) {}
 
   KOKKOS_INLINE_FUNCTION
   void operator()(const member_type &member) const {
@@ -201,36 +185,15 @@ struct Factorize {
 
     Kokkos::parallel_for(
         Kokkos::ThreadVectorRange(member, __AA.extent(5)), [&](const int &v) {
-          auto AAA = Kokkos::subview(__AA, i, Kokkos::ALL(), Kokkos::ALL(),
-                                     Kokkos::ALL(), Kokkos::ALL(), v);
-
-          /// subview patterns
-          auto A = Kokkos::subview(AAA, 0, 1, Kokkos::ALL(), Kokkos::ALL());
-          auto B = Kokkos::subview(AAA, 0, 2, Kokkos::ALL(), Kokkos::ALL());
-          auto C = Kokkos::subview(AAA, 0, 0, Kokkos::ALL(), Kokkos::ALL());
-          auto D = Kokkos::subview(AAA, 0, 1, Kokkos::ALL(), Kokkos::ALL());
-
-          if (__L == 1) {
-            A.assign_data(&AAA(0, 1, 0, 0));
-            LU<member_type, mode_type, algo_type>::invoke(member, A);
-          } else {
-            for (int k = 0; k < (__L - 1); ++k) {
-              A.assign_data(&AAA(k, 1, 0, 0));
-              B.assign_data(&AAA(k, 2, 0, 0));
-              C.assign_data(&AAA(k, 0, 0, 0));
-              D.assign_data(&AAA(k + 1, 1, 0, 0));
-
-              LU<member_type, mode_type, algo_type>::invoke(member, A);
-              Trsm<member_type, Side::Left, Uplo::Lower, Trans::NoTranspose,
-                   Diag::Unit, mode_type, algo_type>::invoke(member, 1.0, A, B);
-              Trsm<member_type, Side::Right, Uplo::Upper, Trans::NoTranspose,
-                   Diag::NonUnit, mode_type, algo_type>::invoke(member, 1.0, A,
-                                                                C);
-              Gemm<member_type, Trans::NoTranspose, Trans::NoTranspose,
-                   mode_type, algo_type>::invoke(member, -1.0, C, B, 1.0, D);
-            }
-            LU<member_type, mode_type, algo_type>::invoke(member, D);
-          }
+          auto A = Kokkos::subview(__AA, i, Kokkos::ALL(), 1, Kokkos::ALL(),
+                                   Kokkos::ALL(), v);
+          auto B = Kokkos::subview(__AA, i, Kokkos::ALL(), 2, Kokkos::ALL(),
+                                   Kokkos::ALL(), v);
+          auto C = Kokkos::subview(__AA, i, Kokkos::ALL(), 0, Kokkos::ALL(),
+                                   Kokkos::ALL(), v);
+
+          BlockTridiagFactor<member_type, mode_type, algo_type>::invoke(
+              member, A, B, C);
         });
   }
 };
@@ -387,7 +350,7 @@ int main(int argc, char *argv[]) {
       policy_type policy(AA.extent(0), team_size, AA.extent(5));
       Kokkos::parallel_for("factorize",
                            policy.set_scratch_size(0, Kokkos::PerTeam(S)),
-                           Factorize<decltype(AA), decltype(L)>(AA, L));
+                           Factorize<decltype(AA)>(AA));
       Kokkos::fence();
       const double t = timer.seconds();
 #if defined(KOKKOS_ENABLE_CUDA) && defined(KOKKOSBATCHED_PROFILE)
@@ -441,95 +404,12 @@ int main(int argc, char *argv[]) {
                       auto b = Kokkos::subview(bb, i, jvec, Kokkos::ALL(),
                                                Kokkos::ALL(), v);
 
-                      auto xt = Kokkos::subview(x, 0, Kokkos::ALL());
-                      auto xb = Kokkos::subview(x, 0, Kokkos::ALL());
+                      Copy<member_type, Trans::NoTranspose, mode_type>::invoke(
+                          member, b, x);
+                      member.team_barrier();
 
-                      ///
-                      /// forward substitution
-                      ///
-                      {
-                        // const bool is_same_x_and_b = (x.data() == b.data());
-                        auto LT =
-                            Kokkos::subview(A, 0, Kokkos::ALL(), Kokkos::ALL());
-                        auto LB =
-                            Kokkos::subview(C, 0, Kokkos::ALL(), Kokkos::ALL());
-
-                        auto bk = Kokkos::subview(b, 0, Kokkos::ALL());
-                        {
-                          {  // if (!is_same_x_and_b) {
-                            Copy<member_type, Trans::NoTranspose,
-                                 mode_type>::invoke(member, bk, xb);
-                            member.team_barrier();
-                          }
-                        }
-                        const int kend = L - 1;
-                        for (int k = 0; k < kend; ++k) {
-                          LT.assign_data(&A(k, 0, 0));
-                          LB.assign_data(&C(k, 0, 0));
-
-                          xt.assign_data(&x(k, 0));
-                          xb.assign_data(&x(k + 1, 0));
-
-                          {  // if (!is_same_x_and_b) {
-                            bk.assign_data(&b(k + 1, 0));
-                            Copy<member_type, Trans::NoTranspose,
-                                 mode_type>::invoke(member, bk, xb);
-                          }
-
-                          Trsv<member_type, Uplo::Lower, Trans::NoTranspose,
-                               Diag::Unit, mode_type, algo_type>::invoke(member,
-                                                                         1.0,
-                                                                         LT,
-                                                                         xt);
-
-                          Gemv<member_type, Trans::NoTranspose, mode_type,
-                               algo_type>::invoke(member, -1.0, LB, xt, 1.0,
-                                                  xb);
-                        }
-                        {
-                          LT.assign_data(&A(kend, 0, 0));
-                          xt.assign_data(&x(kend, 0));
-                          Trsv<member_type, Uplo::Lower, Trans::NoTranspose,
-                               Diag::Unit, mode_type, algo_type>::invoke(member,
-                                                                         1.0,
-                                                                         LT,
-                                                                         xt);
-                        }
-                      }  /// end forward substitution
-
-                      ///
-                      /// backward substitution
-                      ///
-                      {
-                        auto UT =
-                            Kokkos::subview(B, 0, Kokkos::ALL(), Kokkos::ALL());
-                        auto UB =
-                            Kokkos::subview(A, 0, Kokkos::ALL(), Kokkos::ALL());
-
-                        const int kbegin = L - 1;
-                        for (int k = kbegin; k > 0; --k) {
-                          UT.assign_data(&B(k - 1, 0, 0));
-                          UB.assign_data(&A(k, 0, 0));
-
-                          xt.assign_data(&x(k - 1, 0));
-                          xb.assign_data(&x(k, 0));
-
-                          Trsv<member_type, Uplo::Upper, Trans::NoTranspose,
-                               Diag::NonUnit, mode_type,
-                               algo_type>::invoke(member, 1.0, UB, xb);
-
-                          Gemv<member_type, Trans::NoTranspose, mode_type,
-                               algo_type>::invoke(member, -1.0, UT, xb, 1.0,
-                                                  xt);
-                        }
-                        {
-                          UB.assign_data(&A(0, 0, 0));
-                          xb.assign_data(&x(0, 0));
-                          Trsv<member_type, Uplo::Upper, Trans::NoTranspose,
-                               Diag::NonUnit, mode_type,
-                               algo_type>::invoke(member, 1.0, UB, xb);
-                        }
-                      }  // end backward substitution
+                      BlockTridiagSolve<member_type, mode_type,
+                                        algo_type>::invoke(member, A, B, C, x);
                     }
                   });
             });
@@ -0,0 +1,185 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+/// Kokkos headers
+#include "Kokkos_Core.hpp"
+#include "Kokkos_Timer.hpp"
+#include "Kokkos_Random.hpp"
+
+/// KokkosKernels headers
+#include "KokkosBatched_Util.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_Tridiag.hpp"
+
+using exec_space_type   = Kokkos::DefaultExecutionSpace;
+using memory_space_type = exec_space_type::memory_space;
+
+using value_type  = double;
+using policy_type = Kokkos::TeamPolicy<exec_space_type>;
+using member_type = typename policy_type::member_type;
+
+using namespace KokkosBatched;
+
+static constexpr int vector_length =
+    DefaultVectorLength<value_type, memory_space_type>::value;
+
+typedef Vector<SIMD<value_type>, vector_length> vector_type;
+
+/// the systems are made diagonally dominant so that no pivoting is needed
+template <typename ViewType>
+void randomize(const ViewType &dl, const ViewType &d, const ViewType &du,
+               const ViewType &b) {
+  Kokkos::Random_XorShift64_Pool<exec_space_type> random(13245);
+  Kokkos::fill_random(dl, random, value_type(1));
+  Kokkos::fill_random(du, random, value_type(1));
+  Kokkos::fill_random(b, random, value_type(1));
+  Kokkos::fill_random(d, random, value_type(2), value_type(3));
+}
+
+int main(int argc, char *argv[]) {
+  Kokkos::initialize(argc, argv);
+  {
+    Kokkos::print_configuration(std::cout);
+
+    Kokkos::Timer timer;
+
+    ///
+    /// input arguments parsing
+    ///
+    int N     = 128 * 128;  /// # of problems (batch size)
+    int n     = 128;        /// length of the tridiagonal systems
+    int niter = 10;
+    for (int i = 1; i < argc; ++i) {
+      const std::string &token = argv[i];
+      if (token == std::string("-N")) N = std::atoi(argv[++i]);
+      if (token == std::string("-n")) n = std::atoi(argv[++i]);
+      if (token == std::string("-Niter")) niter = std::atoi(argv[++i]);
+    }
+
+    printf(" :::: Testing (N = %d, n = %d, vl = %d, niter = %d)\n", N, n,
+           vector_length, niter);
+
+    typedef Kokkos::View<value_type **, Kokkos::LayoutRight, exec_space_type>
+        view_type;
+    view_type dl0("dl0", N, n - 1), d0("d0", N, n), du0("du0", N, n - 1),
+        b0("b0", N, n);
+    view_type dl("dl", N, n - 1), d("d", N, n), du("du", N, n - 1),
+        b("b", N, n);
+    randomize(dl0, d0, du0, b0);
+
+    auto reset = [&]() {
+      Kokkos::deep_copy(dl, dl0);
+      Kokkos::deep_copy(d, d0);
+      Kokkos::deep_copy(du, du0);
+      Kokkos::deep_copy(b, b0);
+      Kokkos::fence();
+    };
+
+    ///
+    /// Thomas, one system per thread
+    ///
+    {
+      double t = 0;
+      for (int iter = 0; iter < niter; ++iter) {
+        reset();
+        timer.reset();
+        Kokkos::parallel_for(
+            "thomas", Kokkos::RangePolicy<exec_space_type>(0, N),
+            KOKKOS_LAMBDA(const int &l) {
+              SerialGtsv<Tridiag::Thomas>::invoke(
+                  Kokkos::subview(dl, l, Kokkos::ALL()),
+                  Kokkos::subview(d, l, Kokkos::ALL()),
+                  Kokkos::subview(du, l, Kokkos::ALL()),
+                  Kokkos::subview(b, l, Kokkos::ALL()));
+            });
+        Kokkos::fence();
+        t += timer.seconds();
+      }
+      printf("thomas           time = %f\n", t / niter);
+    }
+
+    ///
+    /// cyclic reduction, one system per team
+    ///
+    {
+      double t = 0;
+      for (int iter = 0; iter < niter; ++iter) {
+        reset();
+        timer.reset();
+        Kokkos::parallel_for(
+            "cyclic reduction", policy_type(N, Kokkos::AUTO()),
+            KOKKOS_LAMBDA(const member_type &member) {
+              const int l = member.league_rank();
+              TeamGtsv<member_type, Tridiag::CyclicReduction>::invoke(
+                  member, Kokkos::subview(dl, l, Kokkos::ALL()),
+                  Kokkos::subview(d, l, Kokkos::ALL()),
+                  Kokkos::subview(du, l, Kokkos::ALL()),
+                  Kokkos::subview(b, l, Kokkos::ALL()));
+            });
+        Kokkos::fence();
+        t += timer.seconds();
+      }
+      printf("cyclic reduction time = %f\n", t / niter);
+    }
+
+    ///
+    /// Thomas on vector_length interleaved systems per thread
+    ///
+    if (N % vector_length == 0) {
+      typedef Kokkos::View<vector_type **, Kokkos::LayoutRight,
+                           exec_space_type>
+          simd_view_type;
+      const int Nv = N / vector_length;
+      simd_view_type dlv("dlv", Nv, n - 1), dv("dv", Nv, n),
+          duv("duv", Nv, n - 1), bv("bv", Nv, n);
+
+      double t = 0;
+      for (int iter = 0; iter < niter; ++iter) {
+        reset();
+        /// interleave system l into lane l % vector_length
+        Kokkos::parallel_for(
+            "interleave", Kokkos::RangePolicy<exec_space_type>(0, N),
+            KOKKOS_LAMBDA(const int &l) {
+              const int lv = l / vector_length, v = l % vector_length;
+              for (int i = 0; i < n; ++i) {
+                dv(lv, i)[v] = d(l, i);
+                bv(lv, i)[v] = b(l, i);
+              }
+              for (int i = 0; i < n - 1; ++i) {
+                dlv(lv, i)[v] = dl(l, i);
+                duv(lv, i)[v] = du(l, i);
+              }
+            });
+        Kokkos::fence();
+        timer.reset();
+        Kokkos::parallel_for(
+            "thomas simd", Kokkos::RangePolicy<exec_space_type>(0, Nv),
+            KOKKOS_LAMBDA(const int &l) {
+              SerialGtsv<Tridiag::Thomas>::invoke(
+                  Kokkos::subview(dlv, l, Kokkos::ALL()),
+                  Kokkos::subview(dv, l, Kokkos::ALL()),
+                  Kokkos::subview(duv, l, Kokkos::ALL()),
+                  Kokkos::subview(bv, l, Kokkos::ALL()));
+            });
+        Kokkos::fence();
+        t += timer.seconds();
+      }
+      printf("thomas simd      time = %f\n", t / niter);
+    }
+  }
+  Kokkos::finalize();
+
+  return 0;
+}
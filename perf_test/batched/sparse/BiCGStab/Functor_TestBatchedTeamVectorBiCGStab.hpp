@@ -0,0 +1,183 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// Factorizes the ILU(0) preconditioners of all the systems in place.
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename KrylovHandleType>
+struct Functor_BatchedILU0Factorize {
+  const ValuesViewType _LU;
+  const IntView _r;
+  const IntView _c;
+  KrylovHandleType _handle;
+
+  Functor_BatchedILU0Factorize(const ValuesViewType &LU, const IntView &r,
+                               const IntView &c, KrylovHandleType &handle)
+      : _LU(LU), _r(r), _c(c), _handle(handle) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int first_matrix = _handle.first_index(member.league_rank());
+    const int last_matrix  = _handle.last_index(member.league_rank());
+
+    auto lu = Kokkos::subview(
+        _LU, Kokkos::make_pair(first_matrix, last_matrix), Kokkos::ALL);
+
+    KokkosBatched::ILU0Prec<ValuesViewType, IntView> P(lu, _r, _c);
+    P.template factorize<MemberType, KokkosBatched::Mode::TeamVector>(member);
+  }
+
+  inline double run() {
+    std::string name("KokkosBatched::Test::ILU0Factorize");
+    Kokkos::Timer timer;
+    Kokkos::Profiling::pushRegion(name.c_str());
+
+    Kokkos::TeamPolicy<DeviceType> policy(_handle.get_number_of_teams(),
+                                          Kokkos::AUTO(), Kokkos::AUTO());
+
+    exec_space().fence();
+    timer.reset();
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    exec_space().fence();
+    double sec = timer.seconds();
+    Kokkos::Profiling::popRegion();
+
+    return sec;
+  }
+};
+
+/// \tparam PrecType: 0 no preconditioner, 1 Jacobi, 2 ILU(0)
+template <typename DeviceType, typename ValuesViewType, typename IntView,
+          typename VectorViewType, typename KrylovHandleType, int PrecType>
+struct Functor_TestBatchedTeamVectorBiCGStab {
+  const ValuesViewType _D;
+  const ValuesViewType _P;
+  const IntView _r;
+  const IntView _c;
+  const VectorViewType _X;
+  const VectorViewType _B;
+  const int _team_size, _vector_length;
+  const int _memory_strategy;
+  KrylovHandleType _handle;
+
+  /// \param P [in]: inverse of the diagonal (PrecType 1) or ILU(0) factors
+  /// (PrecType 2) of the matrices, unused otherwise
+  Functor_TestBatchedTeamVectorBiCGStab(
+      const ValuesViewType &D, const ValuesViewType &P, const IntView &r,
+      const IntView &c, const VectorViewType &X, const VectorViewType &B,
+      const int team_size, const int vector_length, const int memory_strategy,
+      KrylovHandleType &handle)
+      : _D(D),
+        _P(P),
+        _r(r),
+        _c(c),
+        _X(X),
+        _B(B),
+        _team_size(team_size),
+        _vector_length(vector_length),
+        _memory_strategy(memory_strategy),
+        _handle(handle) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    const int first_matrix = _handle.first_index(member.league_rank());
+    const int last_matrix  = _handle.last_index(member.league_rank());
+
+    auto d = Kokkos::subview(_D, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto x = Kokkos::subview(_X, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+    auto b = Kokkos::subview(_B, Kokkos::make_pair(first_matrix, last_matrix),
+                             Kokkos::ALL);
+
+    using Operator = KokkosBatched::CrsMatrix<ValuesViewType, IntView>;
+
+    Operator A(d, _r, _c);
+
+    if (PrecType == 1) {
+      auto diag = Kokkos::subview(
+          _P, Kokkos::make_pair(first_matrix, last_matrix), Kokkos::ALL);
+      using PrecOperator = KokkosBatched::JacobiPrec<ValuesViewType>;
+
+      PrecOperator P(diag);
+      P.setComputedInverse();
+
+      KokkosBatched::TeamVectorBiCGStab<MemberType>::template invoke<
+          Operator, VectorViewType, PrecOperator, KrylovHandleType>(
+          member, A, b, x, P, _handle);
+    } else if (PrecType == 2) {
+      auto lu = Kokkos::subview(
+          _P, Kokkos::make_pair(first_matrix, last_matrix), Kokkos::ALL);
+      using PrecOperator = KokkosBatched::ILU0Prec<ValuesViewType, IntView>;
+
+      PrecOperator P(lu, _r, _c);
+      P.setFactorized();
+
+      KokkosBatched::TeamVectorBiCGStab<MemberType>::template invoke<
+          Operator, VectorViewType, PrecOperator, KrylovHandleType>(
+          member, A, b, x, P, _handle);
+    } else {
+      KokkosBatched::TeamVectorBiCGStab<MemberType>::template invoke<
+          Operator, VectorViewType>(member, A, b, x, _handle);
+    }
+  }
+
+  inline double run() {
+    std::string name("KokkosBatched::Test::TeamVectorBiCGStab");
+    Kokkos::Timer timer;
+    Kokkos::Profiling::pushRegion(name.c_str());
+
+    Kokkos::TeamPolicy<DeviceType> auto_policy(_handle.get_number_of_teams(),
+                                               Kokkos::AUTO(), Kokkos::AUTO());
+    Kokkos::TeamPolicy<DeviceType> tuned_policy(_handle.get_number_of_teams(),
+                                                _team_size, _vector_length);
+    Kokkos::TeamPolicy<DeviceType> policy;
+
+    if (_team_size < 1)
+      policy = auto_policy;
+    else
+      policy = tuned_policy;
+
+    const int N_team = _handle.get_number_of_systems_per_team();
+    const int n      = _X.extent(1);
+
+    using ScalarType = typename ValuesViewType::non_const_value_type;
+    using Layout     = typename ValuesViewType::array_layout;
+    using EXSP       = typename ValuesViewType::execution_space;
+
+    using ViewType2D = Kokkos::View<ScalarType **, Layout, EXSP>;
+
+    size_t bytes_norm = ViewType2D::shmem_size(N_team, 8);
+    size_t bytes_vec  = ViewType2D::shmem_size(N_team, 6 * n);
+
+    _handle.set_memory_strategy(_memory_strategy);
+    if (_memory_strategy == 1) {
+      _handle.tmp_view = typename KrylovHandleType::TemporaryViewType(
+          "", _X.extent(0), 6 * n);
+      bytes_vec = 0;
+    }
+
+    policy.set_scratch_size(0, Kokkos::PerTeam(bytes_norm + bytes_vec));
+
+    exec_space().fence();
+    timer.reset();
+    Kokkos::parallel_for(name.c_str(), policy, *this);
+    exec_space().fence();
+    double sec = timer.seconds();
+    Kokkos::Profiling::popRegion();
+
+    return sec;
+  }
+};
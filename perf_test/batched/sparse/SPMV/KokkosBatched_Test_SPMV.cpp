@@ -14,6 +14,7 @@
 //
 //@HEADER
 
+#include <algorithm>
 #include <fstream>
 
 /// Kokkos headers
@@ -25,6 +26,8 @@
 
 #include "KokkosBatched_SPMV_View.hpp"
 #include "KokkosBatched_Spmv.hpp"
+#include "KokkosBatched_Vector.hpp"
+#include "KokkosBatched_InterleavedCrsMatrix.hpp"
 
 typedef Kokkos::DefaultExecutionSpace exec_space;
 typedef typename exec_space::memory_space memory_space;
@@ -118,6 +121,63 @@ struct Functor_TestBatchedTeamVectorSpmv {
   }
 };
 
+template <typename PolicyType, typename PackedViewType, typename IntView,
+          typename xViewType, typename yViewType>
+struct Functor_TestBatchedInterleavedSpmv {
+  PolicyType _policy;
+  const PackedViewType _D;
+  const IntView _r;
+  const IntView _c;
+  const xViewType _X;
+  const yViewType _Y;
+  int _matrices_per_team;
+
+  Functor_TestBatchedInterleavedSpmv(PolicyType policy, const PackedViewType &D,
+                                     const IntView &r, const IntView &c,
+                                     const xViewType &X, const yViewType &Y,
+                                     const int matrices_per_team)
+      : _policy(policy),
+        _D(D),
+        _r(r),
+        _c(c),
+        _X(X),
+        _Y(Y),
+        _matrices_per_team(matrices_per_team) {}
+
+  template <typename MemberType>
+  KOKKOS_INLINE_FUNCTION void operator()(const MemberType &member) const {
+    using Operator =
+        KokkosBatched::InterleavedCrsMatrix<PackedViewType, IntView>;
+    const int l = Operator::vector_length;
+
+    // _matrices_per_team is a multiple of l: a team starts on a pack
+    const int first_matrix =
+        static_cast<int>(member.league_rank()) * _matrices_per_team;
+    const int N = _X.extent(0);
+    const int last_matrix =
+        (static_cast<int>(member.league_rank() + 1) * _matrices_per_team < N
+             ? static_cast<int>(member.league_rank() + 1) * _matrices_per_team
+             : N);
+
+    auto D_team = Kokkos::subview(
+        _D, Kokkos::make_pair(first_matrix / l, (last_matrix + l - 1) / l),
+        Kokkos::ALL);
+    auto X_team = Kokkos::subview(
+        _X, Kokkos::make_pair(first_matrix, last_matrix), Kokkos::ALL);
+    auto Y_team = Kokkos::subview(
+        _Y, Kokkos::make_pair(first_matrix, last_matrix), Kokkos::ALL);
+
+    Operator A(D_team, _r, _c);
+    A.template apply<KokkosBatched::Trans::NoTranspose,
+                     KokkosBatched::Mode::TeamVector>(member, X_team, Y_team);
+  }
+
+  inline void run() {
+    Kokkos::parallel_for("KokkosSparse::PerfTest::InterleavedBSpMV", _policy,
+                         *this);
+  }
+};
+
 int main(int argc, char *argv[]) {
   Kokkos::initialize(argc, argv);
   {
@@ -192,6 +252,11 @@ int main(int argc, char *argv[]) {
                "implementation 1 but using the kernels from "
                "batched/sparse/impl/*."
             << std::endl
+            << "                     Note: implementation 4 : the values of "
+               "the matrices are interleaved in packs of SIMD vectors "
+               "(KokkosBatched::InterleavedCrsMatrix); N_team is rounded up "
+               "to a multiple of the SIMD vector length."
+            << std::endl
             << "-l                :  Specify left layout." << std::endl
             << "-r                :  Specify right layout." << std::endl
             << "-N_team           :  Specify the number of systems per team."
@@ -256,6 +321,12 @@ int main(int argc, char *argv[]) {
     using XYTypeLR           = Kokkos::View<double **, LR>;
     using XYTypeLL           = Kokkos::View<double **, LL>;
 
+    constexpr int simd_length =
+        KokkosBatched::DefaultVectorLength<double, memory_space>::value;
+    using PackedValueView =
+        Kokkos::View<KokkosBatched::Vector<KokkosBatched::SIMD<double>,
+                                           simd_length> **>;
+
     using alphaViewType = Kokkos::View<double *>;
     alphaViewType alphaV("alpha", N);
     alphaViewType betaV("alpha", N);
@@ -288,6 +359,14 @@ int main(int argc, char *argv[]) {
       readArrayFromMM(name_B, xLR);
     }
 
+    PackedValueView valuesPacked;
+    if (std::find(impls.begin(), impls.end(), 4) != impls.end()) {
+      valuesPacked = PackedValueView("values",
+                                     (N + simd_length - 1) / simd_length, nnz);
+      if (layout_left) KokkosBatched::packInterleaved(valuesLL, valuesPacked);
+      if (layout_right) KokkosBatched::packInterleaved(valuesLR, valuesPacked);
+    }
+
     auto alphaV_h = Kokkos::create_mirror_view(alphaV);
     auto betaV_h  = Kokkos::create_mirror_view(betaV);
 
@@ -322,7 +401,9 @@ int main(int argc, char *argv[]) {
           timer.reset();
           exec_space().fence();
 
-          int N_team          = N_team_potential;
+          int N_team = N_team_potential;
+          if (i_impl == 4)
+            N_team = ((N_team + simd_length - 1) / simd_length) * simd_length;
           int number_of_teams = ceil(static_cast<double>(N) / N_team);
 
           if (layout_left) {
@@ -350,7 +431,13 @@ int main(int argc, char *argv[]) {
             if (i_impl > 1)
               policy.set_scratch_size(0, Kokkos::PerTeam(bytes_0 + bytes_1));
             // policy.set_scratch_size(1, Kokkos::PerTeam(bytes_1));
-            if (i_impl == 3) {
+            if (i_impl == 4) {
+              Functor_TestBatchedInterleavedSpmv<policy_type, PackedValueView,
+                                                 IntView, XYTypeLL, XYTypeLL>(
+                  policy, valuesPacked, rowOffsets, colIndices, xLL, yLL,
+                  N_team)
+                  .run();
+            } else if (i_impl == 3) {
               Functor_TestBatchedTeamVectorSpmv<
                   policy_type, AMatrixValueViewLL, IntView, XYTypeLL, XYTypeLL,
                   alphaViewType, alphaViewType, 0>(policy, alphaV, valuesLL,
@@ -388,7 +475,13 @@ int main(int argc, char *argv[]) {
             if (i_impl > 1)
               policy.set_scratch_size(0, Kokkos::PerTeam(bytes_0 + bytes_1));
             // policy.set_scratch_size(1, Kokkos::PerTeam(bytes_1));
-            if (i_impl == 3) {
+            if (i_impl == 4) {
+              Functor_TestBatchedInterleavedSpmv<policy_type, PackedValueView,
+                                                 IntView, XYTypeLR, XYTypeLR>(
+                  policy, valuesPacked, rowOffsets, colIndices, xLR, yLR,
+                  N_team)
+                  .run();
+            } else if (i_impl == 3) {
               Functor_TestBatchedTeamVectorSpmv<
                   policy_type, AMatrixValueViewLR, IntView, XYTypeLR, XYTypeLR,
                   alphaViewType, alphaViewType, 0>(policy, alphaV, valuesLR,
@@ -203,16 +203,24 @@ echo "make -j40 KokkosBlas3_perf_test" >> $KOKKOSKERNELS_BUILD_DIR/build.sh
 chmod +x $KOKKOSKERNELS_BUILD_DIR/build.sh
 
 # Write the arch agnostic kokkos-kernels benchmark script
+# Sweeps of A,B,C sizes: square (SQUARE heuristic), tall with M = N + 32 (TALL
+# heuristic), wide with N = M + 32 (WIDE heuristic). The perf test selects the
+# heuristic from the shape of C. Every size grows by the step.
+shapes=(square tall wide)
+shapes_start=(2x2,2x2,2x2 34x2,2x2,34x2 2x2,2x34,2x34)
+shapes_stop=(64x64,64x64,64x64 96x64,64x64,96x64 64x64,64x96,64x96)
 echo "#!/bin/bash" > $KOKKOSKERNELS_BUILD_DIR/bench.sh
 echo "cd $benchmark_dir" >> $KOKKOSKERNELS_BUILD_DIR/bench.sh
-echo "$KOKKOSKERNELS_BUILD_DIR/perf_test/blas/blas3/KokkosBlas3_perf_test \
-      --test=batched_heuristic --routines=gemm --loop_type=parallel --batch_size_last_dim=0 \
-      --matrix_size_start=2x2,2x2,2x2 --matrix_size_stop=64x64,64x64,64x64 \
-      --matrix_size_step=2 --batch_size=$((32*1024)) \
-      --warm_up_loop=10 --iter=20 --verify=1 \
-      ${use_simd} \
-      --csv=${benchmark_dir}/${precision}_bench.csv" \
-       >> $KOKKOSKERNELS_BUILD_DIR/bench.sh
+for i in ${!shapes[@]}; do
+  echo "$KOKKOSKERNELS_BUILD_DIR/perf_test/blas/blas3/KokkosBlas3_perf_test \
+        --test=batched_heuristic --routines=gemm --loop_type=parallel --batch_size_last_dim=0 \
+        --matrix_size_start=${shapes_start[$i]} --matrix_size_stop=${shapes_stop[$i]} \
+        --matrix_size_step=2 --batch_size=$((32*1024)) \
+        --warm_up_loop=10 --iter=20 --verify=1 \
+        ${use_simd} \
+        --csv=${benchmark_dir}/${precision}_${shapes[$i]}_bench.csv" \
+         >> $KOKKOSKERNELS_BUILD_DIR/bench.sh
+done
 chmod +x $KOKKOSKERNELS_BUILD_DIR/bench.sh
 
 # Check out the correct SHAs
@@ -236,4 +244,6 @@ beval $kokkoskernels_build_cmd
 
 # Run the benchmark
 beval $benchmark_cmd
-beval "cat ${benchmark_dir}/${precision}_bench.csv"
+for shape in ${shapes[@]}; do
+  beval "cat ${benchmark_dir}/${precision}_${shape}_bench.csv"
+done
@@ -453,8 +453,12 @@ template <class algo_tag, class blocking_type, class device_type,
           class algo_mode = void>
 void __do_gemm_parallel_batched_heuristic_template(options_t options,
                                                    gemm_args_t gemm_args) {
+  // pick the heuristic that matches the shape of C
+  const int c_m = gemm_args.dims.c.m, c_n = gemm_args.dims.c.n;
   KokkosBatched::BatchedGemmHandle batchedGemmHandle(
-      KokkosBatched::BaseHeuristicAlgos::SQUARE);
+      c_m > c_n   ? KokkosBatched::BaseHeuristicAlgos::TALL
+      : c_m < c_n ? KokkosBatched::BaseHeuristicAlgos::WIDE
+                  : KokkosBatched::BaseHeuristicAlgos::SQUARE);
   char a  = toupper(gemm_args.transA);
   char b  = toupper(gemm_args.transB);
   using N = KokkosBatched::Trans::NoTranspose;
@@ -0,0 +1,327 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Kokkos_Core.hpp>
+
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spadd.hpp"
+#include "KokkosGraph_Partition.hpp"
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+
+struct PartitionParameters {
+  int repeat               = 1;
+  int num_parts            = 2;
+  double imbalance_tol     = 1.03;
+  int use_threads          = 0;
+  int use_openmp           = 0;
+  int use_cuda             = 0;
+  int use_hip              = 0;
+  int use_serial           = 0;
+  const char* mtx_file     = NULL;
+  const char* compare_file = NULL;
+  const char* output_file  = NULL;
+};
+
+void print_options(std::ostream& os, const char* app_name,
+                   unsigned int indent = 0) {
+  std::string spaces(indent, ' ');
+  os << "Usage:" << std::endl
+     << spaces << "  " << app_name << " [parameters]" << std::endl
+     << std::endl
+     << spaces << "Parameters:" << std::endl
+     << spaces << "  Required Parameters:" << std::endl
+     << spaces
+     << "      --amtx <filename>   Input file in Matrix Market format (.mtx)."
+     << std::endl
+     << std::endl
+     << spaces << "      Device type (the following are enabled in this build):"
+     << std::endl
+#ifdef KOKKOS_ENABLE_SERIAL
+     << spaces << "          --serial            Execute serially." << std::endl
+#endif
+#ifdef KOKKOS_ENABLE_THREADS
+     << spaces << "          --threads           Use posix threads.\n"
+#endif
+#ifdef KOKKOS_ENABLE_OPENMP
+     << spaces << "          --openmp            Use OpenMP.\n"
+#endif
+#ifdef KOKKOS_ENABLE_CUDA
+     << spaces << "          --cuda              Use CUDA.\n"
+#endif
+#ifdef KOKKOS_ENABLE_HIP
+     << spaces << "          --hip               Use HIP.\n"
+#endif
+     << std::endl
+     << spaces << "  Optional Parameters:" << std::endl
+     << spaces << "      --parts <k>         Number of parts (Default: 2)"
+     << std::endl
+     << spaces
+     << "      --imbalance <tol>   Allowed max/average part weight (Default: "
+        "1.03)"
+     << std::endl
+     << spaces
+     << "      --compare <file>    Partition computed by another tool, one "
+        "part id per line"
+     << std::endl
+     << spaces
+     << "                          (e.g. METIS .part file), evaluated on the "
+        "same graph"
+     << std::endl
+     << spaces
+     << "      --output <file>     Write the partition, one part id per line"
+     << std::endl
+     << spaces
+     << "      --repeat <N>        Set number of test repetitions (Default: 1) "
+     << std::endl
+     << spaces << "      --help              Print out command line help."
+     << std::endl
+     << spaces << " " << std::endl;
+}
+
+static char* getNextArg(int& i, int argc, char** argv) {
+  i++;
+  if (i >= argc) {
+    std::cerr << "Error: expected additional command-line argument!\n";
+    exit(1);
+  }
+  return argv[i];
+}
+
+int parse_inputs(PartitionParameters& params, int argc, char** argv) {
+  bool got_required_param_amtx = false;
+  for (int i = 1; i < argc; ++i) {
+    if (0 == Test::string_compare_no_case(argv[i], "--threads")) {
+      params.use_threads = 1;
+    } else if (0 == Test::string_compare_no_case(argv[i], "--serial")) {
+      params.use_serial = 1;
+    } else if (0 == Test::string_compare_no_case(argv[i], "--openmp")) {
+      params.use_openmp = 1;
+    } else if (0 == Test::string_compare_no_case(argv[i], "--cuda")) {
+      params.use_cuda = 1;
+    } else if (0 == Test::string_compare_no_case(argv[i], "--hip")) {
+      params.use_hip = 1;
+    } else if (0 == Test::string_compare_no_case(argv[i], "--repeat")) {
+      params.repeat = atoi(getNextArg(i, argc, argv));
+      if (params.repeat <= 0) {
+        std::cout << "*** Repeat count must be positive, defaulting to 1.\n";
+        params.repeat = 1;
+      }
+    } else if (0 == Test::string_compare_no_case(argv[i], "--parts")) {
+      params.num_parts = atoi(getNextArg(i, argc, argv));
+      if (params.num_parts <= 0) {
+        std::cout << "*** Number of parts must be positive, defaulting to 2.\n";
+        params.num_parts = 2;
+      }
+    } else if (0 == Test::string_compare_no_case(argv[i], "--imbalance")) {
+      params.imbalance_tol = atof(getNextArg(i, argc, argv));
+    } else if (0 == Test::string_compare_no_case(argv[i], "--amtx")) {
+      got_required_param_amtx = true;
+      params.mtx_file         = getNextArg(i, argc, argv);
+    } else if (0 == Test::string_compare_no_case(argv[i], "--compare")) {
+      params.compare_file = getNextArg(i, argc, argv);
+    } else if (0 == Test::string_compare_no_case(argv[i], "--output")) {
+      params.output_file = getNextArg(i, argc, argv);
+    } else if (0 == Test::string_compare_no_case(argv[i], "--help") ||
+               0 == Test::string_compare_no_case(argv[i], "-h")) {
+      print_options(std::cout, argv[0]);
+      return 1;
+    } else {
+      std::cerr << "Unrecognized command line argument #" << i << ": "
+                << argv[i] << std::endl;
+      print_options(std::cout, argv[0]);
+      return 1;
+    }
+  }
+
+  if (!got_required_param_amtx) {
+    std::cout << "Missing required parameter amtx" << std::endl << std::endl;
+    print_options(std::cout, argv[0]);
+    return 1;
+  }
+  if (!params.use_serial && !params.use_threads && !params.use_openmp &&
+      !params.use_cuda && !params.use_hip) {
+    print_options(std::cout, argv[0]);
+    return 1;
+  }
+  return 0;
+}
+
+// edge cut and imbalance of a partition read from a file, computed on the host
+template <typename crsMat_t>
+void evaluate_partition_file(const crsMat_t& A, const char* filename) {
+  using lno_t     = typename crsMat_t::ordinal_type;
+  using size_type = typename crsMat_t::size_type;
+  auto rowmap =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.row_map);
+  auto entries =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.graph.entries);
+  const lno_t numVerts = A.numRows();
+
+  std::ifstream in(filename);
+  std::vector<lno_t> part;
+  lno_t p;
+  while (in >> p) part.push_back(p);
+  if (static_cast<lno_t>(part.size()) != numVerts) {
+    std::cerr << "*** " << filename << " has " << part.size()
+              << " entries but the graph has " << numVerts << " vertices\n";
+    return;
+  }
+  const lno_t k = *std::max_element(part.begin(), part.end()) + 1;
+  std::vector<lno_t> sizes(k, 0);
+  size_type cut = 0;
+  for (lno_t i = 0; i < numVerts; i++) {
+    sizes[part[i]]++;
+    for (size_type j = rowmap(i); j < rowmap(i + 1); j++)
+      if (part[entries(j)] != part[i]) cut++;
+  }
+  const lno_t maxSize = *std::max_element(sizes.begin(), sizes.end());
+  std::cout << "Reference partition (" << filename << "), " << k << " parts\n"
+            << "  edge cut:  " << cut / 2 << '\n'
+            << "  imbalance: " << double(maxSize) * k / numVerts << '\n';
+}
+
+// exclude from Cuda builds without lambdas enabled
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+template <typename device_t>
+void run_partition(const PartitionParameters& params) {
+  using size_type  = default_size_type;
+  using lno_t      = default_lno_t;
+  using exec_space = typename device_t::execution_space;
+  using mem_space  = typename device_t::memory_space;
+  using crsMat_t   = typename KokkosSparse::CrsMatrix<default_scalar, lno_t,
+                                                    device_t, void, size_type>;
+  using KKH        = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, default_scalar, exec_space, mem_space, mem_space>;
+
+  using partitioner_t = KokkosGraph::Experimental::partitioner<crsMat_t>;
+
+  Kokkos::Timer t;
+  crsMat_t A_in =
+      KokkosSparse::Impl::read_kokkos_crst_matrix<crsMat_t>(params.mtx_file);
+  std::cout << "I/O time: " << t.seconds() << " s\n";
+  t.reset();
+  // Symmetrize the matrix and use unit edge weights
+  crsMat_t At_in = KokkosSparse::Impl::transpose_matrix(A_in);
+  crsMat_t A;
+  KKH kkh;
+  const default_scalar one = Kokkos::ArithTraits<default_scalar>::one();
+  kkh.create_spadd_handle(false);
+  KokkosSparse::spadd_symbolic(&kkh, A_in, At_in, A);
+  KokkosSparse::spadd_numeric(&kkh, one, A_in, one, At_in, A);
+  kkh.destroy_spadd_handle();
+  Kokkos::deep_copy(A.values, one);
+  std::cout << "Time to symmetrize: " << t.seconds() << " s\n";
+
+  std::cout << "Num verts: " << A.numRows() << '\n'
+            << "Num edges: " << A.nnz() << '\n';
+
+  typename partitioner_t::partition_handle handle;
+  handle.num_parts     = params.num_parts;
+  handle.imbalance_tol = params.imbalance_tol;
+
+  t.reset();
+  for (int rep = 0; rep < params.repeat; rep++) {
+    partitioner_t::partition(handle, A, true);
+    exec_space().fence();
+  }
+  double totalTime = t.seconds();
+  std::cout << "Partition average time: " << totalTime / params.repeat << '\n'
+            << "Levels: " << handle.coarsen.results.size() << '\n'
+            << "Edge cut: " << handle.edge_cut << '\n'
+            << "Max part weight: " << handle.max_part_weight << '\n'
+            << "Imbalance: " << handle.imbalance << '\n';
+
+  if (params.output_file) {
+    auto part =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), handle.part);
+    std::ofstream out(params.output_file);
+    for (size_t i = 0; i < part.extent(0); i++) out << part(i) << '\n';
+  }
+  if (params.compare_file) evaluate_partition_file(A, params.compare_file);
+}
+#endif
+
+int main(int argc, char* argv[]) {
+  PartitionParameters params;
+
+  if (parse_inputs(params, argc, argv)) {
+    return 1;
+  }
+
+  if (params.mtx_file == NULL) {
+    std::cerr << "Provide a matrix file" << std::endl;
+    return 0;
+  }
+
+  Kokkos::initialize();
+
+  bool run = false;
+
+#if !defined(KOKKOS_ENABLE_CUDA) || defined(KOKKOS_ENABLE_CUDA_LAMBDA)
+#if defined(KOKKOS_ENABLE_OPENMP)
+  if (params.use_openmp) {
+    run_partition<Kokkos::OpenMP>(params);
+    run = true;
+  }
+#endif
+
+#if defined(KOKKOS_ENABLE_THREADS)
+  if (params.use_threads) {
+    run_partition<Kokkos::Threads>(params);
+    run = true;
+  }
+#endif
+
+#if defined(KOKKOS_ENABLE_CUDA)
+  if (params.use_cuda) {
+    run_partition<Kokkos::Cuda>(params);
+    run = true;
+  }
+#endif
+
+#if defined(KOKKOS_ENABLE_HIP)
+  if (params.use_hip) {
+    run_partition<Kokkos::HIP>(params);
+    run = true;
+  }
+#endif
+
+#if defined(KOKKOS_ENABLE_SERIAL)
+  if (params.use_serial) {
+    run_partition<Kokkos::Serial>(params);
+    run = true;
+  }
+#endif
+#endif
+
+  if (!run) {
+    std::cerr << "*** ERROR: did not run, none of the supported device types "
+                 "were selected.\n";
+  }
+
+  Kokkos::finalize();
+
+  return 0;
+}
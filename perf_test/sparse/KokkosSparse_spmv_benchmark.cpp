@@ -39,9 +39,10 @@ struct spmv_parameters {
   std::string filename;
   std::string alg;
   std::string tpl;
+  std::string mode;
 
   spmv_parameters(const int N_)
-      : N(N_), offset(0), filename(""), alg(""), tpl("") {}
+      : N(N_), offset(0), filename(""), alg(""), tpl(""), mode("N") {}
 };
 
 void print_options() {
@@ -65,6 +66,11 @@ void print_options() {
   std::cerr << "\t[Optional] --TPL       :: when available and compatible with "
                "alg, a TPL can be used (cusparse, rocsparse, MKL)"
             << std::endl;
+  std::cerr << "\t[Optional] --mode          :: the mode of spmv (N, T, H). "
+               "For T and H, the atomic\n"
+               "\t                              kernel is compared with the "
+               "cached transpose (default N)"
+            << std::endl;
   std::cerr
       << "  -f [file]       : Read in Matrix Market formatted text file 'file'."
       << std::endl;
@@ -88,6 +94,12 @@ void parse_inputs(int argc, char** argv, spmv_parameters& params) {
       ++i;
     } else if (perf_test::check_arg_str(i, argc, argv, "--TPL", params.tpl)) {
       ++i;
+    } else if (perf_test::check_arg_str(i, argc, argv, "--mode", params.mode)) {
+      if ((params.mode != "N") && (params.mode != "T") &&
+          (params.mode != "H")) {
+        throw std::runtime_error("--mode can only be `N`, `T` or `H`!");
+      }
+      ++i;
     } else if (perf_test::check_arg_str(i, argc, argv, "-f", params.filename)) {
       ++i;
     } else if (perf_test::check_arg_int(i, argc, argv, "--offset",
@@ -101,6 +113,22 @@ void parse_inputs(int argc, char** argv, spmv_parameters& params) {
   }
 }  // parse_inputs
 
+template <class matrix_type>
+matrix_type make_matrix(const spmv_parameters& inputs) {
+  // Create test matrix
+  srand(17312837);
+  matrix_type A;
+  if (inputs.filename == "") {
+    int nnz = 10 * inputs.N;
+    A       = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(
+        inputs.N, inputs.N, nnz, 0, 0.01 * inputs.N);
+  } else {
+    A = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(
+        inputs.filename.c_str());
+  }
+  return A;
+}
+
 template <class execution_space>
 void run_spmv(benchmark::State& state, const spmv_parameters& inputs) {
   using matrix_type =
@@ -113,19 +141,35 @@ void run_spmv(benchmark::State& state, const spmv_parameters& inputs) {
     controls.setParameter("algorithm", inputs.alg);
   }
 
-  // Create test matrix
-  srand(17312837);
-  matrix_type A;
-  if (inputs.filename == "") {
-    int nnz = 10 * inputs.N;
-    A       = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(
-        inputs.N, inputs.N, nnz, 0, 0.01 * inputs.N);
-  } else {
-    A = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(
-        inputs.filename.c_str());
-  }
+  matrix_type A = make_matrix<matrix_type>(inputs);
 
   // Create input vectors
+  const bool transposed = inputs.mode != "N";
+  mv_type x("X", transposed ? A.numRows() : A.numCols());
+  mv_type y("Y", transposed ? A.numCols() : A.numRows());
+
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, 10);
+  Kokkos::fill_random(y, rand_pool, 10);
+
+  // Run the actual experiments
+  for (auto _ : state) {
+    KokkosSparse::spmv(controls, inputs.mode.c_str(), 1.0, A, x, 0.0, y);
+    Kokkos::fence();
+  }
+}
+
+// mode T or H with A^T built once before the timed loop
+template <class execution_space>
+void run_spmv_cached_transpose(benchmark::State& state,
+                               const spmv_parameters& inputs) {
+  using matrix_type =
+      KokkosSparse::CrsMatrix<double, int, execution_space, void, int>;
+  using mv_type = Kokkos::View<double*, execution_space>;
+
+  matrix_type A = make_matrix<matrix_type>(inputs);
+  KokkosSparse::Experimental::SPMVTransposeHandle<matrix_type> handle;
+
   mv_type x("X", A.numRows());
   mv_type y("Y", A.numCols());
 
@@ -133,9 +177,12 @@ void run_spmv(benchmark::State& state, const spmv_parameters& inputs) {
   Kokkos::fill_random(x, rand_pool, 10);
   Kokkos::fill_random(y, rand_pool, 10);
 
+  KokkosSparse::spmv(&handle, inputs.mode.c_str(), 1.0, A, x, 0.0, y);
+  Kokkos::fence();
+
   // Run the actual experiments
   for (auto _ : state) {
-    KokkosSparse::spmv(controls, KokkosSparse::NoTranspose, 1.0, A, x, 0.0, y);
+    KokkosSparse::spmv(&handle, inputs.mode.c_str(), 1.0, A, x, 0.0, y);
     Kokkos::fence();
   }
 }
@@ -159,9 +206,22 @@ int main(int argc, char** argv) {
   parse_inputs(argc, argv, inputs);
 
   // Google benchmark will report the wrong n if an input file matrix is used.
-  KokkosKernelsBenchmark::register_benchmark_real_time(
-      bench_name.c_str(), run_spmv<Kokkos::DefaultExecutionSpace>, {"n"},
-      {inputs.N}, common_params.repeat, inputs);
+  if (inputs.mode == "N") {
+    KokkosKernelsBenchmark::register_benchmark_real_time(
+        bench_name.c_str(), run_spmv<Kokkos::DefaultExecutionSpace>, {"n"},
+        {inputs.N}, common_params.repeat, inputs);
+  } else {
+    // atomic transpose kernel vs row parallel kernel on the cached A^T
+    const std::string atomic_name = bench_name + "_" + inputs.mode + "_atomic";
+    const std::string cached_name = bench_name + "_" + inputs.mode + "_cached";
+    KokkosKernelsBenchmark::register_benchmark_real_time(
+        atomic_name.c_str(), run_spmv<Kokkos::DefaultExecutionSpace>, {"n"},
+        {inputs.N}, common_params.repeat, inputs);
+    KokkosKernelsBenchmark::register_benchmark_real_time(
+        cached_name.c_str(),
+        run_spmv_cached_transpose<Kokkos::DefaultExecutionSpace>, {"n"},
+        {inputs.N}, common_params.repeat, inputs);
+  }
   benchmark::RunSpecifiedBenchmarks();
 
   benchmark::Shutdown();
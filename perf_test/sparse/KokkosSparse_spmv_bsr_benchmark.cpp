@@ -116,7 +116,10 @@ size_t detect_block_size(const fs::path &path) {
     std::cerr << "read " << path << "...\n";
     const Crs crs       = cached_read<Crs>(path);
     size_t detectedSize = KokkosSparse::Impl::detect_block_size(crs);
-    std::cerr << "detected block size = " << detectedSize << "\n";
+    const auto fill = KokkosSparse::Impl::block_fill(crs, detectedSize);
+    std::cerr << "detected block size = " << detectedSize << " ("
+              << fill.numBlocks << " blocks, fill ratio " << fill.fillRatio
+              << ")\n";
     cache[path] = detectedSize;
   }
   return cache.at(path);
@@ -0,0 +1,217 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include <Kokkos_Core.hpp>
+
+// Headers needed to create initial data
+#include <KokkosKernels_IOUtils.hpp>
+#include <KokkosSparse_IOUtils.hpp>
+#include "KokkosKernels_default_types.hpp"
+#include "KokkosKernels_TestUtils.hpp"
+#include "KokkosKernels_perf_test_utilities.hpp"
+
+// Headers for benchmark library
+#include <benchmark/benchmark.h>
+#include "Benchmark_Context.hpp"
+
+// Headers for transpose
+#include <KokkosSparse_CrsMatrix.hpp>
+#include <KokkosSparse_Utils.hpp>
+
+namespace {
+
+struct transpose_parameters {
+  int N;
+  bool dense_column;
+  std::string filename;
+
+  transpose_parameters(const int N_)
+      : N(N_), dense_column(false), filename("") {}
+};
+
+void print_options() {
+  std::cerr << "Options\n" << std::endl;
+
+  std::cerr << perf_test::list_common_options();
+
+  std::cerr << "  -n [N]          :: generate a semi-random banded (band size "
+               "0.01xN)\n"
+               "NxN matrix with average of 10 entries per row."
+            << std::endl;
+  std::cerr << "\t[Optional] --dense-column :: put an entry of column 0 in "
+               "every row"
+            << std::endl;
+  std::cerr
+      << "  -f [file]       : Read in Matrix Market formatted text file 'file'."
+      << std::endl;
+}  // print_options
+
+void parse_inputs(int argc, char** argv, transpose_parameters& params) {
+  for (int i = 1; i < argc; ++i) {
+    if (perf_test::check_arg_int(i, argc, argv, "-n", params.N)) {
+      ++i;
+    } else if (perf_test::check_arg_bool(i, argc, argv, "--dense-column",
+                                         params.dense_column)) {
+    } else if (perf_test::check_arg_str(i, argc, argv, "-f", params.filename)) {
+      ++i;
+    } else {
+      print_options();
+      KK_USER_REQUIRE_MSG(false, "Unrecognized command line argument #"
+                                     << i << ": " << argv[i]);
+    }
+  }
+}  // parse_inputs
+
+template <class matrix_type>
+matrix_type make_matrix(const transpose_parameters& inputs) {
+  // Create test matrix
+  srand(17312837);
+  matrix_type A;
+  if (inputs.filename == "") {
+    int nnz = 10 * inputs.N;
+    A       = KokkosSparse::Impl::kk_generate_sparse_matrix<matrix_type>(
+        inputs.N, inputs.N, nnz, 0, 0.01 * inputs.N);
+  } else {
+    A = KokkosSparse::Impl::read_kokkos_crst_matrix<matrix_type>(
+        inputs.filename.c_str());
+  }
+  if (inputs.dense_column) {
+    // the first entry of every row moves to column 0, so that a single
+    // column holds numRows entries
+    auto h_rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         A.graph.row_map);
+    auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         A.graph.entries);
+    for (int i = 0; i < A.numRows(); ++i)
+      if (h_rowmap(i) < h_rowmap(i + 1)) h_entries(h_rowmap(i)) = 0;
+    Kokkos::deep_copy(A.graph.entries, h_entries);
+  }
+  return A;
+}
+
+// scatter with atomics, the view interface of transpose_matrix
+template <class execution_space>
+void run_transpose_atomic(benchmark::State& state,
+                          const transpose_parameters& inputs) {
+  using matrix_type =
+      KokkosSparse::CrsMatrix<double, int, execution_space, void, int>;
+  using c_rowmap_t  = typename matrix_type::row_map_type;
+  using c_entries_t = typename matrix_type::index_type;
+  using c_values_t  = typename matrix_type::values_type;
+  using rowmap_t    = typename matrix_type::row_map_type::non_const_type;
+  using entries_t   = typename matrix_type::index_type::non_const_type;
+  using values_t    = typename matrix_type::values_type::non_const_type;
+
+  matrix_type A = make_matrix<matrix_type>(inputs);
+
+  // Run the actual experiments
+  for (auto _ : state) {
+    rowmap_t AT_rowmap("Transpose rowmap", A.numCols() + 1);
+    entries_t AT_entries(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose entries"),
+        A.nnz());
+    values_t AT_values(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose values"),
+        A.nnz());
+    KokkosSparse::Impl::transpose_matrix<c_rowmap_t, c_entries_t, c_values_t,
+                                         rowmap_t, entries_t, values_t,
+                                         rowmap_t, execution_space>(
+        A.numRows(), A.numCols(), A.graph.row_map, A.graph.entries, A.values,
+        AT_rowmap, AT_entries, AT_values);
+    Kokkos::fence();
+  }
+}
+
+// deterministic radix sort, used by transpose_matrix(CrsMatrix), crs2ccs,
+// ccs2crs, par_ilut, the outer SpGEMM and the spmv transpose handle
+template <class execution_space>
+void run_transpose_permutation(benchmark::State& state,
+                               const transpose_parameters& inputs) {
+  using matrix_type =
+      KokkosSparse::CrsMatrix<double, int, execution_space, void, int>;
+  using perm_type = Kokkos::View<int*, execution_space>;
+
+  matrix_type A = make_matrix<matrix_type>(inputs);
+  perm_type perm;
+
+  // Run the actual experiments
+  for (auto _ : state) {
+    matrix_type At =
+        KokkosSparse::Impl::transpose_matrix_with_permutation(A, perm);
+    Kokkos::fence();
+  }
+}
+
+// value refresh of a transpose built once with its permutation
+template <class execution_space>
+void run_transpose_values(benchmark::State& state,
+                          const transpose_parameters& inputs) {
+  using matrix_type =
+      KokkosSparse::CrsMatrix<double, int, execution_space, void, int>;
+  using perm_type = Kokkos::View<int*, execution_space>;
+
+  matrix_type A = make_matrix<matrix_type>(inputs);
+  perm_type perm;
+  matrix_type At =
+      KokkosSparse::Impl::transpose_matrix_with_permutation(A, perm);
+  Kokkos::fence();
+
+  // Run the actual experiments
+  for (auto _ : state) {
+    KokkosSparse::Impl::transpose_matrix_values(perm, A, At);
+    Kokkos::fence();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  Kokkos::initialize(argc, argv);
+
+  benchmark::Initialize(&argc, argv);
+  benchmark::SetDefaultTimeUnit(benchmark::kMillisecond);
+  KokkosKernelsBenchmark::add_benchmark_context(true);
+
+  perf_test::CommonInputParams common_params;
+  perf_test::parse_common_options(argc, argv, common_params);
+
+  std::string bench_name = "KokkosSparse_transpose";
+
+  // Set input parameters, default to random 100000x100000
+  transpose_parameters inputs(100000);
+  parse_inputs(argc, argv, inputs);
+
+  // Google benchmark will report the wrong n if an input file matrix is used.
+  const std::string atomic_name = bench_name + "_atomic";
+  const std::string perm_name   = bench_name + "_permutation";
+  const std::string values_name = bench_name + "_values";
+  KokkosKernelsBenchmark::register_benchmark_real_time(
+      atomic_name.c_str(), run_transpose_atomic<Kokkos::DefaultExecutionSpace>,
+      {"n"}, {inputs.N}, common_params.repeat, inputs);
+  KokkosKernelsBenchmark::register_benchmark_real_time(
+      perm_name.c_str(),
+      run_transpose_permutation<Kokkos::DefaultExecutionSpace>, {"n"},
+      {inputs.N}, common_params.repeat, inputs);
+  KokkosKernelsBenchmark::register_benchmark_real_time(
+      values_name.c_str(), run_transpose_values<Kokkos::DefaultExecutionSpace>,
+      {"n"}, {inputs.N}, common_params.repeat, inputs);
+  benchmark::RunSpecifiedBenchmarks();
+
+  benchmark::Shutdown();
+  Kokkos::finalize();
+
+  return 0;
+}
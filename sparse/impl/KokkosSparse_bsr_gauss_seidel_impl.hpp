@@ -0,0 +1,709 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_BSR_GAUSS_SEIDEL_IMPL_HPP_
+#define KOKKOSSPARSE_BSR_GAUSS_SEIDEL_IMPL_HPP_
+
+#include <sstream>
+#include <stdexcept>
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosBlas1_scal.hpp"
+#include "KokkosBlas1_axpby.hpp"
+#include "KokkosBatched_LU_Decl.hpp"
+#include "KokkosBatched_SolveLU_Decl.hpp"
+#include "KokkosSparse_gauss_seidel_handle.hpp"
+#include "KokkosSparse_cluster_gauss_seidel_impl.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// True if the GS handle asks for one of the block smoothers below: cluster or
+// two-stage GS on a BSR matrix, with the diagonal blocks inverted densely.
+template <class GSHandle>
+bool use_bsr_gauss_seidel(const GSHandle *gsHandle) {
+  return gsHandle->get_block_size() > 1 &&
+         (gsHandle->get_algorithm_type() == GS_CLUSTER ||
+          gsHandle->get_algorithm_type() == GS_TWOSTAGE);
+}
+
+// Which blocks of a block row take part in a product
+enum class BsrGSPart { All, Lower, Upper };
+
+// Factors the diagonal block of every block row with LU (no pivoting) and
+// stores its inverse. Counts the block rows without a diagonal block.
+template <class RowMap, class Entries, class Values, class DiagView>
+struct BsrGSInvertDiagonalFunctor {
+  using size_type = typename RowMap::non_const_value_type;
+  using ordinal_t = typename Entries::non_const_value_type;
+  using scalar_t  = typename DiagView::non_const_value_type;
+  using block_t   = Kokkos::View<scalar_t **, Kokkos::LayoutRight,
+                               typename DiagView::device_type,
+                               Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  RowMap rowmap;
+  Entries entries;
+  Values values;
+  DiagView invDiag;
+  DiagView work;  // LU factors
+  ordinal_t bs;
+
+  BsrGSInvertDiagonalFunctor(const RowMap &rowmap_, const Entries &entries_,
+                             const Values &values_, const DiagView &invDiag_,
+                             const DiagView &work_, ordinal_t bs_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        values(values_),
+        invDiag(invDiag_),
+        work(work_),
+        bs(bs_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_t i, ordinal_t &numMissing) const {
+    const size_type bs2 = size_type(bs) * bs;
+    block_t lu(&work(i * bs2), bs, bs);
+    block_t inv(&invDiag(i * bs2), bs, bs);
+    for (ordinal_t r = 0; r < bs; ++r)
+      for (ordinal_t c = 0; c < bs; ++c)
+        inv(r, c) = r == c ? Kokkos::ArithTraits<scalar_t>::one()
+                           : Kokkos::ArithTraits<scalar_t>::zero();
+    size_type diag = rowmap(i + 1);
+    for (size_type k = rowmap(i); k < rowmap(i + 1); ++k) {
+      if (entries(k) == i) {
+        diag = k;
+        break;
+      }
+    }
+    if (diag == rowmap(i + 1)) {
+      ++numMissing;
+      return;
+    }
+    for (ordinal_t r = 0; r < bs; ++r)
+      for (ordinal_t c = 0; c < bs; ++c)
+        lu(r, c) = values(diag * bs2 + r * bs + c);
+    KokkosBatched::SerialLU<KokkosBatched::Algo::LU::Unblocked>::invoke(lu);
+    KokkosBatched::SerialSolveLU<
+        KokkosBatched::Trans::NoTranspose,
+        KokkosBatched::Algo::SolveLU::Unblocked>::invoke(lu, inv);
+  }
+};
+
+// DinvA_ij = D_i^{-1} A_ij for the off-diagonal blocks of block row i, the
+// block analog of the scaled L and U of the point two-stage GS.
+template <class RowMap, class Entries, class Values, class DiagView>
+struct BsrGSScaleOffDiagonalFunctor {
+  using size_type = typename RowMap::non_const_value_type;
+  using ordinal_t = typename Entries::non_const_value_type;
+  using scalar_t  = typename DiagView::non_const_value_type;
+
+  RowMap rowmap;
+  Entries entries;
+  Values values;
+  DiagView invDiag;
+  DiagView scaled;
+  ordinal_t bs;
+
+  BsrGSScaleOffDiagonalFunctor(const RowMap &rowmap_, const Entries &entries_,
+                               const Values &values_, const DiagView &invDiag_,
+                               const DiagView &scaled_, ordinal_t bs_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        values(values_),
+        invDiag(invDiag_),
+        scaled(scaled_),
+        bs(bs_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ordinal_t i) const {
+    const size_type bs2 = size_type(bs) * bs;
+    for (size_type k = rowmap(i); k < rowmap(i + 1); ++k) {
+      if (entries(k) == i) continue;
+      for (ordinal_t r = 0; r < bs; ++r) {
+        for (ordinal_t c = 0; c < bs; ++c) {
+          scalar_t sum = Kokkos::ArithTraits<scalar_t>::zero();
+          for (ordinal_t m = 0; m < bs; ++m)
+            sum += invDiag(i * bs2 + r * bs + m) * values(k * bs2 + m * bs + c);
+          scaled(k * bs2 + r * bs + c) = sum;
+        }
+      }
+    }
+  }
+};
+
+// Y := beta * Y + alpha * M * X over the blocks of M selected by part. Each
+// thread of a team owns a block row and its vector lanes the rows of the
+// block.
+template <class execution_space, class RowMap, class Entries, class Values,
+          class XView, class YView>
+struct BsrGSMultiplyFunctor {
+  using member_t  = typename Kokkos::TeamPolicy<execution_space>::member_type;
+  using size_type = typename RowMap::non_const_value_type;
+  using ordinal_t = typename Entries::non_const_value_type;
+  using scalar_t  = typename YView::non_const_value_type;
+
+  RowMap rowmap;
+  Entries entries;
+  Values values;
+  XView x;
+  YView y;
+  ordinal_t numBlockRows;
+  ordinal_t bs;
+  ordinal_t rowsPerTeam;
+  BsrGSPart part;
+  scalar_t alpha, beta;
+
+  BsrGSMultiplyFunctor(const RowMap &rowmap_, const Entries &entries_,
+                       const Values &values_, const XView &x_, const YView &y_,
+                       ordinal_t numBlockRows_, ordinal_t bs_,
+                       ordinal_t rowsPerTeam_, BsrGSPart part_, scalar_t alpha_,
+                       scalar_t beta_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        values(values_),
+        x(x_),
+        y(y_),
+        numBlockRows(numBlockRows_),
+        bs(bs_),
+        rowsPerTeam(rowsPerTeam_),
+        part(part_),
+        alpha(alpha_),
+        beta(beta_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &team) const {
+    const ordinal_t first = team.league_rank() * rowsPerTeam;
+    const ordinal_t last  = first + rowsPerTeam < numBlockRows
+                               ? first + rowsPerTeam
+                               : numBlockRows;
+    const size_type bs2 = size_type(bs) * bs;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, first, last), [&](const ordinal_t i) {
+          for (size_t c = 0; c < y.extent(1); ++c) {
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(team, bs), [&](const ordinal_t r) {
+                  scalar_t sum = Kokkos::ArithTraits<scalar_t>::zero();
+                  for (size_type k = rowmap(i); k < rowmap(i + 1); ++k) {
+                    const ordinal_t j = entries(k);
+                    if ((part == BsrGSPart::Lower && j >= i) ||
+                        (part == BsrGSPart::Upper && j <= i))
+                      continue;
+                    const size_type blk = k * bs2 + r * bs;
+                    for (ordinal_t m = 0; m < bs; ++m)
+                      sum += values(blk + m) * x(j * bs + m, c);
+                  }
+                  const ordinal_t row = i * bs + r;
+                  if (beta == Kokkos::ArithTraits<scalar_t>::zero())
+                    y(row, c) = alpha * sum;
+                  else
+                    y(row, c) = beta * y(row, c) + alpha * sum;
+                });
+          }
+        });
+  }
+};
+
+// Y := D^{-1} X with the inverse diagonal blocks, block rows over the threads
+// and block rows over the vector lanes as above
+template <class execution_space, class DiagView, class XView, class YView>
+struct BsrGSBlockDiagonalFunctor {
+  using member_t  = typename Kokkos::TeamPolicy<execution_space>::member_type;
+  using size_type = size_t;
+  using ordinal_t = int64_t;
+  using scalar_t  = typename YView::non_const_value_type;
+
+  DiagView invDiag;
+  XView x;
+  YView y;
+  ordinal_t numBlockRows;
+  ordinal_t bs;
+  ordinal_t rowsPerTeam;
+
+  BsrGSBlockDiagonalFunctor(const DiagView &invDiag_, const XView &x_,
+                            const YView &y_, ordinal_t numBlockRows_,
+                            ordinal_t bs_, ordinal_t rowsPerTeam_)
+      : invDiag(invDiag_),
+        x(x_),
+        y(y_),
+        numBlockRows(numBlockRows_),
+        bs(bs_),
+        rowsPerTeam(rowsPerTeam_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &team) const {
+    const ordinal_t first = team.league_rank() * rowsPerTeam;
+    const ordinal_t last  = first + rowsPerTeam < numBlockRows
+                               ? first + rowsPerTeam
+                               : numBlockRows;
+    const size_type bs2 = bs * bs;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, first, last), [&](const ordinal_t i) {
+          for (size_t c = 0; c < y.extent(1); ++c) {
+            Kokkos::parallel_for(
+                Kokkos::ThreadVectorRange(team, bs), [&](const ordinal_t r) {
+                  scalar_t sum = Kokkos::ArithTraits<scalar_t>::zero();
+                  for (ordinal_t m = 0; m < bs; ++m)
+                    sum += invDiag(i * bs2 + r * bs + m) * x(i * bs + m, c);
+                  y(i * bs + r, c) = sum;
+                });
+          }
+        });
+  }
+};
+
+// One color of block cluster GS: every thread relaxes the block rows of a
+// cluster in order, x_i += omega * D_i^{-1} (y_i - sum_j A_ij x_j), with the
+// rows of the block over the vector lanes. The block residual is kept in
+// thread scratch.
+template <class execution_space, class RowMap, class Entries, class Values,
+          class DiagView, class ClusterView, class XView, class YView>
+struct BsrClusterGSFunctor {
+  using member_t  = typename Kokkos::TeamPolicy<execution_space>::member_type;
+  using size_type = typename RowMap::non_const_value_type;
+  using ordinal_t = typename Entries::non_const_value_type;
+  using scalar_t  = typename XView::non_const_value_type;
+  using scratch_view_t =
+      Kokkos::View<scalar_t *, typename execution_space::scratch_memory_space,
+                   Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  RowMap rowmap;
+  Entries entries;
+  Values values;
+  DiagView invDiag;
+  XView x;
+  YView y;
+  ClusterView colorAdj;
+  ClusterView clusterOffsets;
+  ClusterView clusterVerts;
+  ordinal_t bs;
+  ordinal_t clustersPerTeam;
+  scalar_t omega;
+
+  ordinal_t colorSetBegin;
+  ordinal_t colorSetEnd;
+  bool isBackward;
+
+  BsrClusterGSFunctor(const RowMap &rowmap_, const Entries &entries_,
+                      const Values &values_, const DiagView &invDiag_,
+                      const XView &x_, const YView &y_,
+                      const ClusterView &colorAdj_,
+                      const ClusterView &clusterOffsets_,
+                      const ClusterView &clusterVerts_, ordinal_t bs_,
+                      ordinal_t clustersPerTeam_, scalar_t omega_)
+      : rowmap(rowmap_),
+        entries(entries_),
+        values(values_),
+        invDiag(invDiag_),
+        x(x_),
+        y(y_),
+        colorAdj(colorAdj_),
+        clusterOffsets(clusterOffsets_),
+        clusterVerts(clusterVerts_),
+        bs(bs_),
+        clustersPerTeam(clustersPerTeam_),
+        omega(omega_),
+        colorSetBegin(0),
+        colorSetEnd(0),
+        isBackward(false) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const member_t &team) const {
+    scratch_view_t res(team.thread_scratch(0), bs);
+    const size_type bs2 = size_type(bs) * bs;
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(team, clustersPerTeam),
+        [&](const ordinal_t work) {
+          const ordinal_t ii =
+              colorSetBegin + team.league_rank() * clustersPerTeam + work;
+          if (ii >= colorSetEnd) return;
+          const ordinal_t cluster      = colorAdj(ii);
+          const ordinal_t clusterBegin = clusterOffsets(cluster);
+          const ordinal_t clusterEnd   = clusterOffsets(cluster + 1);
+          for (ordinal_t jcount = 0; jcount < clusterEnd - clusterBegin;
+               jcount++) {
+            const ordinal_t i = clusterVerts(
+                isBackward ? clusterEnd - 1 - jcount : clusterBegin + jcount);
+            for (size_t c = 0; c < x.extent(1); ++c) {
+              Kokkos::parallel_for(
+                  Kokkos::ThreadVectorRange(team, bs), [&](const ordinal_t r) {
+                    scalar_t sum = y(i * bs + r, c);
+                    for (size_type k = rowmap(i); k < rowmap(i + 1); ++k) {
+                      const ordinal_t j   = entries(k);
+                      const size_type blk = k * bs2 + r * bs;
+                      for (ordinal_t m = 0; m < bs; ++m)
+                        sum -= values(blk + m) * x(j * bs + m, c);
+                    }
+                    res(r) = sum;
+                  });
+              Kokkos::parallel_for(
+                  Kokkos::ThreadVectorRange(team, bs), [&](const ordinal_t r) {
+                    scalar_t update = Kokkos::ArithTraits<scalar_t>::zero();
+                    for (ordinal_t m = 0; m < bs; ++m)
+                      update += invDiag(i * bs2 + r * bs + m) * res(m);
+                    x(i * bs + r, c) += omega * update;
+                  });
+            }
+          }
+        });
+  }
+};
+
+// Block versions of cluster and two-stage Gauss-Seidel for BSR matrices.
+// num_rows and num_cols count block rows and columns, and x and y have
+// block_size entries per block. The diagonal blocks are factored with
+// KokkosBatched::SerialLU and inverted once in initialize_numeric, so every
+// relaxation applies a dense block inverse. The coloring and clustering of
+// GS_CLUSTER are computed on the graph of the blocks.
+template <typename HandleType, typename lno_row_view_t_,
+          typename lno_nnz_view_t_, typename scalar_nnz_view_t_>
+class BsrGaussSeidel {
+ public:
+  using execution_space = typename HandleType::HandleExecSpace;
+  using size_type       = typename HandleType::size_type;
+  using nnz_lno_t       = typename HandleType::nnz_lno_t;
+  using scalar_t        = typename HandleType::nnz_scalar_t;
+
+  using const_lno_row_view_t    = typename lno_row_view_t_::const_type;
+  using const_lno_nnz_view_t    = typename lno_nnz_view_t_::const_type;
+  using const_scalar_nnz_view_t = typename scalar_nnz_view_t_::const_type;
+
+  using ClusterHandle  = typename HandleType::ClusterGaussSeidelHandleType;
+  using TwoStageHandle = typename HandleType::TwoStageGaussSeidelHandleType;
+
+  using team_policy_t = Kokkos::TeamPolicy<execution_space>;
+  using range_type    = Kokkos::pair<size_t, size_t>;
+
+ private:
+  HandleType *handle;
+  nnz_lno_t num_rows, num_cols;
+  const_lno_row_view_t row_map;
+  const_lno_nnz_view_t entries;
+  const_scalar_nnz_view_t values;
+  bool is_symmetric;
+
+  ClusterHandle *get_cluster_handle() {
+    auto *gsHandle =
+        dynamic_cast<ClusterHandle *>(this->handle->get_gs_handle());
+    if (!gsHandle) {
+      throw std::runtime_error(
+          "BsrGaussSeidel: GS handle has not been created for GS_CLUSTER.");
+    }
+    return gsHandle;
+  }
+
+  TwoStageHandle *get_twostage_handle() {
+    auto *gsHandle =
+        dynamic_cast<TwoStageHandle *>(this->handle->get_gs_handle());
+    if (!gsHandle) {
+      throw std::runtime_error(
+          "BsrGaussSeidel: GS handle has not been created for GS_TWOSTAGE.");
+    }
+    return gsHandle;
+  }
+
+  nnz_lno_t block_size() { return handle->get_gs_handle()->get_block_size(); }
+
+  // Threads per team and vector lanes per thread: the vector lanes cover the
+  // rows of one block, and on CPUs every team has a single thread.
+  void team_shape(nnz_lno_t &team_size, nnz_lno_t &vector_size) {
+    team_size   = 1;
+    vector_size = 1;
+    if (KokkosKernels::Impl::kk_is_gpu_exec_space<execution_space>()) {
+      const nnz_lno_t max_vector = team_policy_t::vector_length_max();
+      while (vector_size < block_size() && vector_size < max_vector)
+        vector_size *= 2;
+      team_size = 128 / vector_size;
+    }
+  }
+
+  template <class DiagView>
+  void invert_diagonal_blocks(const DiagView &invDiag) {
+    const nnz_lno_t bs = block_size();
+    DiagView lu(Kokkos::view_alloc(Kokkos::WithoutInitializing, "LU(D)"),
+                invDiag.extent(0));
+    nnz_lno_t numMissing = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::BsrGaussSeidel::invert_diagonal_blocks",
+        Kokkos::RangePolicy<execution_space>(0, num_rows),
+        BsrGSInvertDiagonalFunctor<const_lno_row_view_t, const_lno_nnz_view_t,
+                                   const_scalar_nnz_view_t, DiagView>(
+            row_map, entries, values, invDiag, lu, bs),
+        numMissing);
+    if (numMissing) {
+      std::ostringstream os;
+      os << "KokkosSparse::block_gauss_seidel_numeric: " << numMissing
+         << " block rows have no diagonal block";
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+  }
+
+  // y = beta * y + alpha * M * x over the blocks selected by part
+  template <class MValues, class XView, class YView>
+  void multiply(const MValues &M, const XView &x, const YView &y,
+                BsrGSPart part, scalar_t alpha, scalar_t beta) {
+    nnz_lno_t team_size, vector_size;
+    team_shape(team_size, vector_size);
+    BsrGSMultiplyFunctor<execution_space, const_lno_row_view_t,
+                         const_lno_nnz_view_t, MValues, XView, YView>
+        func(row_map, entries, M, x, y, num_rows, block_size(), team_size,
+             part, alpha, beta);
+    Kokkos::parallel_for(
+        "KokkosSparse::BsrGaussSeidel::multiply",
+        team_policy_t((num_rows + team_size - 1) / team_size, team_size,
+                      vector_size),
+        func);
+  }
+
+  // y = D^{-1} * x
+  template <class DiagView, class XView, class YView>
+  void block_diagonal(const DiagView &invDiag, const XView &x, const YView &y) {
+    nnz_lno_t team_size, vector_size;
+    team_shape(team_size, vector_size);
+    BsrGSBlockDiagonalFunctor<execution_space, DiagView, XView, YView> func(
+        invDiag, x, y, num_rows, block_size(), team_size);
+    Kokkos::parallel_for(
+        "KokkosSparse::BsrGaussSeidel::block_diagonal",
+        team_policy_t((num_rows + team_size - 1) / team_size, team_size,
+                      vector_size),
+        func);
+  }
+
+ public:
+  BsrGaussSeidel(HandleType *handle_, nnz_lno_t num_rows_, nnz_lno_t num_cols_,
+                 const_lno_row_view_t row_map_, const_lno_nnz_view_t entries_,
+                 bool is_symmetric_ = true)
+      : handle(handle_),
+        num_rows(num_rows_),
+        num_cols(num_cols_),
+        row_map(row_map_),
+        entries(entries_),
+        values(),
+        is_symmetric(is_symmetric_) {}
+
+  BsrGaussSeidel(HandleType *handle_, nnz_lno_t num_rows_, nnz_lno_t num_cols_,
+                 const_lno_row_view_t row_map_, const_lno_nnz_view_t entries_,
+                 const_scalar_nnz_view_t values_, bool is_symmetric_ = true)
+      : handle(handle_),
+        num_rows(num_rows_),
+        num_cols(num_cols_),
+        row_map(row_map_),
+        entries(entries_),
+        values(values_),
+        is_symmetric(is_symmetric_) {}
+
+  void initialize_symbolic() {
+    auto gsHandle = handle->get_gs_handle();
+    if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+      // clusters and colors only depend on the graph of the blocks
+      ClusterGaussSeidel<HandleType, const_lno_row_view_t, const_lno_nnz_view_t,
+                         const_scalar_nnz_view_t>
+          cgs(handle, num_rows, num_cols, row_map, entries, is_symmetric);
+      cgs.initialize_symbolic();
+    } else {
+      get_twostage_handle()->set_call_symbolic(true);
+    }
+  }
+
+  void initialize_numeric() {
+    auto gsHandle = handle->get_gs_handle();
+    if (!gsHandle->is_symbolic_called()) this->initialize_symbolic();
+    const nnz_lno_t bs         = block_size();
+    const size_t numDiagValues = size_t(num_rows) * bs * bs;
+    if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+      auto *cgsHandle = get_cluster_handle();
+      typename ClusterHandle::scalar_persistent_work_view_t invDiag(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "D^-1"),
+          numDiagValues);
+      invert_diagonal_blocks(invDiag);
+      cgsHandle->set_inverse_diagonal(invDiag);
+    } else {
+      auto *tsHandle = get_twostage_handle();
+      if (!tsHandle->isTwoStage()) {
+        throw std::invalid_argument(
+            " *** BsrGaussSeidel: block GS_TWOSTAGE needs inner "
+            "Jacobi-Richardson sweeps, classical GS (sptrsv) is not "
+            "supported ***\n");
+      }
+      using values_view_t = typename TwoStageHandle::values_view_t;
+      values_view_t invDiag(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "D^-1"),
+          numDiagValues);
+      invert_diagonal_blocks(invDiag);
+      // the diagonal blocks of DinvA are never read
+      values_view_t DinvA("D^-1 A", values.extent(0));
+      Kokkos::parallel_for(
+          "KokkosSparse::BsrGaussSeidel::scale_off_diagonal_blocks",
+          Kokkos::RangePolicy<execution_space>(0, num_rows),
+          BsrGSScaleOffDiagonalFunctor<const_lno_row_view_t,
+                                       const_lno_nnz_view_t,
+                                       const_scalar_nnz_view_t, values_view_t>(
+              row_map, entries, values, invDiag, DinvA, bs));
+      tsHandle->setD(invDiag);
+      tsHandle->setDinvA(DinvA);
+    }
+    gsHandle->set_call_numeric(true);
+  }
+
+  template <typename x_value_array_type, typename y_value_array_type>
+  void apply(x_value_array_type x_lhs_output_vec,
+             y_value_array_type y_rhs_input_vec,
+             bool init_zero_x_vector = false, int numIter = 1,
+             scalar_t omega        = Kokkos::ArithTraits<scalar_t>::one(),
+             bool apply_forward = true, bool apply_backward = true,
+             bool /*update_y_vector*/ = true) {
+    auto gsHandle = handle->get_gs_handle();
+    if (!gsHandle->is_numeric_called()) this->initialize_numeric();
+    if (init_zero_x_vector) {
+      KokkosKernels::Impl::zero_vector<x_value_array_type, execution_space>(
+          num_cols, x_lhs_output_vec);
+    }
+    if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+      apply_cluster(x_lhs_output_vec, y_rhs_input_vec, numIter, omega,
+                    apply_forward, apply_backward);
+    } else {
+      apply_twostage(x_lhs_output_vec, y_rhs_input_vec, init_zero_x_vector,
+                     numIter, omega, apply_forward, apply_backward);
+    }
+  }
+
+  template <typename x_value_array_type, typename y_value_array_type>
+  void apply_cluster(x_value_array_type x, y_value_array_type y, int numIter,
+                     scalar_t omega, bool apply_forward, bool apply_backward) {
+    auto *gsHandle          = get_cluster_handle();
+    const nnz_lno_t bs      = block_size();
+    const nnz_lno_t nColors = gsHandle->get_num_colors();
+    auto h_color_xadj       = gsHandle->get_color_xadj();
+    auto invDiag            = gsHandle->get_inverse_diagonal();
+
+    nnz_lno_t team_size, vector_size;
+    team_shape(team_size, vector_size);
+    using cluster_view_t =
+        typename ClusterHandle::nnz_lno_persistent_work_view_t;
+    using functor_t =
+        BsrClusterGSFunctor<execution_space, const_lno_row_view_t,
+                            const_lno_nnz_view_t, const_scalar_nnz_view_t,
+                            decltype(invDiag), cluster_view_t,
+                            x_value_array_type, y_value_array_type>;
+    functor_t gs(row_map, entries, values, invDiag, x, y,
+                 gsHandle->get_color_adj(), gsHandle->get_cluster_xadj(),
+                 gsHandle->get_cluster_adj(), bs, team_size, omega);
+    const size_t scratch = functor_t::scratch_view_t::shmem_size(bs);
+
+    auto sweep_color = [&](nnz_lno_t color) {
+      gs.colorSetBegin            = h_color_xadj(color);
+      gs.colorSetEnd              = h_color_xadj(color + 1);
+      const nnz_lno_t numClusters = gs.colorSetEnd - gs.colorSetBegin;
+      Kokkos::parallel_for(
+          "KokkosSparse::BsrGaussSeidel::cluster_sweep",
+          team_policy_t((numClusters + team_size - 1) / team_size, team_size,
+                        vector_size)
+              .set_scratch_size(0, Kokkos::PerThread(scratch)),
+          gs);
+    };
+    for (int iter = 0; iter < numIter; ++iter) {
+      if (apply_forward) {
+        gs.isBackward = false;
+        for (nnz_lno_t color = 0; color < nColors; ++color) sweep_color(color);
+      }
+      if (apply_backward) {
+        gs.isBackward = true;
+        for (nnz_lno_t color = nColors; color > 0; --color)
+          sweep_color(color - 1);
+      }
+    }
+  }
+
+  // Same iteration as TwostageGaussSeidel::apply (standard form), with the
+  // scalar diagonal replaced by the diagonal blocks.
+  template <typename x_value_array_type, typename y_value_array_type>
+  void apply_twostage(x_value_array_type localX, y_value_array_type localB,
+                      bool init_zero_x_vector, int numIter, scalar_t omega,
+                      bool apply_forward, bool apply_backward) {
+    const scalar_t one = Kokkos::ArithTraits<scalar_t>::one();
+    auto *gsHandle     = get_twostage_handle();
+    scalar_t gamma     = gsHandle->getInnerDampFactor();
+
+    GSDirection direction = gsHandle->getSweepDirection();
+    if (apply_forward && apply_backward) {
+      direction = GS_SYMMETRIC;
+    } else if (apply_forward) {
+      direction = GS_FORWARD;
+    } else if (apply_backward) {
+      direction = GS_BACKWARD;
+    } else {
+      return;
+    }
+
+    auto localD = gsHandle->getD();
+    auto DinvA  = gsHandle->getDinvA();
+    const int n = num_rows * block_size();
+    int nrhs    = localX.extent(1);
+    gsHandle->initVectors(n, nrhs);
+    auto localR = gsHandle->getVectorR();
+    auto localT = gsHandle->getVectorT();
+    auto localZ = gsHandle->getVectorZ();
+    auto localY = Kokkos::subview(localX, range_type(0, n), Kokkos::ALL());
+
+    int NumOuterSweeps = gsHandle->getNumOuterSweeps();
+    int NumInnerSweeps = gsHandle->getNumInnerSweeps();
+    int NumSweeps      = (NumOuterSweeps > numIter ? NumOuterSweeps : numIter);
+    if (direction == GS_SYMMETRIC) {
+      NumSweeps *= 2;
+    }
+    for (int sweep = 0; sweep < NumSweeps; ++sweep) {
+      bool forward_sweep = (direction == GS_FORWARD ||
+                            (direction == GS_SYMMETRIC && sweep % 2 == 0));
+      const BsrGSPart part =
+          forward_sweep ? BsrGSPart::Lower : BsrGSPart::Upper;
+      // R = B - A*x
+      KokkosBlas::scal(localR, one, localB);
+      if (sweep > 0 || !init_zero_x_vector) {
+        multiply(values, localX, localR, BsrGSPart::All, -one, one);
+      }
+      if (NumInnerSweeps == 0) {
+        // Z = gamma * D^{-1}*R, block Jacobi-Richardson
+        block_diagonal(localD, localR, localZ);
+        if (gamma != one) KokkosBlas::scal(localZ, gamma, localZ);
+      } else {
+        // T = D^{-1}*R, and R = gamma * T is the first inner iterate
+        block_diagonal(localD, localR, localT);
+        KokkosBlas::scal(localR, gamma, localT);
+      }
+      // inner Jacobi-Richardson: Z = T - omega * D^{-1}*L*R
+      for (int ii = 0; ii < NumInnerSweeps; ii++) {
+        KokkosBlas::scal(localZ, one, localT);
+        multiply(DinvA, localR, localZ, part, -omega, one);
+        if (gamma != one) {
+          // Z = gamma * Z + (1 - gamma) * R
+          KokkosBlas::axpby(one - gamma, localR, gamma, localZ);
+        }
+        if (ii + 1 < NumInnerSweeps) {
+          KokkosBlas::scal(localR, one, localZ);
+        }
+      }
+      // x = x + omega * Z
+      KokkosBlas::axpy(omega, localZ, localY);
+    }
+  }
+};
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_BSR_GAUSS_SEIDEL_IMPL_HPP_
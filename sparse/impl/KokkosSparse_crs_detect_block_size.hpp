@@ -16,104 +16,170 @@
 #ifndef KOKKOSSPARSE_CRS_DETECT_BLOCK_SIZE_HPP
 #define KOKKOSSPARSE_CRS_DETECT_BLOCK_SIZE_HPP
 
-#include <map>
+#include <algorithm>
+#include <cmath>
+#include <sstream>
+#include <vector>
 
 #include <Kokkos_Core.hpp>
+#include "KokkosKernels_Error.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
 #include "KokkosSparse_Utils.hpp"
 
 /*! \file KokkosSparse_crs_detect_block_size.hpp
 
-    \brief A utility function for detecting the block size in a CrsMatrix. Not
-   for performance-sensitive use.
+    \brief Utility functions for detecting the block size in a CrsMatrix. Block
+   populations are counted in parallel in the matrix's execution space.
 */
 
 namespace KokkosSparse::Impl {
 
 /**
- * \class BlockPopulations
- * \brief A class to store population counts of blocks in a CrsMatrix
+ * \struct BlockFill
+ * \brief Population statistics of the blocks of one size in a CrsMatrix
  */
-class BlockPopulations {
- public:
-  /**
-   * \brief Constructor for BlockPopulations
-   * \param sz The block size
-   */
-  BlockPopulations(size_t sz) : sz_(sz) {}
-
-  /**
-   * \brief Add a point to the corresponding block
-   * \param r The row index of the point
-   * \param c The column index of the point
-   */
-  void add(size_t r, size_t c) {
-    auto key = std::make_pair(r / sz_, c / sz_);
-    auto it  = blocks_.find(key);
-    if (it == blocks_.end()) {
-      blocks_.insert(std::make_pair(key, 1));
-    } else {
-      ++(it->second);
-    }
-  }
+struct BlockFill {
+  size_t blockSize     = 1; /**< The block size */
+  size_t numBlocks     = 0; /**< Number of blocks with at least one entry */
+  size_t minPopulation = 0; /**< Fewest entries in a non-empty block */
+  double fillRatio     = 1; /**< Entries over numBlocks * blockSize^2 */
 
   /**
    * \brief Check if all blocks are dense
-   * \return True if all blocks have a count equal to the block size squared
+   * \return True if every non-empty block holds blockSize squared entries
    */
   bool all_dense() const {
-    for (const auto &kv : blocks_) {
-      if (kv.second < sz_ * sz_) {
-        return false;
-      }
-    }
-    return true;
+    return numBlocks == 0 || minPopulation == blockSize * blockSize;
   }
-
- private:
-  std::map<std::pair<size_t, size_t>, size_t>
-      blocks_; /**< A map of block coordinates to their population counts */
-  size_t sz_;  /**< The block size */
 };
 
 /**
- * @brief Detects the largest block size that yields only dense blocks in a
+ * \brief Count the blocks of size \c blockSize that hold entries of a
  CrsMatrix
  *
+ * The block columns of the entries of each block row are sorted with
+ sort_crs_graph, so that every run of equal block columns is one block and its
+ length is the block's population. This costs one pass over the entries plus a
+ segmented sort. Duplicate entries are counted as separate entries.
+ *
+ * @tparam Crs The type of the CRS matrix.
+ * @param crs The CRS matrix.
+ * @param blockSize The trial block size. Trailing block rows and columns may be
+ partial if it does not divide the matrix dimensions.
+ * @return The number of non-empty blocks, their smallest population and the
+ fill ratio, i.e. the fraction of stored values that would not be padding
+ */
+template <typename Crs>
+BlockFill block_fill(const Crs &crs, size_t blockSize) {
+  using execution_space = typename Crs::execution_space;
+  using device_type     = typename Crs::device_type;
+  using ordinal_type    = typename Crs::non_const_ordinal_type;
+  using size_type       = typename Crs::non_const_size_type;
+  using policy_type     = Kokkos::RangePolicy<execution_space>;
+
+  const ordinal_type bs           = blockSize;
+  const ordinal_type numRows      = crs.numRows();
+  const ordinal_type numBlockRows = (numRows + bs - 1) / bs;
+  auto rowMap                     = crs.graph.row_map;
+  auto entries                    = crs.graph.entries;
+
+  // the entries of a block row are contiguous in the Crs matrix
+  Kokkos::View<size_type *, device_type> blockRowMap(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "blockRowMap"),
+      numBlockRows + 1);
+  Kokkos::View<ordinal_type *, device_type> blockCols(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "blockCols"),
+      entries.extent(0));
+  Kokkos::parallel_for(
+      "block_fill: block row map", policy_type(0, numBlockRows + 1),
+      KOKKOS_LAMBDA(ordinal_type b) {
+        blockRowMap(b) = rowMap(b < numBlockRows ? b * bs : numRows);
+      });
+  Kokkos::parallel_for(
+      "block_fill: block columns", policy_type(0, entries.extent(0)),
+      KOKKOS_LAMBDA(size_t i) { blockCols(i) = entries(i) / bs; });
+  KokkosSparse::sort_crs_graph(execution_space(), blockRowMap, blockCols);
+
+  BlockFill fill;
+  fill.blockSize       = blockSize;
+  size_t minPopulation = 0;
+  Kokkos::parallel_reduce(
+      "block_fill: populations", policy_type(0, numBlockRows),
+      KOKKOS_LAMBDA(ordinal_type b, size_t& numBlocks, size_t& minPop) {
+        const size_type begin = blockRowMap(b);
+        const size_type end   = blockRowMap(b + 1);
+        for (size_type i = begin; i < end;) {
+          size_type runEnd = i + 1;
+          while (runEnd < end && blockCols(runEnd) == blockCols(i)) ++runEnd;
+          ++numBlocks;
+          if (runEnd - i < minPop) minPop = runEnd - i;
+          i = runEnd;
+        }
+      },
+      Kokkos::Sum<size_t>(fill.numBlocks), Kokkos::Min<size_t>(minPopulation));
+  if (fill.numBlocks > 0) {
+    fill.minPopulation = minPopulation;
+    fill.fillRatio =
+        double(crs.nnz()) / (double(fill.numBlocks) * blockSize * blockSize);
+  }
+  return fill;
+}
+
+/**
+ * @brief Detects the largest block size whose blocks are filled to at least
+ the requested ratio in a CrsMatrix
+ *
  * @tparam Crs The type of the CRS matrix.
  * @param crs The CRS matrix to detect the block size for.
- * @return The largest block size that results in completely dense blocks
+ * @param minFillRatio The smallest acceptable fraction of non-padding values
+ in the blocks. The default of 1 only accepts completely dense blocks. Throws
+ if it is not in (0, 1].
+ * @return The largest block size that satisfies \c minFillRatio
     The smallest valid block size is 1
     Since blocks must be dense, sqrt(nnz), num rows, num cols, and min nnz/row
- among non-empty rows are all easy upper bounds of the block size.
+ among non-empty rows are all easy upper bounds of the block size. With padding
+ the bound is sqrt(nnz / minFillRatio) instead of sqrt(nnz) and min nnz/row no
+ longer applies.
  Block sizes are tested from 1 to the minimum of the above.
  The matrix dimensions must divide  evenly into a trial block size (otherwise a
- block would not be full). Furthermore, if a block size of N is not dense, any
- multiple of N will also not be dense, and can be skipped. This is because
- blocks of 2N contain blocks of N, at least one of which is already known not to
- be dense. In practice, this ends up testing only small composite factors and
- all prime factors up to the upper bound.
+ block would not be full). Furthermore, if a block size of N is not filled
+ enough, any multiple of N will not be either, and can be skipped. This is
+ because blocks of kN cover at most k^2 times as many values as blocks of N and
+ contain all of the same entries. In practice, this ends up testing only small
+ composite factors and all prime factors up to the upper bound.
 */
 template <typename Crs>
-size_t detect_block_size(const Crs &crs) {
-  using ordinal_type = typename Crs::ordinal_type;
-
-  // copy matrix data to host
-  auto rs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
-                                                crs.graph.row_map);
-  auto cs = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
-                                                crs.graph.entries);
-
-  // upper bound is minimum of sqrt(nnz), numRows, numCols,
-  // and smallest non-empty row
-  size_t upperBound = std::sqrt(double(crs.nnz()));
+size_t detect_block_size(const Crs &crs, double minFillRatio = 1.0) {
+  using execution_space = typename Crs::execution_space;
+  using ordinal_type    = typename Crs::non_const_ordinal_type;
+
+  // also rejects NaN
+  if (!(minFillRatio > 0.0 && minFillRatio <= 1.0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::Impl::detect_block_size: minFillRatio must be in "
+          "(0, 1], got "
+       << minFillRatio;
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+
+  // upper bound is minimum of sqrt(nnz / minFillRatio), numRows, numCols,
+  // and, for dense blocks, smallest non-empty row
+  size_t upperBound = std::sqrt(double(crs.nnz()) / minFillRatio);
   upperBound        = std::min(upperBound, size_t(crs.numRows()));
   upperBound        = std::min(upperBound, size_t(crs.numCols()));
-  for (size_t i = 1; i < rs.size(); ++i) {
-    size_t rowLen = rs(i) - rs(i - 1);
-    if (rowLen > 0) {
-      upperBound = std::min(upperBound, rowLen);
-    }
+  if (minFillRatio >= 1.0) {
+    auto rowMap   = crs.graph.row_map;
+    size_t minLen = upperBound;
+    Kokkos::parallel_reduce(
+        "detect_block_size: min row length",
+        Kokkos::RangePolicy<execution_space>(0, crs.numRows()),
+        KOKKOS_LAMBDA(ordinal_type i, size_t& update) {
+          const size_t rowLen = rowMap(i + 1) - rowMap(i);
+          if (rowLen > 0 && rowLen < update) update = rowLen;
+        },
+        Kokkos::Min<size_t>(minLen));
+    upperBound = std::min(upperBound, minLen);
   }
 
   // trial blocks sizes that didn't work out
@@ -135,16 +201,13 @@ size_t detect_block_size(const Crs &crs) {
     }
 
     // count the population of all blocks
-    BlockPopulations pops(trialSize);
-    for (ordinal_type row = 0; row < crs.numRows(); ++row) {
-      for (size_t ci = rs(row); ci < rs(row + 1); ++ci) {
-        ordinal_type col = cs(ci);
-        pops.add(row, col);
-      }
-    }
+    const BlockFill fill = block_fill(crs, trialSize);
 
-    // if all blocks are dense, this is the largest one so far
-    if (pops.all_dense()) {
+    // if the blocks are filled enough, this is the largest one so far
+    const bool accepted = minFillRatio >= 1.0
+                              ? fill.all_dense()
+                              : fill.fillRatio >= minFillRatio;
+    if (accepted) {
       largestBlockSize = trialSize;
     } else {
       rejectedSizes.push_back(trialSize);
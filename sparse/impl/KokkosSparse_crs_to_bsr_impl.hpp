@@ -1,7 +1,31 @@
-namespace KokkosSparse {
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_CRS_TO_BSR_IMPL_HPP
+#define KOKKOSSPARSE_CRS_TO_BSR_IMPL_HPP
+
+#include <sstream>
+#include <stdexcept>
 
 #include "KokkosSparse_BsrMatrix.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_SortCrs.hpp"
+#include "KokkosKernels_SimpleUtils.hpp"
+
+namespace KokkosSparse {
 
 namespace Impl {
 
@@ -93,46 +117,129 @@ Bsr expand_crs_to_bsr(const Crs &crs, size_t blockSize) {
   return bsr;
 }  // expand_crs_to_bsr
 
-/*! \brief convert a crs already in block format to a Bsr matrix
- */
+/*! \brief Convert a Crs matrix to a Bsr matrix with the given block size
+    Blocks that are only partially populated are padded with explicit zeros.
+    The conversion runs in parallel in the Bsr execution space: the block
+    columns of each block row are sorted to find the distinct blocks, and every
+    Crs entry then finds its block by binary search. The scalar, ordinal, and
+    device types of the two matrices do not need to be compatible.
+*/
 template <typename Bsr, typename Crs>
-Bsr blocked_crs_to_bsr(const Crs &crs, size_t blockSize) {
-  using bsr_value_type   = typename Bsr::value_type;
-  using bsr_ordinal_type = typename Bsr::ordinal_type;
-
-  // copy matrix data to host
-  auto hRowMap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
-                                                     crs.graph.row_map);
-  auto hColInds = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
-                                                      crs.graph.entries);
-  auto hVals =
-      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), crs.values);
-  Kokkos::fence();
-
-  // construct COO data on host
-  std::vector<bsr_value_type> vals;
-  std::vector<bsr_ordinal_type> rows, cols;
-
-  vals.reserve(crs.nnz());
-  rows.reserve(crs.nnz());
-  cols.reserve(crs.nnz());
-
-  for (bsr_ordinal_type row = 0; row < bsr_ordinal_type(hRowMap.size()) - 1;
-       ++row) {
-    for (size_t ci = hRowMap(row); ci < hRowMap(row + 1); ++ci) {
-      bsr_ordinal_type col = hColInds(ci);
-      bsr_value_type val   = hVals(ci);
-
-      rows.push_back(row);
-      cols.push_back(col);
-      vals.push_back(val);
-    }
+Bsr crs_to_bsr(const Crs &crs, size_t blockSize) {
+  using bsr_device_type     = typename Bsr::device_type;
+  using bsr_execution_space = typename Bsr::execution_space;
+  using bsr_memory_space    = typename Bsr::memory_space;
+  using bsr_ordinal_type    = typename Bsr::non_const_ordinal_type;
+  using bsr_size_type       = typename Bsr::non_const_size_type;
+  using bsr_value_type      = typename Bsr::non_const_value_type;
+  using bsr_values_type     = typename Bsr::values_type;
+  using bsr_index_type      = typename Bsr::index_type;
+  using bsr_row_map_type =
+      Kokkos::View<typename Bsr::row_map_type::non_const_data_type,
+                   bsr_device_type>;  // need non-const version
+  using policy_type = Kokkos::RangePolicy<bsr_execution_space>;
+
+  if (blockSize == 0 || crs.numRows() % blockSize ||
+      crs.numCols() % blockSize) {
+    std::stringstream ss;
+    ss << "crs_to_bsr: block size " << blockSize
+       << " does not divide the dimensions " << crs.numRows() << " x "
+       << crs.numCols() << " of the CrsMatrix";
+    throw std::runtime_error(ss.str());
   }
+  const bsr_ordinal_type bs           = blockSize;
+  const bsr_ordinal_type numBlockRows = crs.numRows() / bs;
+  const bsr_ordinal_type numBlockCols = crs.numCols() / bs;
+
+  // Crs data in the Bsr memory space
+  auto rowMap  = Kokkos::create_mirror_view_and_copy(bsr_memory_space(),
+                                                    crs.graph.row_map);
+  auto entries = Kokkos::create_mirror_view_and_copy(bsr_memory_space(),
+                                                     crs.graph.entries);
+  auto vals =
+      Kokkos::create_mirror_view_and_copy(bsr_memory_space(), crs.values);
+
+  // block column of every entry, grouped and sorted by block row
+  bsr_row_map_type blockRowMap(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "blockRowMap"),
+      numBlockRows + 1);
+  bsr_index_type blockCols(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "blockCols"),
+      entries.extent(0));
+  Kokkos::parallel_for(
+      "crs_to_bsr: block row map", policy_type(0, numBlockRows + 1),
+      KOKKOS_LAMBDA(bsr_ordinal_type b) { blockRowMap(b) = rowMap(b * bs); });
+  Kokkos::parallel_for(
+      "crs_to_bsr: block columns", policy_type(0, entries.extent(0)),
+      KOKKOS_LAMBDA(size_t i) { blockCols(i) = entries(i) / bs; });
+  KokkosSparse::sort_crs_graph(bsr_execution_space(), blockRowMap, blockCols);
+
+  // count the distinct blocks of each block row
+  bsr_row_map_type bsrRowMap("bsrRowMap", numBlockRows + 1);
+  Kokkos::parallel_for(
+      "crs_to_bsr: count blocks", policy_type(0, numBlockRows),
+      KOKKOS_LAMBDA(bsr_ordinal_type b) {
+        bsr_size_type count = 0;
+        for (bsr_size_type i = blockRowMap(b); i < blockRowMap(b + 1); ++i) {
+          if (i == blockRowMap(b) || blockCols(i) != blockCols(i - 1)) ++count;
+        }
+        bsrRowMap(b) = count;
+      });
+  KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum<bsr_execution_space>(
+      numBlockRows + 1, bsrRowMap);
+  bsr_size_type numBlocks = 0;
+  Kokkos::deep_copy(numBlocks, Kokkos::subview(bsrRowMap, numBlockRows));
+
+  // construct the BSR col indices
+  bsr_index_type bsrIndices(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "bsrIndices"), numBlocks);
+  Kokkos::parallel_for(
+      "crs_to_bsr: block indices", policy_type(0, numBlockRows),
+      KOKKOS_LAMBDA(bsr_ordinal_type b) {
+        bsr_size_type out = bsrRowMap(b);
+        for (bsr_size_type i = blockRowMap(b); i < blockRowMap(b + 1); ++i) {
+          if (i == blockRowMap(b) || blockCols(i) != blockCols(i - 1))
+            bsrIndices(out++) = blockCols(i);
+        }
+      });
+
+  // scatter the values, one Crs row per thread so that duplicates are summed
+  // without atomics
+  bsr_values_type bsrVals("bsrVals", numBlocks * bs * bs);
+  Kokkos::parallel_for(
+      "crs_to_bsr: values", policy_type(0, crs.numRows()),
+      KOKKOS_LAMBDA(bsr_ordinal_type row) {
+        const bsr_ordinal_type b  = row / bs;
+        const bsr_ordinal_type lr = row % bs;
+        for (bsr_size_type i = rowMap(row); i < rowMap(row + 1); ++i) {
+          const bsr_ordinal_type col = entries(i);
+          const bsr_ordinal_type bc  = col / bs;
+          // lower bound of bc among the sorted block columns of b
+          bsr_size_type lo = bsrRowMap(b), hi = bsrRowMap(b + 1);
+          while (lo < hi) {
+            const bsr_size_type mid = lo + (hi - lo) / 2;
+            if (bsrIndices(mid) < bc)
+              lo = mid + 1;
+            else
+              hi = mid;
+          }
+          bsrVals(lo * bs * bs + lr * bs + col % bs) += bsr_value_type(vals(i));
+        }
+      });
 
-  Bsr bsr("", crs.numRows(), crs.numCols(), crs.nnz(), vals.data(), rows.data(),
-          cols.data(), blockSize);
+  Bsr bsr("", numBlockRows, numBlockCols, numBlocks, bsrVals, bsrRowMap,
+          bsrIndices, bs);
   return bsr;
-}  // expand_crs_to_bsr
+}  // crs_to_bsr
+
+/*! \brief convert a crs already in block format to a Bsr matrix
+ */
+template <typename Bsr, typename Crs>
+Bsr blocked_crs_to_bsr(const Crs &crs, size_t blockSize) {
+  return crs_to_bsr<Bsr>(crs, blockSize);
+}  // blocked_crs_to_bsr
 
 }  // namespace Impl
 }  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_CRS_TO_BSR_IMPL_HPP
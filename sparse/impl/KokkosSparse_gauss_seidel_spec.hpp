@@ -26,6 +26,7 @@
 #include "KokkosSparse_gauss_seidel_impl.hpp"
 #include "KokkosSparse_cluster_gauss_seidel_impl.hpp"
 #include "KokkosSparse_twostage_gauss_seidel_impl.hpp"
+#include "KokkosSparse_bsr_gauss_seidel_impl.hpp"
 #endif
 
 namespace KokkosSparse {
@@ -194,7 +195,13 @@ struct GAUSS_SEIDEL_SYMBOLIC<ExecSpaceIn, KernelHandle, a_size_view_t_,
     Kokkos::Profiling::pushRegion("KokkosSparse::Impl::gauss_seidel_symbolic");
     auto gsHandle = handle->get_gs_handle();
     gsHandle->set_execution_space(exec_space_in);
-    if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+    if (use_bsr_gauss_seidel(gsHandle)) {
+      using SGS = typename Impl::BsrGaussSeidel<
+          KernelHandle, a_size_view_t_, a_lno_view_t_,
+          typename KernelHandle::in_scalar_nnz_view_t>;
+      SGS sgs(handle, num_rows, num_cols, row_map, entries, is_graph_symmetric);
+      sgs.initialize_symbolic();
+    } else if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
       using SGS = typename Impl::ClusterGaussSeidel<
           KernelHandle, a_size_view_t_, a_lno_view_t_,
           typename KernelHandle::in_scalar_nnz_view_t>;
@@ -231,7 +238,18 @@ struct GAUSS_SEIDEL_NUMERIC<ExecSpaceIn, KernelHandle, format, a_size_view_t_,
     Kokkos::Profiling::pushRegion("KokkosSparse::Impl::gauss_seidel_numeric");
     auto gsHandle = handle->get_gs_handle();
     gsHandle->set_execution_space(exec_space_in);
-    if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+    if (use_bsr_gauss_seidel(gsHandle)) {
+      if (format != KokkosSparse::SparseMatrixFormat::BSR) {
+        throw std::runtime_error(
+            "Block Gauss-Seidel with GS_CLUSTER or GS_TWOSTAGE requires the "
+            "BSR format");
+      }
+      using SGS = typename Impl::BsrGaussSeidel<KernelHandle, a_size_view_t_,
+                                                a_lno_view_t, a_scalar_view_t>;
+      SGS sgs(handle, num_rows, num_cols, row_map, entries, values,
+              is_graph_symmetric);
+      sgs.initialize_numeric();
+    } else if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
       using SGS =
           typename Impl::ClusterGaussSeidel<KernelHandle, a_size_view_t_,
                                             a_lno_view_t, a_scalar_view_t>;
@@ -309,7 +327,18 @@ struct GAUSS_SEIDEL_APPLY<ExecSpaceIn, KernelHandle, format, a_size_view_t_,
     Kokkos::Profiling::pushRegion("KokkosSparse::Impl::gauss_seidel_apply");
     auto gsHandle = handle->get_gs_handle();
     gsHandle->set_execution_space(exec_space_in);
-    if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+    if (use_bsr_gauss_seidel(gsHandle)) {
+      if (format != KokkosSparse::SparseMatrixFormat::BSR) {
+        throw std::runtime_error(
+            "Block Gauss-Seidel with GS_CLUSTER or GS_TWOSTAGE requires the "
+            "BSR format");
+      }
+      using SGS = typename Impl::BsrGaussSeidel<KernelHandle, a_size_view_t_,
+                                                a_lno_view_t, a_scalar_view_t>;
+      SGS sgs(handle, num_rows, num_cols, row_map, entries, values);
+      sgs.apply(x_lhs_output_vec, y_rhs_input_vec, init_zero_x_vector, numIter,
+                omega, apply_forward, apply_backward, update_y_vector);
+    } else if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
       using SGS =
           typename Impl::ClusterGaussSeidel<KernelHandle, a_size_view_t_,
                                             a_lno_view_t, a_scalar_view_t>;
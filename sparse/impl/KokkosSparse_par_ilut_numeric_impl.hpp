@@ -121,14 +121,17 @@ struct IlutWrap {
     Kokkos::resize(t_entries, entries.extent(0));
     Kokkos::resize(t_values, values.extent(0));
 
-    KokkosSparse::Impl::transpose_matrix<
+    // The rows of the deterministic transpose are sorted, no need to sort
+    // the output
+    HandleDeviceRowMapType perm(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "perm"),
+        entries.extent(0));
+    KokkosSparse::Impl::transpose_matrix_with_permutation<
         HandleDeviceRowMapType, HandleDeviceEntriesType, HandleDeviceValueType,
         HandleDeviceRowMapType, HandleDeviceEntriesType, HandleDeviceValueType,
-        HandleDeviceRowMapType, execution_space>(
-        nrows, nrows, row_map, entries, values, t_row_map, t_entries, t_values);
-
-    // Need to ensure output is sorted
-    sort_crs_matrix<execution_space>(t_row_map, t_entries, t_values);
+        HandleDeviceRowMapType, execution_space>(nrows, nrows, row_map, entries,
+                                                 values, t_row_map, t_entries,
+                                                 t_values, perm);
   }
 
   /**
@@ -542,12 +542,16 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
       Kokkos::view_alloc(Kokkos::WithoutInitializing, "transpose_col_values"),
       entriesA.extent(0));
 
-  KokkosSparse::Impl::transpose_matrix<
+  row_lno_temp_work_view_t transpose_perm(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "transpose_perm"),
+      entriesA.extent(0));
+
+  KokkosSparse::Impl::transpose_matrix_with_permutation<
       const_a_lno_row_view_t, const_a_lno_nnz_view_t, const_a_scalar_nnz_view_t,
       row_lno_temp_work_view_t, nnz_lno_temp_work_view_t,
       scalar_temp_work_view_t, row_lno_temp_work_view_t, MyExecSpace>(
       a_row_cnt, b_row_cnt, row_mapA, entriesA, valsA, transpose_col_xadj,
-      transpose_col_adj, tranpose_vals);
+      transpose_col_adj, tranpose_vals, transpose_perm);
 
   MyExecSpace().fence();
   if (KOKKOSKERNELS_VERBOSE) {
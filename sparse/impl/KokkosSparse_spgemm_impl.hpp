@@ -450,6 +450,24 @@ class KokkosSPGEMM {
       c_row_view_t rowmapC_, c_lno_nnz_view_t entriesC_,
       c_scalar_nnz_view_t valuesC_,
       KokkosKernels::Impl::ExecSpaceType my_exec_space);
+
+ public:
+  //////////////////////////////////////////////////////////////////////////
+  /////BELOW CODE IS TO for row binned kkmem SPGEMM
+  ////DECL IS AT _binned.hpp
+  //////////////////////////////////////////////////////////////////////////
+  template <typename c_row_view_t, typename c_nnz_view_t,
+            typename c_scalar_view_t, typename pool_memory_type>
+  struct PortableNumericBinned;
+
+ private:
+  // Groups the rows of C by their flops and output size, and computes each
+  // group with its own accumulator. Requires the row flops of the handle.
+  template <typename c_row_view_t, typename c_lno_nnz_view_t,
+            typename c_scalar_nnz_view_t>
+  void KokkosSPGEMM_numeric_binned(c_row_view_t rowmapC_,
+                                   c_lno_nnz_view_t entriesC_,
+                                   c_scalar_nnz_view_t valuesC_);
 #if defined(KOKKOS_ENABLE_OPENMP)
 #ifdef KOKKOSKERNELS_HAVE_OUTER
  public:
@@ -844,6 +862,7 @@ class KokkosSPGEMM {
 #include "KokkosSparse_spgemm_imp_outer.hpp"
 #include "KokkosSparse_spgemm_impl_memaccess.hpp"
 #include "KokkosSparse_spgemm_impl_kkmem.hpp"
+#include "KokkosSparse_spgemm_impl_binned.hpp"
 #include "KokkosSparse_spgemm_impl_speed.hpp"
 #include "KokkosSparse_spgemm_impl_compression.hpp"
 #include "KokkosSparse_spgemm_impl_def.hpp"
@@ -0,0 +1,466 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#include "KokkosKernels_Utils.hpp"
+#include "KokkosKernels_SizeClass_MemoryPool.hpp"
+
+namespace KokkosSparse {
+
+namespace Impl {
+
+// Numeric phase of KKMEM with the rows grouped by their work. Each group is
+// computed by its own launch with the accumulator that suits it:
+//   - tiny rows (flops <= tiny_row_flops): one thread per row, the products
+//     are merged by insertion into small sorted arrays,
+//   - medium rows (output fits a shared memory hashmap): one vector per row,
+//     each thread of a team has its own hashmap in team scratch and its
+//     keys/values are the row of C,
+//   - huge rows: same as medium, with the hashmap in global memory taken from
+//     a size-class pool, so that each row gets a chunk proportional to its
+//     output size instead of the size of the largest row.
+// Like PortableNumericCHASH, a team of the medium and huge launches computes
+// team_work_size consecutive rows of the bin spread over its threads.
+template <typename HandleType, typename a_row_view_t_,
+          typename a_lno_nnz_view_t_, typename a_scalar_nnz_view_t_,
+          typename b_lno_row_view_t_, typename b_lno_nnz_view_t_,
+          typename b_scalar_nnz_view_t_>
+template <typename c_row_view_t, typename c_nnz_view_t,
+          typename c_scalar_view_t, typename pool_memory_type>
+struct KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
+                    a_scalar_nnz_view_t_, b_lno_row_view_t_, b_lno_nnz_view_t_,
+                    b_scalar_nnz_view_t_>::PortableNumericBinned {
+  struct BinTag {};
+  struct RequestTag {};
+  struct TinyTag {};
+  struct MediumTag {};
+  struct HugeTag {};
+
+  // rows with at most this many flops are merged in registers
+  static constexpr nnz_lno_t tiny_row_flops = 16;
+
+  typedef Kokkos::View<size_t *, MyTempMemorySpace> request_view_t;
+
+  const_a_lno_row_view_t row_mapA;
+  const_a_lno_nnz_view_t entriesA;
+  const_a_scalar_nnz_view_t valuesA;
+
+  const_b_lno_row_view_t row_mapB;
+  const_b_lno_nnz_view_t entriesB;
+  const_b_scalar_nnz_view_t valuesB;
+
+  c_row_view_t rowmapC;
+  c_nnz_view_t entriesC;
+  c_scalar_view_t valuesC;
+
+  nnz_lno_t *pEntriesC;
+  scalar_t *pvaluesC;
+
+  row_lno_persistent_work_view_t flops_per_row;
+  const nnz_lno_t medium_hash_size;
+  // scratch of one thread of the medium launch
+  const size_t medium_shmem_size;
+  const nnz_lno_t team_work_size;
+
+  // rows grouped by bin, the launches read [bin_begin, bin_begin + bin_size)
+  nnz_lno_temp_work_view_t binned_rows;
+  nnz_lno_t bin_begin;
+  nnz_lno_t bin_size;
+  int bin;
+
+  // pool request of each huge row
+  request_view_t requests;
+  pool_memory_type memory_space;
+
+  PortableNumericBinned(
+      const_a_lno_row_view_t row_mapA_, const_a_lno_nnz_view_t entriesA_,
+      const_a_scalar_nnz_view_t valuesA_,
+
+      const_b_lno_row_view_t row_mapB_, const_b_lno_nnz_view_t entriesB_,
+      const_b_scalar_nnz_view_t valuesB_,
+
+      c_row_view_t rowmapC_, c_nnz_view_t entriesC_, c_scalar_view_t valuesC_,
+      row_lno_persistent_work_view_t flops_per_row_,
+      nnz_lno_t medium_hash_size_, nnz_lno_t team_work_size_,
+      nnz_lno_t num_rows)
+      : row_mapA(row_mapA_),
+        entriesA(entriesA_),
+        valuesA(valuesA_),
+
+        row_mapB(row_mapB_),
+        entriesB(entriesB_),
+        valuesB(valuesB_),
+
+        rowmapC(rowmapC_),
+        entriesC(entriesC_),
+        valuesC(valuesC_),
+        pEntriesC(entriesC_.data()),
+        pvaluesC(valuesC_.data()),
+        flops_per_row(flops_per_row_),
+        medium_hash_size(medium_hash_size_),
+        medium_shmem_size(sizeof(nnz_lno_t) * (2 + 2 * medium_hash_size_)),
+        team_work_size(team_work_size_),
+        binned_rows(
+            Kokkos::view_alloc(Kokkos::WithoutInitializing, "binned rows"),
+            num_rows),
+        bin_begin(0),
+        bin_size(0),
+        bin(0),
+        requests(),
+        memory_space() {}
+
+  KOKKOS_INLINE_FUNCTION
+  static nnz_lno_t get_hash_size(const nnz_lno_t row_size) {
+    nnz_lno_t hash_size = 1;
+    while (hash_size < row_size) hash_size *= 2;
+    return hash_size;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  int get_bin(const nnz_lno_t row_index) const {
+    if (flops_per_row(row_index) <= size_type(tiny_row_flops)) return 0;
+    const nnz_lno_t c_row_size =
+        rowmapC(row_index + 1) - rowmapC(row_index);
+    return c_row_size <= medium_hash_size ? 1 : 2;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const BinTag &, const nnz_lno_t row_index,
+                  nnz_lno_t &update, const bool final) const {
+    if (get_bin(row_index) == bin) {
+      if (final) binned_rows(bin_begin + update) = row_index;
+      ++update;
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const RequestTag &, const nnz_lno_t ii) const {
+    const nnz_lno_t row_index = binned_rows(bin_begin + ii);
+    const nnz_lno_t c_row_size =
+        rowmapC(row_index + 1) - rowmapC(row_index);
+    // hash begins and nexts
+    requests(ii) = get_hash_size(c_row_size) + c_row_size;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const TinyTag &, const nnz_lno_t ii) const {
+    const nnz_lno_t row_index = binned_rows(bin_begin + ii);
+
+    nnz_lno_t keys[tiny_row_flops];
+    scalar_t vals[tiny_row_flops];
+    nnz_lno_t used_size = 0;
+
+    for (size_type a_col = row_mapA[row_index];
+         a_col < row_mapA[row_index + 1]; ++a_col) {
+      const nnz_lno_t rowB = entriesA[a_col];
+      const scalar_t valA  = valuesA[a_col];
+      for (size_type adjind = row_mapB[rowB]; adjind < row_mapB[rowB + 1];
+           ++adjind) {
+        const nnz_lno_t b_col_ind = entriesB[adjind];
+        const scalar_t b_val      = valuesB[adjind] * valA;
+
+        // insert into the sorted keys, merging the duplicates
+        nnz_lno_t pos = used_size;
+        while (pos > 0 && keys[pos - 1] > b_col_ind) --pos;
+        if (pos > 0 && keys[pos - 1] == b_col_ind) {
+          vals[pos - 1] += b_val;
+        } else {
+          for (nnz_lno_t i = used_size; i > pos; --i) {
+            keys[i] = keys[i - 1];
+            vals[i] = vals[i - 1];
+          }
+          keys[pos] = b_col_ind;
+          vals[pos] = b_val;
+          ++used_size;
+        }
+      }
+    }
+
+    const size_type c_row_begin = rowmapC[row_index];
+    for (nnz_lno_t i = 0; i < used_size; ++i) {
+      pEntriesC[c_row_begin + i] = keys[i];
+      pvaluesC[c_row_begin + i]  = vals[i];
+    }
+  }
+
+  // Accumulates the row with the vector lanes of the thread. The keys and
+  // values of the hashmap are the row of C, begins and nexts must hold
+  // get_hash_size(row size) and row size entries.
+  KOKKOS_INLINE_FUNCTION
+  void accumulate_row(const team_member_t &teamMember,
+                      const nnz_lno_t row_index, nnz_lno_t *begins,
+                      nnz_lno_t *nexts, volatile nnz_lno_t *used_size) const {
+    const size_type c_row_begin = rowmapC[row_index];
+    const nnz_lno_t c_row_size  = rowmapC[row_index + 1] - c_row_begin;
+    const nnz_lno_t hash_size   = get_hash_size(c_row_size);
+
+    KokkosKernels::Experimental::HashmapAccumulator<
+        nnz_lno_t, nnz_lno_t, scalar_t,
+        KokkosKernels::Experimental::HashOpType::bitwiseAnd>
+        hm(c_row_size, hash_size - 1, begins, nexts, pEntriesC + c_row_begin,
+           pvaluesC + c_row_begin);
+
+    // initialize begins.
+    Kokkos::parallel_for(Kokkos::ThreadVectorRange(teamMember, hash_size),
+                         [&](nnz_lno_t i) { begins[i] = -1; });
+    Kokkos::single(Kokkos::PerThread(teamMember), [&]() { used_size[0] = 0; });
+
+    const size_type col_begin = row_mapA[row_index];
+    const nnz_lno_t left_work = row_mapA[row_index + 1] - col_begin;
+    for (nnz_lno_t ii = 0; ii < left_work; ++ii) {
+      const size_type a_col = col_begin + ii;
+      const nnz_lno_t rowB  = entriesA[a_col];
+      const scalar_t valA   = valuesA[a_col];
+
+      const size_type rowBegin   = row_mapB(rowB);
+      const nnz_lno_t left_work_ = row_mapB(rowB + 1) - rowBegin;
+      // columns of a row of B are unique, the lanes never insert the same key
+      Kokkos::parallel_for(
+          Kokkos::ThreadVectorRange(teamMember, left_work_), [&](nnz_lno_t i) {
+            const size_type adjind = i + rowBegin;
+            hm.vector_atomic_insert_into_hash_mergeAdd(
+                entriesB[adjind], valuesB[adjind] * valA, used_size);
+          });
+    }
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const MediumTag &, const team_member_t &teamMember) const {
+    const nnz_lno_t team_row_begin = teamMember.league_rank() * team_work_size;
+    const nnz_lno_t team_row_end =
+        KOKKOSKERNELS_MACRO_MIN(team_row_begin + team_work_size, bin_size);
+
+    char *all_shared_memory = (char *)(teamMember.team_shmem().get_shmem(
+        medium_shmem_size * teamMember.team_size()));
+
+    // shift it to the thread private part
+    all_shared_memory += medium_shmem_size * teamMember.team_rank();
+
+    volatile nnz_lno_t *used_size = (volatile nnz_lno_t *)(all_shared_memory);
+    all_shared_memory += sizeof(nnz_lno_t) * 2;
+
+    nnz_lno_t *begins = (nnz_lno_t *)(all_shared_memory);
+    all_shared_memory += sizeof(nnz_lno_t) * medium_hash_size;
+
+    nnz_lno_t *nexts = (nnz_lno_t *)(all_shared_memory);
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(teamMember, team_row_begin, team_row_end),
+        [&](const nnz_lno_t &ii) {
+          accumulate_row(teamMember, binned_rows(bin_begin + ii), begins,
+                         nexts, used_size);
+        });
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const HugeTag &, const team_member_t &teamMember) const {
+    const nnz_lno_t team_row_begin = teamMember.league_rank() * team_work_size;
+    const nnz_lno_t team_row_end =
+        KOKKOSKERNELS_MACRO_MIN(team_row_begin + team_work_size, bin_size);
+
+    volatile nnz_lno_t *used_size =
+        (volatile nnz_lno_t *)(teamMember.team_shmem().get_shmem(
+            sizeof(nnz_lno_t) * 2 * teamMember.team_size())) +
+        2 * teamMember.team_rank();
+
+    Kokkos::parallel_for(
+        Kokkos::TeamThreadRange(teamMember, team_row_begin, team_row_end),
+        [&](const nnz_lno_t &ii) {
+          const nnz_lno_t row_index = binned_rows(bin_begin + ii);
+          const size_t request      = requests(ii);
+          const nnz_lno_t c_row_size =
+              rowmapC(row_index + 1) - rowmapC(row_index);
+
+          nnz_lno_t *chunk = NULL;
+          while (chunk == NULL) {
+            Kokkos::single(
+                Kokkos::PerThread(teamMember),
+                [&](nnz_lno_t *&memptr) {
+                  memptr = memory_space.allocate_chunk(request);
+                },
+                chunk);
+          }
+
+          accumulate_row(teamMember, row_index, chunk,
+                         chunk + get_hash_size(c_row_size), used_size);
+
+          Kokkos::single(Kokkos::PerThread(teamMember),
+                         [&]() { memory_space.release_chunk(chunk); });
+        });
+  }
+};
+
+template <typename HandleType, typename a_row_view_t_,
+          typename a_lno_nnz_view_t_, typename a_scalar_nnz_view_t_,
+          typename b_lno_row_view_t_, typename b_lno_nnz_view_t_,
+          typename b_scalar_nnz_view_t_>
+template <typename c_row_view_t, typename c_lno_nnz_view_t,
+          typename c_scalar_nnz_view_t>
+void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
+                  a_scalar_nnz_view_t_, b_lno_row_view_t_, b_lno_nnz_view_t_,
+                  b_scalar_nnz_view_t_>::
+    KokkosSPGEMM_numeric_binned(c_row_view_t rowmapC_,
+                                c_lno_nnz_view_t entriesC_,
+                                c_scalar_nnz_view_t valuesC_) {
+  if (KOKKOSKERNELS_VERBOSE) {
+    std::cout << "\tBINNED HASH MODE" << std::endl;
+  }
+  typedef KokkosKernels::Impl::SizeClassMemoryPool<MyTempMemorySpace,
+                                                   nnz_lno_t>
+      pool_memory_space;
+  typedef PortableNumericBinned<c_row_view_t, c_lno_nnz_view_t,
+                                c_scalar_nnz_view_t, pool_memory_space>
+      binned_functor_t;
+
+  nnz_lno_t brows = row_mapB.extent(0) - 1;
+  size_type bnnz  = valsB.extent(0);
+
+  int suggested_vector_size =
+      this->handle->get_suggested_vector_size(brows, bnnz);
+  int suggested_team_size =
+      this->handle->get_suggested_team_size(suggested_vector_size);
+  nnz_lno_t team_row_chunk_size = this->handle->get_team_work_size(
+      suggested_team_size, concurrency, a_row_cnt);
+
+  // the largest power of two hash whose begins and nexts (and the used size)
+  // fit in the shared memory of a thread
+  const size_t thread_memory = (shmem_size / suggested_team_size / 8) * 8;
+  nnz_lno_t medium_hash_size = 1;
+  while (sizeof(nnz_lno_t) * (2 + 4 * size_t(medium_hash_size)) <=
+         thread_memory) {
+    medium_hash_size *= 2;
+  }
+
+  binned_functor_t sc(row_mapA, entriesA, valsA, row_mapB, entriesB, valsB,
+                      rowmapC_, entriesC_, valuesC_,
+                      this->handle->get_spgemm_handle()->row_flops,
+                      medium_hash_size, team_row_chunk_size, a_row_cnt);
+
+  Kokkos::Timer timer1;
+  // group the rows by bin: tiny, medium and huge
+  nnz_lno_t bin_begins[4] = {0, 0, 0, 0};
+  for (int bin = 0; bin < 3; ++bin) {
+    nnz_lno_t bin_size = 0;
+    sc.bin             = bin;
+    sc.bin_begin       = bin_begins[bin];
+    Kokkos::parallel_scan(
+        "KOKKOSPARSE::SPGEMM::KKMEM::BIN_ROWS",
+        Kokkos::RangePolicy<typename binned_functor_t::BinTag, MyExecSpace>(
+            0, a_row_cnt),
+        sc, bin_size);
+    bin_begins[bin + 1] = bin_begins[bin] + bin_size;
+  }
+
+  if (KOKKOSKERNELS_VERBOSE) {
+    std::cout << "\t\ttiny rows:" << bin_begins[1] - bin_begins[0]
+              << " medium rows:" << bin_begins[2] - bin_begins[1]
+              << " huge rows:" << bin_begins[3] - bin_begins[2]
+              << " medium_hash_size:" << medium_hash_size
+              << " team_size:" << suggested_team_size
+              << " chunk_size:" << team_row_chunk_size
+              << " Binning Time:" << timer1.seconds() << std::endl;
+  }
+  this->handle->get_spgemm_handle()->set_row_bin_sizes(
+      bin_begins[1] - bin_begins[0], bin_begins[2] - bin_begins[1],
+      bin_begins[3] - bin_begins[2]);
+  timer1.reset();
+
+  const nnz_lno_t num_tiny = bin_begins[1] - bin_begins[0];
+  if (num_tiny > 0) {
+    sc.bin_begin = bin_begins[0];
+    Kokkos::parallel_for(
+        "KOKKOSPARSE::SPGEMM::KKMEM::BINNED_TINY",
+        Kokkos::RangePolicy<typename binned_functor_t::TinyTag, MyExecSpace>(
+            0, num_tiny),
+        sc);
+  }
+
+  const nnz_lno_t num_medium = bin_begins[2] - bin_begins[1];
+  if (num_medium > 0) {
+    sc.bin_begin = bin_begins[1];
+    sc.bin_size  = num_medium;
+    Kokkos::TeamPolicy<typename binned_functor_t::MediumTag, MyExecSpace>
+        medium_policy(num_medium / team_row_chunk_size + 1,
+                      suggested_team_size, suggested_vector_size);
+    Kokkos::parallel_for(
+        "KOKKOSPARSE::SPGEMM::KKMEM::BINNED_MEDIUM",
+        medium_policy.set_scratch_size(
+            0, Kokkos::PerTeam(sc.medium_shmem_size * suggested_team_size)),
+        sc);
+  }
+
+  const nnz_lno_t num_huge = bin_begins[3] - bin_begins[2];
+  if (num_huge > 0) {
+    sc.bin_begin = bin_begins[2];
+    sc.bin_size  = num_huge;
+    sc.requests  = typename binned_functor_t::request_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "huge row requests"),
+        num_huge);
+    Kokkos::parallel_for(
+        "KOKKOSPARSE::SPGEMM::KKMEM::BINNED_REQUESTS",
+        Kokkos::RangePolicy<typename binned_functor_t::RequestTag,
+                            MyExecSpace>(0, num_huge),
+        sc);
+
+    // huge rows have more than medium_hash_size entries, so their requests
+    // are larger than 3 * medium_hash_size
+    const size_t min_chunk_size = 4 * size_t(medium_hash_size);
+    const nnz_lno_t max_nnz =
+        this->handle->get_spgemm_handle()
+            ->template get_max_result_nnz<c_row_view_t>(rowmapC_);
+    const size_t max_request =
+        binned_functor_t::get_hash_size(max_nnz) + size_t(max_nnz);
+    const int num_classes =
+        KokkosKernels::Impl::get_size_class(max_request, min_chunk_size) + 1;
+
+    // as many chunks per class as huge rows of that class can run at once,
+    // the classes go up to the largest request so none is oversized
+    size_t num_oversized;
+    auto num_chunks = KokkosKernels::Impl::get_size_class_histogram<
+        MyExecSpace>(sc.requests, min_chunk_size, num_classes, num_oversized);
+    const size_t max_concurrent_rows = KOKKOSKERNELS_MACRO_MAX(
+        concurrency / suggested_vector_size, size_t(1));
+    for (int c = 0; c < num_classes; ++c) {
+      num_chunks(c) = KOKKOSKERNELS_MACRO_MIN(num_chunks(c),
+                                              max_concurrent_rows);
+    }
+    sc.memory_space =
+        pool_memory_space(min_chunk_size, num_chunks, nnz_lno_t(-1), false);
+
+    if (KOKKOSKERNELS_VERBOSE) {
+      std::cout << "\t\tHuge rows pool -- num_classes:" << num_classes
+                << " min_chunk_size:" << min_chunk_size << " Pool Size(MB):"
+                << sc.memory_space.get_memory_footprint() / 1024. / 1024.
+                << std::endl;
+    }
+
+    Kokkos::TeamPolicy<typename binned_functor_t::HugeTag, MyExecSpace>
+        huge_policy(num_huge / team_row_chunk_size + 1, suggested_team_size,
+                    suggested_vector_size);
+    Kokkos::parallel_for(
+        "KOKKOSPARSE::SPGEMM::KKMEM::BINNED_HUGE",
+        huge_policy.set_scratch_size(
+            0, Kokkos::PerTeam(sizeof(nnz_lno_t) * 2 * suggested_team_size)),
+        sc);
+  }
+  MyExecSpace().fence();
+
+  if (KOKKOSKERNELS_VERBOSE) {
+    std::cout << "\t\tNumeric TIME:" << timer1.seconds() << std::endl;
+  }
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
@@ -40,10 +40,17 @@ void KokkosSPGEMM<
     std::cout << "Numeric PHASE" << std::endl;
   }
 
+  // set again by KokkosSPGEMM_numeric_binned if it runs
+  this->handle->get_spgemm_handle()->set_row_bin_sizes(0, 0, 0);
   if (spgemm_algorithm == SPGEMM_KK_SPEED ||
       spgemm_algorithm == SPGEMM_KK_DENSE) {
     this->KokkosSPGEMM_numeric_speed(rowmapC_, entriesC_, valuesC_,
                                      my_exec_space_);
+  } else if ((spgemm_algorithm == SPGEMM_KK ||
+              spgemm_algorithm == SPGEMM_KK_MEMORY) &&
+             this->handle->get_spgemm_handle()->get_row_binning() &&
+             this->handle->get_spgemm_handle()->are_rowflops_computed()) {
+    this->KokkosSPGEMM_numeric_binned(rowmapC_, entriesC_, valuesC_);
   } else {
     this->KokkosSPGEMM_numeric_hash(rowmapC_, entriesC_, valuesC_,
                                     my_exec_space_);
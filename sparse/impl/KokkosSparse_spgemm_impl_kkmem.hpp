@@ -1574,7 +1574,10 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
   }
 
   Kokkos::Timer timer1;
-  pool_memory_space m_space(num_chunks, chunksize, -1, my_pool_type);
+  // reuses the pool of the previous numeric call if the handle retained it
+  pool_memory_space m_space =
+      this->handle->get_spgemm_handle()->get_numeric_pool(
+          num_chunks, chunksize, nnz_lno_t(-1), my_pool_type);
   MyExecSpace().fence();
 
   if (KOKKOSKERNELS_VERBOSE) {
@@ -542,9 +542,12 @@ void KokkosSPGEMM<HandleType, a_row_view_t_, a_lno_nnz_view_t_,
     int num_chunks = concurrency;
 
     Kokkos::Timer timer1;
-    pool_memory_space m_space(
-        num_chunks, this->b_col_cnt + (this->b_col_cnt) / sizeof(scalar_t) + 1,
-        0, my_pool_type);
+    // reuses the pool of the previous numeric call if the handle retained it
+    pool_memory_space m_space =
+        this->handle->get_spgemm_handle()->get_numeric_pool(
+            num_chunks,
+            this->b_col_cnt + (this->b_col_cnt) / sizeof(scalar_t) + 1,
+            scalar_t(0), my_pool_type);
     MyExecSpace().fence();
 
     if (KOKKOSKERNELS_VERBOSE) {
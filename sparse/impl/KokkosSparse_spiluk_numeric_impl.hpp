@@ -23,6 +23,7 @@
 #include <KokkosKernels_config.h>
 #include <Kokkos_ArithTraits.hpp>
 #include <KokkosSparse_spiluk_handle.hpp>
+#include <KokkosSparse_findRelOffset.hpp>
 
 //#define NUMERIC_OUTPUT_INFO
 
@@ -358,6 +359,212 @@ struct ILUKLvlSchedTP1NumericFunctor {
   }
 };
 
+// Fixed-point ILU (Chow and Patel, "Fine-grained parallel incomplete LU
+// factorization", SIAM J. Sci. Comput. 37(2), 2015). The entries of L and U
+// on the pattern computed by the symbolic phase are the fixed point of
+//   l_ij = (a_ij - sum_{k<j} l_ik u_kj) / u_jj,  i > j,
+//   u_ij =  a_ij - sum_{k<i} l_ik u_kj,          i <= j.
+// Each sweep updates all rows in parallel and in place, reading whatever
+// values the other rows currently hold. No level scheduling is needed; a
+// handful of sweeps is usually enough to get a good preconditioner.
+template <class ARowMapType, class AEntriesType, class AValuesType,
+          class LRowMapType, class LEntriesType, class LValuesType,
+          class URowMapType, class UEntriesType, class UValuesType,
+          class FPValuesType>
+struct ILUKFixedPointNumericFunctor {
+  struct ScatterTag {};
+  struct InitTag {};
+  struct SweepTag {};
+
+  using size_type = typename LRowMapType::non_const_value_type;
+  using lno_t     = typename AEntriesType::non_const_value_type;
+  using scalar_t  = typename AValuesType::non_const_value_type;
+
+  ARowMapType A_row_map;
+  AEntriesType A_entries;
+  AValuesType A_values;
+  LRowMapType L_row_map;
+  LEntriesType L_entries;
+  LValuesType L_values;
+  URowMapType U_row_map;
+  UEntriesType U_entries;
+  UValuesType U_values;
+  FPValuesType a_lu;  // A on the pattern of L (first nnzL), then of U
+  size_type nnzL;
+  lno_t nrows;
+
+  ILUKFixedPointNumericFunctor(
+      const ARowMapType &A_row_map_, const AEntriesType &A_entries_,
+      const AValuesType &A_values_, const LRowMapType &L_row_map_,
+      const LEntriesType &L_entries_, LValuesType &L_values_,
+      const URowMapType &U_row_map_, const UEntriesType &U_entries_,
+      UValuesType &U_values_, const FPValuesType &a_lu_,
+      const size_type nnzL_, const lno_t nrows_)
+      : A_row_map(A_row_map_),
+        A_entries(A_entries_),
+        A_values(A_values_),
+        L_row_map(L_row_map_),
+        L_entries(L_entries_),
+        L_values(L_values_),
+        U_row_map(U_row_map_),
+        U_entries(U_entries_),
+        U_values(U_values_),
+        a_lu(a_lu_),
+        nnzL(nnzL_),
+        nrows(nrows_) {}
+
+  // End of the off-diagonal entries of row rowid of L
+  KOKKOS_INLINE_FUNCTION
+  size_type L_offdiag_end(const lno_t rowid) const {
+#ifdef KEEP_DIAG
+    return L_row_map(rowid + 1) - 1;
+#else
+    return L_row_map(rowid + 1);
+#endif
+  }
+
+  // Position of col in the sorted entries [k1, k2), or k2 if not found
+  template <class EntriesType>
+  KOKKOS_INLINE_FUNCTION size_type find(const EntriesType &entries,
+                                        const size_type k1, const size_type k2,
+                                        const lno_t col) const {
+    if (k1 == k2) return k2;
+    return k1 + KokkosSparse::findRelOffset(&entries(k1), k2 - k1, col,
+                                            size_type(0), true);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  scalar_t get_U(const lno_t row, const lno_t col) const {
+    const size_type k2 = U_row_map(row + 1);
+    const size_type k  = find(U_entries, U_row_map(row), k2, col);
+    return k < k2 ? U_values(k) : scalar_t(0.0);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void set_U_diag(const size_type k, const scalar_t &val) const {
+#ifdef KEEP_DIAG
+    U_values(k) = (val == 0.0) ? scalar_t(1e6) : val;
+#else
+    U_values(k) = (val == 0.0) ? scalar_t(1e6) : scalar_t(1.0 / val);
+#endif
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  scalar_t div_U_diag(const scalar_t &val, const lno_t col) const {
+#ifdef KEEP_DIAG
+    return val / U_values(U_row_map(col));
+#else
+    return val * U_values(U_row_map(col));
+#endif
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ScatterTag &, const lno_t rowid) const {
+    const size_type l1 = L_row_map(rowid), l2 = L_offdiag_end(rowid);
+    const size_type u1 = U_row_map(rowid), u2 = U_row_map(rowid + 1);
+    for (size_type k = l1; k < l2; ++k) a_lu(k) = 0.0;
+    for (size_type k = u1; k < u2; ++k) a_lu(nnzL + k) = 0.0;
+    for (size_type k = A_row_map(rowid); k < A_row_map(rowid + 1); ++k) {
+      const lno_t col = A_entries(k);
+      if (col >= nrows) continue;
+      if (col < rowid) {
+        const size_type ipos = find(L_entries, l1, l2, col);
+        if (ipos < l2) a_lu(ipos) = A_values(k);
+      } else {
+        const size_type ipos = find(U_entries, u1, u2, col);
+        if (ipos < u2) a_lu(nnzL + ipos) = A_values(k);
+      }
+    }
+  }
+
+  // Initial guess: L = strict lower part of A scaled by the diagonal of A,
+  // U = upper part of A
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const InitTag &, const lno_t rowid) const {
+    const size_type l2 = L_offdiag_end(rowid);
+    for (size_type k = L_row_map(rowid); k < l2; ++k) {
+      const scalar_t diag = a_lu(nnzL + U_row_map(L_entries(k)));
+      L_values(k) = (diag == 0.0) ? scalar_t(0.0) : scalar_t(a_lu(k) / diag);
+    }
+#ifdef KEEP_DIAG
+    L_values(l2) = scalar_t(1.0);
+#endif
+    const size_type u1 = U_row_map(rowid);
+    set_U_diag(u1, a_lu(nnzL + u1));
+    for (size_type k = u1 + 1; k < U_row_map(rowid + 1); ++k)
+      U_values(k) = a_lu(nnzL + k);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const SweepTag &, const lno_t rowid) const {
+    const size_type l1 = L_row_map(rowid), l2 = L_offdiag_end(rowid);
+
+    // L entries are sorted, so the entries before k are the l_ik with k < j
+    for (size_type k = l1; k < l2; ++k) {
+      const lno_t col = L_entries(k);
+      scalar_t sum    = a_lu(k);
+      for (size_type kk = l1; kk < k; ++kk)
+        sum -= L_values(kk) * get_U(L_entries(kk), col);
+      L_values(k) = div_U_diag(sum, col);
+    }
+
+    const size_type u1 = U_row_map(rowid), u2 = U_row_map(rowid + 1);
+    for (size_type k = u1; k < u2; ++k) {
+      const lno_t col = U_entries(k);
+      scalar_t sum    = a_lu(nnzL + k);
+      for (size_type kk = l1; kk < l2; ++kk)
+        sum -= L_values(kk) * get_U(L_entries(kk), col);
+      if (k == u1)
+        set_U_diag(k, sum);
+      else
+        U_values(k) = sum;
+    }
+  }
+};
+
+template <class ExecutionSpace, class IlukHandle, class ARowMapType,
+          class AEntriesType, class AValuesType, class LRowMapType,
+          class LEntriesType, class LValuesType, class URowMapType,
+          class UEntriesType, class UValuesType>
+void iluk_numeric_fixed_point(
+    const ExecutionSpace &space, IlukHandle &thandle,
+    const ARowMapType &A_row_map, const AEntriesType &A_entries,
+    const AValuesType &A_values, const LRowMapType &L_row_map,
+    const LEntriesType &L_entries, LValuesType &L_values,
+    const URowMapType &U_row_map, const UEntriesType &U_entries,
+    UValuesType &U_values) {
+  using nnz_lno_t    = typename IlukHandle::nnz_lno_t;
+  using FPValuesType = typename IlukHandle::nnz_scalar_view_t;
+
+  using functor_type = ILUKFixedPointNumericFunctor<
+      ARowMapType, AEntriesType, AValuesType, LRowMapType, LEntriesType,
+      LValuesType, URowMapType, UEntriesType, UValuesType, FPValuesType>;
+  using scatter_policy_type =
+      Kokkos::RangePolicy<ExecutionSpace, typename functor_type::ScatterTag>;
+  using init_policy_type =
+      Kokkos::RangePolicy<ExecutionSpace, typename functor_type::InitTag>;
+  using sweep_policy_type =
+      Kokkos::RangePolicy<ExecutionSpace, typename functor_type::SweepTag>;
+
+  const nnz_lno_t nrows = thandle.get_nrows();
+
+  // Allocated once, reused by later refactorizations
+  thandle.alloc_fixed_point_work(thandle.get_nnzL() + thandle.get_nnzU());
+
+  functor_type functor(A_row_map, A_entries, A_values, L_row_map, L_entries,
+                       L_values, U_row_map, U_entries, U_values,
+                       thandle.get_fixed_point_work(), thandle.get_nnzL(),
+                       nrows);
+
+  Kokkos::parallel_for("spiluk_fixed_point_scatter",
+                       scatter_policy_type(space, 0, nrows), functor);
+  Kokkos::parallel_for("spiluk_fixed_point_init",
+                       init_policy_type(space, 0, nrows), functor);
+  for (int sweep = 0; sweep < thandle.get_fixed_point_sweeps(); ++sweep)
+    Kokkos::parallel_for("spiluk_fixed_point_sweep",
+                         sweep_policy_type(space, 0, nrows), functor);
+}
+
 template <class IlukHandle, class ARowMapType, class AEntriesType,
           class AValuesType, class LRowMapType, class LEntriesType,
           class LValuesType, class URowMapType, class UEntriesType,
@@ -374,6 +581,13 @@ void iluk_numeric(IlukHandle &thandle, const ARowMapType &A_row_map,
   using WorkViewType            = typename IlukHandle::work_view_t;
   using LevelHostViewType       = typename IlukHandle::nnz_lno_view_host_t;
 
+  if (thandle.get_fixed_point_sweeps() > 0) {
+    iluk_numeric_fixed_point(execution_space(), thandle, A_row_map, A_entries,
+                             A_values, L_row_map, L_entries, L_values,
+                             U_row_map, U_entries, U_values);
+    return;
+  }
+
   size_type nlevels = thandle.get_num_levels();
   int team_size     = thandle.get_team_size();
 
@@ -436,7 +650,6 @@ void iluk_numeric(IlukHandle &thandle, const ARowMapType &A_row_map,
           else
             Kokkos::parallel_for("parfor_tp1",
                                  policy_type(lvl_nrows_chunk, team_size), tstf);
-          Kokkos::fence();
           lvl_rowid_start += lvl_nrows_chunk;
         }
       }
@@ -532,8 +745,14 @@ void iluk_numeric_streams(const std::vector<ExecutionSpace> &execspace_v,
   }
 
   // Assume all streams use the same algorithm
-  if (thandle_v[0]->get_algorithm() ==
-      KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_RP) {
+  if (thandle_v[0]->get_fixed_point_sweeps() > 0) {
+    for (int i = 0; i < nstreams; i++)
+      iluk_numeric_fixed_point(execspace_v[i], *thandle_v[i], A_row_map_v[i],
+                               A_entries_v[i], A_values_v[i], L_row_map_v[i],
+                               L_entries_v[i], L_values_v[i], U_row_map_v[i],
+                               U_entries_v[i], U_values_v[i]);
+  } else if (thandle_v[0]->get_algorithm() ==
+             KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_RP) {
     // Main loop must be performed sequential
     for (size_type lvl = 0; lvl < nlevels_max; lvl++) {
       // Initial work across streams at each level
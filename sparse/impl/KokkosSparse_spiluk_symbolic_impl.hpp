@@ -32,53 +32,10 @@ namespace KokkosSparse {
 namespace Impl {
 namespace Experimental {
 
-template <class IlukHandle, class RowMapType, class EntriesType,
-          class LevelType1, class LevelType2, class LevelType3, class size_type>
-void level_sched(IlukHandle& thandle, const RowMapType row_map,
-                 const EntriesType entries, LevelType1& level_list,
-                 LevelType2& level_ptr, LevelType3& level_idx,
-                 size_type& nlevels) {
-  // Scheduling currently compute on host
-
-  using nnz_lno_t = typename IlukHandle::nnz_lno_t;
-
-  size_type nrows = thandle.get_nrows();
-
-  nlevels      = 0;
-  level_ptr(0) = 0;
-
-  for (size_type i = 0; i < nrows; ++i) {
-    size_type l        = 0;
-    size_type rowstart = row_map(i);
-    size_type rowend   = row_map(i + 1);
-    for (size_type j = rowstart; j < rowend; ++j) {
-      nnz_lno_t col = entries(j);
-      l             = std::max(l, level_list(col));
-    }
-    level_list(i) = l + 1;
-    level_ptr(l + 1) += 1;
-    nlevels = std::max(nlevels, l + 1);
-  }
-
-  for (size_type i = 1; i <= nlevels; ++i) {
-    level_ptr(i) += level_ptr(i - 1);
-  }
-
-  for (size_type i = 0; i < nrows; i++) {
-    level_idx(level_ptr(level_list(i) - 1)) = i;
-    level_ptr(level_list(i) - 1) += 1;
-  }
-
-  if (nlevels > 0) {  // note: to avoid wrapping around to the max of size_t
-                      // when nlevels = 0.
-    for (size_type i = nlevels - 1; i > 0; --i) {
-      level_ptr(i) = level_ptr(i - 1);
-    }
-  }
-
-  level_ptr(0) = 0;
-
-  // Find the maximum number of rows of levels
+// Find the maximum number of rows of levels
+template <class IlukHandle, class LevelPtrType, class size_type>
+void level_sched(IlukHandle& thandle, const LevelPtrType& level_ptr,
+                 const size_type nlevels) {
   size_type maxrows = 0;
   for (size_type i = 0; i < nlevels; ++i) {
     size_type lnrows = level_ptr(i + 1) - level_ptr(i);
@@ -92,53 +49,12 @@ void level_sched(IlukHandle& thandle, const RowMapType row_map,
 }
 
 // SEQLVLSCHD_TP1 algorithm (chunks)
-template <class IlukHandle, class RowMapType, class EntriesType,
-          class LevelType1, class LevelType2, class LevelType3, class size_type>
-void level_sched_tp(IlukHandle& thandle, const RowMapType row_map,
-                    const EntriesType entries, LevelType1& level_list,
-                    LevelType2& level_ptr, LevelType3& level_idx,
-                    size_type& nlevels, int nstreams = 1) {
-  // Scheduling currently compute on host
-
+template <class IlukHandle, class LevelPtrType, class size_type>
+void level_sched_tp(IlukHandle& thandle, const LevelPtrType& level_ptr,
+                    const size_type nlevels, int nstreams = 1) {
   using nnz_lno_t           = typename IlukHandle::nnz_lno_t;
   using nnz_lno_view_host_t = typename IlukHandle::nnz_lno_view_host_t;
 
-  size_type nrows = thandle.get_nrows();
-
-  nlevels      = 0;
-  level_ptr(0) = 0;
-
-  for (size_type i = 0; i < nrows; ++i) {
-    size_type l        = 0;
-    size_type rowstart = row_map(i);
-    size_type rowend   = row_map(i + 1);
-    for (size_type j = rowstart; j < rowend; ++j) {
-      nnz_lno_t col = entries(j);
-      l             = std::max(l, level_list(col));
-    }
-    level_list(i) = l + 1;
-    level_ptr(l + 1) += 1;
-    nlevels = std::max(nlevels, l + 1);
-  }
-
-  for (size_type i = 1; i <= nlevels; ++i) {
-    level_ptr(i) += level_ptr(i - 1);
-  }
-
-  for (size_type i = 0; i < nrows; i++) {
-    level_idx(level_ptr(level_list(i) - 1)) = i;
-    level_ptr(level_list(i) - 1) += 1;
-  }
-
-  if (nlevels > 0) {  // note: to avoid wrapping around to the max of size_t
-                      // when nlevels = 0.
-    for (size_type i = nlevels - 1; i > 0; --i) {
-      level_ptr(i) = level_ptr(i - 1);
-    }
-  }
-
-  level_ptr(0) = 0;
-
   // Find max rows, number of chunks, max rows of chunks across levels
   thandle.alloc_level_nchunks(nlevels);
   thandle.alloc_level_nrowsperchunk(nlevels);
@@ -147,6 +63,7 @@ void level_sched_tp(IlukHandle& thandle, const RowMapType row_map,
 
 #ifdef KOKKOS_ENABLE_CUDA
   using memory_space = typename IlukHandle::memory_space;
+  size_type nrows    = thandle.get_nrows();
   size_t avail_byte  = 0;
   if (std::is_same<memory_space, Kokkos::CudaSpace>::value) {
     size_t free_byte, total_byte;
@@ -189,35 +106,315 @@ void level_sched_tp(IlukHandle& thandle, const RowMapType row_map,
   thandle.set_level_maxrowsperchunk(maxrowsperchunk);
 }
 
-// Linear Search for the smallest row index
-template <class size_type, class nnz_lno_t, class ViewType>
-size_type search_col_index(nnz_lno_t j, size_type lenl, ViewType h_iL,
-                           ViewType h_llev, ViewType h_iw) {
-  nnz_lno_t irow = h_iL(j);
-  nnz_lno_t ipos = j;
-
-  // Find the smallest col index
-  for (size_type k = j + 1; k < lenl; ++k) {
-    if (h_iL(k) < irow) {
-      irow = h_iL(k);
-      ipos = k;
+// One sweep of the parallel symbolic phase. Every row of the frontier is
+// eliminated as in the sequential up-looking algorithm: the rows of its L part
+// are visited in ascending order, and their U parts (with fill levels) are
+// merged into the current row. This requires the U part of each visited row to
+// be complete; if a row was not completed in a previous sweep, the current row
+// is parked on its wait list and retried in the sweep following its
+// completion. A row thus completes in the sweep after the last of the rows it
+// depends on, i.e. the sweeps are the levels of the level schedule of L.
+//
+// Each slot accumulates one row at a time and processes the frontier rows
+// slot, slot + nslots, ... The off-diagonal entries of the row are kept in
+// compact lists of row_cap entries (L from the front, U from the back) with
+// an open addressing hash from column to position, instead of the dense work
+// arrays of length nrows of the sequential algorithm. A row whose L and U
+// parts do not fit in row_cap is appended to retry. Completed rows store their
+// off-diagonal L and U parts in temporary buffers and append themselves to
+// level_idx.
+template <class IlukHandle, class ARowMapType, class AEntriesType>
+struct ILUKSymbolicSweepFunctor {
+  using size_type      = typename IlukHandle::size_type;
+  using nnz_lno_t      = typename IlukHandle::nnz_lno_t;
+  using memory_space   = typename IlukHandle::memory_space;
+  using nnz_row_view_t = typename IlukHandle::nnz_row_view_t;
+  using nnz_lno_view_t = typename IlukHandle::nnz_lno_view_t;
+  using work_view_t    = typename IlukHandle::work_view_t;
+
+  ARowMapType A_row_map;
+  AEntriesType A_entries;
+  nnz_lno_t nrows;
+  nnz_lno_t fill_lev;
+
+  nnz_lno_t row_cap;
+  nnz_lno_t hash_mask;
+  work_view_t hash_keys;
+  work_view_t hash_pos;
+  work_view_t iL;
+  work_view_t llev;
+  work_view_t ihash;
+
+  nnz_row_view_t L_start;
+  nnz_lno_view_t L_len;
+  nnz_lno_view_t L_tmp;
+  nnz_row_view_t U_start;
+  nnz_lno_view_t U_len;
+  nnz_lno_view_t U_tmp;
+  nnz_lno_view_t U_tmp_lev;
+  Kokkos::View<size_type, memory_space> L_used;
+  Kokkos::View<size_type, memory_space> U_used;
+  Kokkos::View<int, memory_space> overflow;
+
+  nnz_lno_view_t done_level;  // sweep in which each row completed, 0 if not
+  nnz_lno_view_t wait_head;
+  nnz_lno_view_t next_waiter;
+  nnz_lno_view_t level_idx;
+  Kokkos::View<nnz_lno_t, memory_space> ndone;
+
+  nnz_lno_view_t retry;
+  Kokkos::View<nnz_lno_t, memory_space> nretry;
+
+  nnz_lno_view_t frontier;
+  nnz_lno_t nfront;
+  nnz_lno_t nslots;
+  nnz_lno_t sweep;
+
+  ILUKSymbolicSweepFunctor(const ARowMapType& A_row_map_,
+                           const AEntriesType& A_entries_,
+                           const nnz_lno_t nrows_, const nnz_lno_t fill_lev_,
+                           const size_type L_capacity,
+                           const size_type U_capacity,
+                           const nnz_lno_view_t& level_idx_,
+                           const nnz_lno_t nslots_, const nnz_lno_t row_cap_)
+      : A_row_map(A_row_map_),
+        A_entries(A_entries_),
+        nrows(nrows_),
+        fill_lev(fill_lev_),
+        L_start("L_start", nrows_),
+        L_len("L_len", nrows_),
+        L_tmp(Kokkos::view_alloc(Kokkos::WithoutInitializing, "L_tmp"),
+              L_capacity),
+        U_start("U_start", nrows_),
+        U_len("U_len", nrows_),
+        U_tmp(Kokkos::view_alloc(Kokkos::WithoutInitializing, "U_tmp"),
+              U_capacity),
+        U_tmp_lev(Kokkos::view_alloc(Kokkos::WithoutInitializing, "U_tmp_lev"),
+                  U_capacity),
+        L_used("L_used"),
+        U_used("U_used"),
+        overflow("overflow"),
+        done_level("done_level", nrows_),
+        wait_head(Kokkos::view_alloc(Kokkos::WithoutInitializing, "wait_head"),
+                  nrows_),
+        next_waiter("next_waiter", nrows_),
+        level_idx(level_idx_),
+        ndone("ndone"),
+        retry(Kokkos::view_alloc(Kokkos::WithoutInitializing, "retry"),
+              nrows_),
+        nretry("nretry"),
+        frontier(),
+        nfront(0),
+        sweep(0) {
+    Kokkos::deep_copy(wait_head, nnz_lno_t(-1));
+    alloc_work(nslots_, row_cap_);
+  }
+
+  // Size of the hash of a slot, a power of two at least twice row_cap_
+  static nnz_lno_t hash_size(const nnz_lno_t row_cap_) {
+    nnz_lno_t size = 1;
+    while (size < 2 * row_cap_) size *= 2;
+    return size;
+  }
+
+  static size_t slot_bytes(const nnz_lno_t row_cap_) {
+    return (2 * static_cast<size_t>(hash_size(row_cap_)) +
+            3 * static_cast<size_t>(row_cap_)) *
+           sizeof(nnz_lno_t);
+  }
+
+  // (Re)allocates the work arrays of nslots_ slots of row_cap_ entries
+  void alloc_work(const nnz_lno_t nslots_, const nnz_lno_t row_cap_) {
+    nslots    = nslots_;
+    row_cap   = row_cap_;
+    hash_mask = hash_size(row_cap_) - 1;
+
+    // Release the previous arrays first
+    hash_keys = work_view_t();
+    hash_pos  = work_view_t();
+    iL        = work_view_t();
+    llev      = work_view_t();
+    ihash     = work_view_t();
+
+    hash_keys = work_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "hash_keys"), nslots,
+        hash_mask + 1);
+    hash_pos = work_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "hash_pos"), nslots,
+        hash_mask + 1);
+    iL = work_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "iL"),
+                     nslots, row_cap);
+    llev = work_view_t(Kokkos::view_alloc(Kokkos::WithoutInitializing, "llev"),
+                       nslots, row_cap);
+    ihash = work_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "ihash"), nslots,
+        row_cap);
+    Kokkos::deep_copy(hash_keys, nnz_lno_t(-1));
+  }
+
+  // Position in the hash of the slot either holding col or empty
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_t hash_find(const nnz_lno_t slot, const nnz_lno_t col) const {
+    nnz_lno_t h = col & hash_mask;
+    while (hash_keys(slot, h) != -1 && hash_keys(slot, h) != col)
+      h = (h + 1) & hash_mask;
+    return h;
+  }
+
+  // Stores col with level lev at index idx of the lists, and position pos of
+  // the L or U part at the empty hash position h
+  KOKKOS_INLINE_FUNCTION
+  void insert(const nnz_lno_t slot, const nnz_lno_t h, const nnz_lno_t idx,
+              const nnz_lno_t pos, const nnz_lno_t col,
+              const nnz_lno_t lev) const {
+    hash_keys(slot, h) = col;
+    hash_pos(slot, h)  = pos;
+    iL(slot, idx)      = col;
+    llev(slot, idx)    = lev;
+    ihash(slot, idx)   = h;
+  }
+
+  // Moves the smallest column of the L part [j, lenl) to position j and
+  // returns it
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_t next_l_col(const nnz_lno_t slot, const nnz_lno_t j,
+                       const nnz_lno_t lenl) const {
+    nnz_lno_t irow = iL(slot, j);
+    nnz_lno_t ipos = j;
+    for (nnz_lno_t k = j + 1; k < lenl; ++k) {
+      if (iL(slot, k) < irow) {
+        irow = iL(slot, k);
+        ipos = k;
+      }
     }
+    if (ipos != j) {  // Swap entries
+      iL(slot, ipos) = iL(slot, j);
+      iL(slot, j)    = irow;
+
+      nnz_lno_t t      = llev(slot, j);
+      llev(slot, j)    = llev(slot, ipos);
+      llev(slot, ipos) = t;
+
+      t                 = ihash(slot, j);
+      ihash(slot, j)    = ihash(slot, ipos);
+      ihash(slot, ipos) = t;
+
+      hash_pos(slot, ihash(slot, j))    = j;
+      hash_pos(slot, ihash(slot, ipos)) = ipos;
+    }
+    return irow;
   }
 
-  if (ipos != j) {  // Swap entries
-    nnz_lno_t row = h_iL(j);
-    h_iL(j)       = h_iL(ipos);
-    h_iL(ipos)    = row;
+  // Returns -1 if row i was completed, -2 if its L and U parts do not fit in
+  // row_cap, otherwise the row it waits on
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_t eliminate(const nnz_lno_t slot, const nnz_lno_t i) const {
+    // U entry k is stored at uend - k
+    const nnz_lno_t uend = row_cap - 1;
+    nnz_lno_t lenl = 0, lenu = 0;
+
+    nnz_lno_t status = -1;
+
+    // Unpack the ith row
+    for (size_type k = A_row_map(i); k < A_row_map(i + 1); ++k) {
+      nnz_lno_t col = A_entries(k);
+      // Ignore the diagonal and column elements that are not in the square
+      // matrix
+      if (col >= nrows || col == i) continue;
+      nnz_lno_t h = hash_find(slot, col);
+      if (hash_keys(slot, h) != -1) continue;
+      if (lenl + lenu == row_cap) {
+        status = -2;
+        break;
+      }
+      if (col > i) {  // U part
+        insert(slot, h, uend - lenu, lenu, col, 0);
+        lenu++;
+      } else {  // L part
+        insert(slot, h, lenl, lenl, col, 0);
+        lenl++;
+      }
+    }
+
+    // Eliminate rows
+    nnz_lno_t j = -1;
+    while (status == -1 && ++j < lenl) {
+      nnz_lno_t row      = next_l_col(slot, j, lenl);
+      nnz_lno_t row_done = Kokkos::atomic_load(&done_level(row));
+      if (row_done == 0 || row_done >= sweep) {
+        status = row;
+        break;
+      }
+      nnz_lno_t jlev = llev(slot, j);
+      size_type k1   = U_start(row);
+      size_type k2   = k1 + U_len(row);
+      for (size_type k = k1; k < k2; ++k) {
+        nnz_lno_t col  = U_tmp(k);
+        nnz_lno_t lev1 = jlev + U_tmp_lev(k) + 1;
+        if (lev1 > fill_lev || col == i) continue;
+        nnz_lno_t h = hash_find(slot, col);
+        if (hash_keys(slot, h) == -1) {  // Fill-in
+          if (lenl + lenu == row_cap) {
+            status = -2;
+            break;
+          }
+          if (col > i) {  // U part
+            insert(slot, h, uend - lenu, lenu, col, lev1);
+            lenu++;
+          } else {  // L part
+            insert(slot, h, lenl, lenl, col, lev1);
+            lenl++;
+          }
+        } else {  // Not a fill-in
+          nnz_lno_t ipos = hash_pos(slot, h);
+          nnz_lno_t idx  = col > i ? uend - ipos : ipos;
+          llev(slot, idx) = Kokkos::min(llev(slot, idx), lev1);
+        }
+      }
+    }
 
-    nnz_lno_t t  = h_llev(j);
-    h_llev(j)    = h_llev(ipos);
-    h_llev(ipos) = t;
+    // Reset the hash
+    for (nnz_lno_t k = 0; k < lenl; ++k) hash_keys(slot, ihash(slot, k)) = -1;
+    for (nnz_lno_t k = 0; k < lenu; ++k)
+      hash_keys(slot, ihash(slot, uend - k)) = -1;
+
+    if (status != -1) return status;
+
+    // Copy U part and levels, and L part
+    size_type U_pos = Kokkos::atomic_fetch_add(&U_used(), size_type(lenu));
+    size_type L_pos = Kokkos::atomic_fetch_add(&L_used(), size_type(lenl));
+    if (U_pos + lenu > U_tmp.extent(0)) Kokkos::atomic_or(&overflow(), 1);
+    if (L_pos + lenl > L_tmp.extent(0)) Kokkos::atomic_or(&overflow(), 2);
+    if (U_pos + lenu > U_tmp.extent(0) || L_pos + lenl > L_tmp.extent(0))
+      return -1;
+    U_start(i) = U_pos;
+    U_len(i)   = lenu;
+    for (nnz_lno_t k = 0; k < lenu; ++k) {
+      U_tmp(U_pos + k)     = iL(slot, uend - k);
+      U_tmp_lev(U_pos + k) = llev(slot, uend - k);
+    }
+    L_start(i) = L_pos;
+    L_len(i)   = lenl;
+    for (nnz_lno_t k = 0; k < lenl; ++k) L_tmp(L_pos + k) = iL(slot, k);
+    return -1;
+  }
 
-    h_iw(irow) = j;
-    h_iw(row)  = ipos;
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const nnz_lno_t slot) const {
+    for (nnz_lno_t k = slot; k < nfront; k += nslots) {
+      nnz_lno_t i      = frontier(k);
+      nnz_lno_t status = eliminate(slot, i);
+      if (status == -1) {
+        Kokkos::atomic_store(&done_level(i), sweep);
+        level_idx(Kokkos::atomic_fetch_add(&ndone(), nnz_lno_t(1))) = i;
+      } else if (status == -2) {
+        retry(Kokkos::atomic_fetch_add(&nretry(), nnz_lno_t(1))) = i;
+      } else {
+        next_waiter(i) = Kokkos::atomic_exchange(&wait_head(status), i);
+      }
+    }
   }
-  return ((size_type)irow);
-}
+};
 
 template <class IlukHandle, class ARowMapType, class AEntriesType,
           class LRowMapType, class LEntriesType, class URowMapType,
@@ -235,227 +432,253 @@ void iluk_symbolic(IlukHandle& thandle,
   /*   || thandle.get_algorithm() ==
      KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHED_TP2 )*/
   {
-    // Scheduling and symbolic phase currently compute on host - need host copy
-    // of all views
+    // Symbolic phase and level scheduling are computed together on the
+    // execution space of the handle
 
-    using size_type = typename IlukHandle::size_type;
-    using nnz_lno_t = typename IlukHandle::nnz_lno_t;
+    using size_type       = typename IlukHandle::size_type;
+    using nnz_lno_t       = typename IlukHandle::nnz_lno_t;
+    using execution_space = typename IlukHandle::execution_space;
+    using memory_space    = typename IlukHandle::memory_space;
+    using range_policy    = Kokkos::RangePolicy<execution_space>;
 
     using HandleDeviceEntriesType = typename IlukHandle::nnz_lno_view_t;
     using HandleDeviceRowMapType  = typename IlukHandle::nnz_row_view_t;
 
-    // typedef typename IlukHandle::signed_integral_t signed_integral_t;
+    using functor_type =
+        ILUKSymbolicSweepFunctor<IlukHandle, ARowMapType, AEntriesType>;
 
     size_type nrows = thandle.get_nrows();
 
-    auto A_row_map =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A_row_map_d);
-    auto A_entries =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A_entries_d);
-    auto L_row_map =
-        Kokkos::create_mirror_view(Kokkos::HostSpace(), L_row_map_d);
-    auto L_entries =
-        Kokkos::create_mirror_view(Kokkos::HostSpace(), L_entries_d);
-    auto U_row_map =
-        Kokkos::create_mirror_view(Kokkos::HostSpace(), U_row_map_d);
-    auto U_entries =
-        Kokkos::create_mirror_view(Kokkos::HostSpace(), U_entries_d);
-
     HandleDeviceRowMapType dlevel_list = thandle.get_level_list();
-    auto level_list =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dlevel_list);
-
     HandleDeviceEntriesType dlevel_ptr = thandle.get_level_ptr();
     auto level_ptr                     = thandle.get_host_level_ptr();
-
     HandleDeviceEntriesType dlevel_idx = thandle.get_level_idx();
-    auto level_idx =
-        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dlevel_idx);
-
-    size_type nlev = 0;
-
-    // Level scheduling on A???
-    // level_sched<IlukHandle, AHostRowMapType, AHostEntriesType,
-    // HandleHostRowMapType, HandleHostEntriesType, size_type >
-    //                                    (thandle, A_row_map, A_entries, nrows,
-    //                                    level_list, level_ptr, level_idx,
-    //                                    nlev);
-    // level_sched (thandle, A_row_map, A_entries, nrows, level_list, level_ptr,
-    // level_idx, nlev);
-
-    // Symbolic phase
-    // Kokkos::resize(L_row_map_d, nrows-3);// error: static assertion failed:
-    // Can only resize managed views Kokkos::resize(L_entries_d,
-    // L_entries_d.extent(0)-3); thandle.set_nnzL(L_entries_d.extent(0)+5);
-
-    using HostTmpViewType =
-        Kokkos::View<nnz_lno_t*, Kokkos::LayoutLeft, Kokkos::HostSpace>;
-
-    HostTmpViewType h_lev("h_lev", thandle.get_nnzU());
-    HostTmpViewType h_iw("h_iw", nrows);
-    HostTmpViewType h_iL("h_iL", nrows);
-    HostTmpViewType h_llev("h_llev", nrows);
 
-    size_type cntL = 0;
-    size_type cntU = 0;
-    size_type iU, ulev, lenu, lenl;
-
-    L_row_map(0) = 0;
-    U_row_map(0) = 0;
-
-    Kokkos::deep_copy(h_iw, nnz_lno_t(-1));
-
-    // Main loop
-    for (size_type i = 0; i < nrows; ++i) {
-      iU   = i;
-      ulev = i;
-      lenl = lenu = 0;
-
-      // Unpack the ith row
-      size_type k1 = A_row_map(i);
-      size_type k2 = A_row_map(i + 1);
-
-      for (size_type k = k1; k < k2; ++k) {
-        size_type col = static_cast<size_type>(A_entries(k));
-        if (col < nrows) {  // Ignore column elements that are not in the square
-                            // matrix
-          if (col > i) {    // U part
-            h_iw(col)           = lenu;
-            h_iL(iU + lenu)     = col;
-            h_llev(ulev + lenu) = 0;
-            lenu++;
-          } else if (col < i) {  // L part
-            h_iw(col)    = lenl;
-            h_iL(lenl)   = col;
-            h_llev(lenl) = 0;
-            lenl++;
-          }
+    // Each slot accumulates one row in work arrays of row_cap entries, which
+    // starts from the longest row of A times fill_lev + 1 and doubles (up to
+    // nrows) whenever a row does not fit, so the number of slots follows the
+    // concurrency and not nrows. Bound the total size of the slots on every
+    // backend by the storage of the factors (at least 256 MB), and on CUDA
+    // also by the free memory
+    nnz_lno_t max_row_len = 0;
+    Kokkos::parallel_reduce(
+        "KokkosSparse::spiluk_symbolic::max_row_len", range_policy(0, nrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i, nnz_lno_t& lmax) {
+          const nnz_lno_t len = A_row_map_d(i + 1) - A_row_map_d(i);
+          if (lmax < len) lmax = len;
+        },
+        Kokkos::Max<nnz_lno_t>(max_row_len));
+    nnz_lno_t row_cap = static_cast<nnz_lno_t>(std::min(
+        static_cast<size_t>(nrows),
+        std::max(size_t(1), static_cast<size_t>(max_row_len) *
+                                static_cast<size_t>(fill_lev + 1))));
+
+    const size_t work_budget =
+        std::max(size_t(256) << 20,
+                 static_cast<size_t>(L_entries_d.extent(0) +
+                                     U_entries_d.extent(0)) *
+                     sizeof(nnz_lno_t));
+    auto num_slots = [&](const nnz_lno_t cap) {
+      const size_t slot_byte = functor_type::slot_bytes(cap);
+      size_t n =
+          std::min(static_cast<size_t>(nrows),
+                   static_cast<size_t>(execution_space().concurrency()));
+      n = std::min(n, work_budget / slot_byte);
+#ifdef KOKKOS_ENABLE_CUDA
+      if (std::is_same<memory_space, Kokkos::CudaSpace>::value) {
+        size_t free_byte, total_byte;
+        KokkosKernels::Impl::kk_get_free_total_memory<memory_space>(
+            free_byte, total_byte);
+        n = std::min(n, static_cast<size_t>(0.5 *
+                                            static_cast<double>(free_byte) /
+                                            static_cast<double>(slot_byte)));
+      }
+#endif
+      return static_cast<nnz_lno_t>(std::max(n, size_t(1)));
+    };
+
+    functor_type functor(A_row_map_d, A_entries_d, nrows, fill_lev,
+                         L_entries_d.extent(0), U_entries_d.extent(0),
+                         dlevel_idx, num_slots(row_cap), row_cap);
+
+    // All rows are tried in the first sweep
+    HandleDeviceEntriesType frontier(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "frontier"), nrows);
+    HandleDeviceEntriesType next_frontier(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "next_frontier"),
+        nrows);
+    HandleDeviceEntriesType retry_next(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "retry_next"), nrows);
+    Kokkos::View<nnz_lno_t, memory_space> next_end("next_end");
+    Kokkos::parallel_for(
+        "KokkosSparse::spiluk_symbolic::init", range_policy(0, nrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i) { frontier(i) = i; });
+
+    auto done_level  = functor.done_level;
+    auto wait_head   = functor.wait_head;
+    auto next_waiter = functor.next_waiter;
+
+    size_type nlev    = 0;
+    nnz_lno_t nfront  = nrows;
+    nnz_lno_t lev_end = 0;
+    level_ptr(0)      = 0;
+    while (nfront > 0) {
+      functor.frontier = frontier;
+      functor.nfront   = nfront;
+      functor.sweep    = ++nlev;
+      while (functor.nfront > 0) {
+        Kokkos::deep_copy(functor.nretry, nnz_lno_t(0));
+        Kokkos::parallel_for(
+            "KokkosSparse::spiluk_symbolic::sweep",
+            range_policy(0, std::min(functor.nslots, functor.nfront)), functor);
+        Kokkos::deep_copy(functor.nfront, functor.nretry);
+        if (functor.nfront > 0) {
+          // Some rows do not fit in row_cap: grow the slots and retry these
+          // rows within the same sweep, so that they keep their level
+          row_cap = std::min(2 * row_cap, static_cast<nnz_lno_t>(nrows));
+          functor.alloc_work(num_slots(row_cap), row_cap);
+          functor.frontier = functor.retry;
+          std::swap(functor.retry, retry_next);
         }
       }
 
-      // Eliminate rows
-      nnz_lno_t j = -1;
-      while (static_cast<size_type>(++j) < lenl) {
-        size_type row  = search_col_index(j, lenl, h_iL, h_llev, h_iw);
-        nnz_lno_t jlev = h_llev(j);
-        k1             = U_row_map(row) + 1;
-        k2             = U_row_map(row + 1);
-        for (size_type k = k1; k < k2; ++k) {
-          size_type col  = static_cast<size_type>(U_entries(k));
-          nnz_lno_t lev1 = jlev + h_lev(k) + 1;
-          if (lev1 > fill_lev) continue;
-          nnz_lno_t ipos = h_iw(col);
-          if (ipos == -1) {  // Fill-in
-            if (col > i) {   // U part
-              h_iw(col)           = lenu;
-              h_iL(iU + lenu)     = col;
-              h_llev(ulev + lenu) = lev1;
-              lenu++;
-            } else if (col < i) {  // L part
-              h_iw(col)    = lenl;
-              h_iL(lenl)   = col;
-              h_llev(lenl) = lev1;
-              lenl++;
+      const nnz_lno_t lev_start = lev_end;
+      Kokkos::deep_copy(lev_end, functor.ndone);
+      level_ptr(nlev) = lev_end;
+
+      // Release the rows waiting on the rows completed in this sweep
+      Kokkos::deep_copy(next_end, nnz_lno_t(0));
+      Kokkos::parallel_for(
+          "KokkosSparse::spiluk_symbolic::release",
+          range_policy(lev_start, lev_end), KOKKOS_LAMBDA(const nnz_lno_t k) {
+            nnz_lno_t w = wait_head(dlevel_idx(k));
+            while (w != -1) {
+              next_frontier(Kokkos::atomic_fetch_add(&next_end(),
+                                                     nnz_lno_t(1))) = w;
+              w = next_waiter(w);
             }
-          } else {  // Not a fill-in
-            if (col > i)
-              h_llev(ulev + ipos) = std::min(h_llev(ulev + ipos), lev1);
-            else if (col < i)
-              h_llev(ipos) = std::min(h_llev(ipos), lev1);
-          }
-        }
-      }
+          });
+      Kokkos::deep_copy(nfront, next_end);
+      std::swap(frontier, next_frontier);
+    }
 
-      // Reset iw
-      for (size_type k = 0; k < lenl; ++k) h_iw(h_iL(k)) = -1;
-      for (size_type k = 0; k < lenu; ++k) h_iw(h_iL(iU + k)) = -1;
-
-      // Copy U part+diag and levels
-      if (cntU + lenu + 1 > static_cast<size_type>(U_entries_d.extent(0))) {
-        // size_type newsize = (size_type)(U_entries_d.extent(0)*EXPAND_FACT);
-        // Kokkos::resize(h_lev, newsize);
-        // Kokkos::resize(U_entries, newsize);
-        // Kokkos::resize(U_entries_d, newsize);
-        std::ostringstream os;
-        os << "KokkosSparse::Experimental::spiluk_symbolic: U_entries's extent "
-              "must be larger than "
-           << U_entries_d.extent(0);
-        KokkosKernels::Impl::throw_runtime_exception(os.str());
-      }
-      // U diag entry
-      U_entries(cntU) = i;
-      cntU++;
-      // U part
-      for (size_type k = 0; k < lenu; ++k) {
-        U_entries(cntU) = h_iL(iU + k);
-        h_lev(cntU)     = h_llev(ulev + k);
-        cntU++;
-      }
-      U_row_map(i + 1) = cntU;
+    Kokkos::parallel_for(
+        "KokkosSparse::spiluk_symbolic::level_list", range_policy(0, nrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i) { dlevel_list(i) = done_level(i); });
+
+    // Rows complete in arbitrary order, sort the rows of each level
+    Kokkos::deep_copy(dlevel_ptr, level_ptr);
+    KokkosSparse::sort_crs_graph(
+        execution_space(),
+        Kokkos::subview(dlevel_ptr, Kokkos::make_pair(size_type(0), nlev + 1)),
+        dlevel_idx);
+
+    int overflow = 0;
+    Kokkos::deep_copy(overflow, functor.overflow);
+
+    // Row maps of L and U
+    auto L_start = functor.L_start;
+    auto L_len   = functor.L_len;
+    auto L_tmp   = functor.L_tmp;
+    auto U_start = functor.U_start;
+    auto U_len   = functor.U_len;
+    auto U_tmp   = functor.U_tmp;
 
-      // Copy L part
+    size_type cntL = 0;
+    size_type cntU = 0;
+    Kokkos::parallel_scan(
+        "KokkosSparse::spiluk_symbolic::L_row_map", range_policy(0, nrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i, size_type& update, const bool final) {
 #ifdef KEEP_DIAG
-      if (cntL + lenl + 1 > static_cast<size_type>(L_entries_d.extent(0))) {
+          update += L_len(i) + 1;
 #else
-      if (cntL + lenl > static_cast<size_type>(L_entries_d.extent(0))) {
+          update += L_len(i);
 #endif
-        // size_type newsize = (size_type) (L_entries_d.extent(0)*EXPAND_FACT);
-        // Kokkos::resize(L_entries, newsize);
-        // Kokkos::resize(L_entries_d, newsize);
-        std::ostringstream os;
-        os << "KokkosSparse::Experimental::spiluk_symbolic: L_entries's extent "
-              "must be larger than "
-           << L_entries_d.extent(0);
-        KokkosKernels::Impl::throw_runtime_exception(os.str());
-      }
-      for (size_type k = 0; k < lenl; ++k) {
-        L_entries(cntL) = h_iL(k);
-        cntL++;
-      }
+          if (final) {
+            if (i == 0) L_row_map_d(0) = 0;
+            L_row_map_d(i + 1) = update;
+          }
+        },
+        cntL);
+    Kokkos::parallel_scan(
+        "KokkosSparse::spiluk_symbolic::U_row_map", range_policy(0, nrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i, size_type& update, const bool final) {
+          update += U_len(i) + 1;
+          if (final) {
+            if (i == 0) U_row_map_d(0) = 0;
+            U_row_map_d(i + 1) = update;
+          }
+        },
+        cntU);
+
+    if ((overflow & 1) ||
+        cntU > static_cast<size_type>(U_entries_d.extent(0))) {
+      std::ostringstream os;
+      os << "KokkosSparse::Experimental::spiluk_symbolic: U_entries's extent "
+            "must be larger than "
+         << U_entries_d.extent(0);
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    if ((overflow & 2) ||
+        cntL > static_cast<size_type>(L_entries_d.extent(0))) {
+      std::ostringstream os;
+      os << "KokkosSparse::Experimental::spiluk_symbolic: L_entries's extent "
+            "must be larger than "
+         << L_entries_d.extent(0);
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+
+    // Copy U diag + U part and L part (+ L diag)
+    Kokkos::parallel_for(
+        "KokkosSparse::spiluk_symbolic::copy", range_policy(0, nrows),
+        KOKKOS_LAMBDA(const nnz_lno_t i) {
+          size_type pos    = U_row_map_d(i);
+          U_entries_d(pos) = i;
+          for (nnz_lno_t k = 0; k < U_len(i); ++k)
+            U_entries_d(++pos) = U_tmp(U_start(i) + k);
+          pos = L_row_map_d(i);
+          for (nnz_lno_t k = 0; k < L_len(i); ++k)
+            L_entries_d(pos++) = L_tmp(L_start(i) + k);
 #ifdef KEEP_DIAG
-      // L diag entry
-      L_entries(cntL) = i;
-      cntL++;
+          L_entries_d(pos) = i;
 #endif
-      L_row_map(i + 1) = cntL;
-    }  // End main loop i
+        });
 
     thandle.set_nnzL(cntL);
     thandle.set_nnzU(cntU);
 
     // Sort
-    KokkosSparse::sort_crs_graph<Kokkos::DefaultHostExecutionSpace,
-                                 decltype(L_row_map), decltype(L_entries)>(
-        L_row_map, L_entries);
-    KokkosSparse::sort_crs_graph<Kokkos::DefaultHostExecutionSpace,
-                                 decltype(U_row_map), decltype(U_entries)>(
-        U_row_map, U_entries);
+    KokkosSparse::sort_crs_graph(execution_space(), L_row_map_d, L_entries_d);
+    KokkosSparse::sort_crs_graph(execution_space(), U_row_map_d, U_entries_d);
 
     // Level scheduling on L
+
     if (thandle.get_algorithm() ==
         KokkosSparse::Experimental::SPILUKAlgorithm::SEQLVLSCHD_TP1) {
-      level_sched_tp(thandle, L_row_map, L_entries, level_list, level_ptr,
-                     level_idx, nlev, nstreams);
+      level_sched_tp(thandle, level_ptr, nlev, nstreams);
       thandle.alloc_iw(thandle.get_level_maxrowsperchunk(), nrows);
     } else {
-      level_sched(thandle, L_row_map, L_entries, level_list, level_ptr,
-                  level_idx, nlev);
+      level_sched(thandle, level_ptr, nlev);
       thandle.alloc_iw(thandle.get_level_maxrows(), nrows);
     }
 
-    Kokkos::deep_copy(dlevel_ptr, level_ptr);
-    Kokkos::deep_copy(dlevel_idx, level_idx);
-    Kokkos::deep_copy(dlevel_list, level_list);
-
-    Kokkos::deep_copy(L_row_map_d, L_row_map);
-    Kokkos::deep_copy(L_entries_d, L_entries);
-    Kokkos::deep_copy(U_row_map_d, U_row_map);
-    Kokkos::deep_copy(U_entries_d, U_entries);
-
     thandle.set_symbolic_complete();
 
     // Output check
 #ifdef SYMBOLIC_OUTPUT_INFO
+    auto level_list =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dlevel_list);
+    auto level_idx =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), dlevel_idx);
+    auto L_row_map =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_row_map_d);
+    auto L_entries =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_entries_d);
+    auto U_row_map =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_row_map_d);
+    auto U_entries =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_entries_d);
+
     std::cout << "  ILU(k) fill_level: " << fill_lev << std::endl;
     std::cout << "  symbolic complete: " << thandle.is_symbolic_complete()
               << std::endl;
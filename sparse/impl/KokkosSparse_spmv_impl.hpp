@@ -23,6 +23,7 @@
 #include "Kokkos_InnerProductSpaceTraits.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosKernels_ExecSpaceUtils.hpp"
+#include "KokkosKernels_AccumulationType.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include "KokkosSparse_spmv_impl_omp.hpp"
 #include "KokkosSparse_spmv_impl_merge.hpp"
@@ -59,8 +60,8 @@ struct SPMV_Transpose_Functor {
     const auto row                = m_A.rowConst(iRow);
     const ordinal_type row_length = row.length;
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
-      const value_type val =
-          conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+      const auto val = KokkosKernels::Impl::widen<y_value_type>(
+          conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry));
       const ordinal_type ind = row.colidx(iEntry);
       Kokkos::atomic_add(&m_y(ind),
                          static_cast<y_value_type>(alpha * val * m_x(iRow)));
@@ -83,8 +84,9 @@ struct SPMV_Transpose_Functor {
           Kokkos::parallel_for(
               Kokkos::ThreadVectorRange(dev, row_length),
               [&](ordinal_type iEntry) {
-                const value_type val = conjugate ? ATV::conj(row.value(iEntry))
-                                                 : row.value(iEntry);
+                const auto val = KokkosKernels::Impl::widen<y_value_type>(
+                    conjugate ? ATV::conj(row.value(iEntry))
+                              : row.value(iEntry));
                 const ordinal_type ind = row.colidx(iEntry);
                 Kokkos::atomic_add(&m_y(ind), static_cast<y_value_type>(
                                                   alpha * val * m_x(iRow)));
@@ -101,18 +103,19 @@ struct SPMV_Functor {
   typedef typename Kokkos::TeamPolicy<execution_space> team_policy;
   typedef typename team_policy::member_type team_member;
   typedef Kokkos::ArithTraits<value_type> ATV;
+  typedef typename YVector::non_const_value_type coefficient_type;
 
-  const value_type alpha;
+  const coefficient_type alpha;
   AMatrix m_A;
   XVector m_x;
-  const value_type beta;
+  const coefficient_type beta;
   YVector m_y;
 
   const ordinal_type rows_per_team;
 
-  SPMV_Functor(const value_type alpha_, const AMatrix m_A_, const XVector m_x_,
-               const value_type beta_, const YVector m_y_,
-               const int rows_per_team_)
+  SPMV_Functor(const coefficient_type alpha_, const AMatrix m_A_,
+               const XVector m_x_, const coefficient_type beta_,
+               const YVector m_y_, const int rows_per_team_)
       : alpha(alpha_),
         m_A(m_A_),
         m_x(m_x_),
@@ -136,8 +139,8 @@ struct SPMV_Functor {
     y_value_type sum              = 0;
 
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
-      const value_type val =
-          conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry);
+      const auto val = KokkosKernels::Impl::widen<y_value_type>(
+          conjugate ? ATV::conj(row.value(iEntry)) : row.value(iEntry));
       sum += val * m_x(row.colidx(iEntry));
     }
 
@@ -171,8 +174,9 @@ struct SPMV_Functor {
           Kokkos::parallel_reduce(
               Kokkos::ThreadVectorRange(dev, row_length),
               [&](const ordinal_type& iEntry, y_value_type& lsum) {
-                const value_type val = conjugate ? ATV::conj(row.value(iEntry))
-                                                 : row.value(iEntry);
+                const auto val = KokkosKernels::Impl::widen<y_value_type>(
+                    conjugate ? ATV::conj(row.value(iEntry))
+                              : row.value(iEntry));
                 lsum += val * m_x(row.colidx(iEntry));
               },
               sum);
@@ -269,6 +273,7 @@ static void spmv_beta_no_transpose(
     /// serial impl
     typedef typename AMatrix::non_const_value_type value_type;
     typedef typename AMatrix::non_const_size_type size_type;
+    typedef typename YVector::non_const_value_type y_value_type;
     typedef Kokkos::ArithTraits<value_type> ATV;
 
     const size_type* KOKKOS_RESTRICT row_map_ptr    = A.graph.row_map.data();
@@ -301,14 +306,14 @@ static void spmv_beta_no_transpose(
           typename YVector::non_const_value_type tmp1(0), tmp2(0), tmp3(0),
               tmp4(0);
           for (int jj = 0; jj < jdist; ++jj) {
-            const value_type value1 =
-                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
-            const value_type value2 =
-                conjugate ? ATV::conj(values_ptr[j + 1]) : values_ptr[j + 1];
-            const value_type value3 =
-                conjugate ? ATV::conj(values_ptr[j + 2]) : values_ptr[j + 2];
-            const value_type value4 =
-                conjugate ? ATV::conj(values_ptr[j + 3]) : values_ptr[j + 3];
+            const auto value1 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j]);
+            const auto value2 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j + 1]) : values_ptr[j + 1]);
+            const auto value3 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j + 2]) : values_ptr[j + 2]);
+            const auto value4 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j + 3]) : values_ptr[j + 3]);
             const int col_idx1                        = col_idx_ptr[j];
             const int col_idx2                        = col_idx_ptr[j + 1];
             const int col_idx3                        = col_idx_ptr[j + 2];
@@ -324,8 +329,8 @@ static void spmv_beta_no_transpose(
             j += 4;
           }
           for (; j < jend; ++j) {
-            const value_type value =
-                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
+            const auto value = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j]);
             const int col_idx = col_idx_ptr[j];
             tmp1 += value * x_ptr[col_idx];
           }
@@ -497,6 +502,7 @@ static void spmv_beta_transpose(const execution_space& exec,
     if (exec.concurrency() == 1) {
       /// serial impl
       typedef typename AMatrix::non_const_value_type value_type;
+      typedef typename YVector::non_const_value_type y_value_type;
       typedef Kokkos::ArithTraits<value_type> ATV;
       const size_type* KOKKOS_RESTRICT row_map_ptr    = A.graph.row_map.data();
       const ordinal_type* KOKKOS_RESTRICT col_idx_ptr = A.graph.entries.data();
@@ -518,14 +524,14 @@ static void spmv_beta_transpose(const execution_space& exec,
           const typename XVector::const_value_type x_val = alpha * x_ptr[i];
           int j                                          = jbeg;
           for (int jj = 0; jj < jdist; ++jj) {
-            const value_type value1 =
-                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
-            const value_type value2 =
-                conjugate ? ATV::conj(values_ptr[j + 1]) : values_ptr[j + 1];
-            const value_type value3 =
-                conjugate ? ATV::conj(values_ptr[j + 2]) : values_ptr[j + 2];
-            const value_type value4 =
-                conjugate ? ATV::conj(values_ptr[j + 3]) : values_ptr[j + 3];
+            const auto value1 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j]);
+            const auto value2 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j + 1]) : values_ptr[j + 1]);
+            const auto value3 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j + 2]) : values_ptr[j + 2]);
+            const auto value4 = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j + 3]) : values_ptr[j + 3]);
             const int col_idx1 = col_idx_ptr[j];
             const int col_idx2 = col_idx_ptr[j + 1];
             const int col_idx3 = col_idx_ptr[j + 2];
@@ -537,8 +543,8 @@ static void spmv_beta_transpose(const execution_space& exec,
             j += 4;
           }
           for (; j < jend; ++j) {
-            const value_type value =
-                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j];
+            const auto value = KokkosKernels::Impl::widen<y_value_type>(
+                conjugate ? ATV::conj(values_ptr[j]) : values_ptr[j]);
             const int col_idx = col_idx_ptr[j];
             y_ptr[col_idx] += value * x_val;
           }
@@ -698,9 +704,9 @@ struct SPMV_MV_Transpose_Functor {
     const ordinal_type row_length = row.length;
 
     for (ordinal_type iEntry = 0; iEntry < row_length; iEntry++) {
-      const A_value_type val =
+      const auto val = KokkosKernels::Impl::widen<y_value_type>(
           conjugate ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
-                    : row.value(iEntry);
+                    : row.value(iEntry));
       const ordinal_type ind = row.colidx(iEntry);
 
       if (doalpha != 1) {
@@ -740,10 +746,10 @@ struct SPMV_MV_Transpose_Functor {
           Kokkos::parallel_for(
               Kokkos::ThreadVectorRange(dev, row_length),
               [&](ordinal_type iEntry) {
-                const A_value_type val =
+                const auto val = KokkosKernels::Impl::widen<y_value_type>(
                     conjugate ? Kokkos::ArithTraits<A_value_type>::conj(
                                     row.value(iEntry))
-                              : row.value(iEntry);
+                              : row.value(iEntry));
                 const ordinal_type ind = row.colidx(iEntry);
 
                 if (doalpha != 1) {
@@ -828,10 +834,10 @@ struct SPMV_MV_LayoutLeft_Functor {
 
     Kokkos::parallel_for(
         Kokkos::ThreadVectorRange(dev, row.length), [&](ordinal_type iEntry) {
-          const A_value_type val =
+          const auto val = KokkosKernels::Impl::widen<y_value_type>(
               conjugate
                   ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
-                  : row.value(iEntry);
+                  : row.value(iEntry));
           const ordinal_type ind = row.colidx(iEntry);
 #ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
 #pragma unroll
@@ -917,9 +923,9 @@ struct SPMV_MV_LayoutLeft_Functor {
     // never have enough duplicate entries to overflow ordinal_type.
 
     for (ordinal_type iEntry = 0; iEntry < row.length; iEntry++) {
-      const A_value_type val =
+      const auto val = KokkosKernels::Impl::widen<y_value_type>(
           conjugate ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
-                    : row.value(iEntry);
+                    : row.value(iEntry));
       const ordinal_type ind = row.colidx(iEntry);
 #ifdef KOKKOS_ENABLE_PRAGMA_UNROLL
 #pragma unroll
@@ -961,10 +967,10 @@ struct SPMV_MV_LayoutLeft_Functor {
     Kokkos::parallel_reduce(
         Kokkos::ThreadVectorRange(dev, row.length),
         [&](ordinal_type iEntry, y_value_type& lsum) {
-          const A_value_type val =
+          const auto val = KokkosKernels::Impl::widen<y_value_type>(
               conjugate
                   ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
-                  : row.value(iEntry);
+                  : row.value(iEntry));
           lsum += val * m_x(row.colidx(iEntry), 0);
         },
         sum);
@@ -997,9 +1003,9 @@ struct SPMV_MV_LayoutLeft_Functor {
 
     y_value_type sum = y_value_type();
     for (ordinal_type iEntry = 0; iEntry < row.length; iEntry++) {
-      const A_value_type val =
+      const auto val = KokkosKernels::Impl::widen<y_value_type>(
           conjugate ? Kokkos::ArithTraits<A_value_type>::conj(row.value(iEntry))
-                    : row.value(iEntry);
+                    : row.value(iEntry));
       sum += val * m_x(row.colidx(iEntry), 0);
     }
     if (doalpha == -1) {
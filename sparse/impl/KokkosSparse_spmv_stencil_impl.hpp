@@ -0,0 +1,272 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+#ifndef KOKKOSSPARSE_IMPL_SPMV_STENCIL_HPP_
+#define KOKKOSSPARSE_IMPL_SPMV_STENCIL_HPP_
+
+#include <algorithm>
+#include <cstdlib>
+#include <sstream>
+
+#include "Kokkos_Core.hpp"
+#include "Kokkos_ArithTraits.hpp"
+#include "KokkosKernels_Error.hpp"
+
+namespace KokkosSparse {
+namespace Impl {
+
+// Grid points are numbered with i fastest: row = i + ni * (j + nj * k), the
+// same numbering used by spmv_struct. Stencil entry s couples point (i, j, k)
+// to (i + di, j + dj, k + dk) with (di, dj, dk) = offsets(s, 0:3); neighbors
+// outside of the grid are dropped.
+struct StencilGrid {
+  int64_t ni = 1, nj = 1, nk = 1;
+  int ri = 0, rj = 0, rk = 0;  // stencil radius in each direction
+
+  template <class StructureView, class OffsetView>
+  StencilGrid(const StructureView& structure, const OffsetView& offsets) {
+    const int numDimensions = structure.extent(0);
+    if (numDimensions < 1 || numDimensions > 3) {
+      std::ostringstream os;
+      os << "KokkosSparse::spmv_stencil: structure must hold 1 to 3 "
+            "dimensions, got "
+         << numDimensions;
+      KokkosKernels::Impl::throw_runtime_exception(os.str());
+    }
+    ni = structure(0);
+    if (numDimensions > 1) nj = structure(1);
+    if (numDimensions > 2) nk = structure(2);
+    for (size_t s = 0; s < offsets.extent(0); ++s) {
+      ri = std::max<int>(ri, std::abs(offsets(s, 0)));
+      rj = std::max<int>(rj, std::abs(offsets(s, 1)));
+      rk = std::max<int>(rk, std::abs(offsets(s, 2)));
+    }
+  }
+
+  int64_t numPoints() const { return ni * nj * nk; }
+};
+
+// Applies the stencil on tiles of ti x tj points that march through a chunk of
+// tk planes (2.5D blocking). The x values of the 2 * rk + 1 planes in reach of
+// the current output plane, including a halo of ri and rj points, are kept in
+// a ring buffer in team scratch, so every x value is read from global memory
+// once per tile and no column indices are read at all.
+template <class execution_space, class OffsetView, class CoefView,
+          class XVector, class YVector, int dobeta>
+struct SPMV_Stencil_Functor {
+  using team_policy    = Kokkos::TeamPolicy<execution_space>;
+  using team_member    = typename team_policy::member_type;
+  using scratch_space  = typename execution_space::scratch_memory_space;
+  using x_value_type   = typename XVector::non_const_value_type;
+  using y_value_type   = typename YVector::non_const_value_type;
+  using scratch_x_view = Kokkos::View<x_value_type*, scratch_space,
+                                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+  using scratch_i_view = Kokkos::View<int*, scratch_space,
+                                      Kokkos::MemoryTraits<Kokkos::Unmanaged>>;
+
+  const y_value_type alpha;
+  OffsetView m_offsets;
+  CoefView m_coef;
+  XVector m_x;
+  const y_value_type beta;
+  YVector m_y;
+
+  const StencilGrid grid;
+  const int numStencil;
+  const int ti, tj, tk;
+  // halo-extended tile width and height, and the number of planes kept
+  const int wi, wj, numPlanes;
+  const int64_t ntI, ntJ;
+
+  SPMV_Stencil_Functor(const y_value_type alpha_, const OffsetView& offsets_,
+                       const CoefView& coef_, const XVector& x_,
+                       const y_value_type beta_, const YVector& y_,
+                       const StencilGrid& grid_, const int ti_, const int tj_,
+                       const int tk_)
+      : alpha(alpha_),
+        m_offsets(offsets_),
+        m_coef(coef_),
+        m_x(x_),
+        beta(beta_),
+        m_y(y_),
+        grid(grid_),
+        numStencil(offsets_.extent(0)),
+        ti(ti_),
+        tj(tj_),
+        tk(tk_),
+        wi(ti_ + 2 * grid_.ri),
+        wj(tj_ + 2 * grid_.rj),
+        numPlanes(2 * grid_.rk + 1),
+        ntI((grid_.ni + ti_ - 1) / ti_),
+        ntJ((grid_.nj + tj_ - 1) / tj_) {}
+
+  size_t team_shmem_size(int /*team_size*/) const {
+    return scratch_x_view::shmem_size(numPlanes * wi * wj) +
+           scratch_i_view::shmem_size(2 * numStencil);
+  }
+
+  int64_t num_tiles() const { return ntI * ntJ * ((grid.nk + tk - 1) / tk); }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const team_member& dev) const {
+    const int64_t tile = dev.league_rank();
+    const int64_t ti0  = (tile % ntI) * ti;
+    const int64_t tj0  = ((tile / ntI) % ntJ) * tj;
+    const int64_t tk0  = (tile / (ntI * ntJ)) * tk;
+    const int64_t tk1  = tk0 + tk < grid.nk ? tk0 + tk : grid.nk;
+    const int plane    = wi * wj;
+
+    scratch_x_view xs(dev.team_scratch(0), numPlanes * plane);
+    // per stencil entry: the plane offset dk and the in-plane shift
+    scratch_i_view shifts(dev.team_scratch(0), 2 * numStencil);
+    Kokkos::parallel_for(Kokkos::TeamThreadRange(dev, numStencil),
+                         [&](const int s) {
+                           shifts(2 * s)     = m_offsets(s, 2);
+                           shifts(2 * s + 1) = m_offsets(s, 1) * wi +
+                                               m_offsets(s, 0);
+                         });
+
+    for (int64_t kk = tk0 - grid.rk; kk < tk1 + grid.rk; ++kk) {
+      // load plane kk with its halo, zero outside of the grid
+      const int slot = (kk - tk0 + grid.rk) % numPlanes;
+      Kokkos::parallel_for(
+          Kokkos::TeamThreadRange(dev, plane), [&](const int idx) {
+            const int64_t gi  = ti0 - grid.ri + idx % wi;
+            const int64_t gj  = tj0 - grid.rj + idx / wi;
+            const bool inside = gi >= 0 && gi < grid.ni && gj >= 0 &&
+                                gj < grid.nj && kk >= 0 && kk < grid.nk;
+            xs(slot * plane + idx) =
+                inside ? m_x(gi + grid.ni * (gj + grid.nj * kk))
+                       : Kokkos::ArithTraits<x_value_type>::zero();
+          });
+      dev.team_barrier();
+
+      // every plane in reach of k = kk - rk is loaded now
+      const int64_t k = kk - grid.rk;
+      if (k >= tk0) {
+        Kokkos::parallel_for(
+            Kokkos::TeamThreadRange(dev, ti * tj), [&](const int p) {
+              const int li     = p % ti;
+              const int lj     = p / ti;
+              const int64_t gi = ti0 + li;
+              const int64_t gj = tj0 + lj;
+              if (gi >= grid.ni || gj >= grid.nj) return;
+              const int64_t row = gi + grid.ni * (gj + grid.nj * k);
+              const int center  = (lj + grid.rj) * wi + li + grid.ri;
+
+              y_value_type sum = Kokkos::ArithTraits<y_value_type>::zero();
+              for (int s = 0; s < numStencil; ++s) {
+                const int kslot =
+                    (k + shifts(2 * s) - tk0 + grid.rk) % numPlanes;
+                sum += m_coef(row, s) *
+                       xs(kslot * plane + center + shifts(2 * s + 1));
+              }
+              if (dobeta == 0) {
+                m_y(row) = alpha * sum;
+              } else {
+                m_y(row) = beta * m_y(row) + alpha * sum;
+              }
+            });
+      }
+      // the next load overwrites the oldest plane
+      dev.team_barrier();
+    }
+  }
+};
+
+template <class execution_space, class OffsetView, class CoefView,
+          class XVector, class YVector>
+void spmv_stencil(const execution_space& space, const StencilGrid& grid,
+                  const typename YVector::non_const_value_type& alpha,
+                  const OffsetView& offsets, const CoefView& coef,
+                  const XVector& x,
+                  const typename YVector::non_const_value_type& beta,
+                  const YVector& y) {
+  using y_value_type = typename YVector::non_const_value_type;
+
+  // tiles are wide in i so that loads and stores of a tile row are contiguous
+  const int ti = std::min<int64_t>(grid.ni, 32);
+  const int tj = std::min<int64_t>(grid.nj, 8);
+  const int tk = std::min<int64_t>(grid.nk, 32);
+
+  if (beta == Kokkos::ArithTraits<y_value_type>::zero()) {
+    SPMV_Stencil_Functor<execution_space, OffsetView, CoefView, XVector,
+                         YVector, 0>
+        func(alpha, offsets, coef, x, beta, y, grid, ti, tj, tk);
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_stencil",
+        Kokkos::TeamPolicy<execution_space>(space, func.num_tiles(),
+                                            Kokkos::AUTO),
+        func);
+  } else {
+    SPMV_Stencil_Functor<execution_space, OffsetView, CoefView, XVector,
+                         YVector, 1>
+        func(alpha, offsets, coef, x, beta, y, grid, ti, tj, tk);
+    Kokkos::parallel_for(
+        "KokkosSparse::spmv_stencil",
+        Kokkos::TeamPolicy<execution_space>(space, func.num_tiles(),
+                                            Kokkos::AUTO),
+        func);
+  }
+}
+
+// Scatters the entries of a CrsMatrix on the grid into stencil coefficients.
+// Returns the number of entries whose column is not reached by the stencil.
+template <class execution_space, class AMatrix, class OffsetView,
+          class CoefView>
+int64_t extract_stencil_coefficients(const execution_space& space,
+                                     const StencilGrid& grid,
+                                     const OffsetView& offsets,
+                                     const AMatrix& A, const CoefView& coef) {
+  using ordinal_type = typename AMatrix::non_const_ordinal_type;
+  using size_type    = typename AMatrix::non_const_size_type;
+  using value_type   = typename CoefView::non_const_value_type;
+
+  const int numStencil = offsets.extent(0);
+  Kokkos::deep_copy(space, coef, Kokkos::ArithTraits<value_type>::zero());
+  int64_t numMissed = 0;
+  Kokkos::parallel_reduce(
+      "KokkosSparse::extract_stencil_coefficients",
+      Kokkos::RangePolicy<execution_space>(space, 0, A.numRows()),
+      KOKKOS_LAMBDA(const ordinal_type row, int64_t& update) {
+        const int64_t i = row % grid.ni;
+        const int64_t j = (row / grid.ni) % grid.nj;
+        const int64_t k = row / (grid.ni * grid.nj);
+        for (size_type e = A.graph.row_map(row); e < A.graph.row_map(row + 1);
+             ++e) {
+          const int64_t col = A.graph.entries(e);
+          const int64_t di  = col % grid.ni - i;
+          const int64_t dj  = (col / grid.ni) % grid.nj - j;
+          const int64_t dk  = col / (grid.ni * grid.nj) - k;
+          int s             = 0;
+          while (s < numStencil &&
+                 (offsets(s, 0) != di || offsets(s, 1) != dj ||
+                  offsets(s, 2) != dk))
+            ++s;
+          if (s < numStencil)
+            coef(row, s) += A.values(e);
+          else
+            ++update;
+        }
+      },
+      numMissed);
+  return numMissed;
+}
+
+}  // namespace Impl
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_IMPL_SPMV_STENCIL_HPP_
@@ -4034,6 +4034,84 @@ void tri_solve_chain(TriSolveHandle &thandle, const RowMapType row_map,
 
 }  // end tri_solve_chain
 
+// One Jacobi sweep x_new = D^{-1} (b - (A - D) x_old) for a lower or upper
+// triangular A; the first sweep starts from x_old = 0
+template <class RowMapType, class EntriesType, class ValuesType,
+          class XOldType, class XNewType, class RHSType>
+struct TriJacobiSweepFunctor {
+  typedef typename EntriesType::non_const_value_type lno_t;
+  typedef typename XNewType::non_const_value_type scalar_t;
+  RowMapType row_map;
+  EntriesType entries;
+  ValuesType values;
+  XOldType x_old;
+  XNewType x_new;
+  RHSType rhs;
+  bool first;
+
+  TriJacobiSweepFunctor(const RowMapType &row_map_,
+                        const EntriesType &entries_, const ValuesType &values_,
+                        const XOldType &x_old_, const XNewType &x_new_,
+                        const RHSType &rhs_, const bool first_)
+      : row_map(row_map_),
+        entries(entries_),
+        values(values_),
+        x_old(x_old_),
+        x_new(x_new_),
+        rhs(rhs_),
+        first(first_) {}
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const lno_t rowid) const {
+    scalar_t rhs_rowid = rhs(rowid);
+    scalar_t diag      = scalar_t(1.0);
+    for (auto ptr = row_map(rowid); ptr < row_map(rowid + 1); ++ptr) {
+      auto colid = entries(ptr);
+      if (colid == rowid)
+        diag = values(ptr);
+      else if (!first)
+        rhs_rowid -= values(ptr) * x_old(colid);
+    }
+    x_new(rowid) = rhs_rowid / diag;
+  }
+};
+
+// Approximate solve by a fixed number of Jacobi sweeps. Each sweep is one
+// SpMV-like kernel over all rows, so the cost does not depend on the number
+// of levels of the matrix. The sweeps alternate between lhs and the work
+// vector of the handle, ending in lhs.
+template <class TriSolveHandle, class RowMapType, class EntriesType,
+          class ValuesType, class RHSType, class LHSType>
+void tri_solve_jacobi(TriSolveHandle &thandle, const RowMapType row_map,
+                      const EntriesType entries, const ValuesType values,
+                      const RHSType &rhs, LHSType &lhs) {
+  typedef typename TriSolveHandle::execution_space execution_space;
+  typedef typename TriSolveHandle::nnz_scalar_view_t WorkType;
+  typedef Kokkos::RangePolicy<execution_space> policy_type;
+
+  // At least one sweep, x = D^{-1} b
+  const int nsweeps = std::max(thandle.get_jacobi_sweeps(), 1);
+  const auto nrows  = thandle.get_nrows();
+  WorkType work     = thandle.get_jacobi_work();
+
+  for (int sweep = 0; sweep < nsweeps; ++sweep) {
+    const bool first = (sweep == 0);
+    if ((nsweeps - 1 - sweep) % 2 == 0) {
+      Kokkos::parallel_for(
+          "parfor_jacobi", policy_type(0, nrows),
+          TriJacobiSweepFunctor<RowMapType, EntriesType, ValuesType, WorkType,
+                                LHSType, RHSType>(row_map, entries, values,
+                                                  work, lhs, rhs, first));
+    } else {
+      Kokkos::parallel_for(
+          "parfor_jacobi", policy_type(0, nrows),
+          TriJacobiSweepFunctor<RowMapType, EntriesType, ValuesType, LHSType,
+                                WorkType, RHSType>(row_map, entries, values,
+                                                   lhs, work, rhs, first));
+    }
+  }
+}  // end tri_solve_jacobi
+
 // --------------------------------
 // Stream interfaces
 // --------------------------------
@@ -133,6 +133,10 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType,
           KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
         Experimental::tri_solve_chain(*sptrsv_handle, row_map, entries, values,
                                       b, x, true);
+      } else if (sptrsv_handle->get_algorithm() ==
+                 KokkosSparse::Experimental::SPTRSVAlgorithm::SPTRSV_JACOBI) {
+        Experimental::tri_solve_jacobi(*sptrsv_handle, row_map, entries,
+                                       values, b, x);
       } else {
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
         using ExecSpace = typename RowMapType::memory_space::execution_space;
@@ -152,6 +156,10 @@ struct SPTRSV_SOLVE<ExecutionSpace, KernelHandle, RowMapType, EntriesType,
           KokkosSparse::Experimental::SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
         Experimental::tri_solve_chain(*sptrsv_handle, row_map, entries, values,
                                       b, x, false);
+      } else if (sptrsv_handle->get_algorithm() ==
+                 KokkosSparse::Experimental::SPTRSVAlgorithm::SPTRSV_JACOBI) {
+        Experimental::tri_solve_jacobi(*sptrsv_handle, row_map, entries,
+                                       values, b, x);
       } else {
 #ifdef KOKKOSKERNELS_SPTRSV_CUDAGRAPHSUPPORT
         using ExecSpace = typename RowMapType::memory_space::execution_space;
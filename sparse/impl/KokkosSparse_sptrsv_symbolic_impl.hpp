@@ -22,6 +22,8 @@
 #include <KokkosKernels_config.h>
 #include <Kokkos_ArithTraits.hpp>
 #include <KokkosSparse_sptrsv_handle.hpp>
+#include <KokkosSparse_SortCrs.hpp>
+#include <KokkosSparse_Utils.hpp>
 
 //#define TRISOLVE_SYMB_TIMERS
 //#define LVL_OUTPUT_INFO
@@ -54,6 +56,13 @@ void print_view1d_symbolic(const ViewType dv, size_t range = 0) {
 //     call current_alg
 //   else
 //     call single_block(s,e)
+//
+// A chain ends after level j-1 (i.e. j is stored in h_chain_ptr) when j is
+// the last level, or when either level j-1 or level j has more nodes than
+// the chain threshold: levels above the threshold are always solved alone
+// and consecutive levels below it are linked together. Since this only
+// depends on the neighboring levels, the chain pointers are found with a
+// single scan over the levels.
 
 template <class TriSolveHandle, class NPLViewType>
 void symbolic_chain_phase(TriSolveHandle& thandle,
@@ -61,74 +70,37 @@ void symbolic_chain_phase(TriSolveHandle& thandle,
 #ifdef TRISOLVE_SYMB_TIMERS
   Kokkos::Timer timer_sym_chain_total;
 #endif
-  typedef typename TriSolveHandle::size_type size_type;
+  using execution_space       = typename TriSolveHandle::execution_space;
+  using range_policy          = Kokkos::RangePolicy<execution_space>;
+  using size_type             = typename TriSolveHandle::size_type;
+  using signed_nnz_lno_view_t = typename TriSolveHandle::signed_nnz_lno_view_t;
 
   size_type nlevels = thandle.get_num_levels();
 
   // Create the chain now
-  // FIXME Implementations will need to be templated on exec space it seems...
-  auto cutoff_threshold = thandle.get_chain_threshold();
   if (thandle.algm_requires_symb_chain()) {
-    auto h_chain_ptr            = thandle.get_host_chain_ptr();
-    h_chain_ptr(0)              = 0;
-    size_type chainlinks_length = 0;
-    size_type num_chain_entries = 0;
-    int chain_state             = 0;
-    const int cutoff            = cutoff_threshold;
-    for (size_type i = 0; i < nlevels; ++i) {
-      auto cnpl = nodes_per_level(i);
-      if (cnpl <= cutoff) {
-        // this nlevels may be part of a chain passed to the "single_block"
-        // solver to reduce kernel launches
-        chainlinks_length += 1;
-      } else {
-        // Too many levels to run on single block...
-        // If first lvl <= cutoff but next nlevels isn't, the two aren't
-        // separately updated and info is lost... if chainlinks_length > 0, take
-        // path so that chain-links updated, then current too large chain
-        // updated (i.e. 2 updates); if chainlinks_length == 0, then no previous
-        // chains and only one update required (npl too large for single-block
-        chain_state = chainlinks_length > 0 ? 2 : 1;
-      }
+    auto h_chain_ptr = thandle.get_host_chain_ptr();
+    const auto cutoff =
+        static_cast<typename NPLViewType::non_const_value_type>(
+            thandle.get_chain_threshold());
 
-      // if we hit final nlevels before a trigger to update the chain, than
-      // override it in this case, there was not a larger value to miss cutoff
-      // and reset the update
-      if (chain_state == 0 && i == nlevels - 1) {
-        chain_state = 1;
-      }
-
-      if (chain_state == 1) {
-        num_chain_entries += 1;
-        if (chainlinks_length == 0) {
-          h_chain_ptr(num_chain_entries) =
-              h_chain_ptr(num_chain_entries - 1) + 1;
-        } else {
-          h_chain_ptr(num_chain_entries) =
-              h_chain_ptr(num_chain_entries - 1) + chainlinks_length;
-        }
-        chainlinks_length = 0;  // reset
-        chain_state       = 0;  // reset
-      }
-      // Two updates required - should only occur if chainlinks_length > 0
-      // We have found two things: a non-one length chain, and a subsequent one
-      // length chain
-      if (chain_state == 2) {
-        if (chainlinks_length == 0) {
-          throw(std::runtime_error("MAJOR LOGIC ERROR! TERMINATE!"));
-        }
-
-        num_chain_entries += 1;
-        h_chain_ptr(num_chain_entries) =
-            h_chain_ptr(num_chain_entries - 1) + chainlinks_length;
-
-        num_chain_entries += 1;
-        h_chain_ptr(num_chain_entries) = h_chain_ptr(num_chain_entries - 1) + 1;
+    signed_nnz_lno_view_t chain_ptr("chain_ptr", nlevels + 1);
+    size_type num_chain_entries = 0;
+    Kokkos::parallel_scan(
+        "KokkosSparse::sptrsv::symbolic_chain_phase",
+        range_policy(1, nlevels + 1),
+        KOKKOS_LAMBDA(const size_type j, size_type& update, const bool final) {
+          if (j == nlevels || nodes_per_level(j - 1) > cutoff ||
+              nodes_per_level(j) > cutoff) {
+            ++update;
+            if (final) chain_ptr(update) = j;
+          }
+        },
+        num_chain_entries);
 
-        chainlinks_length = 0;  // reset
-        chain_state       = 0;  // reset
-      }
-    }
+    const auto range = Kokkos::make_pair(size_type(0), num_chain_entries + 1);
+    Kokkos::deep_copy(Kokkos::subview(h_chain_ptr, range),
+                      Kokkos::subview(chain_ptr, range));
     thandle.set_num_chain_entries(num_chain_entries);
 
 #ifdef CHAIN_LVL_OUTPUT_INFO
@@ -147,150 +119,177 @@ void symbolic_chain_phase(TriSolveHandle& thandle,
 #endif
 }  // end symbolic_chain_phase
 
-template <class TriSolveHandle, class RowMapType, class EntriesType>
-void lower_tri_symbolic(TriSolveHandle& thandle, const RowMapType drow_map,
-                        const EntriesType dentries) {
-#ifdef TRISOLVE_SYMB_TIMERS
-  Kokkos::Timer timer_sym_lowertri_total;
-  Kokkos::Timer timer;
-#endif
-
-  using namespace KokkosSparse::Experimental;
-  if (thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_RP ||
-      thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
-      /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
-      thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
-    // Scheduling currently computes on host - need host copy of all views
-
-    typedef typename TriSolveHandle::size_type size_type;
-
-    typedef typename TriSolveHandle::nnz_lno_view_t DeviceEntriesType;
-
-    typedef
-        typename TriSolveHandle::signed_nnz_lno_view_t DeviceSignedEntriesType;
-    typedef typename TriSolveHandle::signed_nnz_lno_view_t::HostMirror
-        HostSignedEntriesType;
-
-    typedef typename TriSolveHandle::signed_integral_t signed_integral_t;
+// Level scheduling for the SEQLVLSCHD algorithms, computed on the execution
+// space of the handle. Row i of a lower (upper) triangular matrix depends on
+// the rows given by its column indices below (above) i. Starting from the rows
+// without dependencies, each level is the frontier of rows whose dependencies
+// have all been scheduled in previous levels: one kernel per level visits the
+// rows of the current level and releases their dependents into the next one.
+// The frontiers are written back to back into nodes_grouped_by_level, so no
+// separate grouping pass is needed; rows within a level are finally sorted to
+// keep them in ascending order.
+template <bool IsLower, class TriSolveHandle, class RowMapType,
+          class EntriesType>
+void tri_symbolic_level_sched(TriSolveHandle& thandle,
+                              const RowMapType drow_map,
+                              const EntriesType dentries) {
+  using execution_space   = typename TriSolveHandle::execution_space;
+  using memory_space      = typename TriSolveHandle::memory_space;
+  using range_policy      = Kokkos::RangePolicy<execution_space>;
+  using size_type         = typename TriSolveHandle::size_type;
+  using nnz_lno_t         = typename TriSolveHandle::nnz_lno_t;
+  using signed_integral_t = typename TriSolveHandle::signed_integral_t;
+  using nnz_row_view_t    = typename TriSolveHandle::nnz_row_view_t;
+  using nnz_lno_view_t    = typename TriSolveHandle::nnz_lno_view_t;
+  using counter_view_t    = Kokkos::View<nnz_lno_t, memory_space>;
+
+  // Necessary for partitioned persisting sparse matrix
+  const nnz_lno_t nrows = drow_map.extent(0) - 1;
+
+  auto level_list              = thandle.get_level_list();
+  auto dnodes_per_level        = thandle.get_nodes_per_level();
+  auto nodes_per_level         = thandle.get_host_nodes_per_level();
+  auto dnodes_grouped_by_level = thandle.get_nodes_grouped_by_level();
+  auto nodes_grouped_by_level  = thandle.get_host_nodes_grouped_by_level();
+
+  // Number of rows each row is still waiting on
+  nnz_lno_view_t num_deps(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "num_deps"), nrows);
+  Kokkos::parallel_for(
+      "KokkosSparse::sptrsv::level_sched::count_deps", range_policy(0, nrows),
+      KOKKOS_LAMBDA(const nnz_lno_t i) {
+        nnz_lno_t count = 0;
+        for (size_type k = drow_map(i); k < drow_map(i + 1); ++k) {
+          const nnz_lno_t col = dentries(k);
+          if (IsLower ? col < i : col > i) ++count;
+        }
+        num_deps(i) = count;
+      });
+
+  // Rows depending on each row, i.e. the transposed graph
+  nnz_row_view_t t_row_map("t_row_map", nrows + 1);
+  nnz_lno_view_t t_entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "t_entries"),
+      dentries.extent(0));
+  KokkosSparse::Impl::transpose_graph<RowMapType, EntriesType, nnz_row_view_t,
+                                      nnz_lno_view_t, nnz_row_view_t,
+                                      execution_space>(
+      nrows, nrows, drow_map, dentries, t_row_map, t_entries);
+
+  // The first frontier is the rows without dependencies
+  counter_view_t frontier_end("frontier_end");
+  Kokkos::parallel_for(
+      "KokkosSparse::sptrsv::level_sched::seed", range_policy(0, nrows),
+      KOKKOS_LAMBDA(const nnz_lno_t i) {
+        if (num_deps(i) == 0)
+          dnodes_grouped_by_level(
+              Kokkos::atomic_fetch_add(&frontier_end(), nnz_lno_t(1))) = i;
+      });
+
+  Kokkos::deep_copy(nodes_per_level, nnz_lno_t(0));
+  nnz_lno_t level_begin = 0, level_end = 0;
+  Kokkos::deep_copy(level_end, frontier_end);
+
+  signed_integral_t nlevels = 0;
+  while (level_begin < level_end) {
+    nodes_per_level(nlevels) = level_end - level_begin;
+
+    // level_list is 1-based
+    const signed_integral_t level = ++nlevels;
+    Kokkos::parallel_for(
+        "KokkosSparse::sptrsv::level_sched::frontier",
+        range_policy(level_begin, level_end),
+        KOKKOS_LAMBDA(const nnz_lno_t k) {
+          const nnz_lno_t row = dnodes_grouped_by_level(k);
+          level_list(row)     = level;
+          for (size_type t = t_row_map(row); t < t_row_map(row + 1); ++t) {
+            const nnz_lno_t dep = t_entries(t);
+            if (!(IsLower ? dep > row : dep < row)) continue;
+            // the last dependency to be scheduled releases the row
+            if (Kokkos::atomic_fetch_sub(&num_deps(dep), nnz_lno_t(1)) == 1)
+              dnodes_grouped_by_level(
+                  Kokkos::atomic_fetch_add(&frontier_end(), nnz_lno_t(1))) =
+                  dep;
+          }
+        });
 
-    // Necessary for partitioned persisting sparse matrix
-    size_type nrows = drow_map.extent(0) - 1;
+    level_begin = level_end;
+    Kokkos::deep_copy(level_end, frontier_end);
+  }
 
-    auto row_map = Kokkos::create_mirror_view(drow_map);
-    Kokkos::deep_copy(row_map, drow_map);
+  // Frontiers are filled in arbitrary order, sort the rows of each level
+  nnz_row_view_t level_ptr(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "level_ptr"),
+      nlevels + 1);
+  {
+    auto h_level_ptr = Kokkos::create_mirror_view(level_ptr);
+    h_level_ptr(0)   = 0;
+    for (signed_integral_t l = 0; l < nlevels; ++l)
+      h_level_ptr(l + 1) = h_level_ptr(l) + nodes_per_level(l);
+    Kokkos::deep_copy(level_ptr, h_level_ptr);
+  }
+  KokkosSparse::sort_crs_graph(execution_space(), level_ptr,
+                               dnodes_grouped_by_level);
 
-    auto entries = Kokkos::create_mirror_view(dentries);
-    Kokkos::deep_copy(entries, dentries);
-
-    // get device view - will deep_copy to it at end of this host routine
-    DeviceEntriesType dnodes_per_level = thandle.get_nodes_per_level();
-    auto nodes_per_level               = thandle.get_host_nodes_per_level();
-
-    // get device view - will deep_copy to it at end of this host routine
-    DeviceEntriesType dnodes_grouped_by_level =
-        thandle.get_nodes_grouped_by_level();
-    auto nodes_grouped_by_level = thandle.get_host_nodes_grouped_by_level();
-
-    DeviceSignedEntriesType dlevel_list = thandle.get_level_list();
-    HostSignedEntriesType level_list = Kokkos::create_mirror_view(dlevel_list);
-    Kokkos::deep_copy(level_list, dlevel_list);
-
-    signed_integral_t level = 0;
-    size_type node_count    = 0;
-
-    typename DeviceEntriesType::HostMirror level_ptr(
-        "lp", nrows + 1);  // temp View used for index bookkeeping
-    level_ptr(0) = 0;
-    for (size_type i = 0; i < nrows; ++i) {
-      signed_integral_t l = 0;
-      size_type rowstart  = row_map(i);
-      size_type rowend    = row_map(i + 1);
-      for (size_type j = rowstart; j < rowend; j++) {
-        size_type col = entries(j);
-        l             = std::max(l, level_list(col));
-      }
-      level_list(i) = l + 1;
-      nodes_per_level(l) += 1;  // 0-based indexing
-      level_ptr(l + 1) += 1;
-      level = std::max(level, l + 1);
-      node_count++;
-    }
-    for (signed_integral_t i = 1; i <= level; ++i) {
-      level_ptr(i) += level_ptr(i - 1);
-    }
-    for (size_type i = 0; i < nrows; i++) {
-      nodes_grouped_by_level(level_ptr(level_list(i) - 1)) = i;
-      level_ptr(level_list(i) - 1) += 1;
-    }
+  thandle.set_num_levels(nlevels);
 
-    thandle.set_num_levels(level);
+  // Host copies are used by the solve to launch the per-level kernels
+  Kokkos::deep_copy(dnodes_per_level, nodes_per_level);
+  Kokkos::deep_copy(nodes_grouped_by_level, dnodes_grouped_by_level);
 
-    // Create the chain now
-    if (thandle.algm_requires_symb_chain()) {
-      symbolic_chain_phase(thandle, nodes_per_level);
-    }
+  // Create the chain now
+  if (thandle.algm_requires_symb_chain()) {
+    symbolic_chain_phase(thandle, dnodes_per_level);
+  }
 
-    thandle.set_symbolic_complete();
+  thandle.set_symbolic_complete();
 
-    // Output check
+  // Output check
 #ifdef LVL_OUTPUT_INFO
-    std::cout << "  set symbolic complete: " << thandle.is_symbolic_complete()
+  std::cout << "  set symbolic complete: " << thandle.is_symbolic_complete()
+            << std::endl;
+  std::cout << "  set num levels: " << thandle.get_num_levels() << std::endl;
+
+  std::cout << (IsLower ? "  lower" : "  upper")
+            << "_tri_symbolic result: " << std::endl;
+  auto h_level_list = thandle.get_host_level_list();
+  for (nnz_lno_t i = 0; i < nrows; ++i) {
+    std::cout << "node: " << i << "  level_list = " << h_level_list(i)
               << std::endl;
-    std::cout << "  set num levels: " << thandle.get_num_levels() << std::endl;
-
-    std::cout << "  lower_tri_symbolic result: " << std::endl;
-    for (size_type i = 0; i < node_count; ++i) {
-      std::cout << "node: " << i << "  level_list = " << level_list(i)
-                << std::endl;
-    }
+  }
 
-    for (size_type i = 0; i < level; ++i) {
-      std::cout << "level: " << i
-                << "  nodes_per_level = " << nodes_per_level(i) << std::endl;
-    }
+  for (signed_integral_t i = 0; i < nlevels; ++i) {
+    std::cout << "level: " << i
+              << "  nodes_per_level = " << nodes_per_level(i) << std::endl;
+  }
 
-    for (size_type i = 0; i < node_count; ++i) {
-      std::cout << "i: " << i
-                << "  nodes_grouped_by_level = " << nodes_grouped_by_level(i)
-                << std::endl;
-    }
+  for (nnz_lno_t i = 0; i < nrows; ++i) {
+    std::cout << "i: " << i
+              << "  nodes_grouped_by_level = " << nodes_grouped_by_level(i)
+              << std::endl;
+  }
+  std::cout << "  node_count = " << level_end << std::endl;
 #endif
+}
 
-    // Deep copy to device views
-    Kokkos::deep_copy(dnodes_grouped_by_level, nodes_grouped_by_level);
-    Kokkos::deep_copy(dnodes_per_level, nodes_per_level);
-    Kokkos::deep_copy(dlevel_list, level_list);
-
-    // Extra check:
-#ifdef LVL_OUTPUT_INFO
-    {
-      std::cout << "  End symb - extra checks" << std::endl;
-      std::cout << "  node_count = " << node_count << std::endl;
-      std::cout << "  nlevel = " << level << std::endl;
-      std::cout << "  npl.extent = " << nodes_per_level.extent(0) << std::endl;
-      long check_count = 0;
-      Kokkos::parallel_reduce(
-          "check_count host",
-          Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
-              0, nodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) {
-            update += nodes_per_level(i);
-          },
-          check_count);
-      std::cout << "  host check_count= " << check_count << std::endl;
-
-      check_count = 0;  // reset
-      Kokkos::parallel_reduce(
-          "check_count device",
-          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
-              0, dnodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) {
-            update += dnodes_per_level(i);
-          },
-          check_count);
-      std::cout << "  devicecheck_count= " << check_count << std::endl;
-    }
+template <class TriSolveHandle, class RowMapType, class EntriesType>
+void lower_tri_symbolic(TriSolveHandle& thandle, const RowMapType drow_map,
+                        const EntriesType dentries) {
+#ifdef TRISOLVE_SYMB_TIMERS
+  Kokkos::Timer timer_sym_lowertri_total;
+  Kokkos::Timer timer;
 #endif
+
+  using namespace KokkosSparse::Experimental;
+  if (thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_RP ||
+      thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
+      /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
+      thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
+    tri_symbolic_level_sched<true>(thandle, drow_map, dentries);
+  }
+  else if (thandle.get_algorithm() == SPTRSVAlgorithm::SPTRSV_JACOBI) {
+    // Nothing to schedule, the sweeps are independent of the pattern
+    thandle.set_symbolic_complete();
   }
 #ifdef KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
   else if (thandle.get_algorithm() == SPTRSVAlgorithm::SUPERNODAL_NAIVE ||
@@ -611,137 +610,11 @@ void upper_tri_symbolic(TriSolveHandle& thandle, const RowMapType drow_map,
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1 ||
       /*thandle.get_algorithm () == SPTRSVAlgorithm::SEQLVLSCHED_TP2*/
       thandle.get_algorithm() == SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN) {
-    // Scheduling currently compute on host - need host copy of all views
-
-    typedef typename TriSolveHandle::size_type size_type;
-    typedef typename TriSolveHandle::nnz_lno_view_t DeviceEntriesType;
-    typedef
-        typename TriSolveHandle::signed_nnz_lno_view_t DeviceSignedEntriesType;
-    typedef typename TriSolveHandle::signed_nnz_lno_view_t::HostMirror
-        HostSignedEntriesType;
-    typedef typename TriSolveHandle::signed_integral_t signed_integral_t;
-
-    //  size_type nrows = thandle.get_nrows();
-    // Necessary for partitioned persisting sparse matrix
-    size_type nrows = drow_map.extent(0) - 1;
-
-    auto row_map = Kokkos::create_mirror_view(drow_map);
-    Kokkos::deep_copy(row_map, drow_map);
-
-    auto entries = Kokkos::create_mirror_view(dentries);
-    Kokkos::deep_copy(entries, dentries);
-
-    // get device view - will deep_copy to it at end of this host routine
-    DeviceEntriesType dnodes_per_level = thandle.get_nodes_per_level();
-    auto nodes_per_level               = thandle.get_host_nodes_per_level();
-
-    // get device view - will deep_copy to it at end of this host routine
-    DeviceEntriesType dnodes_grouped_by_level =
-        thandle.get_nodes_grouped_by_level();
-    auto nodes_grouped_by_level = thandle.get_host_nodes_grouped_by_level();
-
-    DeviceSignedEntriesType dlevel_list = thandle.get_level_list();
-    HostSignedEntriesType level_list = Kokkos::create_mirror_view(dlevel_list);
-    Kokkos::deep_copy(level_list, dlevel_list);
-
-    signed_integral_t level = 0;
-    size_type node_count    = 0;
-
-    typename DeviceEntriesType::HostMirror level_ptr(
-        "lp", nrows + 1);  // temp View used for index bookkeeping
-    level_ptr(0) = 0;
-    for (size_type ii = nrows; ii > 0; ii--) {
-      size_type i = ii - 1;  // Avoid >= 0 comparison in for-loop to prevent
-                             // wraparound errors with unsigned types
-      signed_integral_t l = 0;
-      size_type rowstart  = row_map(i) + 1;  // skip diag
-      size_type rowend    = row_map(i + 1);
-      for (size_type j = rowstart; j < rowend; ++j) {
-        size_type col = entries(j);
-        l             = std::max(l, level_list(col));
-      }
-      level_list(i) = l + 1;
-      nodes_per_level(l) += 1;  // 0-based indexing
-      level_ptr(l + 1) += 1;
-      level = std::max(level, l + 1);
-      node_count++;
-    }
-    for (signed_integral_t i = 1; i <= level; ++i) {
-      level_ptr(i) += level_ptr(i - 1);
-    }
-    for (size_type i = 0; i < nrows; i++) {
-      nodes_grouped_by_level(level_ptr(level_list(i) - 1)) = i;
-      level_ptr(level_list(i) - 1) += 1;
-    }
-
-    thandle.set_num_levels(level);
-
-    // Create the chain now
-    if (thandle.algm_requires_symb_chain()) {
-      symbolic_chain_phase(thandle, nodes_per_level);
-    }
-
+    tri_symbolic_level_sched<false>(thandle, drow_map, dentries);
+  }
+  else if (thandle.get_algorithm() == SPTRSVAlgorithm::SPTRSV_JACOBI) {
+    // Nothing to schedule, the sweeps are independent of the pattern
     thandle.set_symbolic_complete();
-
-    // Output check
-#ifdef LVL_OUTPUT_INFO
-    std::cout << "  set symbolic complete: " << thandle.is_symbolic_complete()
-              << std::endl;
-    std::cout << "  set num levels: " << thandle.get_num_levels() << std::endl;
-
-    std::cout << "  upper_tri_symbolic result: " << std::endl;
-    for (size_type i = 0; i < node_count; ++i) {
-      std::cout << "node: " << i << "  level_list = " << level_list(i)
-                << std::endl;
-    }
-
-    for (size_type i = 0; i < level; ++i) {
-      std::cout << "level: " << i
-                << "  nodes_per_level = " << nodes_per_level(i) << std::endl;
-    }
-
-    for (size_type i = 0; i < node_count; ++i) {
-      std::cout << "i: " << i
-                << "  nodes_grouped_by_level = " << nodes_grouped_by_level(i)
-                << std::endl;
-    }
-#endif
-
-    // Deep copy to device views
-    Kokkos::deep_copy(dnodes_grouped_by_level, nodes_grouped_by_level);
-    Kokkos::deep_copy(dnodes_per_level, nodes_per_level);
-    Kokkos::deep_copy(dlevel_list, level_list);
-
-    // Extra check:
-#ifdef LVL_OUTPUT_INFO
-    {
-      std::cout << "  End symb - extra checks" << std::endl;
-      std::cout << "  node_count = " << node_count << std::endl;
-      std::cout << "  nlevel = " << level << std::endl;
-      std::cout << "  npl.extent = " << nodes_per_level.extent(0) << std::endl;
-      long check_count = 0;
-      Kokkos::parallel_reduce(
-          "check_count host",
-          Kokkos::RangePolicy<Kokkos::DefaultHostExecutionSpace>(
-              0, nodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) {
-            update += nodes_per_level(i);
-          },
-          check_count);
-      std::cout << "  host check_count= " << check_count << std::endl;
-
-      check_count = 0;  // reset
-      Kokkos::parallel_reduce(
-          "check_count device",
-          Kokkos::RangePolicy<Kokkos::DefaultExecutionSpace>(
-              0, dnodes_per_level.extent(0)),
-          KOKKOS_LAMBDA(const long i, long& update) {
-            update += dnodes_per_level(i);
-          },
-          check_count);
-      std::cout << "  devicecheck_count= " << check_count << std::endl;
-    }
-#endif
   }
 #ifdef KOKKOSKERNELS_ENABLE_SUPERNODAL_SPTRSV
   else if (thandle.get_algorithm() == SPTRSVAlgorithm::SUPERNODAL_NAIVE ||
@@ -425,31 +425,6 @@ void transpose_matrix(
   MyExecSpace().fence();
 }
 
-template <typename crsMat_t>
-crsMat_t transpose_matrix(const crsMat_t &A) {
-  // Allocate views and call the other version of transpose_matrix
-  using c_rowmap_t  = typename crsMat_t::row_map_type;
-  using c_entries_t = typename crsMat_t::index_type;
-  using c_values_t  = typename crsMat_t::values_type;
-  using rowmap_t    = typename crsMat_t::row_map_type::non_const_type;
-  using entries_t   = typename crsMat_t::index_type::non_const_type;
-  using values_t    = typename crsMat_t::values_type::non_const_type;
-  rowmap_t AT_rowmap("Transpose rowmap", A.numCols() + 1);
-  entries_t AT_entries(
-      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose entries"),
-      A.nnz());
-  values_t AT_values(
-      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose values"),
-      A.nnz());
-  transpose_matrix<c_rowmap_t, c_entries_t, c_values_t, rowmap_t, entries_t,
-                   values_t, rowmap_t, typename crsMat_t::execution_space>(
-      A.numRows(), A.numCols(), A.graph.row_map, A.graph.entries, A.values,
-      AT_rowmap, AT_entries, AT_values);
-  // And construct the transpose crsMat_t
-  return crsMat_t("Transpose", A.numCols(), A.numRows(), A.nnz(), AT_values,
-                  AT_rowmap, AT_entries);
-}
-
 template <typename in_row_view_t, typename in_nnz_view_t,
           typename out_row_view_t, typename out_nnz_view_t,
           typename tempwork_row_view_t, typename MyExecSpace>
@@ -509,6 +484,371 @@ void transpose_graph(
   MyExecSpace().fence();
 }
 
+/// \brief Deterministic transpose of a graph that also returns the
+/// permutation of the entries, such that entry i of the transpose is entry
+/// perm(i) of the input. The rows of the transpose are sorted.
+///
+/// The entries are stably sorted by column with a least significant digit
+/// radix sort, i.e. a partitioned bucket scatter per digit of the column: the
+/// entries are split into contiguous chunks, up to one per thread of the
+/// execution space; every chunk counts its entries per bucket, the (bucket,
+/// chunk) counts are scanned, and every chunk scatters its entries in order
+/// into its own slice of each bucket. There are no atomics, the result does
+/// not depend on the schedule, and the entries of a dense column are spread
+/// over all the chunks. The digits take 4 to 8 bits, the fewest for which the
+/// chunks reach the concurrency while the counts take at most nnz entries.
+/// The rows of the transpose are then gathered with a binary search in xadj,
+/// and t_xadj with a binary search in the sorted columns.
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename out_row_view_t, typename out_nnz_view_t,
+          typename perm_view_t, typename MyExecSpace>
+struct TransposeGraphWithPermutation {
+  struct ChunkCountTag {};
+  struct ChunkScatterTag {};
+  struct RowMapTag {};
+  struct EntriesTag {};
+
+  using nnz_lno_t = typename in_nnz_view_t::non_const_value_type;
+  using size_type = typename in_row_view_t::non_const_value_type;
+
+  using offset_view_t = Kokkos::View<size_type *, MyExecSpace>;
+  using lno_view_t    = Kokkos::View<nnz_lno_t *, MyExecSpace>;
+
+  nnz_lno_t num_rows;
+  nnz_lno_t num_cols;
+  size_type nnz;
+  in_row_view_t xadj;
+  in_nnz_view_t adj;
+  out_row_view_t t_xadj;  // allocated
+  out_nnz_view_t t_adj;   // allocated
+  perm_view_t perm;       // allocated
+
+  size_type num_chunks;
+  size_type chunk_size;
+  int digit_bits;
+  int num_passes;
+  // digit of the current pass, and whether it reads adj directly
+  int shift;
+  bool first_pass;
+
+  // count of (bucket, chunk) at bucket * num_chunks + chunk
+  offset_view_t chunk_offsets;
+  // columns and input positions of the entries, before and after a pass
+  lno_view_t keys_in;
+  lno_view_t keys_out;
+  offset_view_t pos_in;
+  offset_view_t pos_out;
+
+  TransposeGraphWithPermutation(const MyExecSpace &exec,
+                                nnz_lno_t num_rows_, nnz_lno_t num_cols_,
+                                in_row_view_t xadj_, in_nnz_view_t adj_,
+                                out_row_view_t t_xadj_, out_nnz_view_t t_adj_,
+                                perm_view_t perm_)
+      : num_rows(num_rows_),
+        num_cols(num_cols_),
+        nnz(adj_.extent(0)),
+        xadj(xadj_),
+        adj(adj_),
+        t_xadj(t_xadj_),
+        t_adj(t_adj_),
+        perm(perm_),
+        num_chunks(1),
+        chunk_size(1),
+        digit_bits(8),
+        num_passes(1),
+        shift(0),
+        first_pass(true) {
+    const size_type concurrency = exec.concurrency();
+
+    int col_bits = 1;
+    while (col_bits < int(8 * sizeof(nnz_lno_t)) - 1 &&
+           (nnz_lno_t(1) << col_bits) < num_cols)
+      ++col_bits;
+    while (digit_bits > 4 && (nnz >> digit_bits) < concurrency) --digit_bits;
+    if (digit_bits > col_bits) digit_bits = col_bits;
+    num_passes = (col_bits + digit_bits - 1) / digit_bits;
+
+    num_chunks = KOKKOSKERNELS_MACRO_MAX(
+        size_type(1), KOKKOSKERNELS_MACRO_MIN(concurrency, nnz >> digit_bits));
+    chunk_size = (nnz + num_chunks - 1) / num_chunks;
+    num_chunks = (nnz + chunk_size - 1) / chunk_size;
+
+    chunk_offsets = offset_view_t(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "chunk_offsets"),
+        (size_type(1) << digit_bits) * num_chunks + 1);
+    keys_in       = lno_view_t(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys_in"), nnz);
+    keys_out      = lno_view_t(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "keys_out"), nnz);
+    pos_in        = offset_view_t(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "pos_in"), nnz);
+    pos_out       = offset_view_t(
+        Kokkos::view_alloc(exec, Kokkos::WithoutInitializing, "pos_out"), nnz);
+  }
+
+  // Makes the output of a pass the input of the next one
+  void next_pass() {
+    std::swap(keys_in, keys_out);
+    std::swap(pos_in, pos_out);
+    shift += digit_bits;
+    first_pass = false;
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  nnz_lno_t key(const size_type i) const {
+    return first_pass ? nnz_lno_t(adj(i)) : keys_in(i);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  size_type bucket(const nnz_lno_t k) const {
+    return size_type(k >> shift) & ((size_type(1) << digit_bits) - 1);
+  }
+
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ChunkCountTag &, const size_type chunk) const {
+    const size_type begin = chunk * chunk_size;
+    const size_type end   = KOKKOSKERNELS_MACRO_MIN(begin + chunk_size, nnz);
+    for (size_type i = begin; i < end; ++i) {
+      ++chunk_offsets(bucket(key(i)) * num_chunks + chunk);
+    }
+  }
+
+  // the entries of a chunk are scattered in order, so the sort is stable
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const ChunkScatterTag &, const size_type chunk) const {
+    const size_type begin = chunk * chunk_size;
+    const size_type end   = KOKKOSKERNELS_MACRO_MIN(begin + chunk_size, nnz);
+    for (size_type i = begin; i < end; ++i) {
+      const nnz_lno_t k    = key(i);
+      const size_type dest = chunk_offsets(bucket(k) * num_chunks + chunk)++;
+      keys_out(dest)       = k;
+      pos_out(dest)        = first_pass ? i : pos_in(i);
+    }
+  }
+
+  // t_xadj(col) is the first sorted entry whose column is not below col
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const RowMapTag &, const nnz_lno_t col) const {
+    size_type lo = 0, hi = nnz;
+    while (lo < hi) {
+      const size_type mid = lo + (hi - lo) / 2;
+      if (keys_in(mid) < col)
+        lo = mid + 1;
+      else
+        hi = mid;
+    }
+    t_xadj(col) = lo;
+  }
+
+  // the row of an entry is the last row starting at or before it
+  KOKKOS_INLINE_FUNCTION
+  void operator()(const EntriesTag &, const size_type pos) const {
+    const size_type adjind = pos_in(pos);
+
+    nnz_lno_t lo = 0, hi = num_rows;
+    while (hi - lo > 1) {
+      const nnz_lno_t mid = lo + (hi - lo) / 2;
+      if (size_type(xadj(mid)) <= adjind)
+        lo = mid;
+      else
+        hi = mid;
+    }
+    perm(pos)  = adjind;
+    t_adj(pos) = lo;
+  }
+};
+
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename out_row_view_t, typename out_nnz_view_t,
+          typename perm_view_t, typename MyExecSpace>
+void transpose_graph_with_permutation(
+    const MyExecSpace &exec,
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj,
+    out_row_view_t t_xadj,  // pre-allocated -- initialized with 0
+    out_nnz_view_t t_adj,   // pre-allocated -- no need for initialize
+    perm_view_t perm        // pre-allocated -- no need for initialize
+) {
+  if (adj.extent(0) == 0) return;
+
+  typedef TransposeGraphWithPermutation<in_row_view_t, in_nnz_view_t,
+                                        out_row_view_t, out_nnz_view_t,
+                                        perm_view_t, MyExecSpace>
+      TransposeFunctor_t;
+  typedef typename TransposeFunctor_t::nnz_lno_t nnz_lno_t;
+  typedef typename TransposeFunctor_t::size_type size_type;
+
+  TransposeFunctor_t tm(exec, num_rows, num_cols, xadj, adj, t_xadj, t_adj,
+                        perm);
+
+  for (int pass = 0; pass < tm.num_passes; ++pass) {
+    Kokkos::deep_copy(exec, tm.chunk_offsets, size_type(0));
+    Kokkos::parallel_for(
+        "KokkosSparse::Impl::transpose_graph_with_permutation::S0",
+        Kokkos::RangePolicy<typename TransposeFunctor_t::ChunkCountTag,
+                            MyExecSpace>(exec, 0, tm.num_chunks),
+        tm);
+    KokkosKernels::Impl::kk_exclusive_parallel_prefix_sum(
+        exec, tm.chunk_offsets.extent(0), tm.chunk_offsets);
+    Kokkos::parallel_for(
+        "KokkosSparse::Impl::transpose_graph_with_permutation::S1",
+        Kokkos::RangePolicy<typename TransposeFunctor_t::ChunkScatterTag,
+                            MyExecSpace>(exec, 0, tm.num_chunks),
+        tm);
+    tm.next_pass();
+  }
+
+  Kokkos::parallel_for(
+      "KokkosSparse::Impl::transpose_graph_with_permutation::S2",
+      Kokkos::RangePolicy<typename TransposeFunctor_t::RowMapTag, MyExecSpace>(
+          exec, 0, nnz_lno_t(num_cols + 1)),
+      tm);
+  Kokkos::parallel_for(
+      "KokkosSparse::Impl::transpose_graph_with_permutation::S3",
+      Kokkos::RangePolicy<typename TransposeFunctor_t::EntriesTag,
+                          MyExecSpace>(exec, 0, tm.nnz),
+      tm);
+
+  exec.fence();
+}
+
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename out_row_view_t, typename out_nnz_view_t,
+          typename perm_view_t, typename MyExecSpace>
+void transpose_graph_with_permutation(
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj,
+    out_row_view_t t_xadj,  // pre-allocated -- initialized with 0
+    out_nnz_view_t t_adj,   // pre-allocated -- no need for initialize
+    perm_view_t perm        // pre-allocated -- no need for initialize
+) {
+  transpose_graph_with_permutation<in_row_view_t, in_nnz_view_t,
+                                   out_row_view_t, out_nnz_view_t, perm_view_t,
+                                   MyExecSpace>(MyExecSpace(), num_rows,
+                                                num_cols, xadj, adj, t_xadj,
+                                                t_adj, perm);
+}
+
+/// \brief Gathers the values of a transpose computed by
+/// transpose_graph_with_permutation: t_vals(i) = vals(perm(i)). When only the
+/// values of the input change, this is all that is needed to refresh the
+/// transpose.
+template <typename perm_view_t, typename in_scalar_view_t,
+          typename out_scalar_view_t, typename MyExecSpace>
+void transpose_values(const MyExecSpace &exec, perm_view_t perm,
+                      in_scalar_view_t vals, out_scalar_view_t t_vals) {
+  using size_type = typename perm_view_t::non_const_value_type;
+  Kokkos::parallel_for(
+      "KokkosSparse::Impl::transpose_values",
+      Kokkos::RangePolicy<MyExecSpace>(exec, 0, perm.extent(0)),
+      KOKKOS_LAMBDA(const size_type i) { t_vals(i) = vals(perm(i)); });
+}
+
+template <typename perm_view_t, typename in_scalar_view_t,
+          typename out_scalar_view_t, typename MyExecSpace>
+void transpose_values(perm_view_t perm, in_scalar_view_t vals,
+                      out_scalar_view_t t_vals) {
+  transpose_values<perm_view_t, in_scalar_view_t, out_scalar_view_t,
+                   MyExecSpace>(MyExecSpace(), perm, vals, t_vals);
+}
+
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename in_scalar_view_t, typename out_row_view_t,
+          typename out_nnz_view_t, typename out_scalar_view_t,
+          typename perm_view_t, typename MyExecSpace>
+void transpose_matrix_with_permutation(
+    const MyExecSpace &exec,
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj, in_scalar_view_t vals,
+    out_row_view_t t_xadj,     // pre-allocated -- initialized with 0
+    out_nnz_view_t t_adj,      // pre-allocated -- no need for initialize
+    out_scalar_view_t t_vals,  // pre-allocated -- no need for initialize
+    perm_view_t perm           // pre-allocated -- no need for initialize
+) {
+  transpose_graph_with_permutation<in_row_view_t, in_nnz_view_t,
+                                   out_row_view_t, out_nnz_view_t, perm_view_t,
+                                   MyExecSpace>(exec, num_rows, num_cols, xadj,
+                                                adj, t_xadj, t_adj, perm);
+  transpose_values<perm_view_t, in_scalar_view_t, out_scalar_view_t,
+                   MyExecSpace>(exec, perm, vals, t_vals);
+  exec.fence();
+}
+
+template <typename in_row_view_t, typename in_nnz_view_t,
+          typename in_scalar_view_t, typename out_row_view_t,
+          typename out_nnz_view_t, typename out_scalar_view_t,
+          typename perm_view_t, typename MyExecSpace>
+void transpose_matrix_with_permutation(
+    typename in_nnz_view_t::non_const_value_type num_rows,
+    typename in_nnz_view_t::non_const_value_type num_cols, in_row_view_t xadj,
+    in_nnz_view_t adj, in_scalar_view_t vals,
+    out_row_view_t t_xadj,     // pre-allocated -- initialized with 0
+    out_nnz_view_t t_adj,      // pre-allocated -- no need for initialize
+    out_scalar_view_t t_vals,  // pre-allocated -- no need for initialize
+    perm_view_t perm           // pre-allocated -- no need for initialize
+) {
+  transpose_matrix_with_permutation<in_row_view_t, in_nnz_view_t,
+                                    in_scalar_view_t, out_row_view_t,
+                                    out_nnz_view_t, out_scalar_view_t,
+                                    perm_view_t, MyExecSpace>(
+      MyExecSpace(), num_rows, num_cols, xadj, adj, vals, t_xadj, t_adj,
+      t_vals, perm);
+}
+
+/// \brief Deterministic transpose of A that also returns the permutation of
+/// the entries. If only the values of A change later, refresh the transpose
+/// with transpose_matrix_values(perm, A, At).
+template <typename crsMat_t, typename perm_view_t>
+crsMat_t transpose_matrix_with_permutation(const crsMat_t &A,
+                                           perm_view_t &perm) {
+  using c_rowmap_t  = typename crsMat_t::row_map_type;
+  using c_entries_t = typename crsMat_t::index_type;
+  using c_values_t  = typename crsMat_t::values_type;
+  using rowmap_t    = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t   = typename crsMat_t::index_type::non_const_type;
+  using values_t    = typename crsMat_t::values_type::non_const_type;
+  rowmap_t AT_rowmap("Transpose rowmap", A.numCols() + 1);
+  entries_t AT_entries(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose entries"),
+      A.nnz());
+  values_t AT_values(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose values"),
+      A.nnz());
+  perm = perm_view_t(
+      Kokkos::view_alloc(Kokkos::WithoutInitializing, "Transpose permutation"),
+      A.nnz());
+  transpose_matrix_with_permutation<c_rowmap_t, c_entries_t, c_values_t,
+                                    rowmap_t, entries_t, values_t, perm_view_t,
+                                    typename crsMat_t::execution_space>(
+      A.numRows(), A.numCols(), A.graph.row_map, A.graph.entries, A.values,
+      AT_rowmap, AT_entries, AT_values, perm);
+  return crsMat_t("Transpose", A.numCols(), A.numRows(), A.nnz(), AT_values,
+                  AT_rowmap, AT_entries);
+}
+
+/// \brief Copies the values of A into its transpose At, where At and perm
+/// come from transpose_matrix_with_permutation and the pattern of A did not
+/// change.
+template <typename crsMat_t, typename perm_view_t>
+void transpose_matrix_values(const perm_view_t &perm, const crsMat_t &A,
+                             const crsMat_t &At) {
+  transpose_values<perm_view_t, typename crsMat_t::values_type,
+                   typename crsMat_t::values_type,
+                   typename crsMat_t::execution_space>(perm, A.values,
+                                                       At.values);
+}
+
+template <typename crsMat_t>
+crsMat_t transpose_matrix(const crsMat_t &A) {
+  // Deterministic, and the rows of the transpose are sorted
+  Kokkos::View<typename crsMat_t::size_type *, typename crsMat_t::device_type>
+      perm;
+  return transpose_matrix_with_permutation(A, perm);
+}
+
 template <typename in_row_view_t, typename in_nnz_view_t,
           typename in_scalar_view_t, typename out_row_view_t,
           typename out_nnz_view_t, typename out_scalar_view_t>
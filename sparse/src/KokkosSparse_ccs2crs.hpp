@@ -35,6 +35,7 @@ class Ccs2Crs {
   using CrsValsViewType   = typename CrsType::values_type;
   using CrsRowMapViewType = typename CrsType::row_map_type::non_const_type;
   using CrsColIdViewType  = typename CrsType::index_type;
+  using CrsPermViewType   = Kokkos::View<SizeType *, CrsET>;
 
   OrdinalType __nrows;
   OrdinalType __ncols;
@@ -65,11 +66,14 @@ class Ccs2Crs {
     __crs_col_ids = CrsColIdViewType(
         Kokkos::view_alloc(Kokkos::WithoutInitializing, "__crs_col_ids"), nnz);
 
-    KokkosSparse::Impl::transpose_matrix<
+    // deterministic, and the column ids of each row come out sorted
+    CrsPermViewType perm(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "__crs_perm"), nnz);
+    KokkosSparse::Impl::transpose_matrix_with_permutation<
         ColMapViewType, RowIdViewType, ValViewType, CrsRowMapViewType,
-        CrsColIdViewType, CrsValsViewType, CrsRowMapViewType, CrsET>(
+        CrsColIdViewType, CrsValsViewType, CrsPermViewType, CrsET>(
         __ncols, __nrows, __col_map, __row_ids, __vals, __crs_row_map,
-        __crs_col_ids, __crs_vals);
+        __crs_col_ids, __crs_vals, perm);
   }
 
   CrsType get_crsMat() {
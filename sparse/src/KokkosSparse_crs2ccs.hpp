@@ -35,6 +35,7 @@ class Crs2Ccs {
   using CcsValsViewType   = typename CcsType::values_type;
   using CcsColMapViewType = typename CcsType::col_map_type::non_const_type;
   using CcsRowIdViewType  = typename CcsType::index_type;
+  using CcsPermViewType   = Kokkos::View<SizeType *, CcsET>;
 
   OrdinalType __nrows;
   OrdinalType __ncols;
@@ -63,11 +64,14 @@ class Crs2Ccs {
     __ccs_row_ids = CcsRowIdViewType(
         Kokkos::view_alloc(Kokkos::WithoutInitializing, "__ccs_row_ids"), nnz);
 
-    KokkosSparse::Impl::transpose_matrix<
+    // deterministic, and the row ids of each column come out sorted
+    CcsPermViewType perm(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "__ccs_perm"), nnz);
+    KokkosSparse::Impl::transpose_matrix_with_permutation<
         RowMapViewType, ColIdViewType, ValViewType, CcsColMapViewType,
-        CcsRowIdViewType, CcsValsViewType, CcsColMapViewType, CcsET>(
+        CcsRowIdViewType, CcsValsViewType, CcsPermViewType, CcsET>(
         __nrows, __ncols, __row_map, __col_ids, __vals, __ccs_col_map,
-        __ccs_row_ids, __ccs_vals);
+        __ccs_row_ids, __ccs_vals, perm);
   }
 
   CcsType get_ccsMat() {
@@ -157,12 +157,7 @@ void block_gauss_seidel_symbolic(
     typename KernelHandle::const_nnz_lno_t num_cols,
     typename KernelHandle::const_nnz_lno_t block_size, lno_row_view_t_ row_map,
     lno_nnz_view_t_ entries, bool is_graph_symmetric = true) {
-  auto gsHandle = handle->get_point_gs_handle();
-  if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
-    throw std::runtime_error(
-        "Block versions of Gauss-Seidel are incompatible with algorithm "
-        "GS_CLUSTER");
-  }
+  auto gsHandle = handle->get_gs_handle();
   gsHandle->set_block_size(block_size);
 
   gauss_seidel_symbolic(handle, num_rows, num_cols, row_map, entries,
@@ -477,6 +472,9 @@ void gauss_seidel_numeric(KernelHandle *handle,
 /// @param values The matrix's values
 /// @param is_graph_symmetric Whether the upper-left <tt>num_rows x
 /// num_rows</tt> submatrix of A is structurally symmetric
+/// @remark With GS_CLUSTER and GS_TWOSTAGE (BSR format only), every diagonal
+///         block is factored and inverted densely, and the sweeps update
+///         whole blocks of x. The other algorithms relax one row at a time.
 ///
 template <KokkosSparse::SparseMatrixFormat format =
               KokkosSparse::SparseMatrixFormat::BSR,
@@ -488,11 +486,13 @@ void block_gauss_seidel_numeric(
     typename KernelHandle::const_nnz_lno_t block_size, lno_row_view_t_ row_map,
     lno_nnz_view_t_ entries, scalar_nnz_view_t_ values,
     bool is_graph_symmetric = true) {
-  auto gsHandle = handle->get_point_gs_handle();
-  if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+  auto gsHandle = handle->get_gs_handle();
+  if (format != KokkosSparse::SparseMatrixFormat::BSR &&
+      (gsHandle->get_algorithm_type() == GS_CLUSTER ||
+       gsHandle->get_algorithm_type() == GS_TWOSTAGE)) {
     throw std::runtime_error(
-        "Block versions of Gauss-Seidel are incompatible with algorithm "
-        "GS_CLUSTER");
+        "Block versions of Gauss-Seidel with algorithms GS_CLUSTER and "
+        "GS_TWOSTAGE require the BSR format");
   }
   gsHandle->set_block_size(block_size);
 
@@ -770,11 +770,13 @@ void symmetric_block_gauss_seidel_apply(
        << y_rhs_input_vec.extent(1) << " columns.";
     KokkosKernels::Impl::throw_runtime_exception(os.str());
   }
-  auto gsHandle = handle->get_point_gs_handle();
-  if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+  auto gsHandle = handle->get_gs_handle();
+  if (format != KokkosSparse::SparseMatrixFormat::BSR &&
+      (gsHandle->get_algorithm_type() == GS_CLUSTER ||
+       gsHandle->get_algorithm_type() == GS_TWOSTAGE)) {
     throw std::runtime_error(
-        "Block versions of Gauss-Seidel are incompatible with algorithm "
-        "GS_CLUSTER");
+        "Block versions of Gauss-Seidel with algorithms GS_CLUSTER and "
+        "GS_TWOSTAGE require the BSR format");
   }
 
   gsHandle->set_block_size(block_size);
@@ -1052,11 +1054,13 @@ void forward_sweep_block_gauss_seidel_apply(
     KokkosKernels::Impl::throw_runtime_exception(os.str());
   }
 
-  auto gsHandle = handle->get_point_gs_handle();
-  if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+  auto gsHandle = handle->get_gs_handle();
+  if (format != KokkosSparse::SparseMatrixFormat::BSR &&
+      (gsHandle->get_algorithm_type() == GS_CLUSTER ||
+       gsHandle->get_algorithm_type() == GS_TWOSTAGE)) {
     throw std::runtime_error(
-        "Block versions of Gauss-Seidel are incompatible with algorithm "
-        "GS_CLUSTER");
+        "Block versions of Gauss-Seidel with algorithms GS_CLUSTER and "
+        "GS_TWOSTAGE require the BSR format");
   }
   gsHandle->set_block_size(block_size);
   forward_sweep_gauss_seidel_apply<format>(
@@ -1333,11 +1337,13 @@ void backward_sweep_block_gauss_seidel_apply(
        << y_rhs_input_vec.extent(1) << " columns.";
     KokkosKernels::Impl::throw_runtime_exception(os.str());
   }
-  auto gsHandle = handle->get_point_gs_handle();
-  if (gsHandle->get_algorithm_type() == GS_CLUSTER) {
+  auto gsHandle = handle->get_gs_handle();
+  if (format != KokkosSparse::SparseMatrixFormat::BSR &&
+      (gsHandle->get_algorithm_type() == GS_CLUSTER ||
+       gsHandle->get_algorithm_type() == GS_TWOSTAGE)) {
     throw std::runtime_error(
-        "Block versions of Gauss-Seidel are incompatible with algorithm "
-        "GS_CLUSTER");
+        "Block versions of Gauss-Seidel with algorithms GS_CLUSTER and "
+        "GS_TWOSTAGE require the BSR format");
   }
   gsHandle->set_block_size(block_size);
   backward_sweep_gauss_seidel_apply<format>(
@@ -99,6 +99,8 @@ class GaussSeidelHandle {
   int suggested_vector_size;
   int suggested_team_size;
 
+  nnz_lno_t block_size;  // this is for block sgs
+
  public:
   /**
    * \brief Default constructor.
@@ -113,7 +115,8 @@ class GaussSeidelHandle {
         called_symbolic(false),
         called_numeric(false),
         suggested_vector_size(0),
-        suggested_team_size(0) {}
+        suggested_team_size(0),
+        block_size(1) {}
 
   GaussSeidelHandle(HandleExecSpace handle_exec_space, int n_streams,
                     GSAlgorithm gs)
@@ -126,7 +129,8 @@ class GaussSeidelHandle {
         called_symbolic(false),
         called_numeric(false),
         suggested_vector_size(0),
-        suggested_team_size(0) {}
+        suggested_team_size(0),
+        block_size(1) {}
 
   virtual ~GaussSeidelHandle() = default;
 
@@ -148,6 +152,9 @@ class GaussSeidelHandle {
   bool is_symbolic_called() const { return this->called_symbolic; }
   bool is_numeric_called() const { return this->called_numeric; }
 
+  void set_block_size(nnz_lno_t bs) { this->block_size = bs; }
+  nnz_lno_t get_block_size() const { return this->block_size; }
+
   template <class ExecSpaceIn>
   void set_execution_space(const ExecSpaceIn exec_space_in) {
     static bool is_set = false;
@@ -259,7 +266,6 @@ class PointGaussSeidelHandle
   scalar_persistent_work_view2d_t permuted_x_vector;
 
   scalar_persistent_work_view_t permuted_inverse_diagonal;
-  nnz_lno_t block_size;  // this is for block sgs
 
   nnz_lno_t num_values_in_l1, num_values_in_l2, num_big_rows;
   size_t level_1_mem, level_2_mem;
@@ -294,7 +300,6 @@ class PointGaussSeidelHandle
         permuted_y_vector(),
         permuted_x_vector(),
         permuted_inverse_diagonal(),
-        block_size(1),
         num_values_in_l1(-1),
         num_values_in_l2(-1),
         num_big_rows(0),
@@ -318,9 +323,6 @@ class PointGaussSeidelHandle
       : PointGaussSeidelHandle(GSHandle(handle_exec_space, n_streams, gs),
                                coloring_algo_) {}
 
-  void set_block_size(nnz_lno_t bs) { this->block_size = bs; }
-  nnz_lno_t get_block_size() const { return this->block_size; }
-
   void choose_default_algorithm() {
     if (KokkosKernels::Impl::kk_is_gpu_exec_space<ExecutionSpace>())
       this->algorithm_type = GS_TEAM;
@@ -755,6 +757,9 @@ class TwoStageGaussSeidelHandle
   // > diagonal (not-inverse)
   void setDa(values_view_t Da_) { this->Da = Da_; }
   values_view_t getDa() { return this->Da; }
+  // > off-diagonal blocks scaled by the inverse diagonal blocks (block GS)
+  void setDinvA(values_view_t DinvA_) { this->DinvA = DinvA_; }
+  values_view_t getDinvA() { return this->DinvA; }
 
   void initVectors(int nrows_, int nrhs_) {
     if (this->nrows != nrows_ || this->nrhs != nrhs_) {
@@ -783,6 +788,9 @@ class TwoStageGaussSeidelHandle
   values_view_t Da;
   crsmat_t crsmatLa;
   crsmat_t crsmatUa;
+  // > for block GS, D holds the inverse diagonal blocks and DinvA the
+  //   blocks D_i^{-1} A_ij, j != i, of each block row i
+  values_view_t DinvA;
 
   // > residual vector for outer GS, Rk = B-A*Xk
   vector_view_t localR;
@@ -19,6 +19,7 @@
 #include <KokkosKernels_config.h>
 #include <KokkosKernels_Controls.hpp>
 #include <KokkosSparse_Utils.hpp>
+#include <KokkosKernels_Uniform_Initialized_MemoryPool.hpp>
 #include <Kokkos_Core.hpp>
 #include <iostream>
 #include <string>
@@ -298,6 +299,21 @@ class SPGEMMHandle {
   int mkl_sort_option;
   bool calculate_read_write_cost;
 
+  // Accumulator memory pools of the numeric phase. They are kept alive between
+  // numeric calls so that repeated products with the same pattern do not
+  // reallocate and reinitialize them. Kernels hand the chunks back in their
+  // initialized state, so a retained pool can be reused as is.
+  typedef KokkosKernels::Impl::UniformMemoryPool<HandleTempMemorySpace,
+                                                 nnz_lno_t>
+      lno_pool_t;
+  typedef KokkosKernels::Impl::UniformMemoryPool<HandleTempMemorySpace,
+                                                 nnz_scalar_t>
+      scalar_pool_t;
+  bool retain_numeric_workspace;
+  size_t max_retained_workspace_bytes;
+  lno_pool_t numeric_lno_pool;
+  scalar_pool_t numeric_scalar_pool;
+
  public:
   std::string coloring_input_file;
   std::string coloring_output_file;
@@ -305,6 +321,8 @@ class SPGEMMHandle {
   int min_hash_size_scale;
   double compression_cut_off;
   double first_level_hash_cut_off;
+  bool row_binning;
+  size_t row_bin_sizes[3];
   size_t original_max_row_flops, original_overall_flops;
   row_lno_persistent_work_view_t row_flops;
 
@@ -318,6 +336,20 @@ class SPGEMMHandle {
     return this->first_level_hash_cut_off;
   }
 
+  /// \brief If set, the KKMEM numeric phase groups the rows by their flops
+  /// and output size, and computes each group with its own accumulator.
+  void set_row_binning(bool row_binning_) { this->row_binning = row_binning_; }
+  bool get_row_binning() const { return this->row_binning; }
+
+  /// \brief Number of rows of the tiny (0), medium (1) and huge (2) bins in
+  /// the last numeric phase, zero if that phase did not group the rows.
+  void set_row_bin_sizes(size_t tiny, size_t medium, size_t huge) {
+    this->row_bin_sizes[0] = tiny;
+    this->row_bin_sizes[1] = medium;
+    this->row_bin_sizes[2] = huge;
+  }
+  size_t get_row_bin_size(int bin) const { return this->row_bin_sizes[bin]; }
+
   void set_compression_cut_off(double compression_cut_off_) {
     this->compression_cut_off = compression_cut_off_;
   }
@@ -520,11 +552,17 @@ class SPGEMMHandle {
         multi_color_scale(1),
         mkl_sort_option(7),
         calculate_read_write_cost(false),
+        retain_numeric_workspace(true),
+        max_retained_workspace_bytes(std::numeric_limits<size_t>::max()),
+        numeric_lno_pool(),
+        numeric_scalar_pool(),
         coloring_input_file(""),
         coloring_output_file(""),
         min_hash_size_scale(1),
         compression_cut_off(0.85),
         first_level_hash_cut_off(0.50),
+        row_binning(false),
+        row_bin_sizes{0, 0, 0},
         original_max_row_flops(std::numeric_limits<size_t>::max()),
         original_overall_flops(std::numeric_limits<size_t>::max()),
         persistent_a_xadj(),
@@ -777,6 +815,79 @@ class SPGEMMHandle {
 
   bool get_compression_step() { return is_compression_single_step; }
 
+  /// \brief Enables or disables retaining the numeric phase memory pools
+  /// across spgemm_numeric calls. Disabling it releases the retained pools.
+  void set_retain_numeric_workspace(bool retain) {
+    this->retain_numeric_workspace = retain;
+    if (!retain) this->release_numeric_workspace();
+  }
+  bool get_retain_numeric_workspace() const {
+    return this->retain_numeric_workspace;
+  }
+
+  /// \brief Sets the maximum number of bytes the handle may keep alive
+  /// between numeric calls. Pools that would exceed this cap are allocated
+  /// for the call and freed afterwards, as if retention was disabled.
+  void set_max_retained_workspace_bytes(size_t max_bytes) {
+    this->max_retained_workspace_bytes = max_bytes;
+    if (this->get_retained_workspace_bytes() > max_bytes)
+      this->release_numeric_workspace();
+  }
+  size_t get_max_retained_workspace_bytes() const {
+    return this->max_retained_workspace_bytes;
+  }
+
+  /// \brief Returns the number of bytes currently retained by the handle.
+  size_t get_retained_workspace_bytes() const {
+    return numeric_lno_pool.get_memory_footprint() +
+           numeric_scalar_pool.get_memory_footprint();
+  }
+
+  /// \brief Frees the numeric phase memory pools retained by the handle. The
+  /// next numeric call allocates them again.
+  void release_numeric_workspace() {
+    numeric_lno_pool    = lno_pool_t();
+    numeric_scalar_pool = scalar_pool_t();
+  }
+
+  /// \brief Returns a memory pool with (at least) the given number of chunks
+  /// and chunk size, initialized to init_value. If the pool retained from a
+  /// previous numeric call is compatible, it is returned without any
+  /// allocation. Otherwise a new pool is created and, if retention is enabled
+  /// and the cap allows, kept for the next call.
+  template <typename data_type>
+  KokkosKernels::Impl::UniformMemoryPool<HandleTempMemorySpace, data_type>
+  get_numeric_pool(const size_t num_chunks, const size_t chunk_size,
+                   const data_type init_value,
+                   const KokkosKernels::Impl::PoolType pool_type) {
+    static_assert(std::is_same<data_type, nnz_lno_t>::value ||
+                      std::is_same<data_type, nnz_scalar_t>::value,
+                  "SPGEMMHandle::get_numeric_pool: data_type must be the "
+                  "ordinal or the scalar type of the handle");
+    using pool_t = KokkosKernels::Impl::UniformMemoryPool<HandleTempMemorySpace,
+                                                          data_type>;
+    pool_t *retained;
+    if constexpr (std::is_same<data_type, nnz_lno_t>::value)
+      retained = &numeric_lno_pool;
+    else
+      retained = &numeric_scalar_pool;
+
+    if (this->retain_numeric_workspace &&
+        retained->is_compatible(num_chunks, chunk_size, init_value,
+                                pool_type)) {
+      return *retained;
+    }
+    // free the incompatible pool before allocating its replacement
+    *retained = pool_t();
+    pool_t pool(num_chunks, chunk_size, init_value, pool_type);
+    if (this->retain_numeric_workspace &&
+        this->get_retained_workspace_bytes() + pool.get_memory_footprint() <=
+            this->max_retained_workspace_bytes) {
+      *retained = pool;
+    }
+    return pool;
+  }
+
  private:
   // An SpGEMM handle can be reused for multiple products C = A*B, but only if
   // the sparsity patterns of A and B do not change. Enforce this (in debug
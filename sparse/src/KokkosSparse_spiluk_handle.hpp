@@ -78,6 +78,9 @@ class SPILUKHandle {
                        HandlePersistentMemorySpace>
       work_view_t;
 
+  typedef typename Kokkos::View<nnz_scalar_t *, HandlePersistentMemorySpace>
+      nnz_scalar_view_t;
+
  private:
   nnz_row_view_t level_list;  // level IDs which the rows belong to
   nnz_lno_view_t level_idx;   // the list of rows in each level
@@ -90,6 +93,8 @@ class SPILUKHandle {
   nnz_lno_view_host_t
       level_nrowsperchunk;  // maximum number of rows among chunks at each level
   work_view_t iw;  // working view for mapping dense indices to sparse indices
+  nnz_scalar_view_t
+      fp_a_values;  // values of A on the pattern of L and U (fixed-point)
 
   size_type nrows;
   size_type nlevels;
@@ -106,6 +111,8 @@ class SPILUKHandle {
   int team_size;
   int vector_size;
 
+  int fp_sweeps;  // number of fixed-point sweeps, 0 for level scheduling
+
  public:
   SPILUKHandle(SPILUKAlgorithm choice, const size_type nrows_,
                const size_type nnzL_, const size_type nnzU_,
@@ -117,6 +124,7 @@ class SPILUKHandle {
         level_nchunks(),
         level_nrowsperchunk(),
         iw(),
+        fp_a_values(),
         nrows(nrows_),
         nlevels(0),
         nnzL(nnzL_),
@@ -126,7 +134,8 @@ class SPILUKHandle {
         symbolic_complete(symbolic_complete_),
         algm(choice),
         team_size(-1),
-        vector_size(-1) {}
+        vector_size(-1),
+        fp_sweeps(0) {}
 
   void reset_handle(const size_type nrows_, const size_type nnzL_,
                     const size_type nnzU_) {
@@ -143,6 +152,7 @@ class SPILUKHandle {
     level_nchunks       = nnz_lno_view_host_t(),
     level_nrowsperchunk = nnz_lno_view_host_t(), reset_symbolic_complete(),
     iw                  = work_view_t();
+    fp_a_values         = nnz_scalar_view_t();
   }
 
   virtual ~SPILUKHandle(){};
@@ -187,6 +197,17 @@ class SPILUKHandle {
     Kokkos::deep_copy(iw, nnz_lno_t(-1));
   }
 
+  KOKKOS_INLINE_FUNCTION
+  nnz_scalar_view_t get_fixed_point_work() const { return fp_a_values; }
+
+  // Reallocate only if the size changed, so that refactorizations with the
+  // same pattern do not allocate
+  void alloc_fixed_point_work(const size_type nnz_) {
+    if (fp_a_values.extent(0) != nnz_)
+      fp_a_values = nnz_scalar_view_t(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "fp_a_values"), nnz_);
+  }
+
   KOKKOS_INLINE_FUNCTION
   size_type get_nrows() const { return nrows; }
 
@@ -235,6 +256,11 @@ class SPILUKHandle {
   void set_vector_size(const int vs) { this->vector_size = vs; }
   int get_vector_size() const { return this->vector_size; }
 
+  // Run nsweeps fixed-point (Chow-Patel) sweeps in spiluk_numeric instead of
+  // the level-scheduled factorization; 0 restores the latter
+  void set_fixed_point_sweeps(const int nsweeps) { this->fp_sweeps = nsweeps; }
+  int get_fixed_point_sweeps() const { return this->fp_sweeps; }
+
   void print_algorithm() {
     if (algm == SPILUKAlgorithm::SEQLVLSCHD_RP)
       std::cout << "SEQLVLSCHD_RP" << std::endl;
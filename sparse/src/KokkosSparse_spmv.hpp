@@ -29,6 +29,7 @@
 #include <type_traits>
 #include "KokkosSparse_BsrMatrix.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_spmv_transpose_handle.hpp"
 #include "KokkosBlas1_scal.hpp"
 #include "KokkosKernels_Utils.hpp"
 #include "KokkosKernels_Error.hpp"
@@ -1314,6 +1315,52 @@ void spmv(const ExecutionSpace& space, const char mode[],
   spmv(space, controls, mode, alpha, A, x, beta, y);
 }
 
+/// \brief Kokkos sparse matrix-vector multiply with a cached transpose.
+///   Computes y := alpha*Op(A)*x + beta*y, where Op(A) is controlled by mode.
+///
+/// For mode "T" and "H", A^T is built on the first call and kept in handle;
+/// the product then runs the row parallel mode "N" (resp. "C") kernel on A^T
+/// instead of the atomic transpose kernel. A^T is rebuilt when the graph of
+/// A changes and its values are gathered again when the values of A change,
+/// see SPMVTransposeHandle. Other modes use A directly.
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param handle [in/out] The cache of A^T
+/// \param mode [in] Select A's operator mode: "N" for normal, "T" for
+///   transpose, "C" for conjugate or "H" for conjugate transpose.
+/// \param alpha [in] Scalar multiplier for the matrix A.
+/// \param A [in] The sparse matrix A, a KokkosSparse::CrsMatrix.
+/// \param x [in] A vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector,
+          class BetaType, class YVector>
+void spmv(const ExecutionSpace& space,
+          Experimental::SPMVTransposeHandle<AMatrix>* handle,
+          const char mode[], const AlphaType& alpha, const AMatrix& A,
+          const XVector& x, const BetaType& beta, const YVector& y) {
+  static_assert(KokkosSparse::is_crs_matrix<AMatrix>::value,
+                "KokkosSparse::spmv: the transpose cache requires a "
+                "CrsMatrix.");
+  if ((mode[0] == Transpose[0]) || (mode[0] == ConjugateTranspose[0])) {
+    const auto& At = handle->update(space, A);
+    spmv(space, mode[0] == Transpose[0] ? NoTranspose : Conjugate, alpha, At,
+         x, beta, y);
+  } else {
+    spmv(space, mode, alpha, A, x, beta, y);
+  }
+}
+
+template <class AlphaType, class AMatrix, class XVector, class BetaType,
+          class YVector>
+void spmv(Experimental::SPMVTransposeHandle<AMatrix>* handle,
+          const char mode[], const AlphaType& alpha, const AMatrix& A,
+          const XVector& x, const BetaType& beta, const YVector& y) {
+  spmv(typename AMatrix::execution_space{}, handle, mode, alpha, A, x, beta,
+       y);
+}
+
 namespace Experimental {
 
 template <class ExecutionSpace, class AlphaType, class AMatrix, class XVector,
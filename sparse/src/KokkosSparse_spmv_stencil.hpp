@@ -0,0 +1,185 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_stencil.hpp
+/// \brief Matrix-free sparse matrix-vector multiply with stencil operators
+///   on structured grids
+
+#ifndef KOKKOSSPARSE_SPMV_STENCIL_HPP_
+#define KOKKOSSPARSE_SPMV_STENCIL_HPP_
+
+#include <sstream>
+#include <type_traits>
+
+#include "Kokkos_Core.hpp"
+#include "KokkosKernels_Error.hpp"
+#include "KokkosSparse_spmv_stencil_impl.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Computes y := alpha*A*x + beta*y where A is a stencil operator on a
+/// structured grid, given by its stencil and per-point coefficients instead
+/// of a CrsMatrix.
+///
+/// The grid has structure(0) x structure(1) x structure(2) points (1 to 3
+/// dimensions) numbered with the first index fastest, as in spmv_struct.
+/// Stencil entry s couples point (i, j, k) to (i + offsets(s, 0), j +
+/// offsets(s, 1), k + offsets(s, 2)) with weight coefficients(point, s);
+/// neighbors outside of the grid are skipped. Any stencil shape and any
+/// variation of the coefficients over the grid is supported. No column
+/// indices are read: x is staged in team scratch, tile by tile, and reused by
+/// all the stencil entries that reach it.
+///
+/// \tparam ExecutionSpace A Kokkos execution space. Must be able to access
+///   the memory spaces of coefficients, x, and y.
+/// \tparam OrdinalType Integer type of the grid dimensions.
+/// \tparam AlphaType Type of coefficient alpha. Must be convertible to
+///   YVector::value_type.
+/// \tparam CoefView Type of the coefficients, a rank-2 Kokkos::View of
+///   extents (number of grid points, stencil size). LayoutLeft stores every
+///   stencil entry contiguously over the grid (structure of arrays), which
+///   gives contiguous coefficient loads.
+/// \tparam XVector Type of x, must be a rank-1 Kokkos::View
+/// \tparam BetaType Type of coefficient beta. Must be convertible to
+///   YVector::value_type.
+/// \tparam YVector Type of y, must be a rank-1 Kokkos::View
+///
+/// \param space [in] The execution space instance on which to run the
+///   kernel.
+/// \param structure [in] The number of grid points in each dimension.
+/// \param offsets [in] The stencil offsets (di, dj, dk), one row per entry.
+/// \param alpha [in] Scalar multiplier for the operator A.
+/// \param coefficients [in] The stencil weights of every grid point.
+/// \param x [in] A vector to multiply on the left by A.
+/// \param beta [in] Scalar multiplier for the vector y.
+/// \param y [in/out] Result vector.
+template <class ExecutionSpace, class OrdinalType, class AlphaType,
+          class CoefView, class XVector, class BetaType, class YVector>
+void spmv_stencil(
+    const ExecutionSpace& space,
+    const Kokkos::View<OrdinalType*, Kokkos::HostSpace>& structure,
+    const Kokkos::View<int* [3], Kokkos::HostSpace>& offsets,
+    const AlphaType& alpha, const CoefView& coefficients, const XVector& x,
+    const BetaType& beta, const YVector& y) {
+  static_assert(static_cast<int>(CoefView::rank) == 2,
+                "KokkosSparse::spmv_stencil: coefficients must be a rank 2 "
+                "View.");
+  static_assert(static_cast<int>(XVector::rank) == 1 &&
+                    static_cast<int>(YVector::rank) == 1,
+                "KokkosSparse::spmv_stencil: x and y must be rank 1 Views.");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename CoefView::memory_space>::accessible,
+      "KokkosSparse::spmv_stencil: CoefView must be accessible from "
+      "ExecutionSpace");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename XVector::memory_space>::accessible,
+      "KokkosSparse::spmv_stencil: XVector must be accessible from "
+      "ExecutionSpace");
+  static_assert(
+      Kokkos::SpaceAccessibility<ExecutionSpace,
+                                 typename YVector::memory_space>::accessible,
+      "KokkosSparse::spmv_stencil: YVector must be accessible from "
+      "ExecutionSpace");
+  static_assert(std::is_same<typename YVector::value_type,
+                             typename YVector::non_const_value_type>::value,
+                "KokkosSparse::spmv_stencil: Output Vector must be non-const.");
+
+  const KokkosSparse::Impl::StencilGrid grid(structure, offsets);
+  const size_t numPoints = grid.numPoints();
+  if (coefficients.extent(0) != numPoints ||
+      coefficients.extent(1) != offsets.extent(0) ||
+      x.extent(0) != numPoints || y.extent(0) != numPoints) {
+    std::ostringstream os;
+    os << "KokkosSparse::spmv_stencil: Dimensions do not match: grid: "
+       << numPoints << " points, stencil: " << offsets.extent(0)
+       << " entries, coefficients: " << coefficients.extent(0) << " x "
+       << coefficients.extent(1) << ", x: " << x.extent(0)
+       << ", y: " << y.extent(0);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  if (numPoints == 0) return;
+
+  // the stencil is read in the kernel, stage it in the execution space
+  auto d_offsets = Kokkos::create_mirror_view_and_copy(
+      typename ExecutionSpace::memory_space(), offsets);
+
+  using y_value_type = typename YVector::non_const_value_type;
+  KokkosSparse::Impl::spmv_stencil(space, grid, y_value_type(alpha),
+                                   d_offsets, coefficients, x,
+                                   y_value_type(beta), y);
+}
+
+template <class OrdinalType, class AlphaType, class CoefView, class XVector,
+          class BetaType, class YVector>
+void spmv_stencil(
+    const Kokkos::View<OrdinalType*, Kokkos::HostSpace>& structure,
+    const Kokkos::View<int* [3], Kokkos::HostSpace>& offsets,
+    const AlphaType& alpha, const CoefView& coefficients, const XVector& x,
+    const BetaType& beta, const YVector& y) {
+  spmv_stencil(typename CoefView::execution_space{}, structure, offsets, alpha,
+               coefficients, x, beta, y);
+}
+
+/// \brief Fills the per-point stencil coefficients of a CrsMatrix assembled on
+/// a structured grid, for use with spmv_stencil.
+///
+/// coefficients(row, s) is the value of A at column row + offset s, or zero
+/// if A has no such entry. Throws if A has entries that the stencil does not
+/// reach.
+///
+/// \param space [in] The execution space instance on which to run.
+/// \param structure [in] The number of grid points in each dimension.
+/// \param offsets [in] The stencil offsets (di, dj, dk), one row per entry.
+/// \param A [in] The CrsMatrix, one row per grid point.
+/// \param coefficients [out] View of extents (A.numRows(), stencil size).
+template <class ExecutionSpace, class OrdinalType, class AMatrix,
+          class CoefView>
+void extract_stencil_coefficients(
+    const ExecutionSpace& space,
+    const Kokkos::View<OrdinalType*, Kokkos::HostSpace>& structure,
+    const Kokkos::View<int* [3], Kokkos::HostSpace>& offsets,
+    const AMatrix& A, const CoefView& coefficients) {
+  const KokkosSparse::Impl::StencilGrid grid(structure, offsets);
+  if (static_cast<size_t>(A.numRows()) != size_t(grid.numPoints()) ||
+      coefficients.extent(0) != size_t(grid.numPoints()) ||
+      coefficients.extent(1) != offsets.extent(0)) {
+    std::ostringstream os;
+    os << "KokkosSparse::extract_stencil_coefficients: Dimensions do not "
+          "match: grid: "
+       << grid.numPoints() << " points, A: " << A.numRows()
+       << " rows, coefficients: " << coefficients.extent(0) << " x "
+       << coefficients.extent(1);
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+  auto d_offsets = Kokkos::create_mirror_view_and_copy(
+      typename ExecutionSpace::memory_space(), offsets);
+  const int64_t numMissed = KokkosSparse::Impl::extract_stencil_coefficients(
+      space, grid, d_offsets, A, coefficients);
+  if (numMissed > 0) {
+    std::ostringstream os;
+    os << "KokkosSparse::extract_stencil_coefficients: " << numMissed
+       << " entries of A are not reached by the stencil";
+    KokkosKernels::Impl::throw_runtime_exception(os.str());
+  }
+}
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_STENCIL_HPP_
@@ -0,0 +1,186 @@
+//@HEADER
+// ************************************************************************
+//
+//                        Kokkos v. 4.0
+//       Copyright (2022) National Technology & Engineering
+//               Solutions of Sandia, LLC (NTESS).
+//
+// Under the terms of Contract DE-NA0003525 with NTESS,
+// the U.S. Government retains certain rights in this software.
+//
+// Part of Kokkos, under the Apache License v2.0 with LLVM Exceptions.
+// See https://kokkos.org/LICENSE for license information.
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//@HEADER
+
+/// \file KokkosSparse_spmv_transpose_handle.hpp
+/// \brief Cache of the explicit transpose of a CrsMatrix for spmv with
+/// mode "T" or "H".
+
+#ifndef KOKKOSSPARSE_SPMV_TRANSPOSE_HANDLE_HPP_
+#define KOKKOSSPARSE_SPMV_TRANSPOSE_HANDLE_HPP_
+
+#include "Kokkos_Core.hpp"
+#include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_Utils.hpp"
+
+namespace KokkosSparse {
+namespace Experimental {
+
+/// \brief Keeps A^T for spmv with mode "T" and "H".
+///
+/// spmv with mode "T" on a CrsMatrix scatters into y with atomic adds. With
+/// this handle, spmv builds A^T on first use, with
+/// KokkosSparse::Impl::transpose_matrix_with_permutation, and runs the row
+/// parallel mode "N" (or "C" for "H") kernel on it afterwards.
+///
+/// The handle keeps the row map, entries and values Views of the A it was
+/// built from, which also keeps their allocations alive, so a new allocation
+/// cannot reuse their addresses. A new graph rebuilds A^T, and new values are
+/// gathered into A^T with the stored permutation. Both run on the execution
+/// space instance passed to spmv. If the values of A are modified in place,
+/// call set_values_modified() before the next spmv.
+///
+/// \tparam AMatrix The KokkosSparse::CrsMatrix type passed to spmv
+template <class AMatrix>
+class SPMVTransposeHandle {
+ public:
+  using execution_space = typename AMatrix::execution_space;
+  using device_type     = typename AMatrix::device_type;
+  using ordinal_type    = typename AMatrix::non_const_ordinal_type;
+  using size_type       = typename AMatrix::non_const_size_type;
+  using value_type      = typename AMatrix::non_const_value_type;
+
+  using transpose_type =
+      CrsMatrix<value_type, ordinal_type, device_type, void, size_type>;
+  using permutation_type = Kokkos::View<size_type *, device_type>;
+
+  using row_map_type = typename AMatrix::row_map_type;
+  using index_type   = typename AMatrix::index_type;
+  using values_type  = typename AMatrix::values_type;
+
+ private:
+  transpose_type At;
+  permutation_type perm;
+
+  // the Views of the A that At was built from
+  row_map_type row_map;
+  index_type entries;
+  values_type values;
+  ordinal_type num_rows;
+  ordinal_type num_cols;
+
+  bool built;
+  bool values_modified;
+  int num_builds;
+  int num_value_updates;
+
+ public:
+  SPMVTransposeHandle()
+      : At(),
+        perm(),
+        row_map(),
+        entries(),
+        values(),
+        num_rows(0),
+        num_cols(0),
+        built(false),
+        values_modified(false),
+        num_builds(0),
+        num_value_updates(0) {}
+
+  /// \brief The values of A were changed in place, gather them again into
+  /// A^T at the next spmv.
+  void set_values_modified() { values_modified = true; }
+
+  /// \brief Drops A^T, the next spmv builds it again.
+  void reset() {
+    At      = transpose_type();
+    perm    = permutation_type();
+    row_map = row_map_type();
+    entries = index_type();
+    values  = values_type();
+    built   = false;
+  }
+
+  bool is_built() const { return built; }
+  const transpose_type &get_transpose() const { return At; }
+  const permutation_type &get_permutation() const { return perm; }
+
+  /// \brief Number of times A^T was built, and number of times its values
+  /// were gathered again. Useful to check that the cache is reused.
+  int get_num_builds() const { return num_builds; }
+  int get_num_value_updates() const { return num_value_updates; }
+
+  /// \brief Returns A^T for A, building it or refreshing its values first if
+  /// needed, on the execution space instance space. The refresh is not
+  /// fenced: work later submitted to space sees the new values of A^T.
+  template <class ExecutionSpace>
+  const transpose_type &update(const ExecutionSpace &space, const AMatrix &A) {
+    const bool same_graph =
+        built && same_view(row_map, A.graph.row_map) &&
+        same_view(entries, A.graph.entries) && num_rows == A.numRows() &&
+        num_cols == A.numCols();
+    if (!same_graph) {
+      build(space, A);
+    } else if (values_modified || !same_view(values, A.values)) {
+      KokkosSparse::Impl::transpose_values<
+          permutation_type, values_type, typename transpose_type::values_type,
+          ExecutionSpace>(space, perm, A.values, At.values);
+      ++num_value_updates;
+    }
+    values          = A.values;
+    values_modified = false;
+    return At;
+  }
+
+  const transpose_type &update(const AMatrix &A) {
+    return update(execution_space(), A);
+  }
+
+ private:
+  template <class ViewType>
+  static bool same_view(const ViewType &a, const ViewType &b) {
+    return a.data() == b.data() && a.extent(0) == b.extent(0);
+  }
+
+  template <class ExecutionSpace>
+  void build(const ExecutionSpace &space, const AMatrix &A) {
+    using rowmap_t  = typename transpose_type::row_map_type::non_const_type;
+    using entries_t = typename transpose_type::index_type::non_const_type;
+    using values_t  = typename transpose_type::values_type::non_const_type;
+
+    rowmap_t t_rowmap(Kokkos::view_alloc(space, "A^T rowmap"),
+                      A.numCols() + 1);
+    entries_t t_entries(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "A^T entries"),
+        A.nnz());
+    values_t t_values(
+        Kokkos::view_alloc(space, Kokkos::WithoutInitializing, "A^T values"),
+        A.nnz());
+    perm = permutation_type(Kokkos::view_alloc(space,
+                                               Kokkos::WithoutInitializing,
+                                               "A^T permutation"),
+                            A.nnz());
+    KokkosSparse::Impl::transpose_matrix_with_permutation<
+        row_map_type, index_type, values_type, rowmap_t, entries_t, values_t,
+        permutation_type, ExecutionSpace>(
+        space, A.numRows(), A.numCols(), A.graph.row_map, A.graph.entries,
+        A.values, t_rowmap, t_entries, t_values, perm);
+    At = transpose_type("A^T", A.numCols(), A.numRows(), A.nnz(), t_values,
+                        t_rowmap, t_entries);
+
+    row_map  = A.graph.row_map;
+    entries  = A.graph.entries;
+    num_rows = A.numRows();
+    num_cols = A.numCols();
+    built    = true;
+    ++num_builds;
+  }
+};
+
+}  // namespace Experimental
+}  // namespace KokkosSparse
+
+#endif  // KOKKOSSPARSE_SPMV_TRANSPOSE_HANDLE_HPP_
@@ -49,7 +49,8 @@ enum class SPTRSVAlgorithm {
   SUPERNODAL_ETREE,
   SUPERNODAL_DAG,
   SUPERNODAL_SPMV,
-  SUPERNODAL_SPMV_DAG
+  SUPERNODAL_SPMV_DAG,
+  SPTRSV_JACOBI  // approximate solve by a fixed number of Jacobi sweeps
 };
 
 template <class size_type_, class lno_t_, class scalar_t_, class ExecutionSpace,
@@ -312,6 +313,10 @@ class SPTRSVHandle {
   size_type num_chain_entries;
   signed_integral_t chain_threshold;
 
+  // Jacobi sweeps: number of sweeps, and the previous iterate
+  int jacobi_sweeps;
+  nnz_scalar_view_t jacobi_work;
+
   bool symbolic_complete;
   bool numeric_complete;
   bool require_symbolic_lvlsched_phase;
@@ -448,6 +453,8 @@ class SPTRSVHandle {
         h_chain_ptr(),
         num_chain_entries(0),
         chain_threshold(-1),
+        jacobi_sweeps(5),
+        jacobi_work(),
         symbolic_complete(symbolic_complete_),
         numeric_complete(numeric_complete_),
         require_symbolic_lvlsched_phase(false),
@@ -771,6 +778,12 @@ class SPTRSVHandle {
       hdiagonal_values  = Kokkos::create_mirror_view(diagonal_values);
     }
 
+    if (algm == SPTRSVAlgorithm::SPTRSV_JACOBI) {
+      jacobi_work = nnz_scalar_view_t(
+          Kokkos::view_alloc(Kokkos::WithoutInitializing, "jacobi_work"),
+          nrows_);
+    }
+
     if (this->require_symbolic_chain_phase == true) {
       if (this->chain_threshold == -1) {
         // Need default if chain_threshold not set
@@ -1011,6 +1024,12 @@ class SPTRSVHandle {
   int get_num_chain_entries() const { return this->num_chain_entries; }
   void set_num_chain_entries(const int nce) { this->num_chain_entries = nce; }
 
+  // Number of Jacobi sweeps of SPTRSV_JACOBI (at least 1)
+  int get_jacobi_sweeps() const { return this->jacobi_sweeps; }
+  void set_jacobi_sweeps(const int nsweeps) { this->jacobi_sweeps = nsweeps; }
+
+  nnz_scalar_view_t get_jacobi_work() const { return jacobi_work; }
+
   void print_algorithm() {
     if (algm == SPTRSVAlgorithm::SEQLVLSCHD_RP)
       std::cout << "SEQLVLSCHD_RP" << std::endl;
@@ -1048,6 +1067,9 @@ class SPTRSVHandle {
 
     if (algm == SPTRSVAlgorithm::SUPERNODAL_SPMV_DAG)
       std::cout << "SUPERNODAL_SPMV_DAG" << std::endl;
+
+    if (algm == SPTRSVAlgorithm::SPTRSV_JACOBI)
+      std::cout << "SPTRSV_JACOBI" << std::endl;
   }
 
   std::string return_algorithm_string() {
@@ -1066,6 +1088,8 @@ class SPTRSVHandle {
     if (algm == SPTRSVAlgorithm::SPTRSV_CUSPARSE)
       ret_string = "SPTRSV_CUSPARSE";
 
+    if (algm == SPTRSVAlgorithm::SPTRSV_JACOBI) ret_string = "SPTRSV_JACOBI";
+
     return ret_string;
   }
 
@@ -1082,6 +1106,8 @@ class SPTRSVHandle {
       return SPTRSVAlgorithm::SEQLVLSCHD_TP1CHAIN;
     else if (name == "SPTRSV_CUSPARSE")
       return SPTRSVAlgorithm::SPTRSV_CUSPARSE;
+    else if (name == "SPTRSV_JACOBI")
+      return SPTRSVAlgorithm::SPTRSV_JACOBI;
     else
       throw std::runtime_error("Invalid SPTRSVAlgorithm name");
   }
@@ -20,6 +20,10 @@
 #include <stdexcept>
 #include "KokkosSparse_BsrMatrix.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
+#include "KokkosSparse_IOUtils.hpp"
+#include "KokkosSparse_crs_to_bsr_impl.hpp"
+#include "KokkosSparse_bsr_to_crs_impl.hpp"
+#include "KokkosSparse_crs_detect_block_size.hpp"
 
 // #ifndef kokkos_complex_double
 // #define kokkos_complex_double Kokkos::complex<double>
@@ -346,10 +350,78 @@ void testBsrMatrix() {
   }
 }
 
+// Convert random CrsMatrices with crs_to_bsr, compare against the host
+// conversion in the BsrMatrix constructor, and detect the block size of a
+// matrix made of dense blocks.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void testCrsToBsr() {
+  typedef KokkosSparse::CrsMatrix<scalar_t, lno_t, device, void, size_type>
+      crs_matrix_type;
+  typedef KokkosSparse::Experimental::BsrMatrix<scalar_t, lno_t, device, void,
+                                                size_type>
+      bsr_matrix_type;
+
+  const lno_t numRows = 60;
+  for (lno_t blockDim : {1, 2, 3, 5}) {
+    size_type nnz = 6 * numRows;
+    crs_matrix_type crs =
+        KokkosSparse::Impl::kk_generate_sparse_matrix<crs_matrix_type>(
+            numRows, numRows, nnz, 3, numRows);
+    bsr_matrix_type expected(crs, blockDim);
+    bsr_matrix_type actual =
+        KokkosSparse::Impl::crs_to_bsr<bsr_matrix_type>(crs, blockDim);
+
+    EXPECT_EQ(actual.numRows(), expected.numRows());
+    EXPECT_EQ(actual.numCols(), expected.numCols());
+    EXPECT_EQ(actual.blockDim(), expected.blockDim());
+    ASSERT_EQ(actual.nnz(), expected.nnz());
+    auto to_host  = [](const auto &v) {
+      return Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), v);
+    };
+    auto eRowMap  = to_host(expected.graph.row_map);
+    auto aRowMap  = to_host(actual.graph.row_map);
+    auto eEntries = to_host(expected.graph.entries);
+    auto aEntries = to_host(actual.graph.entries);
+    auto eValues  = to_host(expected.values);
+    auto aValues  = to_host(actual.values);
+    for (size_t i = 0; i < eRowMap.extent(0); ++i)
+      EXPECT_EQ(aRowMap(i), eRowMap(i));
+    for (size_t i = 0; i < eEntries.extent(0); ++i)
+      EXPECT_EQ(aEntries(i), eEntries(i));
+    for (size_t i = 0; i < eValues.extent(0); ++i)
+      EXPECT_EQ(aValues(i), eValues(i));
+
+    // block_fill counts the same blocks
+    auto fill = KokkosSparse::Impl::block_fill(crs, blockDim);
+    EXPECT_EQ(fill.numBlocks, size_t(expected.nnz()));
+    EXPECT_EQ(fill.fillRatio, double(crs.nnz()) / (double(expected.nnz()) *
+                                                   blockDim * blockDim));
+
+    // expanding the padded blocks gives a matrix of dense blocks
+    if (blockDim == 3) {
+      crs_matrix_type blocked =
+          KokkosSparse::Impl::bsr_to_crs<crs_matrix_type>(actual);
+      auto blockedFill = KokkosSparse::Impl::block_fill(blocked, blockDim);
+      EXPECT_TRUE(blockedFill.all_dense());
+      EXPECT_EQ(blockedFill.fillRatio, 1.0);
+      EXPECT_EQ(KokkosSparse::Impl::detect_block_size(blocked) % blockDim, 0);
+      EXPECT_GE(KokkosSparse::Impl::detect_block_size(crs, fill.fillRatio),
+                size_t(blockDim));
+      EXPECT_ANY_THROW(KokkosSparse::Impl::detect_block_size(crs, 0.0));
+      EXPECT_ANY_THROW(KokkosSparse::Impl::detect_block_size(crs, 1.5));
+    }
+  }
+}
+
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE)           \
   TEST_F(TestCategory,                                                        \
          sparse##_##bsrmatrix##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
     testBsrMatrix<SCALAR, ORDINAL, OFFSET, DEVICE>();                         \
+  }                                                                           \
+  TEST_F(TestCategory,                                                        \
+         sparse##_##crs_to_bsr##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) { \
+    testCrsToBsr<SCALAR, ORDINAL, OFFSET, DEVICE>();                          \
   }
 
 #include <Test_Common_Test_All_Type_Combos.hpp>
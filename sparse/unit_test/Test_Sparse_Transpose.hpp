@@ -21,6 +21,7 @@
 
 #include <Kokkos_Core.hpp>
 #include <Kokkos_Sort.hpp>
+#include <Kokkos_Random.hpp>
 #include <KokkosSparse_Utils.hpp>
 #include <KokkosKernels_IOUtils.hpp>
 #include <KokkosSparse_IOUtils.hpp>
@@ -292,6 +293,70 @@ void testTransposeBsr(int numRows, int numCols, int blockSize) {
   CompareBsrMatrices(A, Att);
 }
 
+template <typename device_t>
+void testTransposeWithPermutation(int numRows, int numCols) {
+  using exec_space = typename device_t::execution_space;
+  using scalar_t   = default_scalar;
+  using lno_t      = default_lno_t;
+  using size_type  = default_size_type;
+  using crsMat_t   = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, device_t,
+                                                    void, size_type>;
+  using perm_t     = Kokkos::View<size_type *, device_t>;
+  size_type nnz    = 10 * numRows;
+  // Generate a matrix that has 0 entries in some rows
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, 3 * 10, numRows / 2);
+
+  perm_t perm, tperm;
+  crsMat_t At = KokkosSparse::Impl::transpose_matrix_with_permutation(A, perm);
+  crsMat_t Att =
+      KokkosSparse::Impl::transpose_matrix_with_permutation(At, tperm);
+
+  // the rows of the transposes are sorted, so Att is A with sorted rows
+  KokkosSparse::sort_crs_matrix(A);
+  auto h_rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                      A.graph.row_map);
+  auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       A.graph.entries);
+  auto h_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), A.values);
+  auto h_tt_rowmap  = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         Att.graph.row_map);
+  auto h_tt_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                          Att.graph.entries);
+  auto h_tt_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Att.values);
+  for (int i = 0; i <= numRows; ++i) EXPECT_EQ(h_rowmap(i), h_tt_rowmap(i));
+  for (size_type i = 0; i < A.nnz(); ++i) {
+    EXPECT_EQ(h_entries(i), h_tt_entries(i));
+    EXPECT_EQ(h_values(i), h_tt_values(i));
+  }
+
+  // new values, same pattern: gathering with the permutation gives exactly
+  // the transpose computed from scratch
+  Kokkos::Random_XorShift64_Pool<exec_space> random(13718);
+  Kokkos::fill_random(A.values, random, scalar_t(10.0));
+  At = KokkosSparse::Impl::transpose_matrix_with_permutation(A, perm);
+  Kokkos::fill_random(A.values, random, scalar_t(10.0));
+  KokkosSparse::Impl::transpose_matrix_values(perm, A, At);
+  perm_t ref_perm;
+  crsMat_t At_ref =
+      KokkosSparse::Impl::transpose_matrix_with_permutation(A, ref_perm);
+
+  auto h_t_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                         At.graph.entries);
+  auto h_t_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), At.values);
+  auto h_ref_entries = Kokkos::create_mirror_view_and_copy(
+      Kokkos::HostSpace(), At_ref.graph.entries);
+  auto h_ref_values =
+      Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), At_ref.values);
+  for (size_type i = 0; i < A.nnz(); ++i) {
+    EXPECT_EQ(h_t_entries(i), h_ref_entries(i));
+    EXPECT_EQ(h_t_values(i), h_ref_values(i));
+  }
+}
+
 TEST_F(TestCategory, sparse_transpose_matrix) {
   // Test both matrix and graph transpose with various sizes
   testTranspose<TestDevice>(100, 100, true);
@@ -311,6 +376,14 @@ TEST_F(TestCategory, sparse_transpose_graph) {
   testTranspose<TestDevice>(2000, 2000, false);
 }
 
+TEST_F(TestCategory, sparse_transpose_matrix_with_permutation) {
+  testTransposeWithPermutation<TestDevice>(100, 100);
+  testTransposeWithPermutation<TestDevice>(500, 50);
+  testTransposeWithPermutation<TestDevice>(50, 500);
+  testTransposeWithPermutation<TestDevice>(4000, 2000);
+  testTransposeWithPermutation<TestDevice>(2000, 4000);
+}
+
 TEST_F(TestCategory, sparse_transpose_bsr_matrix) {
   testTransposeBsrRef<TestDevice>();
   // Test bsrMatrix transpose with various sizes
@@ -54,7 +54,8 @@ struct GSTestParams {
   mag_t tolerance  = 1e-7;  // relative error for solution x vector
 
   // Note: GS_DEFAULT is same as GS_TEAM and - for blocks - as GS_PERMUTED
-  // Note: GS_TWOSTAGE and GS_CLUSTER are not supported for blocks
+  // Note: GS_TWOSTAGE and GS_CLUSTER are supported for blocks in the BSR
+  // format only, see add_bsr_algorithms()
   std::vector<KokkosSparse::GSAlgorithm> gs_algorithms = {
       KokkosSparse::GS_DEFAULT};
   std::vector<size_t> shmem_sizes = {
@@ -66,6 +67,13 @@ struct GSTestParams {
                                           backward_sweep};
 
   GSTestParams() = default;
+
+  void add_bsr_algorithms(KokkosSparse::SparseMatrixFormat format) {
+    if (format == KokkosSparse::SparseMatrixFormat::BSR) {
+      gs_algorithms.push_back(KokkosSparse::GS_TWOSTAGE);
+      gs_algorithms.push_back(KokkosSparse::GS_CLUSTER);
+    }
+  }
 };
 
 template <typename mtx_t, typename vector_t, typename const_vector_t>
@@ -94,7 +102,10 @@ int run_block_gauss_seidel_1(
   kh.set_team_work_size(16);
   kh.set_shmem_size(shmem_size);
   kh.set_dynamic_scheduling(true);
-  kh.create_gs_handle(gs_algorithm);
+  if (gs_algorithm == KokkosSparse::GS_CLUSTER)
+    kh.create_gs_handle(KokkosSparse::CLUSTER_DEFAULT, 10);
+  else
+    kh.create_gs_handle(gs_algorithm);
 
   const size_t num_rows_1 = input_mat.numRows();
   const size_t num_cols_1 = input_mat.numCols();
@@ -160,7 +171,8 @@ void test_block_gauss_seidel_rank1(lno_t numRows, size_type nnz,
 
   lno_t numCols = numRows;
 
-  const GSTestParams<lno_t, scalar_t, mag_t> params;
+  GSTestParams<lno_t, scalar_t, mag_t> params;
+  params.add_bsr_algorithms(mtx_format);
   lno_t block_size = params.block_size;
 
   crsMat_t crsmat =
@@ -247,7 +259,8 @@ void test_block_gauss_seidel_rank2(lno_t numRows, size_type nnz,
 
   lno_t numCols = numRows;
 
-  const GSTestParams<lno_t, scalar_t, mag_t> params;
+  GSTestParams<lno_t, scalar_t, mag_t> params;
+  params.add_bsr_algorithms(mtx_format);
   lno_t block_size = params.block_size;
 
   crsMat_t crsmat =
@@ -405,6 +405,181 @@ void test_spgemm_symbolic(bool callSymbolicFirst, bool testEmpty) {
       << callSymbolicFirst << ", empty A/B = " << testEmpty;
 }
 
+// Repeated numeric calls with the same handle reuse the memory pools retained
+// by the handle. Check that results stay correct while the pools are retained,
+// released, or capped.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_retained_workspace(KokkosSparse::SPGEMMAlgorithm algo) {
+#if defined(KOKKOSKERNELS_ENABLE_TPL_ARMPL)
+  {
+    std::cerr
+        << "TEST SKIPPED: See "
+           "https://github.com/kokkos/kokkos-kernels/issues/1542 for details."
+        << std::endl;
+    return;
+  }
+#endif  // KOKKOSKERNELS_ENABLE_TPL_ARMPL
+  using namespace Test;
+  using crsMat_t      = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using KernelHandle  = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  lno_t m = 1000, k = 500, n = 1600;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      m, k, m * 20, 10, 500);
+  crsMat_t B = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      k, n, m * 20, 10, 500);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  KernelHandle kh;
+  kh.create_spgemm_handle(algo);
+  auto sh = kh.get_spgemm_handle();
+  EXPECT_TRUE(sh->get_retain_numeric_workspace());
+  EXPECT_EQ(sh->get_retained_workspace_bytes(), size_t(0));
+
+  // KKSPEED uses a dense accumulator without memory pool on GPUs
+  const bool uses_pool =
+      algo != SPGEMM_KK_SPEED ||
+      !KokkosKernels::Impl::kk_is_gpu_exec_space<
+          typename device::execution_space>();
+
+  crsMat_t C;
+  KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+  for (int trial = 0; trial < 4; trial++) {
+    if (trial == 2) {
+      sh->release_numeric_workspace();
+      EXPECT_EQ(sh->get_retained_workspace_bytes(), size_t(0));
+    }
+    if (trial == 3) {
+      sh->set_max_retained_workspace_bytes(0);
+    }
+    // new values for A and B, same pattern
+    A.values = scalar_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "new A values"),
+        A.nnz());
+    B.values = scalar_view_t(
+        Kokkos::view_alloc(Kokkos::WithoutInitializing, "new B values"),
+        B.nnz());
+    randomize_matrix_values(A.values);
+    randomize_matrix_values(B.values);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    if (trial < 2 && uses_pool) {
+      // the first call keeps its pool, the second one reuses it
+      EXPECT_GT(sh->get_retained_workspace_bytes(), size_t(0))
+          << "trial " << trial;
+    }
+    if (trial == 3) {
+      EXPECT_EQ(sh->get_retained_workspace_bytes(), size_t(0));
+    }
+
+    crsMat_t C_reference;
+    run_spgemm<crsMat_t, device>(A, B, SPGEMM_DEBUG, C_reference, false);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_reference)))
+        << "trial " << trial;
+  }
+  kh.destroy_spgemm_handle();
+}
+
+// With row binning, the numeric phase computes the tiny, medium and huge rows
+// of C in separate launches. A mixes the three kinds of rows: B has short and
+// long rows, and A picks a few short rows, a few long rows or all of them.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void test_spgemm_row_binning() {
+  using namespace Test;
+  using crsMat_t      = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using rowmap_t      = typename crsMat_t::row_map_type::non_const_type;
+  using entries_t     = typename crsMat_t::index_type::non_const_type;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using KernelHandle  = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+  const lno_t m = 300, k = 200, n = 20000;
+
+  // rows of B below k / 2 have 4 entries, the others 200
+  rowmap_t rowmapB("B rowmap", k + 1);
+  auto h_rowmapB = Kokkos::create_mirror_view(rowmapB);
+  h_rowmapB(0)   = 0;
+  for (lno_t j = 0; j < k; ++j)
+    h_rowmapB(j + 1) = h_rowmapB(j) + (j < k / 2 ? 4 : 200);
+  entries_t entriesB("B entries", h_rowmapB(k));
+  auto h_entriesB = Kokkos::create_mirror_view(entriesB);
+  for (lno_t j = 0; j < k; ++j)
+    for (lno_t t = 0; t < lno_t(h_rowmapB(j + 1) - h_rowmapB(j)); ++t)
+      h_entriesB(h_rowmapB(j) + t) = (j * 37 + t * 97) % n;
+
+  // tiny rows of A hit 2 short rows of B, medium rows 6 short rows and huge
+  // rows all the rows of B
+  rowmap_t rowmapA("A rowmap", m + 1);
+  auto h_rowmapA = Kokkos::create_mirror_view(rowmapA);
+  h_rowmapA(0)   = 0;
+  for (lno_t i = 0; i < m; ++i)
+    h_rowmapA(i + 1) = h_rowmapA(i) + (i % 3 == 0 ? 2 : i % 3 == 1 ? 6 : k);
+  entries_t entriesA("A entries", h_rowmapA(m));
+  auto h_entriesA = Kokkos::create_mirror_view(entriesA);
+  for (lno_t i = 0; i < m; ++i) {
+    for (lno_t t = 0; t < lno_t(h_rowmapA(i + 1) - h_rowmapA(i)); ++t) {
+      lno_t col = t;
+      if (i % 3 != 2) col = (i + 7 * t) % (k / 2);
+      h_entriesA(h_rowmapA(i) + t) = col;
+    }
+  }
+
+  Kokkos::deep_copy(rowmapA, h_rowmapA);
+  Kokkos::deep_copy(entriesA, h_entriesA);
+  Kokkos::deep_copy(rowmapB, h_rowmapB);
+  Kokkos::deep_copy(entriesB, h_entriesB);
+  scalar_view_t valuesA("A values", entriesA.extent(0));
+  scalar_view_t valuesB("B values", entriesB.extent(0));
+  randomize_matrix_values(valuesA);
+  randomize_matrix_values(valuesB);
+  crsMat_t A("A", m, k, valuesA.extent(0), valuesA, rowmapA, entriesA);
+  crsMat_t B("B", k, n, valuesB.extent(0), valuesB, rowmapB, entriesB);
+  KokkosSparse::sort_crs_matrix(A);
+  KokkosSparse::sort_crs_matrix(B);
+
+  crsMat_t C_reference;
+  run_spgemm<crsMat_t, device>(A, B, SPGEMM_DEBUG, C_reference, false);
+
+  for (auto algo : {SPGEMM_KK, SPGEMM_KK_MEMORY}) {
+    KernelHandle kh;
+    kh.create_spgemm_handle(algo);
+    kh.get_spgemm_handle()->set_row_binning(true);
+
+    crsMat_t C;
+    KokkosSparse::spgemm_symbolic(kh, A, false, B, false, C);
+    KokkosSparse::spgemm_numeric(kh, A, false, B, false, C);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C_reference)))
+        << "algorithm " << algo;
+#if !defined(KOKKOSKERNELS_ENABLE_TPL_CUSPARSE) &&  \
+    !defined(KOKKOSKERNELS_ENABLE_TPL_ROCSPARSE) && \
+    !defined(KOKKOSKERNELS_ENABLE_TPL_MKL)
+    // the rows went through the binned numeric phase, not through the
+    // unbinned hash kernels
+    auto sh = kh.get_spgemm_handle();
+    EXPECT_EQ(sh->get_row_bin_size(0), size_t(m / 3)) << "algorithm " << algo;
+    EXPECT_EQ(sh->get_row_bin_size(1), size_t(m / 3)) << "algorithm " << algo;
+    EXPECT_EQ(sh->get_row_bin_size(2), size_t(m / 3)) << "algorithm " << algo;
+#endif
+
+    // numeric reuse with new values
+    scalar_view_t newValuesA("new A values", A.nnz());
+    randomize_matrix_values(newValuesA);
+    crsMat_t A2("A2", m, k, A.nnz(), newValuesA, A.graph.row_map,
+                A.graph.entries);
+    KokkosSparse::spgemm_numeric(kh, A2, false, B, false, C);
+    crsMat_t C2_reference;
+    run_spgemm<crsMat_t, device>(A2, B, SPGEMM_DEBUG, C2_reference, false);
+    EXPECT_TRUE((is_same_matrix<crsMat_t, device>(C, C2_reference)))
+        << "algorithm " << algo << ", reuse";
+    kh.destroy_spgemm_handle();
+  }
+}
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void test_issue402() {
@@ -579,6 +754,11 @@ void test_issue1738() {
     test_spgemm_symbolic<SCALAR, ORDINAL, OFFSET, DEVICE>(false, true);        \
     test_spgemm_symbolic<SCALAR, ORDINAL, OFFSET, DEVICE>(true, false);        \
     test_spgemm_symbolic<SCALAR, ORDINAL, OFFSET, DEVICE>(false, false);       \
+    test_spgemm_retained_workspace<SCALAR, ORDINAL, OFFSET, DEVICE>(           \
+        SPGEMM_KK_MEMORY);                                                     \
+    test_spgemm_retained_workspace<SCALAR, ORDINAL, OFFSET, DEVICE>(           \
+        SPGEMM_KK_SPEED);                                                      \
+    test_spgemm_row_binning<SCALAR, ORDINAL, OFFSET, DEVICE>();                \
     test_issue402<SCALAR, ORDINAL, OFFSET, DEVICE>();                          \
     test_issue1738<SCALAR, ORDINAL, OFFSET, DEVICE>();                         \
   }
@@ -17,12 +17,16 @@
 #include <gtest/gtest.h>
 #include <Kokkos_Core.hpp>
 
+#include <algorithm>
+#include <map>
 #include <string>
 #include <stdexcept>
+#include <vector>
 
 #include "KokkosSparse_Utils.hpp"
 #include "KokkosSparse_CrsMatrix.hpp"
 #include <KokkosKernels_IOUtils.hpp>
+#include "KokkosSparse_IOUtils.hpp"
 #include "KokkosBlas1_nrm2.hpp"
 #include "KokkosSparse_spmv.hpp"
 #include "KokkosSparse_spiluk.hpp"
@@ -260,6 +264,72 @@ void run_test_spiluk() {
 
     kh.destroy_spiluk_handle();
   }
+
+  // Fixed-point sweeps, refactorizing with the same handle
+  {
+    kh.create_spiluk_handle(SPILUKAlgorithm::SEQLVLSCHD_RP, nrows, 4 * nrows,
+                            4 * nrows);
+
+    auto spiluk_handle = kh.get_spiluk_handle();
+
+    // Allocate L and U as outputs
+    RowMapType L_row_map("L_row_map", nrows + 1);
+    EntriesType L_entries("L_entries", spiluk_handle->get_nnzL());
+    ValuesType L_values("L_values", spiluk_handle->get_nnzL());
+    RowMapType U_row_map("U_row_map", nrows + 1);
+    EntriesType U_entries("U_entries", spiluk_handle->get_nnzU());
+    ValuesType U_values("U_values", spiluk_handle->get_nnzU());
+
+    typename KernelHandle::const_nnz_lno_t fill_lev = 2;
+
+    spiluk_symbolic(&kh, fill_lev, row_map, entries, L_row_map, L_entries,
+                    U_row_map, U_entries);
+
+    Kokkos::fence();
+
+    Kokkos::resize(L_entries, spiluk_handle->get_nnzL());
+    Kokkos::resize(L_values, spiluk_handle->get_nnzL());
+    Kokkos::resize(U_entries, spiluk_handle->get_nnzU());
+    Kokkos::resize(U_values, spiluk_handle->get_nnzU());
+
+    spiluk_handle->set_fixed_point_sweeps(20);
+    for (int refactor = 0; refactor < 2; ++refactor) {
+      spiluk_numeric(&kh, fill_lev, row_map, entries, values, L_row_map,
+                     L_entries, L_values, U_row_map, U_entries, U_values);
+    }
+
+    Kokkos::fence();
+
+    // Checking
+    typedef CrsMatrix<scalar_t, lno_t, device, void, size_type> crsMat_t;
+    crsMat_t A("A_Mtx", nrows, nrows, nnz, values, row_map, entries);
+    crsMat_t L("L_Mtx", nrows, nrows, spiluk_handle->get_nnzL(), L_values,
+               L_row_map, L_entries);
+    crsMat_t U("U_Mtx", nrows, nrows, spiluk_handle->get_nnzU(), U_values,
+               U_row_map, U_entries);
+
+    // Create a reference view e set to all 1's
+    ValuesType e_one("e_one", nrows);
+    Kokkos::deep_copy(e_one, 1.0);
+
+    // Create two views for spmv results
+    ValuesType bb("bb", nrows);
+    ValuesType bb_tmp("bb_tmp", nrows);
+
+    // Compute norm2(L*U*e_one - A*e_one)/norm2(A*e_one)
+    KokkosSparse::spmv("N", ONE, A, e_one, ZERO, bb);
+
+    typename AT::mag_type bb_nrm = KokkosBlas::nrm2(bb);
+
+    KokkosSparse::spmv("N", ONE, U, e_one, ZERO, bb_tmp);
+    KokkosSparse::spmv("N", ONE, L, bb_tmp, MONE, bb);
+
+    typename AT::mag_type diff_nrm = KokkosBlas::nrm2(bb);
+
+    EXPECT_TRUE((diff_nrm / bb_nrm) < 1e-4);
+
+    kh.destroy_spiluk_handle();
+  }
 }
 
 template <typename scalar_t, typename lno_t, typename size_type,
@@ -472,12 +542,172 @@ void run_test_spiluk_streams(int test_algo, int nstreams) {
   }
 }
 
+// Sequential up-looking ILU(k) symbolic factorization: the rows of L (with
+// the diagonal) and U, and the level of each row in the schedule of L.
+template <typename lno_t, typename size_type, typename RowMapType,
+          typename EntriesType>
+void iluk_symbolic_reference(const RowMapType &row_map,
+                             const EntriesType &entries, const lno_t nrows,
+                             const int fill_lev,
+                             std::vector<std::vector<lno_t>> &L,
+                             std::vector<std::vector<lno_t>> &U,
+                             std::vector<size_type> &level) {
+  // off-diagonal U entries of the completed rows, with their levels
+  std::vector<std::vector<std::pair<lno_t, int>>> U_lev(nrows);
+  L.assign(nrows, std::vector<lno_t>());
+  U.assign(nrows, std::vector<lno_t>());
+  level.assign(nrows, 0);
+  for (lno_t i = 0; i < nrows; ++i) {
+    std::map<lno_t, int> row;
+    for (size_type k = row_map(i); k < row_map(i + 1); ++k) {
+      const lno_t col = entries(k);
+      if (col < nrows && col != i) row[col] = 0;
+    }
+    // rows are eliminated in increasing order, fill-ins are inserted after
+    for (auto it = row.begin(); it != row.end() && it->first < i; ++it) {
+      for (const auto &u : U_lev[it->first]) {
+        const int lev = it->second + u.second + 1;
+        if (lev > fill_lev) continue;
+        auto pos = row.find(u.first);
+        if (pos == row.end())
+          row.emplace(u.first, lev);
+        else
+          pos->second = std::min(pos->second, lev);
+      }
+    }
+    size_type max_level = 0;
+    U[i].push_back(i);
+    for (const auto &e : row) {
+      if (e.first < i) {
+        L[i].push_back(e.first);
+        max_level = std::max(max_level, level[e.first]);
+      } else {
+        U[i].push_back(e.first);
+        U_lev[i].push_back(e);
+      }
+    }
+    L[i].push_back(i);
+    level[i] = max_level + 1;
+  }
+}
+
+// The symbolic phase runs in parallel sweeps on the execution space of the
+// handle. Compare the L/U patterns and the level schedule of a larger random
+// matrix with the sequential algorithm.
+template <typename scalar_t, typename lno_t, typename size_type,
+          typename device>
+void run_test_spiluk_symbolic_random() {
+  using RowMapType   = Kokkos::View<size_type *, device>;
+  using EntriesType  = Kokkos::View<lno_t *, device>;
+  using crsMat_t     = CrsMatrix<scalar_t, lno_t, device, void, size_type>;
+  using KernelHandle = KokkosKernels::Experimental::KokkosKernelsHandle<
+      size_type, lno_t, scalar_t, typename device::execution_space,
+      typename device::memory_space, typename device::memory_space>;
+
+  const lno_t nrows = 2000;
+  size_type nnz     = 8 * nrows;
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      nrows, nrows, nnz, 4, 100);
+  auto h_row_map = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       A.graph.row_map);
+  auto h_entries = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                       A.graph.entries);
+  size_t max_row_len = 0;
+  for (lno_t i = 0; i < nrows; ++i)
+    max_row_len =
+        std::max(max_row_len, size_t(h_row_map(i + 1) - h_row_map(i)));
+
+  const SPILUKAlgorithm algos[] = {SPILUKAlgorithm::SEQLVLSCHD_RP,
+                                   SPILUKAlgorithm::SEQLVLSCHD_TP1};
+  for (const SPILUKAlgorithm algo : algos) {
+    for (int fill_lev = 0; fill_lev <= 3; ++fill_lev) {
+      std::vector<std::vector<lno_t>> L_ref, U_ref;
+      std::vector<size_type> level_ref;
+      iluk_symbolic_reference<lno_t, size_type>(h_row_map, h_entries, nrows,
+                                                fill_lev, L_ref, U_ref,
+                                                level_ref);
+      size_type nnzL = 0, nnzU = 0, nlevels = 0;
+      size_t max_fill = 0;
+      for (lno_t i = 0; i < nrows; ++i) {
+        nnzL += L_ref[i].size();
+        nnzU += U_ref[i].size();
+        nlevels  = std::max(nlevels, level_ref[i]);
+        max_fill = std::max(max_fill, L_ref[i].size() + U_ref[i].size() - 2);
+      }
+      // With fill, some rows do not fit in the initial work arrays of the
+      // sweeps (the longest row of A times fill_lev + 1), which are then grown
+      if (fill_lev > 0)
+        EXPECT_GT(max_fill, max_row_len * (fill_lev + 1))
+            << "fill level " << fill_lev;
+
+      KernelHandle kh;
+      kh.create_spiluk_handle(algo, nrows, 2 * nnzL, 2 * nnzU);
+      auto spiluk_handle = kh.get_spiluk_handle();
+
+      RowMapType L_row_map("L_row_map", nrows + 1);
+      EntriesType L_entries("L_entries", spiluk_handle->get_nnzL());
+      RowMapType U_row_map("U_row_map", nrows + 1);
+      EntriesType U_entries("U_entries", spiluk_handle->get_nnzU());
+      spiluk_symbolic(&kh, fill_lev, A.graph.row_map, A.graph.entries,
+                      L_row_map, L_entries, U_row_map, U_entries);
+      Kokkos::fence();
+
+      ASSERT_EQ(spiluk_handle->get_nnzL(), nnzL) << "fill level " << fill_lev;
+      ASSERT_EQ(spiluk_handle->get_nnzU(), nnzU) << "fill level " << fill_lev;
+      auto h_L_row_map =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_row_map);
+      auto h_L_entries =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), L_entries);
+      auto h_U_row_map =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_row_map);
+      auto h_U_entries =
+          Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), U_entries);
+      bool same_pattern = true;
+      for (lno_t i = 0; i < nrows && same_pattern; ++i) {
+        same_pattern =
+            (size_t(h_L_row_map(i + 1) - h_L_row_map(i)) == L_ref[i].size()) &&
+            (size_t(h_U_row_map(i + 1) - h_U_row_map(i)) == U_ref[i].size()) &&
+            std::equal(L_ref[i].begin(), L_ref[i].end(),
+                       h_L_entries.data() + h_L_row_map(i)) &&
+            std::equal(U_ref[i].begin(), U_ref[i].end(),
+                       h_U_entries.data() + h_U_row_map(i));
+      }
+      EXPECT_TRUE(same_pattern) << "fill level " << fill_lev;
+
+      // Levels are numbered from 1, rows are increasing within a level
+      ASSERT_EQ(spiluk_handle->get_num_levels(), nlevels)
+          << "fill level " << fill_lev;
+      auto h_level_list = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), spiluk_handle->get_level_list());
+      auto h_level_idx = Kokkos::create_mirror_view_and_copy(
+          Kokkos::HostSpace(), spiluk_handle->get_level_idx());
+      auto h_level_ptr = spiluk_handle->get_host_level_ptr();
+      std::vector<size_type> level_ptr_ref(nlevels + 1, 0);
+      for (lno_t i = 0; i < nrows; ++i) {
+        EXPECT_EQ(h_level_list(i), level_ref[i]) << "row " << i;
+        level_ptr_ref[level_ref[i]]++;
+      }
+      for (size_type l = 0; l < nlevels; ++l) {
+        level_ptr_ref[l + 1] += level_ptr_ref[l];
+        EXPECT_EQ(size_type(h_level_ptr(l + 1)), level_ptr_ref[l + 1]);
+      }
+      std::vector<size_type> cursor(level_ptr_ref.begin(),
+                                    level_ptr_ref.end() - 1);
+      for (lno_t i = 0; i < nrows; ++i)
+        EXPECT_EQ(h_level_idx(cursor[level_ref[i] - 1]++), i);
+
+      kh.destroy_spiluk_handle();
+    }
+  }
+}
+
 }  // namespace Test
 
 template <typename scalar_t, typename lno_t, typename size_type,
           typename device>
 void test_spiluk() {
   Test::run_test_spiluk<scalar_t, lno_t, size_type, device>();
+  Test::run_test_spiluk_symbolic_random<scalar_t, lno_t, size_type, device>();
 }
 
 template <typename scalar_t, typename lno_t, typename size_type,
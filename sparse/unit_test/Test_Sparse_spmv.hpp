@@ -18,6 +18,7 @@
 #include <Kokkos_Random.hpp>
 
 #include <KokkosSparse_spmv.hpp>
+#include <KokkosSparse_spmv_stencil.hpp>
 #include <KokkosKernels_TestUtils.hpp>
 #include <KokkosKernels_Test_Structured_Matrix.hpp>
 #include <KokkosKernels_IOUtils.hpp>
@@ -908,6 +909,192 @@ void test_spmv_struct_3D(lno_t nx, lno_t ny, lno_t nz, lno_t horizontal1BC,
   }
 }
 
+// Apply the 27 point FE matrix with spmv_stencil and compare against spmv
+// with the assembled CrsMatrix, then check a one-sided stencil of radius 2
+// against a host evaluation.
+template <typename scalar_t, typename lno_t, typename size_type, class Device>
+void test_spmv_stencil_3D(lno_t nx, lno_t ny, lno_t nz) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using coef_view_t   = Kokkos::View<scalar_t **, Kokkos::LayoutLeft, Device>;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using ExecSpace     = typename Device::execution_space;
+
+  constexpr mag_t max_x   = static_cast<mag_t>(1);
+  constexpr mag_t max_y   = static_cast<mag_t>(1);
+  constexpr mag_t max_val = static_cast<mag_t>(26);
+  const double eps        = Kokkos::ArithTraits<mag_t>::eps();
+
+  Kokkos::View<lno_t *, Kokkos::HostSpace> structure("Spmv Structure", 3);
+  structure(0) = nx;
+  structure(1) = ny;
+  structure(2) = nz;
+  Kokkos::View<lno_t * [3], Kokkos::HostSpace> mat_structure("Matrix Structure",
+                                                             3);
+  for (int d = 0; d < 3; ++d) {
+    mat_structure(d, 0) = structure(d);
+    mat_structure(d, 1) = 1;
+    mat_structure(d, 2) = 1;
+  }
+  crsMat_t A =
+      Test::generate_structured_matrix3D<crsMat_t>("FE", mat_structure);
+
+  Kokkos::View<int * [3], Kokkos::HostSpace> offsets("offsets", 27);
+  for (int s = 0; s < 27; ++s) {
+    offsets(s, 0) = s % 3 - 1;
+    offsets(s, 1) = (s / 3) % 3 - 1;
+    offsets(s, 2) = s / 9 - 1;
+  }
+  coef_view_t coef("coefficients", A.numRows(), 27);
+  KokkosSparse::Experimental::extract_stencil_coefficients(
+      ExecSpace(), structure, offsets, A, coef);
+
+  scalar_view_t x("x", A.numCols());
+  scalar_view_t y("y", A.numRows());
+  scalar_view_t expected_y("expected_y", A.numRows());
+  Kokkos::Random_XorShift64_Pool<ExecSpace> rand_pool(13718);
+  Kokkos::fill_random(x, rand_pool, max_x);
+
+  const mag_t max_error = max_y + 27 * max_val * max_x;
+  for (double beta : {0.0, 1.0}) {
+    Kokkos::fill_random(y, rand_pool, max_y);
+    Kokkos::deep_copy(expected_y, y);
+    KokkosSparse::spmv("N", 1.0, A, x, beta, expected_y);
+    KokkosSparse::Experimental::spmv_stencil(structure, offsets, 1.0, coef, x,
+                                             beta, y);
+    int num_errors = 0;
+    Kokkos::parallel_reduce(
+        "KokkosKernels::UnitTests::spmv_stencil",
+        Kokkos::RangePolicy<ExecSpace>(0, y.extent(0)),
+        Test::fSPMV<scalar_view_t, scalar_view_t>(expected_y, y, eps,
+                                                  max_error),
+        num_errors);
+    EXPECT_EQ(num_errors, 0) << "spmv_stencil 27pt, beta = " << beta;
+  }
+
+  Kokkos::View<int * [3], Kokkos::HostSpace> wide("wide", 5);
+  const int wideOffsets[5][3] = {
+      {0, 0, 0}, {2, 0, 0}, {-1, 1, 0}, {0, 0, -2}, {0, -1, 1}};
+  for (int s = 0; s < 5; ++s)
+    for (int d = 0; d < 3; ++d) wide(s, d) = wideOffsets[s][d];
+  coef_view_t wideCoef("wide coefficients", A.numRows(), 5);
+  Kokkos::fill_random(wideCoef, rand_pool, max_x);
+  KokkosSparse::Experimental::spmv_stencil(structure, wide, 1.0, wideCoef, x,
+                                           0.0, y);
+
+  auto h_x    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), x);
+  auto h_y    = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+  auto h_coef = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(),
+                                                    wideCoef);
+  int num_errors = 0;
+  for (lno_t k = 0; k < nz; ++k)
+    for (lno_t j = 0; j < ny; ++j)
+      for (lno_t i = 0; i < nx; ++i) {
+        const lno_t row = i + nx * (j + ny * k);
+        scalar_t sum    = 0;
+        for (int s = 0; s < 5; ++s) {
+          const lno_t ci = i + wide(s, 0), cj = j + wide(s, 1),
+                      ck = k + wide(s, 2);
+          if (ci < 0 || ci >= nx || cj < 0 || cj >= ny || ck < 0 || ck >= nz)
+            continue;
+          sum += h_coef(row, s) * h_x(ci + nx * (cj + ny * ck));
+        }
+        if (Kokkos::ArithTraits<scalar_t>::abs(sum - h_y(row)) >
+            eps * 5 * max_val * max_x)
+          ++num_errors;
+      }
+  EXPECT_EQ(num_errors, 0) << "spmv_stencil with a one-sided stencil";
+}
+
+// spmv with mode "T" and "H" through the transpose cache matches the atomic
+// transpose kernel, and the cache is rebuilt or refreshed only when needed.
+template <typename scalar_t, typename lno_t, typename size_type, class Device>
+void test_spmv_transpose_cache(lno_t numRows, lno_t numCols, size_type nnz,
+                               lno_t bandwidth, lno_t row_size_variance) {
+  using crsMat_t = typename KokkosSparse::CrsMatrix<scalar_t, lno_t, Device,
+                                                    void, size_type>;
+  using scalar_view_t = typename crsMat_t::values_type::non_const_type;
+  using mag_t         = typename Kokkos::ArithTraits<scalar_t>::mag_type;
+  using ExecSpace     = typename Device::execution_space;
+  using handle_t = KokkosSparse::Experimental::SPMVTransposeHandle<crsMat_t>;
+
+  constexpr mag_t max_x   = static_cast<mag_t>(1);
+  constexpr mag_t max_y   = static_cast<mag_t>(1);
+  constexpr mag_t max_val = static_cast<mag_t>(1);
+  const double eps        = 10 * Kokkos::ArithTraits<mag_t>::eps();
+
+  crsMat_t A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+      numRows, numCols, nnz, row_size_variance, bandwidth);
+  Kokkos::Random_XorShift64_Pool<ExecSpace> rand_pool(13718);
+  Kokkos::fill_random(A.values, rand_pool, randomUpperBound<scalar_t>(max_val));
+
+  scalar_view_t x("x", A.numRows());
+  scalar_view_t y("y", A.numCols());
+  scalar_view_t expected_y("expected_y", A.numCols());
+  Kokkos::fill_random(x, rand_pool, randomUpperBound<scalar_t>(max_x));
+
+  // the columns of the generated matrices hold about as many entries as the
+  // rows
+  const mag_t max_error =
+      max_y + 2 * (nnz / numRows + row_size_variance) * max_val * max_x;
+  auto check = [&](handle_t &handle, const char *mode, const char *what) {
+    for (double beta : {0.0, 1.0}) {
+      Kokkos::fill_random(y, rand_pool, randomUpperBound<scalar_t>(max_y));
+      Kokkos::deep_copy(expected_y, y);
+      KokkosSparse::spmv(mode, 1.0, A, x, beta, expected_y);
+      KokkosSparse::spmv(ExecSpace(), &handle, mode, 1.0, A, x, beta, y);
+      int num_errors = 0;
+      Kokkos::parallel_reduce(
+          "KokkosKernels::UnitTests::spmv_transpose_cache",
+          Kokkos::RangePolicy<ExecSpace>(0, y.extent(0)),
+          Test::fSPMV<scalar_view_t, scalar_view_t>(expected_y, y, eps,
+                                                    max_error),
+          num_errors);
+      EXPECT_EQ(num_errors, 0)
+          << "mode " << mode << ", beta = " << beta << ", " << what;
+    }
+  };
+
+  for (const char *mode : {"T", "H"}) {
+    handle_t handle;
+    check(handle, mode, "first use");
+    EXPECT_EQ(handle.get_num_builds(), 1);
+    EXPECT_EQ(handle.get_num_value_updates(), 0);
+
+    // values changed in place
+    Kokkos::fill_random(A.values, rand_pool,
+                        randomUpperBound<scalar_t>(max_val));
+    handle.set_values_modified();
+    check(handle, mode, "values modified in place");
+    EXPECT_EQ(handle.get_num_builds(), 1);
+    EXPECT_EQ(handle.get_num_value_updates(), 1);
+
+    // new values View, detected by the handle
+    scalar_view_t new_values("new values", A.nnz());
+    Kokkos::fill_random(new_values, rand_pool,
+                        randomUpperBound<scalar_t>(max_val));
+    A.values = new_values;
+    check(handle, mode, "new values");
+    EXPECT_EQ(handle.get_num_builds(), 1);
+    EXPECT_EQ(handle.get_num_value_updates(), 2);
+
+    // the non transpose modes do not touch the cache
+    KokkosSparse::spmv(&handle, "N", 1.0, A, y, 0.0, x);
+    EXPECT_EQ(handle.get_num_builds(), 1);
+
+    // a new graph rebuilds A^T, the handle keeps the old Views alive so
+    // their addresses cannot be reused by the new matrix
+    A = KokkosSparse::Impl::kk_generate_sparse_matrix<crsMat_t>(
+        numRows, numCols, nnz, row_size_variance, bandwidth);
+    Kokkos::fill_random(A.values, rand_pool,
+                        randomUpperBound<scalar_t>(max_val));
+    check(handle, mode, "new graph");
+    EXPECT_EQ(handle.get_num_builds(), 2);
+    EXPECT_EQ(handle.get_num_value_updates(), 2);
+  }
+}
+
 template <typename scalar_t, typename lno_t, typename size_type,
           typename layout, class Device>
 void test_spmv_mv_struct_1D(lno_t nx, int numMV) {
@@ -1154,6 +1341,85 @@ void test_github_issue_101() {
   }
 }
 
+// A stores its values in half or bfloat16 while x, y, alpha and beta are in
+// the wider YScalar. The result must match the product with a YScalar copy
+// of the rounded values of A: the values are widened before any product and
+// alpha and beta are not rounded to the precision of A.
+template <class AScalar, class YScalar, class DeviceType>
+void test_spmv_reduced_precision_values() {
+  using ref_matrix_type = KokkosSparse::CrsMatrix<YScalar, int, DeviceType>;
+  using low_matrix_type = KokkosSparse::CrsMatrix<AScalar, int, DeviceType>;
+  using vector_type     = Kokkos::View<YScalar *, DeviceType>;
+  using execution_space = typename DeviceType::execution_space;
+  using mag_type        = typename Kokkos::ArithTraits<YScalar>::mag_type;
+  using size_type       = typename ref_matrix_type::non_const_size_type;
+  using multivector_type =
+      Kokkos::View<YScalar **, Kokkos::LayoutLeft, DeviceType>;
+
+  const int numRows = 500, numCols = 400, numVecs = 3;
+  size_type nnz     = 10 * numRows;
+  ref_matrix_type A = KokkosSparse::Impl::kk_generate_sparse_matrix<
+      ref_matrix_type>(numRows, numCols, nnz, 5, 100);
+
+  // round the values of A, the reference keeps the rounded values
+  low_matrix_type A_low("A_low", A.graph, numCols);
+  auto h_values     = Kokkos::create_mirror_view(A.values);
+  auto h_values_low = Kokkos::create_mirror_view(A_low.values);
+  Kokkos::deep_copy(h_values, A.values);
+  for (size_t k = 0; k < h_values.extent(0); ++k) {
+    h_values_low(k) = static_cast<AScalar>(h_values(k));
+    h_values(k)     = static_cast<YScalar>(h_values_low(k));
+  }
+  Kokkos::deep_copy(A.values, h_values);
+  Kokkos::deep_copy(A_low.values, h_values_low);
+
+  // only the native kernels support mixed value types
+  KokkosKernels::Experimental::Controls controls;
+  controls.setParameter("algorithm", "native");
+
+  const YScalar alpha = 0.1, beta = -0.3;
+  const mag_type eps  = 100 * Kokkos::ArithTraits<YScalar>::epsilon();
+  Kokkos::Random_XorShift64_Pool<execution_space> rand_pool(13718);
+  for (const char *mode : {"N", "T"}) {
+    const bool trans = mode[0] == 'T';
+    const int xLen   = trans ? numRows : numCols;
+    const int yLen   = trans ? numCols : numRows;
+
+    vector_type x("x", xLen), y("y", yLen), y_ref("y_ref", yLen);
+    Kokkos::fill_random(x, rand_pool, YScalar(1));
+    Kokkos::fill_random(y, rand_pool, YScalar(1));
+    Kokkos::deep_copy(y_ref, y);
+    KokkosSparse::spmv(controls, mode, alpha, A_low, x, beta, y);
+    KokkosSparse::spmv(controls, mode, alpha, A, x, beta, y_ref);
+    auto h_y = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y);
+    auto h_y_ref =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), y_ref);
+    for (int i = 0; i < yLen; ++i)
+      EXPECT_NEAR_KK(h_y(i), h_y_ref(i),
+                     eps * (1 + Kokkos::ArithTraits<YScalar>::abs(h_y_ref(i))),
+                     std::string("mode ") + mode + ", row " +
+                         std::to_string(i));
+
+    multivector_type X("X", xLen, numVecs), Y("Y", yLen, numVecs),
+        Y_ref("Y_ref", yLen, numVecs);
+    Kokkos::fill_random(X, rand_pool, YScalar(1));
+    Kokkos::fill_random(Y, rand_pool, YScalar(1));
+    Kokkos::deep_copy(Y_ref, Y);
+    KokkosSparse::spmv(controls, mode, alpha, A_low, X, beta, Y);
+    KokkosSparse::spmv(controls, mode, alpha, A, X, beta, Y_ref);
+    auto h_Y = Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Y);
+    auto h_Y_ref =
+        Kokkos::create_mirror_view_and_copy(Kokkos::HostSpace(), Y_ref);
+    for (int i = 0; i < yLen; ++i)
+      for (int j = 0; j < numVecs; ++j)
+        EXPECT_NEAR_KK(
+            h_Y(i, j), h_Y_ref(i, j),
+            eps * (1 + Kokkos::ArithTraits<YScalar>::abs(h_Y_ref(i, j))),
+            std::string("mode ") + mode + ", row " + std::to_string(i) +
+                ", vector " + std::to_string(j));
+  }
+}
+
 template <class scalar_t, class lno_t, class size_type, class layout_t,
           class DeviceType>
 void test_spmv_all_interfaces_light() {
@@ -1276,6 +1542,16 @@ void test_spmv_all_interfaces_light() {
     test_github_issue_101<DEVICE>();                                      \
   }
 
+#define EXECUTE_TEST_REDUCED_PRECISION(DEVICE)                            \
+  TEST_F(TestCategory, sparse##_##spmv_half_values##_##DEVICE) {          \
+    test_spmv_reduced_precision_values<Kokkos::Experimental::half_t,      \
+                                       float, DEVICE>();                  \
+    test_spmv_reduced_precision_values<Kokkos::Experimental::half_t,      \
+                                       double, DEVICE>();                 \
+    test_spmv_reduced_precision_values<Kokkos::Experimental::bhalf_t,     \
+                                       float, DEVICE>();                  \
+  }
+
 #define EXECUTE_TEST_FN(SCALAR, ORDINAL, OFFSET, DEVICE)                       \
   TEST_F(TestCategory,                                                         \
          sparse##_##spmv##_##SCALAR##_##ORDINAL##_##OFFSET##_##DEVICE) {       \
@@ -1293,6 +1569,8 @@ void test_spmv_all_interfaces_light() {
                                                           100, 5, false);      \
     test_spmv_controls<SCALAR, ORDINAL, OFFSET, DEVICE>(10000, 10000 * 20,     \
                                                         100, 5);               \
+    test_spmv_transpose_cache<SCALAR, ORDINAL, OFFSET, DEVICE>(                \
+        1000, 800, 1000 * 10, 200, 5);                                         \
   }
 
 #define EXECUTE_TEST_INTERFACES(SCALAR, ORDINAL, OFFSET, LAYOUT, DEVICE)              \
@@ -1336,6 +1614,7 @@ void test_spmv_all_interfaces_light() {
     test_spmv_struct_3D<SCALAR, ORDINAL, OFFSET, DEVICE>(25, 10, 20, 3, 3, 3); \
     test_spmv_struct_3D<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 20, 25, 3, 3, 3); \
     test_spmv_struct_3D<SCALAR, ORDINAL, OFFSET, DEVICE>(10, 24, 20, 3, 3, 3); \
+    test_spmv_stencil_3D<SCALAR, ORDINAL, OFFSET, DEVICE>(21, 10, 35);         \
   }
 
 #define EXECUTE_TEST_MV_STRUCT(SCALAR, ORDINAL, OFFSET, LAYOUT, DEVICE)                    \
@@ -1351,6 +1630,7 @@ void test_spmv_all_interfaces_light() {
 #if (!defined(KOKKOSKERNELS_ETI_ONLY) && \
      !defined(KOKKOSKERNELS_IMPL_CHECK_ETI_CALLS))
 EXECUTE_TEST_ISSUE_101(TestDevice)
+EXECUTE_TEST_REDUCED_PRECISION(TestDevice)
 #endif
 
 #define KOKKOSKERNELS_EXECUTE_TEST(SCALAR, ORDINAL, OFFSET, DEVICE) \
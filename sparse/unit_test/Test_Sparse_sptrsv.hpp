@@ -412,6 +412,19 @@ void run_test_sptrsv() {
       sptrsv_symbolic(&kh, row_map, entries);
       Kokkos::fence();
 
+      // level sets are {4}, {1, 3}, {2} and {0}
+      {
+        auto sptrsv_handle = kh.get_sptrsv_handle();
+        auto hnpl          = sptrsv_handle->get_host_nodes_per_level();
+        auto hngbl         = sptrsv_handle->get_host_nodes_grouped_by_level();
+        const lno_t npl_expected[]  = {1, 2, 1, 1};
+        const lno_t ngbl_expected[] = {4, 1, 3, 2, 0};
+        EXPECT_EQ(sptrsv_handle->get_num_levels(), size_type(4));
+        for (int i = 0; i < 4; ++i) EXPECT_EQ(hnpl(i), npl_expected[i]);
+        for (size_type i = 0; i < nrows; ++i)
+          EXPECT_EQ(hngbl(i), ngbl_expected[i]);
+      }
+
       sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
       Kokkos::fence();
 
@@ -475,6 +488,44 @@ void run_test_sptrsv() {
       sptrsv_symbolic(&kh, row_map, entries);
       Kokkos::fence();
 
+      // level 1 has two nodes and is solved alone, levels 2 and 3 are chained
+      {
+        auto h_chain_ptr = kh.get_sptrsv_handle()->get_host_chain_ptr();
+        const int chain_ptr_expected[] = {0, 1, 2, 4};
+        EXPECT_EQ(kh.get_sptrsv_handle()->get_num_chain_entries(), 3);
+        for (int i = 0; i < 4; ++i)
+          EXPECT_EQ(h_chain_ptr(i), chain_ptr_expected[i]);
+      }
+
+      sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
+      Kokkos::fence();
+
+      scalar_t sum = 0.0;
+      Kokkos::parallel_reduce(
+          Kokkos::RangePolicy<typename device::execution_space>(0,
+                                                                lhs.extent(0)),
+          ReductionCheck<ValuesType, scalar_t, lno_t>(lhs), sum);
+      if (sum != lhs.extent(0)) {
+        std::cout << "Upper Tri Solve FAILURE" << std::endl;
+        kh.get_sptrsv_handle()->print_algorithm();
+      }
+      EXPECT_TRUE(sum == scalar_t(lhs.extent(0)));
+
+      kh.destroy_sptrsv_handle();
+    }
+
+    {
+      Kokkos::deep_copy(lhs, ZERO);
+      KernelHandle kh;
+      bool is_lower_tri = false;
+      kh.create_sptrsv_handle(SPTRSVAlgorithm::SPTRSV_JACOBI, nrows,
+                              is_lower_tri);
+      // as many sweeps as levels make the Jacobi solve exact
+      kh.get_sptrsv_handle()->set_jacobi_sweeps(4);
+
+      sptrsv_symbolic(&kh, row_map, entries);
+      Kokkos::fence();
+
       sptrsv_solve(&kh, row_map, entries, values, rhs, lhs);
       Kokkos::fence();
 